@@ -0,0 +1,82 @@
+# ========================================
+#  GCD Algorithm Analyzer - PGO driver
+# ========================================
+#
+# Runs the three profile-guided optimization stages in one build directory:
+#   1. configure with GCD_PGO=GENERATE and build the instrumented programs
+#   2. run gcd_bench --train (benchmark suite + dispatcher calibration)
+#   3. reconfigure with GCD_PGO=USE and rebuild from the profiles
+#
+# Usage:
+#   cmake -DSOURCE_DIR=<repo> -DBINARY_DIR=<build> [-DBUILD_TYPE=Release]
+#         [-DGENERATOR=Ninja] -P cmake/GcdPgo.cmake
+#
+# Clang users merge the raw profiles between stages 2 and 3; the script
+# does it with llvm-profdata when the compiler is Clang.
+
+if(NOT SOURCE_DIR OR NOT BINARY_DIR)
+    message(FATAL_ERROR "Usage: cmake -DSOURCE_DIR=<repo> -DBINARY_DIR=<build> -P GcdPgo.cmake")
+endif()
+if(NOT BUILD_TYPE)
+    set(BUILD_TYPE Release)
+endif()
+
+get_filename_component(SOURCE_DIR "${SOURCE_DIR}" ABSOLUTE)
+get_filename_component(BINARY_DIR "${BINARY_DIR}" ABSOLUTE)
+set(PGO_DIR "${BINARY_DIR}/pgo-data")
+
+set(GENERATOR_ARGS "")
+if(GENERATOR)
+    set(GENERATOR_ARGS -G "${GENERATOR}")
+endif()
+
+# Run one step, stopping the flow when it fails
+function(gcd_pgo_step description)
+    message(STATUS "PGO: ${description}")
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "PGO: ${description} failed (${result})")
+    endif()
+endfunction()
+
+# ============================================================================
+# STAGE 1: INSTRUMENTED BUILD
+# ============================================================================
+
+file(REMOVE_RECURSE "${PGO_DIR}")
+gcd_pgo_step("configuring the instrumented build"
+    ${CMAKE_COMMAND} -S "${SOURCE_DIR}" -B "${BINARY_DIR}" ${GENERATOR_ARGS}
+    -DCMAKE_BUILD_TYPE=${BUILD_TYPE} -DGCD_PGO=GENERATE "-DGCD_PGO_DIR=${PGO_DIR}")
+gcd_pgo_step("building the instrumented programs"
+    ${CMAKE_COMMAND} --build "${BINARY_DIR}" --config ${BUILD_TYPE} --clean-first)
+
+# ============================================================================
+# STAGE 2: TRAINING
+# ============================================================================
+
+gcd_pgo_step("training on the benchmark suite"
+    ${CMAKE_COMMAND} --build "${BINARY_DIR}" --config ${BUILD_TYPE} --target pgo-train)
+
+file(STRINGS "${BINARY_DIR}/CMakeCache.txt" compiler REGEX "^CMAKE_C_COMPILER:")
+string(REGEX REPLACE "^[^=]*=" "" compiler "${compiler}")
+execute_process(COMMAND "${compiler}" --version OUTPUT_VARIABLE compiler_version)
+if(compiler_version MATCHES "clang")
+    find_program(LLVM_PROFDATA NAMES llvm-profdata)
+    if(NOT LLVM_PROFDATA)
+        message(FATAL_ERROR "PGO: llvm-profdata not found")
+    endif()
+    file(GLOB raw_profiles "${PGO_DIR}/*.profraw")
+    gcd_pgo_step("merging the raw profiles"
+        "${LLVM_PROFDATA}" merge -o "${PGO_DIR}/default.profdata" ${raw_profiles})
+endif()
+
+# ============================================================================
+# STAGE 3: OPTIMIZED BUILD
+# ============================================================================
+
+gcd_pgo_step("configuring the profile-guided build"
+    ${CMAKE_COMMAND} -S "${SOURCE_DIR}" -B "${BINARY_DIR}" -DGCD_PGO=USE)
+gcd_pgo_step("building the profile-guided programs"
+    ${CMAKE_COMMAND} --build "${BINARY_DIR}" --config ${BUILD_TYPE} --clean-first)
+
+message(STATUS "PGO: done, programs in ${BINARY_DIR}")
@@ -85,17 +85,49 @@ echo ========================================
 echo  Iniciando compilacao...
 echo ========================================
 
-gcc -Wall -Wextra -O2 -std=c99 -o gcd_analyzer.exe ^
+gcc -Wall -Wextra -O2 -std=c99 -pthread -o gcd_analyzer.exe ^
     "src\interfaces\cli\main.c" ^
     "src\interfaces\cli\command_parser.c" ^
     "src\core\orchestration\system_coordinator.c" ^
+    "src\core\orchestration\system_jobs.c" ^
+    "src\core\orchestration\system_stream.c" ^
+    "src\core\orchestration\system_dataset.c" ^
+    "src\core\orchestration\system_server.c" ^
     "src\challenges\greatest_common_divisor\challenge_services\solution_registry.c" ^
     "src\challenges\greatest_common_divisor\challenge_services\mdc_analyzer.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\batch_gcd.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\modular_arithmetic.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\input_generators.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\benchmark_suite.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\benchmark_report.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\gcd_dispatcher.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\gcd_cache.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\step_counter.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\gcd_stream.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\gcd_dataset.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\gcd_protocol.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\gcd_isa.c" ^
+    "src\challenges\greatest_common_divisor\challenge_services\gcd_isa_kernels.c" ^
     "src\challenges\greatest_common_divisor\solutions\euclidean_family\implementations\classic.c" ^
     "src\challenges\greatest_common_divisor\solutions\euclidean_family\implementations\recursive.c" ^
+    "src\challenges\greatest_common_divisor\solutions\euclidean_family\implementations\lehmer.c" ^
+    "src\challenges\greatest_common_divisor\solutions\euclidean_family\implementations\table_lookup.c" ^
+    "src\challenges\greatest_common_divisor\solutions\euclidean_family\implementations\extended_iterative.c" ^
+    "src\challenges\greatest_common_divisor\solutions\euclidean_family\implementations\bignum_euclidean.c" ^
+    "src\challenges\greatest_common_divisor\solutions\euclidean_family\implementations\bignum_half_gcd.c" ^
     "src\challenges\greatest_common_divisor\solutions\binary_family\implementations\stein.c" ^
+    "src\challenges\greatest_common_divisor\solutions\binary_family\implementations\stein_simd.c" ^
+    "src\challenges\greatest_common_divisor\solutions\binary_family\implementations\binary_extended.c" ^
+    "src\challenges\greatest_common_divisor\solutions\binary_family\implementations\bignum_stein.c" ^
+    "src\infrastructure\platform\cpu_detection.c" ^
+    "src\infrastructure\platform\cycle_counter.c" ^
+    "src\infrastructure\platform\file_mapping.c" ^
+    "src\infrastructure\platform\socket_io.c" ^
     "src\infrastructure\utilities\math_utils.c" ^
     "src\infrastructure\utilities\memory_utils.c" ^
+    "src\infrastructure\utilities\bignum_utils.c" ^
+    "src\infrastructure\utilities\benchmark_utils.c" ^
+    "src\infrastructure\utilities\perf_counters.c" ^
     "challenge_implementation.c"
 
 REM Verificar se a compilação foi bem-sucedida
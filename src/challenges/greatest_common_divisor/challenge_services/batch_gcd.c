@@ -0,0 +1,978 @@
+/**
+ * @file batch_gcd.c
+ * @brief Product-tree / remainder-tree batch GCD service
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This file implements Bernstein's batch GCD on top of the bignum backend.
+ * Level 0 of the product tree is the caller's moduli; level k+1 holds the
+ * pairwise products of level k (an odd last node is carried up unchanged).
+ * The remainder tree walks back down with R_k[i] = R_{k+1}[i/2] mod T_k[i]^2,
+ * starting from the root product, and the leaf step is fused with the last
+ * reduction so R_0 is never materialized.
+ */
+
+#include "batch_gcd.h"
+#include "../solutions/euclidean_family/implementations/bignum_euclidean.h"
+#include "../../../infrastructure/utilities/math_utils.h"
+#include "../../../infrastructure/utilities/memory_utils.h"
+#include "../../../infrastructure/utilities/bignum_utils.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Threading support
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || defined(__MINGW32__)
+#ifndef SINGLE_THREADED
+#define HAS_POSIX_THREADS 1
+#endif
+#endif
+
+#ifdef HAS_POSIX_THREADS
+#include <pthread.h>
+#endif
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/**
+ * @brief Upper bound on worker threads per tree level
+ */
+#define BATCH_GCD_MAX_THREADS 256
+
+/**
+ * @brief Maximum length of a spill file path
+ */
+#define BATCH_GCD_PATH_LENGTH 512
+
+/**
+ * @brief Nodes claimed per lock acquisition, per worker, at the leaves
+ */
+#define BATCH_GCD_LEAF_CLAIMS_PER_WORKER 8
+
+// ============================================================================
+// TREE LEVELS
+// ============================================================================
+
+/**
+ * @brief One level of the product or remainder tree
+ *
+ * Owned levels keep their node array and limbs in a single arena; borrowed
+ * levels (the caller's moduli, the root used as first remainder) only point
+ * at existing values. A spilled level has no resident values and lives in
+ * spill_file until it is loaded again.
+ */
+typedef struct
+{
+    MathBigInteger *values; /**< Node values (NULL while spilled) */
+    MathNatural count;      /**< Number of nodes */
+    MemoryArena arena;      /**< Backing storage of an owned level */
+    bool owns_values;       /**< Whether values live in arena */
+    FILE *spill_file;       /**< Spilled contents, NULL if never spilled */
+    char spill_path[BATCH_GCD_PATH_LENGTH]; /**< File to remove on release ("" for tmpfile()) */
+} BatchGcdLevel;
+
+/**
+ * @brief Bytes held in RAM by a level
+ */
+static size_t batch_gcd_level_bytes(const BatchGcdLevel *level)
+{
+    return (level->owns_values && level->values != NULL) ? level->arena.capacity : 0;
+}
+
+/**
+ * @brief Make an owned level with room for count nodes totalling total_limbs
+ */
+static MathStatus batch_gcd_level_reserve(BatchGcdLevel *level, MathNatural count, MathNatural total_limbs)
+{
+    size_t alignment = MEMORY_ARENA_DEFAULT_ALIGNMENT;
+    size_t bytes = (size_t)count * (sizeof(MathBigInteger) + sizeof(MathLimb) + alignment) +
+                   (size_t)total_limbs * sizeof(MathLimb) + 2 * alignment;
+
+    MathStatus status = memory_arena_init(&level->arena, bytes);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    level->values = (MathBigInteger *)memory_arena_alloc(&level->arena, (size_t)count * sizeof(MathBigInteger),
+                                                         alignment);
+    if (level->values == NULL)
+    {
+        memory_arena_destroy(&level->arena);
+        return MATH_ERROR_MEMORY;
+    }
+
+    level->count = count;
+    level->owns_values = true;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Free the resident storage of a level (its spill file is kept)
+ */
+static void batch_gcd_level_unload(BatchGcdLevel *level)
+{
+    if (level->owns_values && level->values != NULL)
+    {
+        memory_arena_destroy(&level->arena);
+    }
+    level->values = NULL;
+}
+
+/**
+ * @brief Free everything held by a level, spill file included
+ */
+static void batch_gcd_level_release(BatchGcdLevel *level)
+{
+    batch_gcd_level_unload(level);
+
+    if (level->spill_file != NULL)
+    {
+        fclose(level->spill_file);
+        level->spill_file = NULL;
+        if (level->spill_path[0] != '\0')
+        {
+            remove(level->spill_path);
+            level->spill_path[0] = '\0';
+        }
+    }
+}
+
+/**
+ * @brief Open a fresh spill file for a level
+ */
+static FILE *batch_gcd_open_spill_file(BatchGcdLevel *level, const char *directory, MathNatural index)
+{
+    if (directory == NULL)
+    {
+        level->spill_path[0] = '\0';
+        return tmpfile();
+    }
+
+    snprintf(level->spill_path, sizeof(level->spill_path), "%s/batch_gcd_%lx_%lu_%lu.spill",
+             directory, (unsigned long)(uintptr_t)level, (unsigned long)index,
+             (unsigned long)math_get_time_ms());
+    return fopen(level->spill_path, "w+b");
+}
+
+/**
+ * @brief Write a resident level to disk and free its RAM
+ *
+ * Layout: node count, total limbs, then each node as its size followed by
+ * its limbs.
+ */
+static MathStatus batch_gcd_level_spill(BatchGcdLevel *level, const char *directory, MathNatural index)
+{
+    if (!level->owns_values || level->values == NULL)
+    {
+        return MATH_SUCCESS;
+    }
+
+    level->spill_file = batch_gcd_open_spill_file(level, directory, index);
+    if (level->spill_file == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+
+    MathNatural total_limbs = 0;
+    for (MathNatural i = 0; i < level->count; i++)
+    {
+        total_limbs += level->values[i].size;
+    }
+
+    bool written = fwrite(&level->count, sizeof(MathNatural), 1, level->spill_file) == 1 &&
+                   fwrite(&total_limbs, sizeof(MathNatural), 1, level->spill_file) == 1;
+
+    for (MathNatural i = 0; written && i < level->count; i++)
+    {
+        const MathBigInteger *node = &level->values[i];
+        written = fwrite(&node->size, sizeof(MathNatural), 1, level->spill_file) == 1 &&
+                  fwrite(node->limbs, sizeof(MathLimb), (size_t)node->size, level->spill_file) == node->size;
+    }
+
+    if (!written || fflush(level->spill_file) != 0)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+
+    batch_gcd_level_unload(level);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Read a spilled level back into RAM
+ */
+static MathStatus batch_gcd_level_load(BatchGcdLevel *level)
+{
+    if (level->values != NULL)
+    {
+        return MATH_SUCCESS;
+    }
+
+    if (level->spill_file == NULL || fseek(level->spill_file, 0, SEEK_SET) != 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathNatural count = 0;
+    MathNatural total_limbs = 0;
+    if (fread(&count, sizeof(MathNatural), 1, level->spill_file) != 1 ||
+        fread(&total_limbs, sizeof(MathNatural), 1, level->spill_file) != 1 ||
+        count != level->count)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathStatus status = batch_gcd_level_reserve(level, count, total_limbs);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    for (MathNatural i = 0; i < count; i++)
+    {
+        MathNatural size = 0;
+        MathBigInteger *node = &level->values[i];
+        if (fread(&size, sizeof(MathNatural), 1, level->spill_file) != 1 ||
+            bignum_alloc(node, &level->arena, MATH_MAX(size, 1)) != MATH_SUCCESS ||
+            fread(node->limbs, sizeof(MathLimb), (size_t)size, level->spill_file) != size)
+        {
+            batch_gcd_level_unload(level);
+            return MATH_ERROR_MEMORY;
+        }
+        node->size = size;
+    }
+
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Largest node size of a resident level, in limbs
+ */
+static MathNatural batch_gcd_level_max_limbs(const BatchGcdLevel *level)
+{
+    MathNatural max_limbs = 1;
+    for (MathNatural i = 0; i < level->count; i++)
+    {
+        max_limbs = MATH_MAX(max_limbs, level->values[i].size);
+    }
+    return max_limbs;
+}
+
+// ============================================================================
+// LEVEL JOBS
+// ============================================================================
+
+/**
+ * @brief Work performed on every node of a level
+ */
+typedef enum
+{
+    BATCH_GCD_PHASE_PRODUCT,   /**< output[i] = input[2i] * input[2i + 1] */
+    BATCH_GCD_PHASE_REMAINDER, /**< output[i] = input[i / 2] mod tree[i]^2 */
+    BATCH_GCD_PHASE_LEAF       /**< gcds[i] = gcd(tree[i], (input[i / 2] mod tree[i]^2) / tree[i]) */
+} BatchGcdPhase;
+
+/**
+ * @brief Shared description of one level's work
+ */
+typedef struct
+{
+    BatchGcdPhase phase;
+    const BatchGcdLevel *input;  /**< Product: level k; otherwise the parent remainders */
+    const BatchGcdLevel *tree;   /**< Remainder/leaf: product-tree level k */
+    BatchGcdLevel *output;       /**< Product: level k + 1; remainder: R_k */
+    MathBigInteger *gcds;        /**< Leaf outputs */
+    MathNatural node_count;      /**< Nodes to produce */
+    MathNatural claim_size;      /**< Nodes taken per claim */
+    size_t scratch_bytes;        /**< Per-worker scratch arena size */
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_t lock;
+#endif
+    MathNatural next_node;       /**< Next unclaimed node */
+    MathStatus status;           /**< First failure, MATH_SUCCESS otherwise */
+} BatchGcdLevelJob;
+
+/**
+ * @brief Per-worker state of a level job
+ */
+typedef struct
+{
+    BatchGcdLevelJob *job;
+    MathNatural shared; /**< Leaf phase: non-trivial GCDs found */
+} BatchGcdWorker;
+
+/**
+ * @brief Claim the next range of nodes, or return false when done or failed
+ */
+static bool batch_gcd_claim(BatchGcdLevelJob *job, MathNatural *begin, MathNatural *end)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&job->lock);
+#endif
+    bool claimed = job->status == MATH_SUCCESS && job->next_node < job->node_count;
+    if (claimed)
+    {
+        *begin = job->next_node;
+        *end = MATH_MIN(job->node_count, job->next_node + job->claim_size);
+        job->next_node = *end;
+    }
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&job->lock);
+#endif
+    return claimed;
+}
+
+/**
+ * @brief Record a failure so every worker stops claiming nodes
+ */
+static void batch_gcd_fail(BatchGcdLevelJob *job, MathStatus status)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&job->lock);
+#endif
+    if (job->status == MATH_SUCCESS)
+    {
+        job->status = status;
+    }
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&job->lock);
+#endif
+}
+
+/**
+ * @brief r = parent mod node^2 using scratch for the square
+ */
+static MathStatus batch_gcd_reduce(MathBigInteger *r, const MathBigInteger *parent,
+                                   const MathBigInteger *node, MemoryArena *scratch)
+{
+    MathBigInteger square;
+    MathStatus status = bignum_alloc(&square, scratch, 2 * node->size);
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&square, node, node, scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mod_barrett(r, parent, &square, scratch);
+    }
+    return status;
+}
+
+/**
+ * @brief Leaf step for node i: gcd(N_i, (parent mod N_i^2) / N_i)
+ */
+static MathStatus batch_gcd_leaf(const BatchGcdLevelJob *job, MathNatural i, MemoryArena *scratch, bool *shared)
+{
+    const MathBigInteger *modulus = &job->tree->values[i];
+    const MathBigInteger *parent = &job->input->values[i / 2];
+
+    MathBigInteger z, quotient, remainder;
+    MathStatus status = bignum_alloc(&z, scratch, 2 * modulus->size);
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&quotient, scratch, modulus->size + 2);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&remainder, scratch, modulus->size);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = batch_gcd_reduce(&z, parent, modulus, scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        // N_i divides P, so P mod N_i^2 is an exact multiple of N_i
+        status = bignum_divmod(&quotient, &remainder, &z, modulus, scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        MathNatural steps = 0;
+        MathBigBinaryInput gcd_input = MATH_BIG_BINARY_INPUT_INIT(modulus, &quotient, &job->gcds[i]);
+        status = bignum_is_zero(&quotient) ? bignum_copy(&job->gcds[i], modulus)
+                                           : mdc_big_lehmer(&gcd_input, scratch, &steps);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        *shared = job->gcds[i].size > 1 || job->gcds[i].limbs[0] != 1;
+    }
+    return status;
+}
+
+/**
+ * @brief Process one node of a level job
+ */
+static MathStatus batch_gcd_process_node(BatchGcdWorker *worker, MathNatural i, MemoryArena *scratch)
+{
+    const BatchGcdLevelJob *job = worker->job;
+
+    switch (job->phase)
+    {
+    case BATCH_GCD_PHASE_PRODUCT:
+    {
+        const MathBigInteger *left = &job->input->values[2 * i];
+        MathBigInteger *out = &job->output->values[i];
+        if (2 * i + 1 >= job->input->count)
+        {
+            return bignum_copy(out, left);
+        }
+        return bignum_mul_karatsuba(out, left, &job->input->values[2 * i + 1], scratch);
+    }
+
+    case BATCH_GCD_PHASE_REMAINDER:
+    {
+        const MathBigInteger *parent = &job->input->values[i / 2];
+        MathBigInteger *out = &job->output->values[i];
+
+        // A carried node equals its parent, whose remainder is already below node^2
+        if (i % 2 == 0 && i + 1 == job->tree->count)
+        {
+            return bignum_copy(out, parent);
+        }
+        return batch_gcd_reduce(out, parent, &job->tree->values[i], scratch);
+    }
+
+    case BATCH_GCD_PHASE_LEAF:
+    {
+        bool shared = false;
+        MathStatus status = batch_gcd_leaf(job, i, scratch, &shared);
+        worker->shared += shared ? 1 : 0;
+        return status;
+    }
+    }
+
+    return MATH_ERROR_INVALID_INPUT;
+}
+
+/**
+ * @brief Worker loop: claim node ranges until the level is done
+ *
+ * @param arg Pointer to the worker's BatchGcdWorker
+ * @return NULL
+ */
+static void *batch_gcd_worker_main(void *arg)
+{
+    BatchGcdWorker *worker = (BatchGcdWorker *)arg;
+    BatchGcdLevelJob *job = worker->job;
+
+    MemoryArena scratch;
+    MathStatus status = memory_arena_init(&scratch, job->scratch_bytes);
+    if (status != MATH_SUCCESS)
+    {
+        batch_gcd_fail(job, status);
+        return NULL;
+    }
+
+    MathNatural begin, end;
+    while (batch_gcd_claim(job, &begin, &end))
+    {
+        for (MathNatural i = begin; i < end; i++)
+        {
+            memory_arena_reset(&scratch);
+            status = batch_gcd_process_node(worker, i, &scratch);
+            if (status != MATH_SUCCESS)
+            {
+                batch_gcd_fail(job, status);
+                break;
+            }
+        }
+    }
+
+    memory_arena_destroy(&scratch);
+    return NULL;
+}
+
+/**
+ * @brief Run a level job on up to thread_count workers
+ *
+ * @param job Level description
+ * @param thread_count Worker count (the calling thread is worker 0)
+ * @param shared Optional output for the leaf phase's non-trivial count
+ * @return First failure, MATH_SUCCESS otherwise
+ */
+static MathStatus batch_gcd_run_level(BatchGcdLevelJob *job, MathNatural thread_count, MathNatural *shared)
+{
+    thread_count = MATH_MAX(1, MATH_MIN(thread_count, job->node_count));
+    job->next_node = 0;
+    job->status = MATH_SUCCESS;
+    job->claim_size = 1;
+    if (job->phase == BATCH_GCD_PHASE_LEAF)
+    {
+        job->claim_size = MATH_MAX(1, job->node_count / (thread_count * BATCH_GCD_LEAF_CLAIMS_PER_WORKER));
+    }
+
+    BatchGcdWorker workers[BATCH_GCD_MAX_THREADS];
+    for (MathNatural w = 0; w < thread_count; w++)
+    {
+        workers[w].job = job;
+        workers[w].shared = 0;
+    }
+
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_init(&job->lock, NULL);
+
+    pthread_t threads[BATCH_GCD_MAX_THREADS];
+    MathNatural started = 1;
+    for (MathNatural w = 1; w < thread_count; w++)
+    {
+        if (pthread_create(&threads[w], NULL, batch_gcd_worker_main, &workers[w]) != 0)
+        {
+            break; // Running workers pick up the remaining nodes
+        }
+        started++;
+    }
+    batch_gcd_worker_main(&workers[0]);
+    for (MathNatural w = 1; w < started; w++)
+    {
+        pthread_join(threads[w], NULL);
+    }
+
+    pthread_mutex_destroy(&job->lock);
+#else
+    thread_count = 1;
+    batch_gcd_worker_main(&workers[0]);
+#endif
+
+    if (shared != NULL)
+    {
+        *shared = 0;
+        for (MathNatural w = 0; w < thread_count; w++)
+        {
+            *shared += workers[w].shared;
+        }
+    }
+
+    return job->status;
+}
+
+/**
+ * @brief Per-worker scratch needed for nodes up to max_limbs limbs
+ *
+ * Covers the worst phase: squaring a node, reducing a parent remainder of
+ * up to 4 * max_limbs limbs by that square, and the leaf's Lehmer GCD.
+ */
+static size_t batch_gcd_scratch_bytes(MathNatural max_limbs)
+{
+    return BIGNUM_KARATSUBA_SCRATCH_BYTES(max_limbs) +
+           BIGNUM_BARRETT_SCRATCH_BYTES(4 * max_limbs + 2, 2 * max_limbs) +
+           (size_t)(6 * max_limbs + 16) * sizeof(MathLimb) +
+           8 * MEMORY_ARENA_DEFAULT_ALIGNMENT +
+           BIGNUM_SCRATCH_BYTES(max_limbs + 2);
+}
+
+// ============================================================================
+// BATCH GCD
+// ============================================================================
+
+/**
+ * @brief Validate batch GCD arguments
+ */
+static MathStatus batch_gcd_validate(const MathBigInteger *moduli, MathNatural count, const MathBigInteger *gcds)
+{
+    if (count == 0)
+    {
+        return MATH_SUCCESS;
+    }
+
+    if (moduli == NULL || gcds == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    for (MathNatural i = 0; i < count; i++)
+    {
+        if (moduli[i].size == 0 || moduli[i].negative || moduli[i].limbs == NULL)
+        {
+            return MATH_ERROR_INVALID_INPUT;
+        }
+        if (gcds[i].capacity < moduli[i].size)
+        {
+            return MATH_ERROR_OVERFLOW;
+        }
+    }
+
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Track the resident tree footprint and spill old product levels over budget
+ *
+ * @param levels Product-tree levels built so far
+ * @param newest Index of the level just built (never spilled, it feeds the next one)
+ * @param config Execution options
+ * @param stats Run summary to update
+ * @return MATH_SUCCESS or a spill error
+ */
+static MathStatus batch_gcd_enforce_budget(BatchGcdLevel *levels, MathNatural newest,
+                                           const BatchGcdConfig *config, BatchGcdStats *stats)
+{
+    size_t resident = 0;
+    for (MathNatural k = 0; k <= newest; k++)
+    {
+        resident += batch_gcd_level_bytes(&levels[k]);
+    }
+    stats->peak_memory_bytes = MATH_MAX(stats->peak_memory_bytes, resident);
+
+    for (MathNatural k = 1; k < newest && config->memory_limit_bytes > 0 && resident > config->memory_limit_bytes; k++)
+    {
+        size_t bytes = batch_gcd_level_bytes(&levels[k]);
+        if (bytes == 0)
+        {
+            continue;
+        }
+
+        MathStatus status = batch_gcd_level_spill(&levels[k], config->spill_directory, k);
+        if (status != MATH_SUCCESS)
+        {
+            return status;
+        }
+        resident -= bytes;
+        stats->spilled_levels++;
+    }
+
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Build product-tree level k + 1 from level k
+ */
+static MathStatus batch_gcd_build_product_level(BatchGcdLevel *levels, MathNatural k, MathNatural thread_count)
+{
+    const BatchGcdLevel *input = &levels[k];
+    BatchGcdLevel *output = &levels[k + 1];
+    MathNatural count = (input->count + 1) / 2;
+
+    MathNatural total_limbs = 0;
+    for (MathNatural i = 0; i < input->count; i++)
+    {
+        total_limbs += input->values[i].size;
+    }
+
+    MathStatus status = batch_gcd_level_reserve(output, count, total_limbs);
+    for (MathNatural i = 0; status == MATH_SUCCESS && i < count; i++)
+    {
+        MathNatural capacity = input->values[2 * i].size;
+        if (2 * i + 1 < input->count)
+        {
+            capacity += input->values[2 * i + 1].size;
+        }
+        status = bignum_alloc(&output->values[i], &output->arena, capacity);
+    }
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    BatchGcdLevelJob job = {
+        .phase = BATCH_GCD_PHASE_PRODUCT,
+        .input = input,
+        .tree = NULL,
+        .output = output,
+        .gcds = NULL,
+        .node_count = count,
+        .scratch_bytes = BIGNUM_KARATSUBA_SCRATCH_BYTES(batch_gcd_level_max_limbs(input))};
+
+    return batch_gcd_run_level(&job, thread_count, NULL);
+}
+
+/**
+ * @brief Build remainder level R_k from R_{k+1} and product-tree level k
+ */
+static MathStatus batch_gcd_build_remainder_level(const BatchGcdLevel *parent, const BatchGcdLevel *tree,
+                                                  BatchGcdLevel *output, MathNatural thread_count)
+{
+    MathNatural total_limbs = 0;
+    for (MathNatural i = 0; i < tree->count; i++)
+    {
+        total_limbs += 2 * tree->values[i].size;
+    }
+
+    MathStatus status = batch_gcd_level_reserve(output, tree->count, total_limbs);
+    for (MathNatural i = 0; status == MATH_SUCCESS && i < tree->count; i++)
+    {
+        status = bignum_alloc(&output->values[i], &output->arena, 2 * tree->values[i].size);
+    }
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    BatchGcdLevelJob job = {
+        .phase = BATCH_GCD_PHASE_REMAINDER,
+        .input = parent,
+        .tree = tree,
+        .output = output,
+        .gcds = NULL,
+        .node_count = tree->count,
+        .scratch_bytes = batch_gcd_scratch_bytes(batch_gcd_level_max_limbs(tree))};
+
+    return batch_gcd_run_level(&job, thread_count, NULL);
+}
+
+/**
+ * @brief Compute gcd(N_i, prod_{j != i} N_j) for every modulus
+ *
+ * @param moduli Positive moduli (count elements)
+ * @param count Number of moduli
+ * @param gcds Caller-initialized outputs, gcds[i] with capacity >= moduli[i].size
+ * @param config Execution options (NULL = BATCH_GCD_CONFIG_INIT)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus batch_gcd_compute(const MathBigInteger *moduli, MathNatural count, MathBigInteger *gcds,
+                             const BatchGcdConfig *config, BatchGcdStats *stats)
+{
+    static const BatchGcdConfig default_config = BATCH_GCD_CONFIG_INIT;
+    BatchGcdStats local_stats;
+    if (config == NULL)
+    {
+        config = &default_config;
+    }
+    if (stats == NULL)
+    {
+        stats = &local_stats;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->moduli_count = count;
+    stats->thread_count = MATH_MAX(1, MATH_MIN(config->thread_count, BATCH_GCD_MAX_THREADS));
+#ifndef HAS_POSIX_THREADS
+    stats->thread_count = 1;
+#endif
+
+    MathStatus status = batch_gcd_validate(moduli, count, gcds);
+    if (status != MATH_SUCCESS || count == 0)
+    {
+        return status;
+    }
+
+    double start_time = math_get_time_ms();
+
+    if (count == 1)
+    {
+        // No other modulus to share a factor with
+        stats->tree_levels = 1;
+        stats->execution_time_ms = math_elapsed_time_ms(start_time, math_get_time_ms());
+        return bignum_set_natural(&gcds[0], 1);
+    }
+
+    MathNatural level_count = 1;
+    for (MathNatural n = count; n > 1; n = (n + 1) / 2)
+    {
+        level_count++;
+    }
+
+    BatchGcdLevel *levels = (BatchGcdLevel *)calloc(level_count, sizeof(BatchGcdLevel));
+    if (levels == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+    stats->tree_levels = level_count;
+
+    // Level 0 borrows the caller's moduli
+    levels[0].values = (MathBigInteger *)moduli;
+    levels[0].count = count;
+
+    // ---- Product tree ----
+    for (MathNatural k = 0; status == MATH_SUCCESS && k + 1 < level_count; k++)
+    {
+        status = batch_gcd_build_product_level(levels, k, stats->thread_count);
+        if (status == MATH_SUCCESS)
+        {
+            status = batch_gcd_enforce_budget(levels, k + 1, config, stats);
+        }
+    }
+
+    double product_end = math_get_time_ms();
+    stats->product_tree_ms = math_elapsed_time_ms(start_time, product_end);
+
+    // ---- Remainder tree ----
+    // The root's remainder modulo its own square is the root itself
+    BatchGcdLevel root_remainder = levels[level_count - 1];
+    root_remainder.owns_values = false;
+    root_remainder.spill_file = NULL;
+    BatchGcdLevel *parent = &root_remainder;
+    BatchGcdLevel remainders[2];
+    memset(remainders, 0, sizeof(remainders));
+
+    for (MathNatural k = level_count - 1; status == MATH_SUCCESS && k-- > 1;)
+    {
+        BatchGcdLevel *output = &remainders[k % 2];
+        status = batch_gcd_level_load(&levels[k]);
+        if (status == MATH_SUCCESS)
+        {
+            status = batch_gcd_build_remainder_level(parent, &levels[k], output, stats->thread_count);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            size_t resident = batch_gcd_level_bytes(parent) + batch_gcd_level_bytes(output);
+            for (MathNatural j = 1; j <= k; j++)
+            {
+                resident += batch_gcd_level_bytes(&levels[j]);
+            }
+            stats->peak_memory_bytes = MATH_MAX(stats->peak_memory_bytes, resident);
+        }
+
+        // Neither the parent remainders nor the levels above k are needed again
+        batch_gcd_level_release(parent);
+        batch_gcd_level_release(&levels[k + 1]);
+        parent = output;
+    }
+
+    if (status == MATH_SUCCESS)
+    {
+        BatchGcdLevelJob job = {
+            .phase = BATCH_GCD_PHASE_LEAF,
+            .input = parent,
+            .tree = &levels[0],
+            .output = NULL,
+            .gcds = gcds,
+            .node_count = count,
+            .scratch_bytes = batch_gcd_scratch_bytes(batch_gcd_level_max_limbs(&levels[0]))};
+
+        status = batch_gcd_run_level(&job, stats->thread_count, &stats->shared_count);
+    }
+
+    batch_gcd_level_release(parent);
+    for (MathNatural k = 1; k < level_count; k++)
+    {
+        batch_gcd_level_release(&levels[k]);
+    }
+    free(levels);
+
+    double end_time = math_get_time_ms();
+    stats->remainder_tree_ms = math_elapsed_time_ms(product_end, end_time);
+    stats->execution_time_ms = math_elapsed_time_ms(start_time, end_time);
+    return status;
+}
+
+/**
+ * @brief Batch GCD over 64-bit moduli
+ *
+ * @param moduli Positive moduli (count elements)
+ * @param count Number of moduli
+ * @param gcds Output array receiving one GCD per modulus
+ * @param config Execution options (NULL = BATCH_GCD_CONFIG_INIT)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus batch_gcd_compute_words(const GcdInteger *moduli, MathNatural count, GcdInteger *gcds,
+                                   const BatchGcdConfig *config, BatchGcdStats *stats)
+{
+    if (count > 0 && (moduli == NULL || gcds == NULL))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    for (MathNatural i = 0; i < count; i++)
+    {
+        if (moduli[i] <= 0)
+        {
+            return MATH_ERROR_INVALID_INPUT;
+        }
+    }
+
+    MemoryArena arena;
+    size_t bytes = (size_t)count * 2 * (sizeof(MathBigInteger) + BIGNUM_WORD_LIMBS * sizeof(MathLimb) +
+                                        2 * MEMORY_ARENA_DEFAULT_ALIGNMENT) +
+                   2 * MEMORY_ARENA_DEFAULT_ALIGNMENT;
+    MathStatus status = memory_arena_init(&arena, bytes);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    MathBigInteger *values = (MathBigInteger *)memory_arena_alloc(
+        &arena, (size_t)count * 2 * sizeof(MathBigInteger), MEMORY_ARENA_DEFAULT_ALIGNMENT);
+    if (values == NULL && count > 0)
+    {
+        memory_arena_destroy(&arena);
+        return MATH_ERROR_MEMORY;
+    }
+
+    MathBigInteger *big_moduli = values;
+    MathBigInteger *big_gcds = values + count;
+    for (MathNatural i = 0; status == MATH_SUCCESS && i < count; i++)
+    {
+        status = bignum_alloc(&big_moduli[i], &arena, BIGNUM_WORD_LIMBS);
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_alloc(&big_gcds[i], &arena, BIGNUM_WORD_LIMBS);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_set_int(&big_moduli[i], moduli[i]);
+        }
+    }
+
+    if (status == MATH_SUCCESS)
+    {
+        status = batch_gcd_compute(big_moduli, count, big_gcds, config, stats);
+    }
+
+    for (MathNatural i = 0; status == MATH_SUCCESS && i < count; i++)
+    {
+        status = bignum_to_int(&big_gcds[i], &gcds[i]);
+    }
+
+    memory_arena_destroy(&arena);
+    return status;
+}
+
+/**
+ * @brief Estimate the bytes held by a product tree over the given moduli
+ *
+ * @param moduli Input moduli
+ * @param count Number of moduli
+ * @return Estimated product-tree size in bytes (leaves excluded)
+ */
+size_t batch_gcd_estimate_tree_bytes(const MathBigInteger *moduli, MathNatural count)
+{
+    if (moduli == NULL || count < 2)
+    {
+        return 0;
+    }
+
+    MathNatural leaf_limbs = 0;
+    for (MathNatural i = 0; i < count; i++)
+    {
+        leaf_limbs += moduli[i].size;
+    }
+
+    size_t bytes = 0;
+    for (MathNatural n = count; n > 1; n = (n + 1) / 2)
+    {
+        MathNatural nodes = (n + 1) / 2;
+        bytes += (size_t)leaf_limbs * sizeof(MathLimb) +
+                 (size_t)nodes * (sizeof(MathBigInteger) + MEMORY_ARENA_DEFAULT_ALIGNMENT);
+    }
+    return bytes;
+}
+
+/**
+ * @brief Print a batch GCD summary
+ *
+ * @param stats Run summary to print
+ */
+void batch_gcd_print_stats(const BatchGcdStats *stats)
+{
+    if (stats == NULL)
+    {
+        return;
+    }
+
+    printf("\n=== Batch GCD (product/remainder tree) ===\n");
+    printf("Moduli:          %lu\n", (unsigned long)stats->moduli_count);
+    printf("Shared factors:  %lu\n", (unsigned long)stats->shared_count);
+    printf("Tree levels:     %lu (%lu spilled to disk)\n",
+           (unsigned long)stats->tree_levels, (unsigned long)stats->spilled_levels);
+    printf("Threads:         %lu\n", (unsigned long)stats->thread_count);
+    printf("Peak tree RAM:   %.1f KiB\n", (double)stats->peak_memory_bytes / 1024.0);
+    printf("Product tree:    %.3f ms\n", stats->product_tree_ms);
+    printf("Remainder tree:  %.3f ms\n", stats->remainder_tree_ms);
+    printf("Total:           %.3f ms\n", stats->execution_time_ms);
+}
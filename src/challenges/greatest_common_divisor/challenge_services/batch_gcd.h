@@ -0,0 +1,117 @@
+/**
+ * @file batch_gcd.h
+ * @brief Product-tree / remainder-tree batch GCD service
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares Bernstein's batch GCD: given moduli N_1..N_n it
+ * finds, for every i, gcd(N_i, prod_{j != i} N_j) without running the
+ * n^2 pairwise GCDs. A product tree multiplies the moduli pairwise up to
+ * their full product P, a remainder tree reduces P modulo N_i^2 on the
+ * way back down, and each leaf finishes with gcd(N_i, (P mod N_i^2) / N_i).
+ *
+ * Nodes of one tree level are independent, so every level is spread over
+ * worker threads. Product-tree levels that do not fit the configured
+ * memory budget are written to spill files and read back during the
+ * remainder descent.
+ */
+
+#ifndef BATCH_GCD_H
+#define BATCH_GCD_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../domain_types.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// ============================================================================
+// CONFIGURATION AND STATISTICS
+// ============================================================================
+
+/**
+ * @brief Batch GCD execution options
+ */
+typedef struct
+{
+    MathNatural thread_count;    /**< Worker threads per tree level (0 or 1 = calling thread only) */
+    size_t memory_limit_bytes;   /**< Product-tree bytes kept in RAM before spilling (0 = unlimited) */
+    const char *spill_directory; /**< Directory for spill files (NULL = tmpfile()) */
+} BatchGcdConfig;
+
+/**
+ * @brief Batch GCD configuration initialization macro
+ */
+#define BATCH_GCD_CONFIG_INIT { \
+    .thread_count = 1,          \
+    .memory_limit_bytes = 0,    \
+    .spill_directory = NULL}
+
+/**
+ * @brief Summary of one batch GCD run
+ */
+typedef struct
+{
+    MathNatural moduli_count;    /**< Number of input moduli */
+    MathNatural shared_count;    /**< Moduli with a non-trivial common factor */
+    MathNatural tree_levels;     /**< Levels in the product tree, leaves included */
+    MathNatural spilled_levels;  /**< Product-tree levels written to disk */
+    MathNatural thread_count;    /**< Worker threads actually used */
+    size_t peak_memory_bytes;    /**< Largest tree footprint held in RAM */
+    double product_tree_ms;      /**< Time spent building the product tree */
+    double remainder_tree_ms;    /**< Time spent in the remainder tree and leaf GCDs */
+    double execution_time_ms;    /**< Total wall-clock time */
+} BatchGcdStats;
+
+// ============================================================================
+// BATCH GCD
+// ============================================================================
+
+/**
+ * @brief Compute gcd(N_i, prod_{j != i} N_j) for every modulus
+ *
+ * A result of 1 means N_i shares no factor with the other moduli; a
+ * result equal to N_i means every prime of N_i occurs elsewhere.
+ *
+ * @param moduli Positive moduli (count elements)
+ * @param count Number of moduli
+ * @param gcds Caller-initialized outputs, gcds[i] with capacity >= moduli[i].size
+ * @param config Execution options (NULL = BATCH_GCD_CONFIG_INIT)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus batch_gcd_compute(const MathBigInteger *moduli, MathNatural count, MathBigInteger *gcds,
+                             const BatchGcdConfig *config, BatchGcdStats *stats);
+
+/**
+ * @brief Batch GCD over 64-bit moduli
+ *
+ * @param moduli Positive moduli (count elements)
+ * @param count Number of moduli
+ * @param gcds Output array receiving one GCD per modulus
+ * @param config Execution options (NULL = BATCH_GCD_CONFIG_INIT)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus batch_gcd_compute_words(const GcdInteger *moduli, MathNatural count, GcdInteger *gcds,
+                                   const BatchGcdConfig *config, BatchGcdStats *stats);
+
+/**
+ * @brief Estimate the bytes held by a product tree over the given moduli
+ *
+ * Every level stores roughly the same number of limbs as the leaves, so
+ * the tree needs about (levels - 1) times the input size.
+ *
+ * @param moduli Input moduli
+ * @param count Number of moduli
+ * @return Estimated product-tree size in bytes (leaves excluded)
+ */
+size_t batch_gcd_estimate_tree_bytes(const MathBigInteger *moduli, MathNatural count);
+
+/**
+ * @brief Print a batch GCD summary
+ *
+ * @param stats Run summary to print
+ */
+void batch_gcd_print_stats(const BatchGcdStats *stats);
+
+#endif // BATCH_GCD_H
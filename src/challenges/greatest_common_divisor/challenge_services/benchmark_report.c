@@ -0,0 +1,983 @@
+/**
+ * @file benchmark_report.c
+ * @brief Machine-readable (JSON/CSV) benchmark reports and regression comparison
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Reports are written directly with fprintf, field by field; no document
+ * is built in memory. The reader is not a general JSON parser: it walks
+ * the "results" array of a report produced by this file, keeps the
+ * string and number members it needs and skips everything else, which
+ * is enough to accept reports from older and newer builds alike.
+ */
+
+#include "benchmark_report.h"
+#include "mdc_analyzer.h"
+#include "gcd_isa.h"
+#include "../../../infrastructure/platform/cpu_detection.h"
+#include "../../../infrastructure/utilities/memory_utils.h"
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+#define HAS_POSIX_UNAME 1
+#include <sys/utsname.h>
+#endif
+
+// ============================================================================
+// REPORT FORMATS
+// ============================================================================
+
+/**
+ * @brief Parse a format name ("text", "json" or "csv")
+ *
+ * @param name Format name
+ * @param format Output format
+ * @return true if the name is known
+ */
+bool report_parse_format(const char *name, ReportFormat *format)
+{
+    if (name == NULL || format == NULL)
+    {
+        return false;
+    }
+
+    if (strcmp(name, "text") == 0)
+    {
+        *format = REPORT_FORMAT_TEXT;
+    }
+    else if (strcmp(name, "json") == 0)
+    {
+        *format = REPORT_FORMAT_JSON;
+    }
+    else if (strcmp(name, "csv") == 0)
+    {
+        *format = REPORT_FORMAT_CSV;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// HOST METADATA
+// ============================================================================
+
+/**
+ * @brief Collect the metadata of the running host and build
+ *
+ * @param info Output metadata
+ */
+void report_collect_host_info(ReportHostInfo *info)
+{
+    if (info == NULL)
+    {
+        return;
+    }
+    memory_clear(info, sizeof(*info));
+
+    memory_safe_strcpy(info->hostname, "unknown", sizeof(info->hostname));
+    memory_safe_strcpy(info->os, "unknown", sizeof(info->os));
+#if defined(HAS_POSIX_UNAME)
+    struct utsname name;
+    if (uname(&name) == 0)
+    {
+        memory_safe_strcpy(info->hostname, name.nodename, sizeof(info->hostname));
+        snprintf(info->os, sizeof(info->os), "%.31s %.47s %.15s", name.sysname, name.release, name.machine);
+    }
+#elif defined(_WIN32)
+    const char *computer = getenv("COMPUTERNAME");
+    if (computer != NULL)
+    {
+        memory_safe_strcpy(info->hostname, computer, sizeof(info->hostname));
+    }
+    memory_safe_strcpy(info->os, "Windows", sizeof(info->os));
+#endif
+
+    platform_cpu_model(info->cpu, sizeof(info->cpu));
+
+#if defined(__clang__)
+    snprintf(info->compiler, sizeof(info->compiler), "clang %s", __clang_version__);
+#elif defined(__GNUC__)
+    snprintf(info->compiler, sizeof(info->compiler), "gcc %s", __VERSION__);
+#elif defined(_MSC_VER)
+    snprintf(info->compiler, sizeof(info->compiler), "msvc %d", _MSC_VER);
+#else
+    memory_safe_strcpy(info->compiler, "unknown", sizeof(info->compiler));
+#endif
+
+    time_t now = time(NULL);
+    struct tm *utc = gmtime(&now);
+    if (utc == NULL || strftime(info->timestamp, sizeof(info->timestamp), "%Y-%m-%dT%H:%M:%SZ", utc) == 0)
+    {
+        memory_safe_strcpy(info->timestamp, "unknown", sizeof(info->timestamp));
+    }
+
+    info->simd = platform_simd_level_name(platform_detect_simd_level());
+    info->isa = platform_isa_level_name(gcd_isa_active_level());
+    info->build = GCD_BUILD_CONFIG;
+    info->timer = benchmark_timer_name();
+    info->timer_hz = benchmark_timer_frequency();
+    info->cpu_count = platform_cpu_count();
+    info->limb_bits = MATH_LIMB_BITS;
+}
+
+// ============================================================================
+// JSON AND CSV PRIMITIVES
+// ============================================================================
+
+/**
+ * @brief Write a JSON string literal
+ */
+static void report_json_string(FILE *stream, const char *text)
+{
+    fputc('"', stream);
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            fprintf(stream, "\\%c", *c);
+        }
+        else if (*c < 0x20)
+        {
+            fprintf(stream, "\\u%04x", *c);
+        }
+        else
+        {
+            fputc(*c, stream);
+        }
+    }
+    fputc('"', stream);
+}
+
+/**
+ * @brief Write a JSON number (null if not finite)
+ */
+static void report_json_number(FILE *stream, double value)
+{
+    if (isfinite(value))
+    {
+        fprintf(stream, "%.3f", value);
+    }
+    else
+    {
+        fputs("null", stream);
+    }
+}
+
+/**
+ * @brief Write a CSV field, quoting it when it contains a separator or quote
+ */
+static void report_csv_field(FILE *stream, const char *text)
+{
+    if (strpbrk(text, ",\"\n") == NULL)
+    {
+        fputs(text, stream);
+        return;
+    }
+
+    fputc('"', stream);
+    for (const char *c = text; *c != '\0'; c++)
+    {
+        if (*c == '"')
+        {
+            fputc('"', stream);
+        }
+        fputc(*c, stream);
+    }
+    fputc('"', stream);
+}
+
+/**
+ * @brief Write the report preamble: JSON envelope up to "results", or CSV metadata lines
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param command Command that produced the report
+ * @param config Harness configuration (NULL for untimed commands)
+ */
+static void report_write_preamble(FILE *stream, ReportFormat format, const char *command,
+                                  const BenchmarkConfig *config)
+{
+    ReportHostInfo host;
+    report_collect_host_info(&host);
+
+    if (format == REPORT_FORMAT_CSV)
+    {
+        fprintf(stream, "# schema=%d\n# command=%s\n", REPORT_SCHEMA_VERSION, command);
+        fprintf(stream, "# hostname=%s\n# os=%s\n# cpu=%s\n# cpu_count=%u\n# simd=%s\n",
+                host.hostname, host.os, host.cpu, host.cpu_count, host.simd);
+        fprintf(stream, "# isa=%s\n# compiler=%s\n# build=%s\n# limb_bits=%u\n# timestamp=%s\n# timer=%s\n# timer_hz=%.0f\n",
+                host.isa, host.compiler, host.build, host.limb_bits, host.timestamp, host.timer, host.timer_hz);
+        if (config != NULL)
+        {
+            fprintf(stream, "# samples=%lu\n# warmup=%lu\n",
+                    (unsigned long)config->sample_count, (unsigned long)config->warmup_samples);
+        }
+        return;
+    }
+
+    fprintf(stream, "{\n  \"schema\": %d,\n  \"tool\": \"gcd_analyzer\",\n  \"command\": ", REPORT_SCHEMA_VERSION);
+    report_json_string(stream, command);
+    fprintf(stream, ",\n  \"host\": {\n    \"hostname\": ");
+    report_json_string(stream, host.hostname);
+    fprintf(stream, ",\n    \"os\": ");
+    report_json_string(stream, host.os);
+    fprintf(stream, ",\n    \"cpu\": ");
+    report_json_string(stream, host.cpu);
+    fprintf(stream, ",\n    \"cpu_count\": %u,\n    \"simd\": ", host.cpu_count);
+    report_json_string(stream, host.simd);
+    fprintf(stream, ",\n    \"isa\": ");
+    report_json_string(stream, host.isa);
+    fprintf(stream, ",\n    \"compiler\": ");
+    report_json_string(stream, host.compiler);
+    fprintf(stream, ",\n    \"build\": ");
+    report_json_string(stream, host.build);
+    fprintf(stream, ",\n    \"limb_bits\": %u,\n    \"timestamp\": ", host.limb_bits);
+    report_json_string(stream, host.timestamp);
+    fprintf(stream, ",\n    \"timer\": ");
+    report_json_string(stream, host.timer);
+    fprintf(stream, ",\n    \"timer_hz\": %.0f\n  },\n", host.timer_hz);
+    if (config != NULL)
+    {
+        fprintf(stream, "  \"config\": {\"samples\": %lu, \"warmup\": %lu, \"min_sample_ns\": %.0f},\n",
+                (unsigned long)config->sample_count, (unsigned long)config->warmup_samples, config->min_sample_ns);
+    }
+}
+
+/**
+ * @brief Write the CSV header of statistics entries
+ */
+static void report_write_stats_header(FILE *stream, ReportFormat format)
+{
+    if (format == REPORT_FORMAT_CSV)
+    {
+        fprintf(stream, "variant,input,status,min_ns,median_ns,p99_ns,max_ns,mean_ns,stddev_ns,median_ticks,samples,batch\n");
+    }
+    else
+    {
+        fprintf(stream, "  \"results\": [");
+    }
+}
+
+/**
+ * @brief Write one statistics entry
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param first Whether this is the first JSON entry
+ * @param variant Algorithm of the entry
+ * @param input Input label
+ * @param stats Statistics (sample_count == 0 = rejected)
+ */
+static void report_write_stats_entry(FILE *stream, ReportFormat format, bool first,
+                                     GcdAlgorithmVariant variant, const char *input, const BenchmarkStats *stats)
+{
+    const char *name = mdc_analyzer_get_algorithm_name(variant);
+    bool measured = stats->sample_count > 0;
+
+    if (format == REPORT_FORMAT_CSV)
+    {
+        report_csv_field(stream, name);
+        fputc(',', stream);
+        report_csv_field(stream, input);
+        if (measured)
+        {
+            fprintf(stream, ",ok,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%lu,%lu\n",
+                    stats->min_ns, stats->median_ns, stats->p99_ns, stats->max_ns, stats->mean_ns,
+                    stats->stddev_ns, stats->median_ticks,
+                    (unsigned long)stats->sample_count, (unsigned long)stats->batch_size);
+        }
+        else
+        {
+            fprintf(stream, ",rejected,,,,,,,,,\n");
+        }
+        return;
+    }
+
+    fprintf(stream, "%s\n    {\"variant\": ", first ? "" : ",");
+    report_json_string(stream, name);
+    fprintf(stream, ", \"input\": ");
+    report_json_string(stream, input);
+    if (!measured)
+    {
+        fprintf(stream, ", \"status\": \"rejected\"}");
+        return;
+    }
+    fprintf(stream, ", \"status\": \"ok\", \"min_ns\": ");
+    report_json_number(stream, stats->min_ns);
+    fprintf(stream, ", \"median_ns\": ");
+    report_json_number(stream, stats->median_ns);
+    fprintf(stream, ", \"p99_ns\": ");
+    report_json_number(stream, stats->p99_ns);
+    fprintf(stream, ", \"max_ns\": ");
+    report_json_number(stream, stats->max_ns);
+    fprintf(stream, ", \"mean_ns\": ");
+    report_json_number(stream, stats->mean_ns);
+    fprintf(stream, ", \"stddev_ns\": ");
+    report_json_number(stream, stats->stddev_ns);
+    fprintf(stream, ", \"median_ticks\": ");
+    report_json_number(stream, stats->median_ticks);
+    fprintf(stream, ", \"samples\": %lu, \"batch\": %lu}",
+            (unsigned long)stats->sample_count, (unsigned long)stats->batch_size);
+}
+
+/**
+ * @brief Close the results array and the JSON document (nothing for CSV)
+ */
+static void report_write_footer(FILE *stream, ReportFormat format)
+{
+    if (format == REPORT_FORMAT_JSON)
+    {
+        fprintf(stream, "\n  ]\n}\n");
+    }
+}
+
+// ============================================================================
+// REPORT WRITERS
+// ============================================================================
+
+/**
+ * @brief Write single-pair benchmark statistics
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param a First operand
+ * @param b Second operand
+ * @param config Harness configuration used
+ * @param variants Algorithm of each entry
+ * @param stats Statistics of each entry
+ * @param count Number of entries
+ */
+void report_write_benchmark(FILE *stream, ReportFormat format, GcdInteger a, GcdInteger b,
+                            const BenchmarkConfig *config, const GcdAlgorithmVariant *variants,
+                            const BenchmarkStats *stats, MathNatural count)
+{
+    if (stream == NULL || format == REPORT_FORMAT_TEXT || variants == NULL || stats == NULL)
+    {
+        return;
+    }
+
+    char input[48];
+    snprintf(input, sizeof(input), "%lld,%lld", (long long)a, (long long)b);
+
+    report_write_preamble(stream, format, "benchmark", config);
+    report_write_stats_header(stream, format);
+    for (MathNatural i = 0; i < count; i++)
+    {
+        report_write_stats_entry(stream, format, i == 0, variants[i], input, &stats[i]);
+    }
+    report_write_footer(stream, format);
+}
+
+/**
+ * @brief Write a benchmark suite matrix, one entry per cell
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param matrix Suite results
+ */
+void report_write_suite(FILE *stream, ReportFormat format, const GcdSuiteMatrix *matrix)
+{
+    if (stream == NULL || format == REPORT_FORMAT_TEXT || matrix == NULL)
+    {
+        return;
+    }
+
+    report_write_preamble(stream, format, "bench-suite", &matrix->config);
+    if (format == REPORT_FORMAT_CSV)
+    {
+        fprintf(stream, "# seed=0x%llx\n", (unsigned long long)matrix->seed);
+    }
+    else
+    {
+        fprintf(stream, "  \"seed\": \"0x%llx\",\n", (unsigned long long)matrix->seed);
+    }
+
+    report_write_stats_header(stream, format);
+    bool first = true;
+    for (MathNatural r = 0; r < matrix->variant_count; r++)
+    {
+        for (MathNatural c = 0; c < GCD_SUITE_COLUMN_COUNT; c++)
+        {
+            // Columns an algorithm has no path for are left out rather than reported as rejected
+            const BenchmarkStats *cell = &matrix->cells[r][c];
+            if (cell->sample_count == 0)
+            {
+                continue;
+            }
+            report_write_stats_entry(stream, format, first, matrix->variants[r], matrix->columns[c].name, cell);
+            first = false;
+        }
+    }
+    report_write_footer(stream, format);
+}
+
+/**
+ * @brief Write the results of running every algorithm once on a pair
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param a First operand
+ * @param b Second operand
+ * @param variants Algorithm of each result
+ * @param results Result of each algorithm
+ * @param steps Step counts of each algorithm (NULL = no step fields)
+ * @param count Number of results
+ * @param consistent Whether all valid results agree
+ */
+void report_write_comparison(FILE *stream, ReportFormat format, GcdInteger a, GcdInteger b,
+                             const GcdAlgorithmVariant *variants, const MathResult *results,
+                             const GcdStepCounts *steps, MathNatural count, bool consistent)
+{
+    if (stream == NULL || format == REPORT_FORMAT_TEXT || variants == NULL || results == NULL)
+    {
+        return;
+    }
+
+    char input[48];
+    snprintf(input, sizeof(input), "%lld,%lld", (long long)a, (long long)b);
+
+    report_write_preamble(stream, format, "compare", NULL);
+    if (format == REPORT_FORMAT_CSV)
+    {
+        fprintf(stream, "# consistent=%s\nvariant,input,status,gcd,time_ns%s\n", consistent ? "true" : "false",
+                steps != NULL ? ",divisions,subtractions,shifts" : "");
+    }
+    else
+    {
+        fprintf(stream, "  \"consistent\": %s,\n  \"results\": [", consistent ? "true" : "false");
+    }
+
+    for (MathNatural i = 0; i < count; i++)
+    {
+        const char *name = mdc_analyzer_get_algorithm_name(variants[i]);
+        bool valid = MATH_IS_VALID_RESULT(results[i]);
+
+        if (format == REPORT_FORMAT_CSV)
+        {
+            report_csv_field(stream, name);
+            fputc(',', stream);
+            report_csv_field(stream, input);
+            if (valid)
+            {
+                fprintf(stream, ",ok,%lld,%.3f", (long long)results[i].value, results[i].execution_time_ms * 1e6);
+                if (steps != NULL)
+                {
+                    fprintf(stream, ",%llu,%llu,%llu", (unsigned long long)steps[i].divisions,
+                            (unsigned long long)steps[i].subtractions, (unsigned long long)steps[i].shifts);
+                }
+                fputc('\n', stream);
+            }
+            else
+            {
+                fprintf(stream, ",error %d,,%s\n", results[i].status, steps != NULL ? ",,," : "");
+            }
+            continue;
+        }
+
+        fprintf(stream, "%s\n    {\"variant\": ", i == 0 ? "" : ",");
+        report_json_string(stream, name);
+        fprintf(stream, ", \"input\": ");
+        report_json_string(stream, input);
+        if (valid)
+        {
+            fprintf(stream, ", \"status\": \"ok\", \"gcd\": %lld, \"time_ns\": ", (long long)results[i].value);
+            report_json_number(stream, results[i].execution_time_ms * 1e6);
+            if (steps != NULL)
+            {
+                fprintf(stream, ", \"steps\": {\"divisions\": %llu, \"subtractions\": %llu, \"shifts\": %llu}",
+                        (unsigned long long)steps[i].divisions, (unsigned long long)steps[i].subtractions,
+                        (unsigned long long)steps[i].shifts);
+            }
+            fputc('}', stream);
+        }
+        else
+        {
+            fprintf(stream, ", \"status\": \"error\", \"error\": %d}", results[i].status);
+        }
+    }
+    report_write_footer(stream, format);
+}
+
+/**
+ * @brief Write the fastest algorithm found for a pair
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param a First operand
+ * @param b Second operand
+ * @param fastest Fastest algorithm
+ * @param time_ms Time of the fastest algorithm (negative if none succeeded)
+ */
+void report_write_fastest(FILE *stream, ReportFormat format, GcdInteger a, GcdInteger b,
+                          GcdAlgorithmVariant fastest, double time_ms)
+{
+    if (stream == NULL || format == REPORT_FORMAT_TEXT)
+    {
+        return;
+    }
+
+    char input[48];
+    snprintf(input, sizeof(input), "%lld,%lld", (long long)a, (long long)b);
+    const char *name = time_ms >= 0 ? mdc_analyzer_get_algorithm_name(fastest) : "";
+
+    report_write_preamble(stream, format, "fastest", NULL);
+    if (format == REPORT_FORMAT_CSV)
+    {
+        fprintf(stream, "variant,input,time_ns\n");
+        if (time_ms >= 0)
+        {
+            report_csv_field(stream, name);
+            fputc(',', stream);
+            report_csv_field(stream, input);
+            fprintf(stream, ",%.3f\n", time_ms * 1e6);
+        }
+        return;
+    }
+
+    fprintf(stream, "  \"fastest\": ");
+    if (time_ms >= 0)
+    {
+        report_json_string(stream, name);
+    }
+    else
+    {
+        fputs("null", stream);
+    }
+    fprintf(stream, ",\n  \"results\": [");
+    if (time_ms >= 0)
+    {
+        fprintf(stream, "\n    {\"variant\": ");
+        report_json_string(stream, name);
+        fprintf(stream, ", \"input\": ");
+        report_json_string(stream, input);
+        fprintf(stream, ", \"status\": \"ok\", \"time_ns\": ");
+        report_json_number(stream, time_ms * 1e6);
+        fputc('}', stream);
+    }
+    report_write_footer(stream, format);
+}
+
+// ============================================================================
+// REPORT READER
+// ============================================================================
+
+/**
+ * @brief Cursor over a JSON document held in memory
+ */
+typedef struct
+{
+    const char *text;
+    size_t position;
+    bool failed;
+} ReportJsonCursor;
+
+/**
+ * @brief Skip whitespace and return the next character without consuming it
+ */
+static char report_json_peek(ReportJsonCursor *cursor)
+{
+    while (isspace((unsigned char)cursor->text[cursor->position]))
+    {
+        cursor->position++;
+    }
+    return cursor->text[cursor->position];
+}
+
+/**
+ * @brief Consume an expected character
+ */
+static bool report_json_expect(ReportJsonCursor *cursor, char expected)
+{
+    if (report_json_peek(cursor) != expected)
+    {
+        cursor->failed = true;
+        return false;
+    }
+    cursor->position++;
+    return true;
+}
+
+/**
+ * @brief Read a string literal into buffer (truncated to size, escapes kept verbatim)
+ */
+static bool report_json_read_string(ReportJsonCursor *cursor, char *buffer, size_t size)
+{
+    if (!report_json_expect(cursor, '"'))
+    {
+        return false;
+    }
+
+    size_t length = 0;
+    while (cursor->text[cursor->position] != '"')
+    {
+        char c = cursor->text[cursor->position];
+        if (c == '\0')
+        {
+            cursor->failed = true;
+            return false;
+        }
+        if (c == '\\' && cursor->text[cursor->position + 1] != '\0')
+        {
+            // Only \" and \\ can appear in the names this file writes
+            cursor->position++;
+            c = cursor->text[cursor->position];
+        }
+        if (buffer != NULL && length + 1 < size)
+        {
+            buffer[length++] = c;
+        }
+        cursor->position++;
+    }
+    cursor->position++;
+
+    if (buffer != NULL && size > 0)
+    {
+        buffer[length] = '\0';
+    }
+    return true;
+}
+
+/**
+ * @brief Skip any JSON value (string, number, literal, object or array)
+ */
+static void report_json_skip_value(ReportJsonCursor *cursor)
+{
+    char c = report_json_peek(cursor);
+    if (c == '"')
+    {
+        report_json_read_string(cursor, NULL, 0);
+        return;
+    }
+    if (c == '{' || c == '[')
+    {
+        // Nested containers: track depth, skipping strings so braces inside them are ignored
+        int depth = 0;
+        do
+        {
+            c = report_json_peek(cursor);
+            if (c == '"')
+            {
+                report_json_read_string(cursor, NULL, 0);
+                continue;
+            }
+            if (c == '\0')
+            {
+                cursor->failed = true;
+                return;
+            }
+            if (c == '{' || c == '[')
+            {
+                depth++;
+            }
+            else if (c == '}' || c == ']')
+            {
+                depth--;
+            }
+            cursor->position++;
+        } while (depth > 0 && !cursor->failed);
+        return;
+    }
+
+    // Number or literal: up to the next separator
+    size_t start = cursor->position;
+    while (cursor->text[cursor->position] != '\0' && strchr(",}] \t\r\n", cursor->text[cursor->position]) == NULL)
+    {
+        cursor->position++;
+    }
+    if (cursor->position == start)
+    {
+        cursor->failed = true;
+    }
+}
+
+/**
+ * @brief Read one results entry, keeping its name, input and timing
+ *
+ * @param cursor Cursor positioned on the entry's '{'
+ * @param entry Output entry
+ * @return true if the entry carries a timing
+ */
+static bool report_json_read_entry(ReportJsonCursor *cursor, ReportEntry *entry)
+{
+    memory_clear(entry, sizeof(*entry));
+    bool timed = false;
+
+    if (!report_json_expect(cursor, '{'))
+    {
+        return false;
+    }
+    if (report_json_peek(cursor) == '}')
+    {
+        cursor->position++;
+        return false;
+    }
+
+    do
+    {
+        char key[32];
+        if (!report_json_read_string(cursor, key, sizeof(key)) || !report_json_expect(cursor, ':'))
+        {
+            return false;
+        }
+
+        if (strcmp(key, "variant") == 0)
+        {
+            report_json_read_string(cursor, entry->variant, sizeof(entry->variant));
+        }
+        else if (strcmp(key, "input") == 0)
+        {
+            report_json_read_string(cursor, entry->input, sizeof(entry->input));
+        }
+        else if ((strcmp(key, "median_ns") == 0 || (strcmp(key, "time_ns") == 0 && !timed)) &&
+                 report_json_peek(cursor) != 'n')
+        {
+            char *end;
+            entry->time_ns = strtod(cursor->text + cursor->position, &end);
+            timed = end != cursor->text + cursor->position;
+            cursor->position = (size_t)(end - cursor->text);
+        }
+        else
+        {
+            report_json_skip_value(cursor);
+        }
+
+        if (cursor->failed)
+        {
+            return false;
+        }
+    } while (report_json_peek(cursor) == ',' && ++cursor->position);
+
+    return report_json_expect(cursor, '}') && timed && entry->variant[0] != '\0';
+}
+
+/**
+ * @brief Read a whole file into a NUL-terminated buffer
+ *
+ * @param path File to read
+ * @return Buffer to free, or NULL on error
+ */
+static char *report_read_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return NULL;
+    }
+
+    char *text = NULL;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        long size = ftell(file);
+        if (size >= 0 && fseek(file, 0, SEEK_SET) == 0)
+        {
+            text = (char *)malloc((size_t)size + 1);
+            if (text != NULL)
+            {
+                size_t read = fread(text, 1, (size_t)size, file);
+                text[read] = '\0';
+            }
+        }
+    }
+
+    fclose(file);
+    return text;
+}
+
+/**
+ * @brief Load the timed results of a JSON report
+ *
+ * @param path Report file
+ * @param entries Output entries
+ * @param max_entries Capacity of entries
+ * @param count Number of entries loaded
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT (unreadable or malformed
+ *         file) or MATH_ERROR_MEMORY
+ */
+MathStatus report_load_entries(const char *path, ReportEntry *entries, MathNatural max_entries, MathNatural *count)
+{
+    if (path == NULL || entries == NULL || count == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    *count = 0;
+
+    char *text = report_read_file(path);
+    if (text == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    ReportJsonCursor cursor = {.text = text, .position = 0, .failed = false};
+    MathStatus status = MATH_ERROR_INVALID_INPUT;
+
+    // Walk the top-level members until "results"
+    if (report_json_expect(&cursor, '{'))
+    {
+        while (!cursor.failed && report_json_peek(&cursor) == '"')
+        {
+            char key[32];
+            if (!report_json_read_string(&cursor, key, sizeof(key)) || !report_json_expect(&cursor, ':'))
+            {
+                break;
+            }
+
+            if (strcmp(key, "results") != 0)
+            {
+                report_json_skip_value(&cursor);
+                if (report_json_peek(&cursor) == ',')
+                {
+                    cursor.position++;
+                }
+                continue;
+            }
+
+            if (!report_json_expect(&cursor, '['))
+            {
+                break;
+            }
+            while (!cursor.failed && report_json_peek(&cursor) == '{')
+            {
+                ReportEntry entry;
+                if (report_json_read_entry(&cursor, &entry) && *count < max_entries)
+                {
+                    entries[(*count)++] = entry;
+                }
+                if (report_json_peek(&cursor) == ',')
+                {
+                    cursor.position++;
+                }
+            }
+            if (!cursor.failed && report_json_expect(&cursor, ']'))
+            {
+                status = MATH_SUCCESS;
+            }
+            break;
+        }
+    }
+
+    free(text);
+    return status;
+}
+
+// ============================================================================
+// REGRESSION COMPARISON
+// ============================================================================
+
+/**
+ * @brief Find the entry with the same variant and input
+ *
+ * @return Index of the match, or count if none
+ */
+static MathNatural report_find_entry(const ReportEntry *entries, MathNatural count, const ReportEntry *key)
+{
+    for (MathNatural i = 0; i < count; i++)
+    {
+        if (strcmp(entries[i].variant, key->variant) == 0 && strcmp(entries[i].input, key->input) == 0)
+        {
+            return i;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Compare a run against a baseline and print the per-entry deltas
+ *
+ * @param baseline Baseline entries
+ * @param baseline_count Number of baseline entries
+ * @param current Entries of the run under test
+ * @param current_count Number of current entries
+ * @param threshold_percent Allowed slowdown in percent
+ * @param print_results Whether to print the comparison table
+ * @return Number of regressions
+ */
+MathNatural report_compare_entries(const ReportEntry *baseline, MathNatural baseline_count,
+                                   const ReportEntry *current, MathNatural current_count,
+                                   double threshold_percent, bool print_results)
+{
+    if (baseline == NULL || current == NULL)
+    {
+        return 0;
+    }
+
+    MathNatural regressions = 0;
+    MathNatural improvements = 0;
+    MathNatural unchanged = 0;
+    MathNatural missing = 0;
+
+    if (print_results)
+    {
+        printf("%-26s %-12s %12s %12s %9s  %s\n", "Algorithm", "Input", "baseline ns", "current ns", "change", "status");
+    }
+
+    for (MathNatural i = 0; i < baseline_count; i++)
+    {
+        MathNatural match = report_find_entry(current, current_count, &baseline[i]);
+        if (match == current_count)
+        {
+            missing++;
+            if (print_results)
+            {
+                printf("%-26s %-12s %12.1f %12s %9s  missing\n",
+                       baseline[i].variant, baseline[i].input, baseline[i].time_ns, "-", "-");
+            }
+            continue;
+        }
+
+        double before = baseline[i].time_ns;
+        double after = current[match].time_ns;
+        double change = before > 0.0 ? (after - before) / before * 100.0 : 0.0;
+        const char *verdict = "ok";
+        if (change > threshold_percent)
+        {
+            verdict = "REGRESSION";
+            regressions++;
+        }
+        else if (change < -threshold_percent)
+        {
+            verdict = "improved";
+            improvements++;
+        }
+        else
+        {
+            unchanged++;
+        }
+
+        if (print_results)
+        {
+            printf("%-26s %-12s %12.1f %12.1f %+8.1f%%  %s\n",
+                   baseline[i].variant, baseline[i].input, before, after, change, verdict);
+        }
+    }
+
+    MathNatural added = 0;
+    for (MathNatural i = 0; i < current_count; i++)
+    {
+        if (report_find_entry(baseline, baseline_count, &current[i]) == baseline_count)
+        {
+            added++;
+            if (print_results)
+            {
+                printf("%-26s %-12s %12s %12.1f %9s  new\n", current[i].variant, current[i].input, "-",
+                       current[i].time_ns, "-");
+            }
+        }
+    }
+
+    if (print_results)
+    {
+        printf("\nThreshold: +%.1f%% over the baseline median\n", threshold_percent);
+        printf("Summary: %lu regressed, %lu improved, %lu unchanged, %lu missing, %lu new\n\n",
+               (unsigned long)regressions, (unsigned long)improvements, (unsigned long)unchanged,
+               (unsigned long)missing, (unsigned long)added);
+    }
+
+    return regressions;
+}
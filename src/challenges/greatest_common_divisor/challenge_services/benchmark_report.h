@@ -0,0 +1,214 @@
+/**
+ * @file benchmark_report.h
+ * @brief Machine-readable (JSON/CSV) benchmark reports and regression comparison
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The console tables of benchmark, bench-suite, compare and fastest are
+ * meant for people. This header declares writers that emit the same data
+ * as JSON or CSV together with host metadata (CPU, OS, compiler, timer),
+ * and a reader that loads the timings of two JSON reports back so a
+ * baseline can be compared against a new run.
+ *
+ * Every report carries a "results" array whose entries are identified by
+ * "variant" (algorithm name) and "input" (operand pair or input class).
+ * Timed entries carry "median_ns" (benchmarks) or "time_ns" (single runs).
+ */
+
+#ifndef BENCHMARK_REPORT_H
+#define BENCHMARK_REPORT_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../domain_types.h"
+#include "../../../infrastructure/utilities/benchmark_utils.h"
+#include "benchmark_suite.h"
+#include "step_counter.h"
+#include <stdio.h>
+
+// ============================================================================
+// REPORT FORMATS
+// ============================================================================
+
+/**
+ * @brief Version of the report layout, bumped on incompatible changes
+ */
+#define REPORT_SCHEMA_VERSION 1
+
+/**
+ * @brief Default slowdown, in percent of the baseline median, flagged as a regression
+ */
+#define REPORT_DEFAULT_THRESHOLD_PERCENT 5.0
+
+/**
+ * @brief Maximum timed entries loaded from one report
+ */
+#define REPORT_MAX_ENTRIES 512
+
+/**
+ * @brief Output format of the analysis commands
+ */
+typedef enum
+{
+    REPORT_FORMAT_TEXT, /**< Human-readable console tables */
+    REPORT_FORMAT_JSON, /**< One JSON document */
+    REPORT_FORMAT_CSV   /**< '#' metadata lines followed by a header and one row per result */
+} ReportFormat;
+
+/**
+ * @brief Parse a format name ("text", "json" or "csv")
+ *
+ * @param name Format name
+ * @param format Output format
+ * @return true if the name is known
+ */
+bool report_parse_format(const char *name, ReportFormat *format);
+
+// ============================================================================
+// HOST METADATA
+// ============================================================================
+
+/**
+ * @brief Build configuration recorded in reports
+ *
+ * The CMake build defines it (e.g. "cmake Release lto pgo-use"); other builds
+ * report "unspecified".
+ */
+#ifndef GCD_BUILD_CONFIG
+#define GCD_BUILD_CONFIG "unspecified"
+#endif
+
+/**
+ * @brief Description of the machine and build that produced a report
+ */
+typedef struct
+{
+    char hostname[64];       /**< Network name of the host */
+    char os[96];             /**< Operating system, release and architecture */
+    char cpu[64];            /**< CPU model string */
+    char compiler[96];       /**< Compiler and version */
+    char timestamp[32];      /**< UTC time of the report, ISO 8601 */
+    const char *simd;        /**< Best SIMD level available */
+    const char *isa;         /**< ISA level of the multiversioned batch kernels in use */
+    const char *build;       /**< Build configuration (GCD_BUILD_CONFIG) */
+    const char *timer;       /**< Benchmark counter name */
+    double timer_hz;         /**< Benchmark counter rate */
+    unsigned int cpu_count;  /**< Online logical CPUs */
+    unsigned int limb_bits;  /**< Bits per bignum limb in this build */
+} ReportHostInfo;
+
+/**
+ * @brief Collect the metadata of the running host and build
+ *
+ * @param info Output metadata
+ */
+void report_collect_host_info(ReportHostInfo *info);
+
+// ============================================================================
+// REPORT WRITERS
+// ============================================================================
+
+/**
+ * @brief Write single-pair benchmark statistics
+ *
+ * Entries with sample_count == 0 are reported with status "rejected".
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param a First operand
+ * @param b Second operand
+ * @param config Harness configuration used
+ * @param variants Algorithm of each entry
+ * @param stats Statistics of each entry
+ * @param count Number of entries
+ */
+void report_write_benchmark(FILE *stream, ReportFormat format, GcdInteger a, GcdInteger b,
+                            const BenchmarkConfig *config, const GcdAlgorithmVariant *variants,
+                            const BenchmarkStats *stats, MathNatural count);
+
+/**
+ * @brief Write a benchmark suite matrix, one entry per cell
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param matrix Suite results
+ */
+void report_write_suite(FILE *stream, ReportFormat format, const GcdSuiteMatrix *matrix);
+
+/**
+ * @brief Write the results of running every algorithm once on a pair
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param a First operand
+ * @param b Second operand
+ * @param variants Algorithm of each result
+ * @param results Result of each algorithm
+ * @param steps Step counts of each algorithm (NULL = no step fields)
+ * @param count Number of results
+ * @param consistent Whether all valid results agree
+ */
+void report_write_comparison(FILE *stream, ReportFormat format, GcdInteger a, GcdInteger b,
+                             const GcdAlgorithmVariant *variants, const MathResult *results,
+                             const GcdStepCounts *steps, MathNatural count, bool consistent);
+
+/**
+ * @brief Write the fastest algorithm found for a pair
+ *
+ * @param stream Output stream
+ * @param format REPORT_FORMAT_JSON or REPORT_FORMAT_CSV
+ * @param a First operand
+ * @param b Second operand
+ * @param fastest Fastest algorithm
+ * @param time_ms Time of the fastest algorithm (negative if none succeeded)
+ */
+void report_write_fastest(FILE *stream, ReportFormat format, GcdInteger a, GcdInteger b,
+                          GcdAlgorithmVariant fastest, double time_ms);
+
+// ============================================================================
+// REGRESSION COMPARISON
+// ============================================================================
+
+/**
+ * @brief One timed result loaded from a JSON report
+ */
+typedef struct
+{
+    char variant[MATH_MAX_NAME_LENGTH]; /**< Algorithm name */
+    char input[48];                     /**< Operand pair or input class */
+    double time_ns;                     /**< Median (or single-run) time per GCD */
+} ReportEntry;
+
+/**
+ * @brief Load the timed results of a JSON report
+ *
+ * Entries without a timing (rejected inputs or failed runs) are skipped.
+ *
+ * @param path Report file
+ * @param entries Output entries
+ * @param max_entries Capacity of entries
+ * @param count Number of entries loaded
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT (unreadable or malformed
+ *         file) or MATH_ERROR_MEMORY
+ */
+MathStatus report_load_entries(const char *path, ReportEntry *entries, MathNatural max_entries, MathNatural *count);
+
+/**
+ * @brief Compare a run against a baseline and print the per-entry deltas
+ *
+ * Entries are matched on (variant, input). A matched entry whose time
+ * exceeds the baseline by more than threshold_percent is a regression;
+ * entries present in only one report are listed but not counted.
+ *
+ * @param baseline Baseline entries
+ * @param baseline_count Number of baseline entries
+ * @param current Entries of the run under test
+ * @param current_count Number of current entries
+ * @param threshold_percent Allowed slowdown in percent
+ * @param print_results Whether to print the comparison table
+ * @return Number of regressions
+ */
+MathNatural report_compare_entries(const ReportEntry *baseline, MathNatural baseline_count,
+                                   const ReportEntry *current, MathNatural current_count,
+                                   double threshold_percent, bool print_results);
+
+#endif // BENCHMARK_REPORT_H
@@ -0,0 +1,493 @@
+/**
+ * @file benchmark_suite.c
+ * @brief Benchmark every registered GCD algorithm over every input class
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Each column's operands are generated once and shared by every row, so
+ * the algorithms in a column are compared on identical pairs. 64-bit
+ * columns go through mdc_analyzer_benchmark_pairs and bignum columns
+ * through mdc_analyzer_benchmark_big_pairs; algorithms without a path
+ * for a column, and linear-time algorithms on columns with unbounded
+ * quotients, are left unmeasured.
+ */
+
+#include "benchmark_suite.h"
+#include "mdc_analyzer.h"
+#include "solution_registry.h"
+#include "../../../infrastructure/utilities/bignum_utils.h"
+#include "../../../infrastructure/utilities/memory_utils.h"
+#include "../../../infrastructure/platform/cpu_detection.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Operand sizes of the arbitrary-precision columns
+ */
+static const MathNatural SUITE_BIG_SIZES[GCD_SUITE_BIG_SIZE_COUNT] = {128, 512, 2048};
+
+// ============================================================================
+// COLUMN SETUP
+// ============================================================================
+
+/**
+ * @brief Fill in the name and description of every column
+ *
+ * @param matrix Matrix whose columns are described
+ */
+static void suite_init_columns(GcdSuiteMatrix *matrix)
+{
+    for (MathNatural c = 0; c < GCD_INPUT_CLASS_COUNT; c++)
+    {
+        GcdSuiteColumn *column = &matrix->columns[c];
+        column->input_class = (GcdInputClass)c;
+        column->bits = 0;
+        memory_safe_strcpy(column->name, gcd_input_class_name(column->input_class), sizeof(column->name));
+        memory_safe_strcpy(column->description, gcd_input_class_description(column->input_class),
+                           sizeof(column->description));
+    }
+
+    for (MathNatural s = 0; s < GCD_SUITE_BIG_SIZE_COUNT; s++)
+    {
+        GcdSuiteColumn *column = &matrix->columns[GCD_INPUT_CLASS_COUNT + s];
+        column->input_class = GCD_INPUT_CLASS_COUNT;
+        column->bits = SUITE_BIG_SIZES[s];
+        snprintf(column->name, sizeof(column->name), "big%lu", (unsigned long)column->bits);
+        snprintf(column->description, sizeof(column->description), "uniform %lu-bit operands",
+                 (unsigned long)column->bits);
+    }
+}
+
+// ============================================================================
+// COLUMN MEASUREMENT
+// ============================================================================
+
+/**
+ * @brief Whether an algorithm can finish every pair of a 64-bit input class
+ *
+ * Linear-time (subtraction) algorithms take a step per unit of quotient,
+ * so they only run on classes whose quotients are bounded.
+ *
+ * @param variant Row algorithm
+ * @param input_class Column input class
+ * @return true if the cell is measured
+ */
+static bool suite_word_cell_bounded(GcdAlgorithmVariant variant, GcdInputClass input_class)
+{
+    const ImplementationSpec *spec = gcd_registry_get_implementation(variant);
+    return spec != NULL &&
+           (spec->metadata.time_complexity != COMPLEXITY_LINEAR || gcd_input_class_bounded_quotients(input_class));
+}
+
+/**
+ * @brief Measure every row on a 64-bit input column
+ *
+ * @param matrix Matrix being filled
+ * @param column Column index
+ * @param rng Operand generator
+ * @return MATH_SUCCESS or MATH_ERROR_MEMORY
+ */
+static MathStatus suite_run_word_column(GcdSuiteMatrix *matrix, MathNatural column, GcdRandom *rng)
+{
+    GcdInteger *operands = (GcdInteger *)malloc(2 * GCD_SUITE_PAIRS * sizeof(GcdInteger));
+    if (operands == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+    GcdInteger *a = operands;
+    GcdInteger *b = operands + GCD_SUITE_PAIRS;
+    gcd_generate_pairs(matrix->columns[column].input_class, rng, a, b, GCD_SUITE_PAIRS);
+
+    for (MathNatural row = 0; row < matrix->variant_count; row++)
+    {
+        if (!suite_word_cell_bounded(matrix->variants[row], matrix->columns[column].input_class))
+        {
+            continue;
+        }
+        // Rejected operands leave the cell unmeasured
+        mdc_analyzer_benchmark_pairs(matrix->variants[row], a, b, GCD_SUITE_PAIRS,
+                                     &matrix->config, &matrix->cells[row][column]);
+    }
+
+    free(operands);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Measure every row with an arbitrary-precision path on a bignum column
+ *
+ * @param matrix Matrix being filled
+ * @param column Column index
+ * @param rng Operand generator
+ * @return MATH_SUCCESS or MATH_ERROR_MEMORY
+ */
+static MathStatus suite_run_big_column(GcdSuiteMatrix *matrix, MathNatural column, GcdRandom *rng)
+{
+    MathNatural limbs = bignum_limbs_for_bits(matrix->columns[column].bits);
+    MemoryArena arena;
+    if (memory_arena_init(&arena, 2 * GCD_SUITE_BIG_PAIRS *
+                                      (limbs * sizeof(MathLimb) + MEMORY_ARENA_DEFAULT_ALIGNMENT)) != MATH_SUCCESS)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+
+    MathBigInteger a[GCD_SUITE_BIG_PAIRS];
+    MathBigInteger b[GCD_SUITE_BIG_PAIRS];
+    MathStatus status = gcd_generate_big_pairs(rng, matrix->columns[column].bits, &arena, a, b, GCD_SUITE_BIG_PAIRS);
+
+    for (MathNatural row = 0; row < matrix->variant_count && status == MATH_SUCCESS; row++)
+    {
+        // Algorithms without compute_big leave the cell unmeasured
+        mdc_analyzer_benchmark_big_pairs(matrix->variants[row], a, b, GCD_SUITE_BIG_PAIRS,
+                                         &matrix->config, &matrix->cells[row][column]);
+    }
+
+    memory_arena_destroy(&arena);
+    return status;
+}
+
+// ============================================================================
+// SUITE INTERFACE
+// ============================================================================
+
+/**
+ * @brief Run every registered algorithm over every input column
+ *
+ * @param config Harness configuration per cell (NULL = BENCHMARK_CONFIG_INIT
+ *        with GCD_SUITE_DEFAULT_SAMPLES samples)
+ * @param seed Operand generator seed
+ * @param matrix Output matrix
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_suite_run(const BenchmarkConfig *config, MathNatural seed, GcdSuiteMatrix *matrix)
+{
+    if (matrix == NULL || (config != NULL && config->sample_count == 0))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    memory_clear(matrix, sizeof(*matrix));
+    matrix->config = (BenchmarkConfig)BENCHMARK_CONFIG_INIT;
+    matrix->config.sample_count = GCD_SUITE_DEFAULT_SAMPLES;
+    if (config != NULL)
+    {
+        matrix->config = *config;
+    }
+    matrix->seed = seed;
+    matrix->variant_count = gcd_registry_list_variants(matrix->variants, GCD_SUITE_MAX_VARIANTS);
+    if (matrix->variant_count == 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    suite_init_columns(matrix);
+
+    MathStatus status = MATH_SUCCESS;
+    for (MathNatural column = 0; column < GCD_SUITE_COLUMN_COUNT && status == MATH_SUCCESS; column++)
+    {
+        // One stream per column, so a column's operands do not depend on the others
+        GcdRandom rng;
+        gcd_random_seed(&rng, seed + column);
+
+        if (matrix->columns[column].bits == 0)
+        {
+            status = suite_run_word_column(matrix, column, &rng);
+        }
+        else
+        {
+            status = suite_run_big_column(matrix, column, &rng);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Print the median time per GCD of every cell, marking the fastest per column
+ *
+ * @param matrix Matrix to print
+ */
+void gcd_suite_print_matrix(const GcdSuiteMatrix *matrix)
+{
+    if (matrix == NULL)
+    {
+        return;
+    }
+
+    // Fastest measured row of each column
+    MathNatural fastest[GCD_SUITE_COLUMN_COUNT];
+    for (MathNatural c = 0; c < GCD_SUITE_COLUMN_COUNT; c++)
+    {
+        fastest[c] = matrix->variant_count;
+        for (MathNatural r = 0; r < matrix->variant_count; r++)
+        {
+            const BenchmarkStats *cell = &matrix->cells[r][c];
+            if (cell->sample_count > 0 &&
+                (fastest[c] == matrix->variant_count || cell->median_ns < matrix->cells[fastest[c]][c].median_ns))
+            {
+                fastest[c] = r;
+            }
+        }
+    }
+
+    printf("Median ns per GCD (* = fastest in column, - = not applicable)\n\n");
+    printf("%-26s", "Algorithm");
+    for (MathNatural c = 0; c < GCD_SUITE_COLUMN_COUNT; c++)
+    {
+        printf(" %11s", matrix->columns[c].name);
+    }
+    printf("\n");
+
+    for (MathNatural r = 0; r < matrix->variant_count; r++)
+    {
+        printf("%-26s", mdc_analyzer_get_algorithm_name(matrix->variants[r]));
+        for (MathNatural c = 0; c < GCD_SUITE_COLUMN_COUNT; c++)
+        {
+            const BenchmarkStats *cell = &matrix->cells[r][c];
+            if (cell->sample_count == 0)
+            {
+                printf(" %11s", "- ");
+            }
+            else
+            {
+                printf(" %10.1f%c", cell->median_ns, fastest[c] == r ? '*' : ' ');
+            }
+        }
+        printf("\n");
+    }
+
+    printf("\nColumns:\n");
+    for (MathNatural c = 0; c < GCD_SUITE_COLUMN_COUNT; c++)
+    {
+        const GcdSuiteColumn *column = &matrix->columns[c];
+        printf("  %-12s %s (%lu pairs)\n", column->name, column->description,
+               (unsigned long)(column->bits == 0 ? GCD_SUITE_PAIRS : GCD_SUITE_BIG_PAIRS));
+    }
+    printf("\n");
+}
+
+// ============================================================================
+// DISPATCH CALIBRATION
+// ============================================================================
+
+/**
+ * @brief Race Lehmer and the half-GCD on doubling operand sizes and set the
+ *        big-operand crossover of a table
+ *
+ * The crossover is left as installed if the half-GCD does not win at the
+ * largest size.
+ *
+ * @param calibration Calibration receiving the timings
+ * @param seed Operand generator seed
+ * @param table Table whose half_gcd_bits threshold is set
+ * @return MATH_SUCCESS or MATH_ERROR_MEMORY
+ */
+static MathStatus suite_calibrate_crossover(GcdDispatchCalibration *calibration, MathNatural seed,
+                                            GcdDispatchTable *table)
+{
+    static const GcdAlgorithmVariant racers[2] = {GCD_BIGNUM_LEHMER, GCD_BIGNUM_HALF_GCD};
+
+    // One timed operation is one GCD: a few slow calls need no batching
+    BenchmarkConfig config = BENCHMARK_CONFIG_INIT;
+    config.warmup_samples = 1;
+    config.sample_count = GCD_SUITE_CROSSOVER_SAMPLES;
+    config.batch_size = 1;
+
+    for (MathNatural s = 0; s < GCD_SUITE_CROSSOVER_SIZE_COUNT; s++)
+    {
+        MathNatural bits = (MathNatural)GCD_SUITE_CROSSOVER_MIN_BITS << s;
+        calibration->crossover_bits[s] = bits;
+
+        MemoryArena arena;
+        if (memory_arena_init(&arena, 2 * GCD_SUITE_CROSSOVER_PAIRS *
+                                          (bignum_limbs_for_bits(bits) * sizeof(MathLimb) +
+                                           MEMORY_ARENA_DEFAULT_ALIGNMENT)) != MATH_SUCCESS)
+        {
+            return MATH_ERROR_MEMORY;
+        }
+
+        GcdRandom rng;
+        gcd_random_seed(&rng, seed + GCD_DISPATCH_BUCKET_COUNT + s);
+        MathBigInteger a[GCD_SUITE_CROSSOVER_PAIRS];
+        MathBigInteger b[GCD_SUITE_CROSSOVER_PAIRS];
+        MathStatus status = gcd_generate_big_pairs(&rng, bits, &arena, a, b, GCD_SUITE_CROSSOVER_PAIRS);
+        for (MathNatural r = 0; r < 2 && status == MATH_SUCCESS; r++)
+        {
+            // An unmeasured racer leaves its cell empty and cannot win
+            mdc_analyzer_benchmark_big_pairs(racers[r], a, b, GCD_SUITE_CROSSOVER_PAIRS, &config,
+                                             &calibration->crossover[s][r]);
+        }
+
+        memory_arena_destroy(&arena);
+        if (status != MATH_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    // Smallest size from which the half-GCD wins at every larger size
+    MathNatural crossover = GCD_SUITE_CROSSOVER_SIZE_COUNT;
+    while (crossover > 0)
+    {
+        const BenchmarkStats *race = calibration->crossover[crossover - 1];
+        if (race[1].sample_count == 0 ||
+            (race[0].sample_count != 0 && race[0].median_ns <= race[1].median_ns))
+        {
+            break;
+        }
+        crossover--;
+    }
+    if (crossover < GCD_SUITE_CROSSOVER_SIZE_COUNT)
+    {
+        table->thresholds.half_gcd_bits = (unsigned int)calibration->crossover_bits[crossover];
+    }
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Measure every dispatcher candidate on every bucket and build a table
+ *
+ * @param config Harness configuration per cell (NULL = BENCHMARK_CONFIG_INIT
+ *        with GCD_SUITE_DEFAULT_SAMPLES samples)
+ * @param seed Operand generator seed
+ * @param calibration Output timings
+ * @param table Output decision table
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_suite_calibrate_dispatch(const BenchmarkConfig *config, MathNatural seed,
+                                        GcdDispatchCalibration *calibration, GcdDispatchTable *table)
+{
+    if (calibration == NULL || table == NULL || (config != NULL && config->sample_count == 0))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    memory_clear(calibration, sizeof(*calibration));
+    calibration->config = (BenchmarkConfig)BENCHMARK_CONFIG_INIT;
+    calibration->config.sample_count = GCD_SUITE_DEFAULT_SAMPLES;
+    if (config != NULL)
+    {
+        calibration->config = *config;
+    }
+    calibration->seed = seed;
+    calibration->candidate_count = gcd_dispatch_list_candidates(calibration->candidates, GCD_VARIANT_COUNT);
+
+    GcdInteger *operands = (GcdInteger *)malloc(2 * GCD_SUITE_CALIBRATION_PAIRS * sizeof(GcdInteger));
+    if (operands == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+    GcdInteger *a = operands;
+    GcdInteger *b = operands + GCD_SUITE_CALIBRATION_PAIRS;
+
+    // Pairs are drawn with the installed thresholds, so the table keeps them
+    gcd_dispatch_default_table(table);
+    table->thresholds = gcd_dispatch_get_table()->thresholds;
+    for (MathNatural bucket = 0; bucket < GCD_DISPATCH_BUCKET_COUNT; bucket++)
+    {
+        GcdRandom rng;
+        gcd_random_seed(&rng, seed + bucket);
+        gcd_dispatch_generate_pairs((GcdDispatchBucket)bucket, &rng, a, b, GCD_SUITE_CALIBRATION_PAIRS);
+
+        // Keep the default for a bucket where no candidate could be measured
+        double best = -1.0;
+        for (MathNatural c = 0; c < calibration->candidate_count; c++)
+        {
+            BenchmarkStats *cell = &calibration->cells[bucket][c];
+            if (mdc_analyzer_benchmark_pairs(calibration->candidates[c], a, b, GCD_SUITE_CALIBRATION_PAIRS,
+                                             &calibration->config, cell) != MATH_SUCCESS)
+            {
+                continue;
+            }
+            table->cost_ns[bucket][calibration->candidates[c]] = cell->median_ns;
+            if (best < 0 || cell->median_ns < best)
+            {
+                best = cell->median_ns;
+                table->choice[bucket] = calibration->candidates[c];
+                table->median_ns[bucket] = cell->median_ns;
+            }
+        }
+    }
+
+    free(operands);
+
+    MathStatus status = suite_calibrate_crossover(calibration, seed, table);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    table->calibrated = true;
+    platform_cpu_model(table->cpu, sizeof(table->cpu));
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Print the calibration timings, marking the choice of each bucket
+ *
+ * @param calibration Calibration timings
+ * @param table Table built from them
+ */
+void gcd_suite_print_calibration(const GcdDispatchCalibration *calibration, const GcdDispatchTable *table)
+{
+    if (calibration == NULL || table == NULL)
+    {
+        return;
+    }
+
+    printf("Median ns per GCD (* = chosen for bucket, - = not measured)\n\n");
+    printf("%-20s", "Algorithm");
+    for (MathNatural bucket = 0; bucket < GCD_DISPATCH_BUCKET_COUNT; bucket++)
+    {
+        printf(" %11s", gcd_dispatch_bucket_name((GcdDispatchBucket)bucket));
+    }
+    printf("\n");
+
+    for (MathNatural c = 0; c < calibration->candidate_count; c++)
+    {
+        printf("%-20s", mdc_analyzer_get_algorithm_name(calibration->candidates[c]));
+        for (MathNatural bucket = 0; bucket < GCD_DISPATCH_BUCKET_COUNT; bucket++)
+        {
+            const BenchmarkStats *cell = &calibration->cells[bucket][c];
+            if (cell->sample_count == 0)
+            {
+                printf(" %11s", "- ");
+            }
+            else
+            {
+                printf(" %10.1f%c", cell->median_ns,
+                       table->choice[bucket] == calibration->candidates[c] ? '*' : ' ');
+            }
+        }
+        printf("\n");
+    }
+    printf("\n");
+
+    printf("Big operands, median us per GCD (* = faster, half-GCD from %u bits)\n\n",
+           table->thresholds.half_gcd_bits);
+    printf("%-20s", "Algorithm");
+    for (MathNatural s = 0; s < GCD_SUITE_CROSSOVER_SIZE_COUNT; s++)
+    {
+        printf(" %11lu", (unsigned long)calibration->crossover_bits[s]);
+    }
+    printf("\n");
+
+    for (MathNatural r = 0; r < 2; r++)
+    {
+        printf("%-20s", mdc_analyzer_get_algorithm_name(r == 0 ? GCD_BIGNUM_LEHMER : GCD_BIGNUM_HALF_GCD));
+        for (MathNatural s = 0; s < GCD_SUITE_CROSSOVER_SIZE_COUNT; s++)
+        {
+            const BenchmarkStats *race = calibration->crossover[s];
+            if (race[r].sample_count == 0)
+            {
+                printf(" %11s", "- ");
+            }
+            else
+            {
+                bool faster = race[1 - r].sample_count == 0 || race[r].median_ns < race[1 - r].median_ns;
+                printf(" %10.1f%c", race[r].median_ns / 1000.0, faster ? '*' : ' ');
+            }
+        }
+        printf("\n");
+    }
+    printf("\n");
+}
@@ -0,0 +1,192 @@
+/**
+ * @file benchmark_suite.h
+ * @brief Benchmark every registered GCD algorithm over every input class
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The suite draws a fixed set of operand pairs per input class (see
+ * input_generators.h) and arbitrary-precision pairs at a few sizes, then
+ * measures each registered algorithm on each set with the benchmark
+ * harness. The result is a matrix of timing distributions, one row per
+ * algorithm and one column per input class.
+ *
+ * The same harness calibrates the GCD_AUTO decision table: every
+ * dispatcher candidate is measured on pairs drawn from every dispatch
+ * bucket, and the fastest per bucket becomes the table entry.
+ */
+
+#ifndef BENCHMARK_SUITE_H
+#define BENCHMARK_SUITE_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../domain_types.h"
+#include "../../../infrastructure/utilities/benchmark_utils.h"
+#include "input_generators.h"
+#include "gcd_dispatcher.h"
+
+// ============================================================================
+// SUITE PARAMETERS
+// ============================================================================
+
+/**
+ * @brief Operand pairs drawn per 64-bit input class
+ */
+#define GCD_SUITE_PAIRS 1024
+
+/**
+ * @brief Operand pairs drawn per arbitrary-precision size
+ */
+#define GCD_SUITE_BIG_PAIRS 16
+
+/**
+ * @brief Number of arbitrary-precision operand sizes (128, 512 and 2048 bits)
+ */
+#define GCD_SUITE_BIG_SIZE_COUNT 3
+
+/**
+ * @brief Default number of timed samples per cell
+ */
+#define GCD_SUITE_DEFAULT_SAMPLES 100
+
+/**
+ * @brief Maximum rows (registered algorithms) in a matrix
+ */
+#define GCD_SUITE_MAX_VARIANTS GCD_VARIANT_CAPACITY
+
+/**
+ * @brief Columns in a matrix
+ */
+#define GCD_SUITE_COLUMN_COUNT (GCD_INPUT_CLASS_COUNT + GCD_SUITE_BIG_SIZE_COUNT)
+
+// ============================================================================
+// SUITE TYPES
+// ============================================================================
+
+/**
+ * @brief One input column of the matrix
+ */
+typedef struct
+{
+    char name[24];             /**< Column label (e.g. "fibonacci", "big512") */
+    char description[64];      /**< One-line description of the operands */
+    MathNatural bits;          /**< Operand size for bignum columns, 0 for 64-bit columns */
+    GcdInputClass input_class; /**< Generator of a 64-bit column */
+} GcdSuiteColumn;
+
+/**
+ * @brief Timing matrix produced by gcd_suite_run
+ *
+ * A cell with sample_count == 0 was not measured: the algorithm rejects
+ * some operand of the column, has no path for its operand size, or is a
+ * linear-time algorithm on a column with unbounded quotients.
+ */
+typedef struct
+{
+    MathNatural variant_count;                            /**< Rows in use */
+    GcdAlgorithmVariant variants[GCD_SUITE_MAX_VARIANTS]; /**< Row algorithms */
+    GcdSuiteColumn columns[GCD_SUITE_COLUMN_COUNT];       /**< Column inputs */
+    BenchmarkConfig config;                               /**< Harness configuration used */
+    MathNatural seed;                                     /**< Seed of the operand generator */
+
+    /** Per-GCD timings, indexed [row][column] */
+    BenchmarkStats cells[GCD_SUITE_MAX_VARIANTS][GCD_SUITE_COLUMN_COUNT];
+} GcdSuiteMatrix;
+
+// ============================================================================
+// SUITE INTERFACE
+// ============================================================================
+
+/**
+ * @brief Run every registered algorithm over every input column
+ *
+ * The registry must be initialized. Operands are regenerated from seed
+ * for each column, so two runs with the same seed measure identical
+ * inputs.
+ *
+ * @param config Harness configuration per cell (NULL = BENCHMARK_CONFIG_INIT
+ *        with GCD_SUITE_DEFAULT_SAMPLES samples)
+ * @param seed Operand generator seed
+ * @param matrix Output matrix
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_suite_run(const BenchmarkConfig *config, MathNatural seed, GcdSuiteMatrix *matrix);
+
+/**
+ * @brief Print the median time per GCD of every cell, marking the fastest per column
+ *
+ * @param matrix Matrix to print
+ */
+void gcd_suite_print_matrix(const GcdSuiteMatrix *matrix);
+
+// ============================================================================
+// DISPATCH CALIBRATION
+// ============================================================================
+
+/**
+ * @brief Operand pairs drawn per dispatch bucket
+ */
+#define GCD_SUITE_CALIBRATION_PAIRS 512
+
+/**
+ * @brief Operand sizes at which Lehmer and the half-GCD are raced for the
+ *        big-operand crossover (doubling from 4096 bits)
+ */
+#define GCD_SUITE_CROSSOVER_SIZE_COUNT 5
+#define GCD_SUITE_CROSSOVER_MIN_BITS 4096
+
+/**
+ * @brief Operand pairs and timed samples per crossover size
+ *
+ * A GCD of 65536-bit operands takes milliseconds, so a few samples of a
+ * few pairs already give stable medians.
+ */
+#define GCD_SUITE_CROSSOVER_PAIRS 4
+#define GCD_SUITE_CROSSOVER_SAMPLES 5
+
+/**
+ * @brief Timings behind a calibrated decision table
+ */
+typedef struct
+{
+    MathNatural candidate_count;                       /**< Columns in use */
+    GcdAlgorithmVariant candidates[GCD_VARIANT_COUNT]; /**< Column algorithms */
+    BenchmarkConfig config;                            /**< Harness configuration used */
+    MathNatural seed;                                  /**< Seed of the operand generator */
+
+    /** Per-GCD timings, indexed [bucket][candidate] */
+    BenchmarkStats cells[GCD_DISPATCH_BUCKET_COUNT][GCD_VARIANT_COUNT];
+
+    MathNatural crossover_bits[GCD_SUITE_CROSSOVER_SIZE_COUNT]; /**< Operand sizes raced */
+
+    /** Per-GCD timings of big operands, indexed [size][0 = Lehmer, 1 = half-GCD] */
+    BenchmarkStats crossover[GCD_SUITE_CROSSOVER_SIZE_COUNT][2];
+} GcdDispatchCalibration;
+
+/**
+ * @brief Measure every dispatcher candidate on every bucket and build a table
+ *
+ * The table records the fastest candidate per bucket, its median time,
+ * the cost of every candidate, the installed thresholds and the CPU
+ * model; it is returned, not installed. The half_gcd_bits threshold is
+ * measured too: it becomes the smallest raced size from which the
+ * half-GCD beats Lehmer at that size and every larger one.
+ *
+ * @param config Harness configuration per cell (NULL = BENCHMARK_CONFIG_INIT
+ *        with GCD_SUITE_DEFAULT_SAMPLES samples)
+ * @param seed Operand generator seed
+ * @param calibration Output timings
+ * @param table Output decision table
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_suite_calibrate_dispatch(const BenchmarkConfig *config, MathNatural seed,
+                                        GcdDispatchCalibration *calibration, GcdDispatchTable *table);
+
+/**
+ * @brief Print the calibration timings, marking the choice of each bucket
+ *
+ * @param calibration Calibration timings
+ * @param table Table built from them
+ */
+void gcd_suite_print_calibration(const GcdDispatchCalibration *calibration, const GcdDispatchTable *table);
+
+#endif // BENCHMARK_SUITE_H
@@ -0,0 +1,550 @@
+/**
+ * @file gcd_cache.c
+ * @brief Bounded memo of GCD and Extended GCD results for repeated pairs
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Shards come from a fixed pool, claimed under a lock the first time a
+ * thread uses the cache and returned, contents included, when the thread
+ * exits, the same way perf_counters.c hands out counter blocks. Only the
+ * owner touches a shard's table; the configuration and the counters are
+ * read and written with relaxed atomics so status queries can run during
+ * a computation.
+ *
+ * Reconfiguring or clearing bumps a generation number instead of walking
+ * the shards: each owner notices the change on its next access and
+ * rebuilds its own table.
+ */
+
+#include "gcd_cache.h"
+#include "../../../infrastructure/utilities/memory_utils.h"
+#include <stdlib.h>
+
+// Platform detection for the shard pool lock
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || defined(__MINGW32__)
+#if !defined(SINGLE_THREADED) && (defined(__GNUC__) || defined(__clang__))
+#define HAS_POSIX_THREADS 1
+#endif
+#endif
+
+#ifdef HAS_POSIX_THREADS
+#include <pthread.h>
+#endif
+
+/**
+ * @brief Relaxed accesses: status readers may run while owners update
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define CACHE_THREAD_LOCAL __thread
+#define CACHE_LOAD(x) __atomic_load_n(&(x), __ATOMIC_RELAXED)
+#define CACHE_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELAXED)
+#define CACHE_ATOMIC_ADD(x, v) __atomic_fetch_add(&(x), (v), __ATOMIC_RELAXED)
+#define CACHE_ALIGNED __attribute__((aligned(64)))
+#else
+#define CACHE_THREAD_LOCAL
+#define CACHE_LOAD(x) (x)
+#define CACHE_STORE(x, v) ((x) = (v))
+#define CACHE_ATOMIC_ADD(x, v) ((x) += (v))
+#define CACHE_ALIGNED
+#endif
+
+// ============================================================================
+// SHARD POOL
+// ============================================================================
+
+/**
+ * @brief One memoized pair: the variant's result for (a, b) as given
+ */
+typedef struct
+{
+    GcdInteger a;          /**< First operand (0 marks an empty slot) */
+    GcdInteger b;          /**< Second operand */
+    unsigned int variant;  /**< Variant that computed the entry */
+    unsigned int epoch;    /**< Epoch of the variant number when stored */
+    bool has_coefficients; /**< Stored from an Extended GCD */
+    GcdInteger gcd;        /**< The variant's GCD of (a, b) */
+    GcdInteger x;          /**< Coefficient of a, if has_coefficients */
+    GcdInteger y;          /**< Coefficient of b, if has_coefficients */
+} GcdCacheEntry;
+
+/**
+ * @brief Table and counters of one thread (cache-line aligned, so owners never share a line)
+ */
+typedef struct
+{
+    GcdCacheEntry *entries;
+    MathNatural capacity;   /**< Slots in entries (a power of two) */
+    MathNatural generation; /**< Configuration the table was built for */
+    MathNatural clock;      /**< Round-robin victim within a full window */
+    MathNatural hits;
+    MathNatural misses;
+    MathNatural evictions;
+} CACHE_ALIGNED GcdCacheShard;
+
+static GcdCacheShard g_cache_shards[GCD_CACHE_MAX_SHARDS];
+static bool g_cache_owned[GCD_CACHE_MAX_SHARDS];
+static MathNatural g_cache_claimed; /**< High-water mark of g_cache_shards in use */
+static GcdCacheShard g_cache_unsharded; /**< Marks a thread the pool had no shard for */
+
+static MathNatural g_cache_capacity;   /**< Entries per shard (0 = disabled) */
+static MathNatural g_cache_generation; /**< Bumped by every configure and clear */
+
+/** Bumped when a variant number is released, so its reuse starts uncached */
+static unsigned int g_cache_variant_epochs[GCD_VARIANT_CAPACITY];
+
+static CACHE_THREAD_LOCAL GcdCacheShard *t_cache_shard;
+
+#ifdef HAS_POSIX_THREADS
+static pthread_mutex_t g_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t g_cache_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_cache_key;
+
+/**
+ * @brief Return an exiting thread's shard to the pool, entries included
+ */
+static void cache_release_shard(void *shard)
+{
+    MathNatural index = (MathNatural)((GcdCacheShard *)shard - g_cache_shards);
+    pthread_mutex_lock(&g_cache_lock);
+    g_cache_owned[index] = false;
+    pthread_mutex_unlock(&g_cache_lock);
+}
+
+static void cache_create_key(void)
+{
+    pthread_key_create(&g_cache_key, cache_release_shard);
+}
+#endif
+
+/**
+ * @brief Claim a shard for the calling thread
+ *
+ * @return Private shard, or &g_cache_unsharded when the pool is exhausted
+ */
+static GcdCacheShard *cache_claim_shard(void)
+{
+    GcdCacheShard *shard = &g_cache_unsharded;
+
+#ifdef HAS_POSIX_THREADS
+    pthread_once(&g_cache_key_once, cache_create_key);
+    pthread_mutex_lock(&g_cache_lock);
+#endif
+    for (MathNatural i = 0; i < GCD_CACHE_MAX_SHARDS; i++)
+    {
+        if (!g_cache_owned[i])
+        {
+            g_cache_owned[i] = true;
+            shard = &g_cache_shards[i];
+            if (i + 1 > g_cache_claimed)
+            {
+                CACHE_STORE(g_cache_claimed, i + 1);
+            }
+            break;
+        }
+    }
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&g_cache_lock);
+    if (shard != &g_cache_unsharded)
+    {
+        pthread_setspecific(g_cache_key, shard);
+    }
+#endif
+
+    t_cache_shard = shard;
+    return shard;
+}
+
+/**
+ * @brief Rebuild a shard's table for the current configuration
+ *
+ * @return true if the shard has a table afterwards
+ */
+static bool cache_rebuild_shard(GcdCacheShard *shard, MathNatural capacity, MathNatural generation)
+{
+    if (shard->capacity != capacity || shard->entries == NULL)
+    {
+        void *old_entries = shard->entries;
+        memory_safe_free(&old_entries);
+        shard->entries = (GcdCacheEntry *)calloc((size_t)capacity, sizeof(GcdCacheEntry));
+        CACHE_STORE(shard->capacity, shard->entries != NULL ? capacity : 0);
+    }
+    else
+    {
+        memory_clear(shard->entries, (size_t)capacity * sizeof(GcdCacheEntry));
+    }
+
+    shard->clock = 0;
+    CACHE_STORE(shard->hits, 0);
+    CACHE_STORE(shard->misses, 0);
+    CACHE_STORE(shard->evictions, 0);
+    CACHE_STORE(shard->generation, generation);
+    return shard->entries != NULL;
+}
+
+/**
+ * @brief Shard of the calling thread, brought up to date
+ *
+ * @return Shard, or NULL when the cache is off or this thread has none
+ */
+static GcdCacheShard *cache_shard(void)
+{
+    MathNatural capacity = CACHE_LOAD(g_cache_capacity);
+    if (capacity == 0)
+    {
+        return NULL;
+    }
+
+    GcdCacheShard *shard = t_cache_shard != NULL ? t_cache_shard : cache_claim_shard();
+    if (shard == &g_cache_unsharded)
+    {
+        return NULL;
+    }
+
+    MathNatural generation = CACHE_LOAD(g_cache_generation);
+    if ((shard->generation != generation || shard->capacity != capacity) &&
+        !cache_rebuild_shard(shard, capacity, generation))
+    {
+        return NULL;
+    }
+    return shard;
+}
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+/**
+ * @brief Enable the cache, resize it or turn it off
+ *
+ * @param entries Entries per thread, rounded up to a power of two (0 disables)
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus gcd_cache_configure(MathNatural entries)
+{
+    if (entries > GCD_CACHE_MAX_ENTRIES)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    // At least one probe window, so a window never wraps onto itself
+    MathNatural capacity = 0;
+    if (entries > 0)
+    {
+        capacity = GCD_CACHE_PROBE_WINDOW;
+        while (capacity < entries)
+        {
+            capacity <<= 1;
+        }
+    }
+
+    CACHE_STORE(g_cache_capacity, capacity);
+    CACHE_ATOMIC_ADD(g_cache_generation, 1);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Entries per thread shard
+ *
+ * @return Configured capacity (0 when the cache is off)
+ */
+MathNatural gcd_cache_get_capacity(void)
+{
+    return CACHE_LOAD(g_cache_capacity);
+}
+
+/**
+ * @brief Drop every cached result and reset the counters
+ */
+void gcd_cache_clear(void)
+{
+    CACHE_ATOMIC_ADD(g_cache_generation, 1);
+}
+
+/**
+ * @brief Drop the results of one variant number
+ *
+ * @param variant Variant whose entries stop matching
+ */
+void gcd_cache_invalidate_variant(GcdAlgorithmVariant variant)
+{
+    if ((unsigned int)variant < GCD_VARIANT_CAPACITY)
+    {
+        CACHE_ATOMIC_ADD(g_cache_variant_epochs[variant], 1);
+    }
+}
+
+// ============================================================================
+// LOOKUP AND STORE
+// ============================================================================
+
+/**
+ * @brief Key of a lookup: the variant, its epoch and the pair exactly as given
+ */
+typedef struct
+{
+    GcdInteger a;
+    GcdInteger b;
+    unsigned int variant;
+    unsigned int epoch;
+} GcdCacheKey;
+
+/**
+ * @brief Build a key
+ *
+ * Zero operands cost nothing to compute and mark empty slots, so they are
+ * not cached.
+ *
+ * @return true if the pair is cacheable
+ */
+static bool cache_make_key(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b, GcdCacheKey *key)
+{
+    if (a == 0 || b == 0 || (unsigned int)variant >= GCD_VARIANT_CAPACITY)
+    {
+        return false;
+    }
+
+    key->a = a;
+    key->b = b;
+    key->variant = (unsigned int)variant;
+    key->epoch = CACHE_LOAD(g_cache_variant_epochs[variant]);
+    return true;
+}
+
+/**
+ * @brief Check whether an entry holds a key
+ */
+static bool cache_entry_matches(const GcdCacheEntry *entry, const GcdCacheKey *key)
+{
+    return entry->a == key->a && entry->b == key->b && entry->variant == key->variant && entry->epoch == key->epoch;
+}
+
+/**
+ * @brief First slot of a key's probe window
+ */
+static MathNatural cache_home_slot(const GcdCacheKey *key, MathNatural capacity)
+{
+    MathNatural h = (MathNatural)key->a * 0x9E3779B97F4A7C15ull ^ (MathNatural)key->b * 0xD6E8FEB86659FD93ull ^
+                    (MathNatural)key->variant * 0xA0761D6478BD642Full;
+    h ^= h >> 32;
+    return h & (capacity - 1);
+}
+
+/**
+ * @brief Find a key in a shard
+ *
+ * @return Entry, or NULL if the key is not cached
+ */
+static GcdCacheEntry *cache_find(GcdCacheShard *shard, const GcdCacheKey *key)
+{
+    MathNatural mask = shard->capacity - 1;
+    MathNatural home = cache_home_slot(key, shard->capacity);
+    for (MathNatural i = 0; i < GCD_CACHE_PROBE_WINDOW; i++)
+    {
+        GcdCacheEntry *entry = &shard->entries[(home + i) & mask];
+        if (cache_entry_matches(entry, key))
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Slot to store a key in: its entry, a free slot or a victim
+ */
+static GcdCacheEntry *cache_slot_for(GcdCacheShard *shard, const GcdCacheKey *key)
+{
+    MathNatural mask = shard->capacity - 1;
+    MathNatural home = cache_home_slot(key, shard->capacity);
+    GcdCacheEntry *free_slot = NULL;
+    for (MathNatural i = 0; i < GCD_CACHE_PROBE_WINDOW; i++)
+    {
+        GcdCacheEntry *entry = &shard->entries[(home + i) & mask];
+        if (cache_entry_matches(entry, key))
+        {
+            return entry;
+        }
+        if (entry->a == 0 && free_slot == NULL)
+        {
+            free_slot = entry;
+        }
+    }
+    if (free_slot != NULL)
+    {
+        return free_slot;
+    }
+
+    CACHE_STORE(shard->evictions, shard->evictions + 1);
+    return &shard->entries[(home + (shard->clock++ % GCD_CACHE_PROBE_WINDOW)) & mask];
+}
+
+/**
+ * @brief Count a lookup outcome
+ */
+static void cache_count(GcdCacheShard *shard, bool hit)
+{
+    if (hit)
+    {
+        CACHE_STORE(shard->hits, shard->hits + 1);
+    }
+    else
+    {
+        CACHE_STORE(shard->misses, shard->misses + 1);
+    }
+}
+
+/**
+ * @brief Look up the GCD a variant computed for a pair
+ *
+ * @param variant Variant that computed the entry
+ * @param a First operand
+ * @param b Second operand
+ * @param gcd Output GCD on a hit
+ * @return true on a hit
+ */
+bool gcd_cache_lookup(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b, GcdInteger *gcd)
+{
+    GcdCacheKey key;
+    GcdCacheShard *shard;
+    if (gcd == NULL || !cache_make_key(variant, a, b, &key) || (shard = cache_shard()) == NULL)
+    {
+        return false;
+    }
+
+    GcdCacheEntry *entry = cache_find(shard, &key);
+    cache_count(shard, entry != NULL);
+    if (entry == NULL)
+    {
+        return false;
+    }
+    *gcd = entry->gcd;
+    return true;
+}
+
+/**
+ * @brief Remember the GCD a variant computed for a pair
+ *
+ * @param variant Variant that computed it
+ * @param a First operand
+ * @param b Second operand
+ * @param gcd The variant's result
+ */
+void gcd_cache_store(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b, GcdInteger gcd)
+{
+    GcdCacheKey key;
+    GcdCacheShard *shard;
+    if (!cache_make_key(variant, a, b, &key) || (shard = cache_shard()) == NULL)
+    {
+        return;
+    }
+
+    GcdCacheEntry *entry = cache_slot_for(shard, &key);
+    if (cache_entry_matches(entry, &key) && entry->has_coefficients)
+    {
+        return; // Keep the coefficients an Extended GCD already paid for
+    }
+    *entry = (GcdCacheEntry){
+        .a = a,
+        .b = b,
+        .variant = key.variant,
+        .epoch = key.epoch,
+        .has_coefficients = false,
+        .gcd = gcd};
+}
+
+/**
+ * @brief Look up the GCD and Bezout coefficients a variant computed for a pair
+ *
+ * @param variant Variant that computed the entry
+ * @param a First operand
+ * @param b Second operand
+ * @param result Output result on a hit
+ * @return true on a hit
+ */
+bool gcd_cache_lookup_extended(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b, ExtendedGcdResult *result)
+{
+    GcdCacheKey key;
+    GcdCacheShard *shard;
+    if (result == NULL || !cache_make_key(variant, a, b, &key) || (shard = cache_shard()) == NULL)
+    {
+        return false;
+    }
+
+    GcdCacheEntry *entry = cache_find(shard, &key);
+    bool hit = entry != NULL && entry->has_coefficients;
+    cache_count(shard, hit);
+    if (!hit)
+    {
+        return false;
+    }
+
+    *result = EXTENDED_GCD_INIT(entry->gcd, entry->x, entry->y);
+    return true;
+}
+
+/**
+ * @brief Remember the GCD and Bezout coefficients a variant computed for a pair
+ *
+ * @param variant Variant that computed it
+ * @param a First operand
+ * @param b Second operand
+ * @param result Valid Extended GCD result of (a, b)
+ */
+void gcd_cache_store_extended(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b,
+                              const ExtendedGcdResult *result)
+{
+    GcdCacheKey key;
+    GcdCacheShard *shard;
+    if (result == NULL || !result->is_valid || !cache_make_key(variant, a, b, &key) || (shard = cache_shard()) == NULL)
+    {
+        return;
+    }
+
+    GcdCacheEntry *entry = cache_slot_for(shard, &key);
+    *entry = (GcdCacheEntry){
+        .a = a,
+        .b = b,
+        .variant = key.variant,
+        .epoch = key.epoch,
+        .has_coefficients = true,
+        .gcd = result->gcd,
+        .x = result->coefficient_x,
+        .y = result->coefficient_y};
+}
+
+// ============================================================================
+// STATISTICS
+// ============================================================================
+
+/**
+ * @brief Read the cache counters
+ *
+ * Shards not yet rebuilt since the last configure or clear still hold
+ * counts of the previous generation and are left out.
+ *
+ * @param stats Output statistics
+ */
+void gcd_cache_get_stats(GcdCacheStats *stats)
+{
+    if (stats == NULL)
+    {
+        return;
+    }
+
+    memory_clear(stats, sizeof(*stats));
+    stats->capacity = CACHE_LOAD(g_cache_capacity);
+    MathNatural generation = CACHE_LOAD(g_cache_generation);
+    MathNatural claimed = CACHE_LOAD(g_cache_claimed);
+    for (MathNatural i = 0; i < claimed; i++)
+    {
+        GcdCacheShard *shard = &g_cache_shards[i];
+        if (CACHE_LOAD(shard->generation) != generation || CACHE_LOAD(shard->capacity) == 0)
+        {
+            continue;
+        }
+        stats->shards++;
+        stats->hits += CACHE_LOAD(shard->hits);
+        stats->misses += CACHE_LOAD(shard->misses);
+        stats->evictions += CACHE_LOAD(shard->evictions);
+    }
+}
@@ -0,0 +1,161 @@
+/**
+ * @file gcd_cache.h
+ * @brief Bounded memo of GCD and Extended GCD results for repeated pairs
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Workloads that test the same moduli against a rotating set of
+ * candidates compute the same pairs over and over. The cache remembers
+ * recent results keyed on the variant and the pair exactly as given, and
+ * hands back exactly what that variant returned: variants disagree on
+ * the sign of the GCD of negative operands (Modulo follows C's %, Stein
+ * returns magnitudes), so a result is never shared across variants,
+ * operand order or signs.
+ *
+ * Each thread owns a shard: an open-addressed table probed over a short
+ * window and replaced round-robin when the window is full. Shards are
+ * never shared, so lookups and stores take no lock. The cache is off
+ * until gcd_cache_configure() gives it a capacity.
+ */
+
+#ifndef GCD_CACHE_H
+#define GCD_CACHE_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../domain_types.h"
+#include <stdbool.h>
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+/**
+ * @brief Largest shard capacity accepted by gcd_cache_configure
+ */
+#define GCD_CACHE_MAX_ENTRIES (1u << 20)
+
+/**
+ * @brief Slots examined per lookup, starting at the hashed slot
+ */
+#define GCD_CACHE_PROBE_WINDOW 4
+
+/**
+ * @brief Threads that get a shard; further threads run uncached
+ */
+#define GCD_CACHE_MAX_SHARDS 64
+
+/**
+ * @brief Enable the cache, resize it or turn it off
+ *
+ * Existing entries are dropped. Each thread's shard is rebuilt the next
+ * time that thread uses the cache.
+ *
+ * @param entries Entries per thread, rounded up to a power of two (0 disables)
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT above GCD_CACHE_MAX_ENTRIES
+ */
+MathStatus gcd_cache_configure(MathNatural entries);
+
+/**
+ * @brief Entries per thread shard
+ *
+ * @return Configured capacity (0 when the cache is off)
+ */
+MathNatural gcd_cache_get_capacity(void);
+
+/**
+ * @brief Drop every cached result and reset the counters
+ */
+void gcd_cache_clear(void);
+
+/**
+ * @brief Drop the results of one variant number, in every shard
+ *
+ * Called when a runtime variant is unregistered, so the implementation
+ * that next receives its number does not get the old one's results.
+ * Entries stop matching at once; their slots are reused as they are
+ * replaced.
+ *
+ * @param variant Variant whose entries are dropped
+ */
+void gcd_cache_invalidate_variant(GcdAlgorithmVariant variant);
+
+// ============================================================================
+// LOOKUP AND STORE
+// ============================================================================
+
+/**
+ * @brief Look up the GCD a variant computed for a pair
+ *
+ * Pairs with a zero operand are never cached.
+ *
+ * @param variant Variant that computed the entry
+ * @param a First operand
+ * @param b Second operand
+ * @param gcd Output GCD on a hit
+ * @return true on a hit
+ */
+bool gcd_cache_lookup(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b, GcdInteger *gcd);
+
+/**
+ * @brief Remember the GCD a variant computed for a pair
+ *
+ * @param variant Variant that computed it
+ * @param a First operand
+ * @param b Second operand
+ * @param gcd The variant's result
+ */
+void gcd_cache_store(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b, GcdInteger gcd);
+
+/**
+ * @brief Look up the GCD and Bezout coefficients a variant computed for a pair
+ *
+ * Entries stored by gcd_cache_store() have no coefficients and miss here.
+ *
+ * @param variant Variant that computed the entry
+ * @param a First operand
+ * @param b Second operand
+ * @param result Output result on a hit
+ * @return true on a hit
+ */
+bool gcd_cache_lookup_extended(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b, ExtendedGcdResult *result);
+
+/**
+ * @brief Remember the GCD and Bezout coefficients a variant computed for a pair
+ *
+ * The entry also answers plain GCD lookups for the same variant.
+ *
+ * @param variant Variant that computed it
+ * @param a First operand
+ * @param b Second operand
+ * @param result Valid Extended GCD result of (a, b)
+ */
+void gcd_cache_store_extended(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b,
+                              const ExtendedGcdResult *result);
+
+// ============================================================================
+// STATISTICS
+// ============================================================================
+
+/**
+ * @brief Cache counters summed over all shards
+ */
+typedef struct
+{
+    MathNatural capacity;  /**< Entries per shard (0 = disabled) */
+    MathNatural shards;    /**< Shards allocated */
+    MathNatural hits;      /**< Lookups answered from the cache */
+    MathNatural misses;    /**< Lookups that had to compute */
+    MathNatural evictions; /**< Entries replaced by a store into a full window */
+} GcdCacheStats;
+
+/**
+ * @brief Read the cache counters
+ *
+ * Counters are read without stopping the threads that update them, so a
+ * snapshot taken during a run may be a few operations behind.
+ *
+ * @param stats Output statistics
+ */
+void gcd_cache_get_stats(GcdCacheStats *stats);
+
+#endif // GCD_CACHE_H
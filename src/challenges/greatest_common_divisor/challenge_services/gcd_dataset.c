@@ -0,0 +1,271 @@
+/**
+ * @file gcd_dataset.c
+ * @brief Memory-mapped binary operand datasets and GCD result files
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Header fields are encoded byte by byte, so the header is portable
+ * whatever the host. Records are used in place, which is only correct on
+ * a little-endian host; opening or creating a dataset anywhere else fails
+ * instead of producing byte-swapped operands.
+ */
+
+#include "gcd_dataset.h"
+#include "../../../infrastructure/utilities/memory_utils.h"
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Largest layout value understood by this version
+ */
+#define GCD_DATASET_LAYOUT_MAX GCD_DATASET_VALUES
+
+// ============================================================================
+// FILE FORMAT
+// ============================================================================
+
+/**
+ * @brief Check whether raw records match the host byte order
+ */
+static bool gcd_dataset_host_is_little_endian(void)
+{
+    const uint16_t probe = 1;
+    return *(const unsigned char *)&probe == 1;
+}
+
+/**
+ * @brief Store the low bytes of a value in little-endian order
+ */
+static void gcd_dataset_store_le(unsigned char *out, uint64_t value, unsigned int bytes)
+{
+    for (unsigned int i = 0; i < bytes; i++)
+    {
+        out[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief Load a little-endian value of a few bytes
+ */
+static uint64_t gcd_dataset_load_le(const unsigned char *in, unsigned int bytes)
+{
+    uint64_t value = 0;
+    for (unsigned int i = 0; i < bytes; i++)
+    {
+        value |= (uint64_t)in[i] << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief Operands per record of a layout
+ */
+static MathNatural gcd_dataset_operands_per_record(GcdDatasetLayout layout)
+{
+    return layout == GCD_DATASET_VALUES ? 1 : 2;
+}
+
+/**
+ * @brief Encode a header into its 64-byte file representation
+ *
+ * @param header Header to encode
+ * @param out Destination of GCD_DATASET_HEADER_SIZE bytes
+ */
+void gcd_dataset_encode_header(const GcdDatasetHeader *header, unsigned char *out)
+{
+    memset(out, 0, GCD_DATASET_HEADER_SIZE);
+    memcpy(out, GCD_DATASET_MAGIC, 4);
+    gcd_dataset_store_le(out + 4, GCD_DATASET_VERSION, 2);
+    out[6] = (unsigned char)header->width_bits;
+    out[7] = (unsigned char)header->layout;
+    gcd_dataset_store_le(out + 8, header->count, 8);
+}
+
+/**
+ * @brief Decode and validate a header against the size of its file
+ *
+ * @param data First bytes of the file
+ * @param size File size in bytes
+ * @param header Output header
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_NOT_IMPLEMENTED
+ */
+MathStatus gcd_dataset_decode_header(const unsigned char *data, size_t size, GcdDatasetHeader *header)
+{
+    if (data == NULL || header == NULL || size < GCD_DATASET_HEADER_SIZE ||
+        memcmp(data, GCD_DATASET_MAGIC, 4) != 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    if (gcd_dataset_load_le(data + 4, 2) != GCD_DATASET_VERSION)
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+    if (data[7] > GCD_DATASET_LAYOUT_MAX)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    GcdDatasetHeader decoded = {
+        .count = gcd_dataset_load_le(data + 8, 8),
+        .width_bits = data[6],
+        .layout = (GcdDatasetLayout)data[7]};
+    if (decoded.width_bits != GCD_DATASET_WIDTH_BITS)
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // A truncated or padded file would put records where none were written
+    size_t expected_size;
+    if (gcd_dataset_file_size(&decoded, &expected_size) != MATH_SUCCESS || expected_size != size)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    *header = decoded;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Compute the size of a dataset file
+ *
+ * @param header Header describing the file
+ * @param size Output size in bytes, header included
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if it does not fit in size_t
+ */
+MathStatus gcd_dataset_file_size(const GcdDatasetHeader *header, size_t *size)
+{
+    if (header == NULL || size == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathNatural record_bytes = gcd_dataset_operands_per_record(header->layout) * (header->width_bits / 8);
+    MathNatural limit = (MathNatural)((size_t)-1 - GCD_DATASET_HEADER_SIZE);
+    if (record_bytes != 0 && header->count > limit / record_bytes)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    *size = GCD_DATASET_HEADER_SIZE + (size_t)(header->count * record_bytes);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Get a human-readable name for a layout
+ *
+ * @param layout Layout
+ * @return Layout name
+ */
+const char *gcd_dataset_layout_name(GcdDatasetLayout layout)
+{
+    switch (layout)
+    {
+    case GCD_DATASET_AOS:
+        return "AoS";
+    case GCD_DATASET_SOA:
+        return "SoA";
+    case GCD_DATASET_VALUES:
+        return "values";
+    default:
+        return "unknown";
+    }
+}
+
+// ============================================================================
+// MAPPED DATASETS
+// ============================================================================
+
+/**
+ * @brief Map an existing dataset for reading
+ *
+ * @param path File to open
+ * @param dataset Output dataset
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus gcd_dataset_open(const char *path, GcdDataset *dataset)
+{
+    if (path == NULL || dataset == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    memory_clear(dataset, sizeof(*dataset));
+    dataset->mapping.handle = -1; // Nothing to close if we fail before mapping
+
+    if (!gcd_dataset_host_is_little_endian())
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+    if (!platform_map_file_read(path, &dataset->mapping))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathStatus status = gcd_dataset_decode_header((const unsigned char *)dataset->mapping.data,
+                                                  dataset->mapping.size, &dataset->header);
+    if (status != MATH_SUCCESS)
+    {
+        platform_unmap_file(&dataset->mapping);
+        return status;
+    }
+
+    dataset->records = (GcdInteger *)((unsigned char *)dataset->mapping.data + GCD_DATASET_HEADER_SIZE);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Create a dataset file and map it for writing
+ *
+ * @param path File to create
+ * @param header Count, width and layout of the new file
+ * @param dataset Output dataset
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus gcd_dataset_create(const char *path, const GcdDatasetHeader *header, GcdDataset *dataset)
+{
+    if (path == NULL || header == NULL || dataset == NULL || header->layout > GCD_DATASET_LAYOUT_MAX)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    memory_clear(dataset, sizeof(*dataset));
+    dataset->mapping.handle = -1; // Nothing to close if we fail before mapping
+
+    if (header->width_bits != GCD_DATASET_WIDTH_BITS || !gcd_dataset_host_is_little_endian())
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+
+    size_t size;
+    MathStatus status = gcd_dataset_file_size(header, &size);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+    if (!platform_map_file_create(path, size, &dataset->mapping))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    unsigned char *base = (unsigned char *)dataset->mapping.data;
+    gcd_dataset_encode_header(header, base);
+    dataset->header = *header;
+    dataset->records = (GcdInteger *)(base + GCD_DATASET_HEADER_SIZE);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Unmap a dataset, committing the records of a created one
+ *
+ * @param dataset Dataset to close
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT if writing back failed
+ */
+MathStatus gcd_dataset_close(GcdDataset *dataset)
+{
+    if (dataset == NULL)
+    {
+        return MATH_SUCCESS;
+    }
+
+    bool ok = platform_unmap_file(&dataset->mapping);
+    dataset->records = NULL;
+    return ok ? MATH_SUCCESS : MATH_ERROR_INVALID_INPUT;
+}
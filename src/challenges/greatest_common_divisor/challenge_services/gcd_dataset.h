@@ -0,0 +1,166 @@
+/**
+ * @file gcd_dataset.h
+ * @brief Memory-mapped binary operand datasets and GCD result files
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * A dataset file is a 64-byte header followed by raw little-endian
+ * operands, so a mapped file can be handed to the batch API without
+ * parsing or copying. Header fields (all little-endian):
+ *
+ *   offset  size  field
+ *        0     4  magic "GCDS"
+ *        4     2  version (1)
+ *        6     1  operand width in bits (64)
+ *        7     1  layout (GcdDatasetLayout)
+ *        8     8  record count
+ *       16    48  reserved, zero
+ *
+ * Layouts:
+ * - AoS: count pairs stored as a0 b0 a1 b1 ...
+ * - SoA: count first operands, then count second operands
+ * - values: count single values; result files of the run command use it
+ *
+ * The payload starts on a 64-byte boundary of the mapping, which keeps
+ * every operand naturally aligned. Only 64-bit operands on little-endian
+ * hosts are supported for now: other widths are rejected as not
+ * implemented rather than silently converted.
+ */
+
+#ifndef GCD_DATASET_H
+#define GCD_DATASET_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../domain_types.h"
+#include "../../../infrastructure/platform/file_mapping.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// ============================================================================
+// FILE FORMAT
+// ============================================================================
+
+#define GCD_DATASET_MAGIC "GCDS"
+#define GCD_DATASET_VERSION 1
+#define GCD_DATASET_HEADER_SIZE 64
+#define GCD_DATASET_WIDTH_BITS 64
+
+/**
+ * @brief Arrangement of the records after the header
+ */
+typedef enum
+{
+    GCD_DATASET_AOS = 0,   /**< Interleaved pairs: a0 b0 a1 b1 ... */
+    GCD_DATASET_SOA = 1,   /**< All first operands, then all second operands */
+    GCD_DATASET_VALUES = 2 /**< One value per record (GCD results) */
+} GcdDatasetLayout;
+
+/**
+ * @brief Decoded dataset header
+ */
+typedef struct
+{
+    MathNatural count;       /**< Pairs (AoS, SoA) or values */
+    unsigned int width_bits; /**< Bits per operand */
+    GcdDatasetLayout layout; /**< Record arrangement */
+} GcdDatasetHeader;
+
+/**
+ * @brief Encode a header into its 64-byte file representation
+ *
+ * @param header Header to encode
+ * @param out Destination of GCD_DATASET_HEADER_SIZE bytes
+ */
+void gcd_dataset_encode_header(const GcdDatasetHeader *header, unsigned char *out);
+
+/**
+ * @brief Decode and validate a header against the size of its file
+ *
+ * @param data First bytes of the file
+ * @param size File size in bytes
+ * @param header Output header
+ * @return MATH_SUCCESS; MATH_ERROR_INVALID_INPUT for a file that is not a
+ *         dataset, has an unknown layout or whose size disagrees with the
+ *         count; MATH_ERROR_NOT_IMPLEMENTED for another version or width
+ */
+MathStatus gcd_dataset_decode_header(const unsigned char *data, size_t size, GcdDatasetHeader *header);
+
+/**
+ * @brief Compute the size of a dataset file
+ *
+ * @param header Header describing the file
+ * @param size Output size in bytes, header included
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if it does not fit in size_t
+ */
+MathStatus gcd_dataset_file_size(const GcdDatasetHeader *header, size_t *size);
+
+/**
+ * @brief Get a human-readable name for a layout
+ *
+ * @param layout Layout
+ * @return "AoS", "SoA", "values" or "unknown"
+ */
+const char *gcd_dataset_layout_name(GcdDatasetLayout layout);
+
+// ============================================================================
+// MAPPED DATASETS
+// ============================================================================
+
+/**
+ * @brief An open dataset file
+ */
+typedef struct
+{
+    PlatformFileMapping mapping; /**< Whole file */
+    GcdDatasetHeader header;     /**< Decoded header */
+    GcdInteger *records;         /**< First record (read-only for opened datasets) */
+} GcdDataset;
+
+/**
+ * @brief Map an existing dataset for reading
+ *
+ * @param path File to open
+ * @param dataset Output dataset
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT (unreadable file or bad
+ *         header) or MATH_ERROR_NOT_IMPLEMENTED (unsupported version, width
+ *         or a big-endian host)
+ */
+MathStatus gcd_dataset_open(const char *path, GcdDataset *dataset);
+
+/**
+ * @brief Create a dataset file and map it for writing
+ *
+ * The header is written immediately; records are filled in through
+ * dataset->records and reach the file when the dataset is closed.
+ *
+ * @param path File to create (truncated if it exists)
+ * @param header Count, width and layout of the new file
+ * @param dataset Output dataset
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT (file cannot be created),
+ *         MATH_ERROR_OVERFLOW or MATH_ERROR_NOT_IMPLEMENTED
+ */
+MathStatus gcd_dataset_create(const char *path, const GcdDatasetHeader *header, GcdDataset *dataset);
+
+/**
+ * @brief Unmap a dataset, committing the records of a created one
+ *
+ * @param dataset Dataset to close (NULL is ignored)
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT if writing back failed
+ */
+MathStatus gcd_dataset_close(GcdDataset *dataset);
+
+/**
+ * @brief Summary of one dataset run
+ */
+typedef struct
+{
+    MathNatural pairs;         /**< Pairs computed */
+    MathNatural failed;        /**< Pairs the algorithm rejected */
+    GcdDatasetLayout layout;   /**< Layout of the input */
+    MathNatural bytes_read;    /**< Size of the input file */
+    MathNatural bytes_written; /**< Size of the output file */
+    double compute_time_ms;    /**< Time spent in the batch API */
+    double execution_time_ms;  /**< Wall-clock time including mapping and unmapping */
+} GcdDatasetStats;
+
+#endif // GCD_DATASET_H
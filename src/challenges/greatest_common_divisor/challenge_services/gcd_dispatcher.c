@@ -0,0 +1,794 @@
+/**
+ * @file gcd_dispatcher.c
+ * @brief GCD_AUTO: per-input algorithm selection from a calibrated decision table
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The table is resolved into one kernel pointer per bucket when it is
+ * installed, so a dispatched call costs two bit scans, a few compares and
+ * an indirect call on top of the kernel itself. No candidate is ever run
+ * just to pick a winner.
+ */
+
+#include "gcd_dispatcher.h"
+#include "mdc_analyzer.h"
+#include "step_counter.h"
+#include "../solutions/euclidean_family/implementations/classic.h"
+#include "../solutions/euclidean_family/implementations/lehmer.h"
+#include "../solutions/euclidean_family/implementations/table_lookup.h"
+#include "../solutions/euclidean_family/implementations/recursive.h"
+#include "../solutions/binary_family/implementations/stein.h"
+#include "../solutions/euclidean_family/implementations/bignum_euclidean.h"
+#include "../solutions/euclidean_family/implementations/bignum_half_gcd.h"
+#include "../gcd_batch.h"
+#include "../gcd_inline.h"
+#include "../../../infrastructure/utilities/math_utils.h"
+#include "../../../infrastructure/utilities/memory_utils.h"
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief Bit length and trailing zeros of a non-zero 64-bit value
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define DISPATCH_BIT_LENGTH(x) (64u - (unsigned int)__builtin_clzll(x))
+#define DISPATCH_CTZ(x) ((unsigned int)__builtin_ctzll(x))
+#else
+#define DISPATCH_BIT_LENGTH(x) ((unsigned int)math_bit_length(x))
+#define DISPATCH_CTZ(x) ((unsigned int)math_count_trailing_zeros((MathInteger)(x)))
+#endif
+
+// ============================================================================
+// CANDIDATES
+// ============================================================================
+
+/**
+ * @brief Kernel run for a candidate variant (non-negative operands below 2^63)
+ */
+typedef struct
+{
+    GcdAlgorithmVariant variant;
+    GcdAlgorithmFunc kernel;
+} DispatchCandidate;
+
+static const DispatchCandidate DISPATCH_CANDIDATES[] = {
+    {GCD_EUCLIDEAN_MODULO, mdc_modulo},
+    {GCD_EUCLIDEAN_DIVISION, mdc_divisao},
+    {GCD_EUCLIDEAN_LEHMER, mdc_lehmer},
+    {GCD_EUCLIDEAN_TABLE, mdc_table},
+    {GCD_RECURSIVE_MODULO, mdc_mod},
+    {GCD_BINARY_STEIN, mdc_stein},
+    {GCD_BINARY_STEIN_CTZ, mdc_stein_ctz}};
+
+#define DISPATCH_CANDIDATE_COUNT (sizeof(DISPATCH_CANDIDATES) / sizeof(DISPATCH_CANDIDATES[0]))
+
+/**
+ * @brief Kernel of a candidate variant
+ *
+ * @return Kernel, or NULL if the variant is not a candidate
+ */
+static GcdAlgorithmFunc dispatch_kernel(GcdAlgorithmVariant variant)
+{
+    for (MathNatural i = 0; i < DISPATCH_CANDIDATE_COUNT; i++)
+    {
+        if (DISPATCH_CANDIDATES[i].variant == variant)
+        {
+            return DISPATCH_CANDIDATES[i].kernel;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Check whether a variant can be chosen by the dispatcher
+ *
+ * @param variant Variant to check
+ * @return true if the variant may appear in a decision table
+ */
+bool gcd_dispatch_is_candidate(GcdAlgorithmVariant variant)
+{
+    return dispatch_kernel(variant) != NULL;
+}
+
+/**
+ * @brief List the dispatcher candidates
+ *
+ * @param variants Array to store variants
+ * @param max_variants Capacity of variants
+ * @return Number of candidates returned
+ */
+MathNatural gcd_dispatch_list_candidates(GcdAlgorithmVariant *variants, MathNatural max_variants)
+{
+    if (variants == NULL)
+    {
+        return 0;
+    }
+
+    MathNatural count = 0;
+    for (; count < DISPATCH_CANDIDATE_COUNT && count < max_variants; count++)
+    {
+        variants[count] = DISPATCH_CANDIDATES[count].variant;
+    }
+    return count;
+}
+
+// ============================================================================
+// DISPATCH STATE
+// ============================================================================
+
+/**
+ * @brief Built-in choices: the lookup table for tiny pairs, modulo where the
+ *        first division does most of the work (skewed pairs), the ctz binary
+ *        GCD elsewhere
+ */
+#define DISPATCH_DEFAULT_CHOICES {                                                       \
+    GCD_EUCLIDEAN_TABLE, GCD_BINARY_STEIN_CTZ, GCD_EUCLIDEAN_MODULO, GCD_BINARY_STEIN_CTZ, \
+    GCD_BINARY_STEIN_CTZ}
+
+#define DISPATCH_DEFAULT_KERNELS {mdc_table, mdc_stein_ctz, mdc_modulo, mdc_stein_ctz, mdc_stein_ctz}
+
+#define DISPATCH_DEFAULT_THRESHOLDS {                                                          \
+    .tiny_bits = GCD_DISPATCH_TINY_BITS, .two_adic_zeros = GCD_DISPATCH_TWO_ADIC_ZEROS,        \
+    .skew_bits = GCD_DISPATCH_SKEW_BITS, .word32_bits = GCD_DISPATCH_WORD32_BITS,              \
+    .half_gcd_bits = GCD_DISPATCH_HALF_GCD_BITS}
+
+/**
+ * @brief Installed table and the kernel resolved for each bucket
+ */
+typedef struct
+{
+    GcdDispatchTable table;
+    GcdAlgorithmFunc kernels[GCD_DISPATCH_BUCKET_COUNT];
+} GcdDispatchState;
+
+// Statically initialized, so the hot path never checks for a missing table
+static GcdDispatchState g_dispatch = {
+    .table = {.choice = DISPATCH_DEFAULT_CHOICES, .thresholds = DISPATCH_DEFAULT_THRESHOLDS, .calibrated = false},
+    .kernels = DISPATCH_DEFAULT_KERNELS};
+
+// ============================================================================
+// INPUT BUCKETS
+// ============================================================================
+
+/**
+ * @brief Check that thresholds describe non-empty buckets
+ *
+ * @param thresholds Thresholds to check
+ * @return true if every bucket can be reached
+ */
+bool gcd_dispatch_thresholds_valid(const GcdDispatchThresholds *thresholds)
+{
+    // The limits keep every bucket wide enough for gcd_dispatch_generate_pairs
+    return thresholds != NULL &&
+           thresholds->tiny_bits >= 1 && thresholds->tiny_bits < thresholds->word32_bits &&
+           thresholds->word32_bits <= 62 &&
+           thresholds->skew_bits >= 1 && thresholds->tiny_bits + thresholds->skew_bits <= 62 &&
+           thresholds->two_adic_zeros >= 2 && thresholds->two_adic_zeros <= 100 &&
+           thresholds->half_gcd_bits >= 64;
+}
+
+/**
+ * @brief Classify an operand pair
+ *
+ * @param a First operand (any sign)
+ * @param b Second operand (any sign)
+ * @return Bucket of the pair
+ */
+GcdDispatchBucket gcd_dispatch_classify(GcdInteger a, GcdInteger b)
+{
+    const GcdDispatchThresholds *limits = &g_dispatch.table.thresholds;
+
+    // Unsigned negation keeps LLONG_MIN well defined
+    MathNatural u = a < 0 ? 0 - (MathNatural)a : (MathNatural)a;
+    MathNatural v = b < 0 ? 0 - (MathNatural)b : (MathNatural)b;
+
+    unsigned int bits_u = u != 0 ? DISPATCH_BIT_LENGTH(u) : 0;
+    unsigned int bits_v = v != 0 ? DISPATCH_BIT_LENGTH(v) : 0;
+    unsigned int max_bits = MATH_MAX(bits_u, bits_v);
+    if (max_bits <= limits->tiny_bits)
+    {
+        return GCD_DISPATCH_TINY;
+    }
+
+    unsigned int zeros = (u != 0 ? DISPATCH_CTZ(u) : 0) + (v != 0 ? DISPATCH_CTZ(v) : 0);
+    if (zeros >= limits->two_adic_zeros)
+    {
+        return GCD_DISPATCH_TWO_ADIC;
+    }
+
+    // The bit-length gap is the order of magnitude of the first quotient
+    unsigned int gap = max_bits - MATH_MIN(bits_u, bits_v);
+    if (gap >= limits->skew_bits)
+    {
+        return GCD_DISPATCH_SKEWED;
+    }
+
+    return max_bits <= limits->word32_bits ? GCD_DISPATCH_BALANCED_32 : GCD_DISPATCH_BALANCED_64;
+}
+
+/**
+ * @brief Short name of a bucket (used in tables and the persisted file)
+ *
+ * @param bucket Bucket
+ * @return Name such as "skewed", or "unknown"
+ */
+const char *gcd_dispatch_bucket_name(GcdDispatchBucket bucket)
+{
+    switch (bucket)
+    {
+    case GCD_DISPATCH_TINY:
+        return "tiny";
+    case GCD_DISPATCH_TWO_ADIC:
+        return "two-adic";
+    case GCD_DISPATCH_SKEWED:
+        return "skewed";
+    case GCD_DISPATCH_BALANCED_32:
+        return "balanced32";
+    case GCD_DISPATCH_BALANCED_64:
+        return "balanced64";
+    default:
+        return "unknown";
+    }
+}
+
+/**
+ * @brief Random value with exactly the given bit length (1..63)
+ */
+static GcdInteger dispatch_random_bits(GcdRandom *rng, unsigned int bits)
+{
+    MathNatural low = 1ull << (bits - 1);
+    return (GcdInteger)gcd_random_range(rng, low, low + (low - 1));
+}
+
+/**
+ * @brief Fill arrays with operand pairs representative of a bucket
+ *
+ * @param bucket Bucket to draw from
+ * @param rng Generator (advanced by the call)
+ * @param a Array receiving the first operands
+ * @param b Array receiving the second operands
+ * @param n Number of pairs
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus gcd_dispatch_generate_pairs(GcdDispatchBucket bucket, GcdRandom *rng,
+                                       GcdInteger *a, GcdInteger *b, MathNatural n)
+{
+    if (rng == NULL || a == NULL || b == NULL || bucket >= GCD_DISPATCH_BUCKET_COUNT)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    const GcdDispatchThresholds *limits = &g_dispatch.table.thresholds;
+    for (MathNatural i = 0; i < n; i++)
+    {
+        // Draws that land in an earlier bucket (e.g. balanced pairs with many
+        // trailing zeros) are rare and simply redrawn
+        do
+        {
+            switch (bucket)
+            {
+            case GCD_DISPATCH_TINY:
+                a[i] = (GcdInteger)gcd_random_range(rng, 1, (1ull << limits->tiny_bits) - 1);
+                b[i] = (GcdInteger)gcd_random_range(rng, 1, (1ull << limits->tiny_bits) - 1);
+                break;
+
+            case GCD_DISPATCH_TWO_ADIC:
+            {
+                // Each operand carries at least half of the required zeros
+                unsigned int low = (limits->two_adic_zeros + 1) / 2;
+                unsigned int high = MATH_MIN(low + 16, 60u);
+                unsigned int shift_a = (unsigned int)gcd_random_range(rng, low, high);
+                unsigned int shift_b = (unsigned int)gcd_random_range(rng, low, high);
+                a[i] = (GcdInteger)((gcd_random_range(rng, 0, (1ull << (62 - shift_a)) - 1) | 1) << shift_a);
+                b[i] = (GcdInteger)((gcd_random_range(rng, 0, (1ull << (62 - shift_b)) - 1) | 1) << shift_b);
+                break;
+            }
+
+            case GCD_DISPATCH_SKEWED:
+            {
+                unsigned int bits = (unsigned int)gcd_random_range(rng, limits->tiny_bits + limits->skew_bits, 63);
+                unsigned int gap = (unsigned int)gcd_random_range(rng, limits->skew_bits, bits - 1);
+                a[i] = dispatch_random_bits(rng, bits);
+                b[i] = dispatch_random_bits(rng, bits - gap);
+                break;
+            }
+
+            case GCD_DISPATCH_BALANCED_32:
+            case GCD_DISPATCH_BALANCED_64:
+            {
+                unsigned int low = bucket == GCD_DISPATCH_BALANCED_32 ? limits->tiny_bits + 1
+                                                                      : limits->word32_bits + 1;
+                unsigned int high = bucket == GCD_DISPATCH_BALANCED_32 ? limits->word32_bits : 63;
+                unsigned int bits = (unsigned int)gcd_random_range(rng, low, high);
+                unsigned int gap = (unsigned int)gcd_random_range(rng, 0, limits->skew_bits - 1);
+                a[i] = dispatch_random_bits(rng, bits);
+                b[i] = dispatch_random_bits(rng, bits > gap ? bits - gap : 1);
+                break;
+            }
+
+            default:
+                return MATH_ERROR_INVALID_INPUT;
+            }
+        } while (gcd_dispatch_classify(a[i], b[i]) != bucket);
+    }
+
+    return MATH_SUCCESS;
+}
+
+// ============================================================================
+// DECISION TABLE
+// ============================================================================
+
+/**
+ * @brief Fill a table with the built-in defaults
+ *
+ * @param table Table to fill
+ */
+void gcd_dispatch_default_table(GcdDispatchTable *table)
+{
+    if (table == NULL)
+    {
+        return;
+    }
+
+    static const GcdAlgorithmVariant defaults[GCD_DISPATCH_BUCKET_COUNT] = DISPATCH_DEFAULT_CHOICES;
+    static const GcdDispatchThresholds default_thresholds = DISPATCH_DEFAULT_THRESHOLDS;
+    memory_clear(table, sizeof(*table));
+    for (MathNatural i = 0; i < GCD_DISPATCH_BUCKET_COUNT; i++)
+    {
+        table->choice[i] = defaults[i];
+    }
+    table->thresholds = default_thresholds;
+}
+
+/**
+ * @brief Install a decision table (copied)
+ *
+ * @param table Table to install (NULL = built-in defaults)
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT if a choice is not a
+ *         candidate or the thresholds are invalid
+ */
+MathStatus gcd_dispatch_set_table(const GcdDispatchTable *table)
+{
+    GcdDispatchTable defaults;
+    if (table == NULL)
+    {
+        gcd_dispatch_default_table(&defaults);
+        table = &defaults;
+    }
+
+    if (!gcd_dispatch_thresholds_valid(&table->thresholds))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    GcdAlgorithmFunc kernels[GCD_DISPATCH_BUCKET_COUNT];
+    for (MathNatural i = 0; i < GCD_DISPATCH_BUCKET_COUNT; i++)
+    {
+        kernels[i] = dispatch_kernel(table->choice[i]);
+        if (kernels[i] == NULL)
+        {
+            return MATH_ERROR_INVALID_INPUT;
+        }
+    }
+
+    g_dispatch.table = *table;
+    memcpy(g_dispatch.kernels, kernels, sizeof(kernels));
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Decision table in use
+ *
+ * @return Current table (built-in defaults until one is installed)
+ */
+const GcdDispatchTable *gcd_dispatch_get_table(void)
+{
+    return &g_dispatch.table;
+}
+
+/**
+ * @brief Variant the dispatcher runs for an operand pair
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @return Chosen variant
+ */
+GcdAlgorithmVariant gcd_dispatch_select(GcdInteger a, GcdInteger b)
+{
+    return g_dispatch.table.choice[gcd_dispatch_classify(a, b)];
+}
+
+/**
+ * @brief Run the kernel the dispatcher chooses for a pair
+ *
+ * @param a First operand (positive, below 2^63)
+ * @param b Second operand (positive, below 2^63)
+ * @return gcd(a, b)
+ */
+GcdInteger gcd_dispatch_gcd(GcdInteger a, GcdInteger b)
+{
+    return g_dispatch.kernels[gcd_dispatch_classify(a, b)](a, b);
+}
+
+// ============================================================================
+// PERSISTENCE
+// ============================================================================
+
+/**
+ * @brief Threshold field named in a profile line
+ *
+ * @return Field, or NULL if the name is unknown
+ */
+static unsigned int *dispatch_threshold_field(GcdDispatchThresholds *thresholds, const char *name)
+{
+    if (strcmp(name, "tiny_bits") == 0)
+    {
+        return &thresholds->tiny_bits;
+    }
+    if (strcmp(name, "two_adic_zeros") == 0)
+    {
+        return &thresholds->two_adic_zeros;
+    }
+    if (strcmp(name, "skew_bits") == 0)
+    {
+        return &thresholds->skew_bits;
+    }
+    if (strcmp(name, "word32_bits") == 0)
+    {
+        return &thresholds->word32_bits;
+    }
+    if (strcmp(name, "half_gcd_bits") == 0)
+    {
+        return &thresholds->half_gcd_bits;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bucket of a profile line
+ *
+ * @return Bucket, or GCD_DISPATCH_BUCKET_COUNT if the name is unknown
+ */
+static GcdDispatchBucket dispatch_find_bucket(const char *name)
+{
+    for (MathNatural i = 0; i < GCD_DISPATCH_BUCKET_COUNT; i++)
+    {
+        if (strcmp(name, gcd_dispatch_bucket_name((GcdDispatchBucket)i)) == 0)
+        {
+            return (GcdDispatchBucket)i;
+        }
+    }
+    return GCD_DISPATCH_BUCKET_COUNT;
+}
+
+/**
+ * @brief Write a decision table as text
+ *
+ * @param table Table to save
+ * @param path Destination file
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT (unwritable file)
+ */
+MathStatus gcd_dispatch_save(const GcdDispatchTable *table, const char *path)
+{
+    if (table == NULL || path == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    fprintf(file, "# gcd_analyzer dispatch table: <bucket> <median ns> <algorithm>\n");
+    fprintf(file, "cpu %s\n", table->cpu[0] != '\0' ? table->cpu : "unknown");
+    fprintf(file, "calibrated %d\n", table->calibrated ? 1 : 0);
+    fprintf(file, "threshold tiny_bits %u\n", table->thresholds.tiny_bits);
+    fprintf(file, "threshold two_adic_zeros %u\n", table->thresholds.two_adic_zeros);
+    fprintf(file, "threshold skew_bits %u\n", table->thresholds.skew_bits);
+    fprintf(file, "threshold word32_bits %u\n", table->thresholds.word32_bits);
+    fprintf(file, "threshold half_gcd_bits %u\n", table->thresholds.half_gcd_bits);
+    for (MathNatural i = 0; i < GCD_DISPATCH_BUCKET_COUNT; i++)
+    {
+        fprintf(file, "%s %.3f %s\n", gcd_dispatch_bucket_name((GcdDispatchBucket)i), table->median_ns[i],
+                mdc_analyzer_get_algorithm_name(table->choice[i]));
+    }
+    for (MathNatural i = 0; i < GCD_DISPATCH_BUCKET_COUNT; i++)
+    {
+        for (MathNatural c = 0; c < DISPATCH_CANDIDATE_COUNT; c++)
+        {
+            GcdAlgorithmVariant variant = DISPATCH_CANDIDATES[c].variant;
+            if (table->cost_ns[i][variant] > 0.0)
+            {
+                fprintf(file, "cost %s %.3f %s\n", gcd_dispatch_bucket_name((GcdDispatchBucket)i),
+                        table->cost_ns[i][variant], mdc_analyzer_get_algorithm_name(variant));
+            }
+        }
+    }
+
+    return fclose(file) == 0 ? MATH_SUCCESS : MATH_ERROR_INVALID_INPUT;
+}
+
+/**
+ * @brief Candidate whose algorithm name matches
+ *
+ * @return true if found
+ */
+static bool dispatch_find_candidate(const char *name, GcdAlgorithmVariant *variant)
+{
+    for (MathNatural i = 0; i < DISPATCH_CANDIDATE_COUNT; i++)
+    {
+        if (strcmp(mdc_analyzer_get_algorithm_name(DISPATCH_CANDIDATES[i].variant), name) == 0)
+        {
+            *variant = DISPATCH_CANDIDATES[i].variant;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Read a decision table written by gcd_dispatch_save
+ *
+ * @param path Source file
+ * @param table Output table
+ * @return MATH_SUCCESS, MATH_ERROR_NO_SOLUTION (file cannot be opened) or
+ *         MATH_ERROR_INVALID_INPUT (unknown bucket, threshold or algorithm)
+ */
+MathStatus gcd_dispatch_load(const char *path, GcdDispatchTable *table)
+{
+    if (path == NULL || table == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        return MATH_ERROR_NO_SOLUTION;
+    }
+
+    gcd_dispatch_default_table(table);
+    MathStatus status = MATH_SUCCESS;
+    char line[160];
+
+    while (status == MATH_SUCCESS && fgets(line, sizeof(line), file) != NULL)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || line[0] == '\0')
+        {
+            continue;
+        }
+
+        if (strncmp(line, "cpu ", 4) == 0)
+        {
+            memory_safe_strcpy(table->cpu, line + 4, sizeof(table->cpu));
+            continue;
+        }
+
+        int flag;
+        if (sscanf(line, "calibrated %d", &flag) == 1)
+        {
+            table->calibrated = flag != 0;
+            continue;
+        }
+
+        char name[24];
+        unsigned int value;
+        if (sscanf(line, "threshold %23s %u", name, &value) == 2)
+        {
+            unsigned int *field = dispatch_threshold_field(&table->thresholds, name);
+            if (field == NULL)
+            {
+                status = MATH_ERROR_INVALID_INPUT;
+                break;
+            }
+            *field = value;
+            continue;
+        }
+
+        // "cost" lines fill the cost curves, bucket lines the choices
+        bool is_cost = strncmp(line, "cost ", 5) == 0;
+        char algorithm[MATH_MAX_NAME_LENGTH];
+        double median_ns;
+        if (sscanf(is_cost ? line + 5 : line, "%23s %lf %63[^\n]", name, &median_ns, algorithm) != 3)
+        {
+            status = MATH_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        GcdDispatchBucket bucket = dispatch_find_bucket(name);
+        GcdAlgorithmVariant variant;
+        if (bucket == GCD_DISPATCH_BUCKET_COUNT || !dispatch_find_candidate(algorithm, &variant))
+        {
+            status = MATH_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        if (is_cost)
+        {
+            table->cost_ns[bucket][variant] = median_ns;
+        }
+        else
+        {
+            table->choice[bucket] = variant;
+            table->median_ns[bucket] = median_ns;
+        }
+    }
+
+    fclose(file);
+    if (status == MATH_SUCCESS && !gcd_dispatch_thresholds_valid(&table->thresholds))
+    {
+        status = MATH_ERROR_INVALID_INPUT;
+    }
+    return status;
+}
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Validate input for the dispatcher
+ *
+ * @param input Input parameters
+ * @return true if input is valid
+ */
+static bool gcd_auto_validate(const MathBinaryInput *input)
+{
+    // Every candidate accepts any pair once it is reduced to absolute values
+    return input != NULL;
+}
+
+/**
+ * @brief Execute the dispatcher with interface
+ *
+ * @param input Input parameters
+ * @return MathResult of the chosen kernel
+ */
+MathResult gcd_auto_compute(const MathBinaryInput *input)
+{
+    if (!gcd_auto_validate(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    // Handle special cases first
+    MathResult special_result;
+    if (math_handle_gcd_special_cases(input->operand_a, input->operand_b, &special_result))
+    {
+        return special_result;
+    }
+
+    MathInteger abs_a, abs_b;
+    if (math_safe_abs(input->operand_a, &abs_a) != MATH_SUCCESS ||
+        math_safe_abs(input->operand_b, &abs_b) != MATH_SUCCESS)
+    {
+        return math_create_error_result(MATH_ERROR_OVERFLOW, 0, 0.0);
+    }
+
+    // Classification is timed too: it is part of the cost of dispatching
+    GCD_STEPS_BEGIN();
+    double start_time = math_get_time_ms();
+    GcdInteger result = g_dispatch.kernels[gcd_dispatch_classify(abs_a, abs_b)](abs_a, abs_b);
+    double end_time = math_get_time_ms();
+
+    return math_create_success_result(result, GCD_STEPS_END(), math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Dispatcher kernel of the batch loop: classify the pair, run its kernel
+ */
+static GcdInteger gcd_auto_batch_kernel(GcdInteger a, GcdInteger b)
+{
+    if (a == 0 || b == 0)
+    {
+        return a | b;
+    }
+    return g_dispatch.kernels[gcd_dispatch_classify(a, b)](a, b);
+}
+
+/**
+ * @brief Execute the dispatcher over a batch, choosing a kernel per pair
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult gcd_auto_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run(input, gcd_auto_batch_kernel);
+}
+
+/**
+ * @brief Execute the dispatcher on unsigned operands
+ *
+ * @param input Unsigned operands
+ * @return MathUnsignedResult of the chosen kernel
+ */
+MathUnsignedResult gcd_auto_compute_unsigned(const MathUnsignedBinaryInput *input)
+{
+    if (input == NULL)
+    {
+        return math_create_unsigned_error_result(MATH_ERROR_INVALID_INPUT);
+    }
+
+    MathWideNatural a = input->operand_a;
+    MathWideNatural b = input->operand_b;
+    MathWideNatural result;
+    double start_time = math_get_time_ms();
+    if (a == 0 || b == 0)
+    {
+        result = a | b;
+    }
+    else if (((a | b) >> 63) == 0)
+    {
+        // Both below 2^63: the bucket's kernel, as for signed operands
+        result = (MathWideNatural)g_dispatch.kernels[gcd_dispatch_classify((GcdInteger)a, (GcdInteger)b)](
+            (GcdInteger)a, (GcdInteger)b);
+    }
+    else
+    {
+        result = gcd_inline_stein_wide(a, b);
+    }
+    double end_time = math_get_time_ms();
+
+    return math_create_unsigned_result(result, 0, math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Bignum kernel of GCD_AUTO: Lehmer or Extended Euclid below the
+ *        half-GCD crossover, the half-GCD from there on
+ */
+static MathStatus dispatch_gcd_big(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps)
+{
+    if (input == NULL || input->operand_a == NULL || input->operand_b == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathNatural smaller = MATH_MIN(bignum_bit_length(input->operand_a), bignum_bit_length(input->operand_b));
+    if (smaller >= g_dispatch.table.thresholds.half_gcd_bits)
+    {
+        return mdc_big_half_gcd(input, scratch, steps);
+    }
+    if (input->coefficient_x != NULL || input->coefficient_y != NULL)
+    {
+        return mdc_big_extended(input, scratch, steps);
+    }
+    return mdc_big_lehmer(input, scratch, steps);
+}
+
+/**
+ * @brief Execute the dispatcher on big operands
+ *
+ * @param input Arbitrary-precision input
+ * @return MathResult of the chosen kernel
+ */
+MathResult gcd_auto_compute_big(const MathBigBinaryInput *input)
+{
+    return bignum_run_gcd_kernel(dispatch_gcd_big, input);
+}
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (Global Variable)
+// ============================================================================
+
+/**
+ * @brief Implementation specification of GCD_AUTO
+ */
+ImplementationSpec gcd_auto_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Auto Dispatch",
+        "Chooses a kernel per input from bit lengths, trailing zeros and size gap via a calibrated table",
+        ALGORITHM_FAMILY_ADAPTIVE,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = gcd_auto_compute,
+    .validate = gcd_auto_validate,
+    .compute_batch = gcd_auto_compute_batch,
+    .compute_unsigned = gcd_auto_compute_unsigned,
+    .compute_big = gcd_auto_compute_big,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
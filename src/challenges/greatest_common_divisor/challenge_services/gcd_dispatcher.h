@@ -0,0 +1,295 @@
+/**
+ * @file gcd_dispatcher.h
+ * @brief GCD_AUTO: per-input algorithm selection from a calibrated decision table
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The dispatcher sorts an operand pair into a bucket using features that
+ * cost a few instructions (bit lengths, trailing zeros and the bit-length
+ * gap as an estimate of the first quotient) and runs the kernel the
+ * decision table names for that bucket. The table starts from built-in
+ * defaults; gcd_suite_calibrate_dispatch measures every candidate on
+ * every bucket of the running machine, and the result can be saved and
+ * loaded so later processes skip the measurement.
+ *
+ * A saved table is the per-host profile: besides the choices it keeps the
+ * bucket thresholds and the measured cost of every candidate per bucket.
+ *
+ * Big operands are dispatched on size alone: Lehmer (Extended Euclid when
+ * coefficients are wanted) below the half-GCD crossover, the half-GCD from
+ * there on. The crossover is a threshold of the profile like the others.
+ */
+
+#ifndef GCD_DISPATCHER_H
+#define GCD_DISPATCHER_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../../../core/interfaces/implementation_interface.h"
+#include "../domain_types.h"
+#include "input_generators.h"
+
+// ============================================================================
+// INPUT BUCKETS
+// ============================================================================
+
+/**
+ * @brief Built-in bucket thresholds on the operand features (a profile may override them)
+ */
+#define GCD_DISPATCH_TINY_BITS 8         /**< Larger operand below 2^8: a handful of steps */
+#define GCD_DISPATCH_TWO_ADIC_ZEROS 16   /**< Trailing zeros of both operands together */
+#define GCD_DISPATCH_SKEW_BITS 8         /**< Bit-length gap: first quotient of 2^8 or more */
+#define GCD_DISPATCH_WORD32_BITS 32      /**< Balanced operands up to 32 bits */
+#define GCD_DISPATCH_HALF_GCD_BITS 16384 /**< Smaller big operand from which the half-GCD beats Lehmer */
+
+/**
+ * @brief Bucket thresholds in use
+ */
+typedef struct
+{
+    unsigned int tiny_bits;      /**< Tiny: larger operand of at most this many bits */
+    unsigned int two_adic_zeros; /**< Two-adic: at least this many trailing zeros in total */
+    unsigned int skew_bits;      /**< Skewed: bit-length gap of at least this much */
+    unsigned int word32_bits;    /**< Balanced32: larger operand of at most this many bits */
+    unsigned int half_gcd_bits;  /**< Big operands: half-GCD once the smaller has this many bits */
+} GcdDispatchThresholds;
+
+/**
+ * @brief Input buckets of the decision table, tested in this order
+ */
+typedef enum
+{
+    GCD_DISPATCH_TINY,        /**< Both operands below 2^GCD_DISPATCH_TINY_BITS */
+    GCD_DISPATCH_TWO_ADIC,    /**< Many factors of two (Stein strips them in one shift) */
+    GCD_DISPATCH_SKEWED,      /**< Very different sizes (one division removes the gap) */
+    GCD_DISPATCH_BALANCED_32, /**< Similar sizes, up to 32 bits */
+    GCD_DISPATCH_BALANCED_64, /**< Similar sizes, above 32 bits */
+    GCD_DISPATCH_BUCKET_COUNT
+} GcdDispatchBucket;
+
+/**
+ * @brief Check that thresholds describe non-empty buckets
+ *
+ * Requires 1 <= tiny_bits < word32_bits <= 62, tiny_bits + skew_bits <= 62,
+ * skew_bits >= 1 and 2 <= two_adic_zeros <= 100.
+ *
+ * @param thresholds Thresholds to check
+ * @return true if every bucket can be reached
+ */
+bool gcd_dispatch_thresholds_valid(const GcdDispatchThresholds *thresholds);
+
+/**
+ * @brief Classify an operand pair with the installed thresholds
+ *
+ * @param a First operand (any sign)
+ * @param b Second operand (any sign)
+ * @return Bucket of the pair
+ */
+GcdDispatchBucket gcd_dispatch_classify(GcdInteger a, GcdInteger b);
+
+/**
+ * @brief Short name of a bucket (used in tables and the persisted file)
+ *
+ * @param bucket Bucket
+ * @return Name such as "skewed", or "unknown"
+ */
+const char *gcd_dispatch_bucket_name(GcdDispatchBucket bucket);
+
+/**
+ * @brief Fill arrays with operand pairs representative of a bucket
+ *
+ * Every generated pair classifies into the requested bucket under the
+ * installed thresholds.
+ *
+ * @param bucket Bucket to draw from
+ * @param rng Generator (advanced by the call)
+ * @param a Array receiving the first operands
+ * @param b Array receiving the second operands
+ * @param n Number of pairs
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus gcd_dispatch_generate_pairs(GcdDispatchBucket bucket, GcdRandom *rng,
+                                       GcdInteger *a, GcdInteger *b, MathNatural n);
+
+// ============================================================================
+// DECISION TABLE
+// ============================================================================
+
+/**
+ * @brief Maximum length of the CPU model recorded with a calibrated table
+ */
+#define GCD_DISPATCH_CPU_LENGTH 64
+
+/**
+ * @brief Algorithm chosen for each bucket, with the measurements behind it
+ */
+typedef struct
+{
+    GcdAlgorithmVariant choice[GCD_DISPATCH_BUCKET_COUNT]; /**< Variant run for each bucket */
+    double median_ns[GCD_DISPATCH_BUCKET_COUNT];           /**< Measured cost of the choice (0 = default) */
+    GcdDispatchThresholds thresholds;                      /**< Bucket boundaries */
+    bool calibrated;                                       /**< Measured on this machine */
+    char cpu[GCD_DISPATCH_CPU_LENGTH];                     /**< CPU model the table was measured on */
+
+    /** Cost curve of every variant: median ns per bucket (0 = not measured) */
+    double cost_ns[GCD_DISPATCH_BUCKET_COUNT][GCD_VARIANT_COUNT];
+} GcdDispatchTable;
+
+/**
+ * @brief Check whether a variant can be chosen by the dispatcher
+ *
+ * Candidates are the plain 64-bit kernels. Subtraction variants (linear
+ * on skewed inputs), extended variants (extra coefficient work), the SIMD
+ * kernel (only faster across lanes) and the bignum variants are excluded.
+ *
+ * @param variant Variant to check
+ * @return true if the variant may appear in a decision table
+ */
+bool gcd_dispatch_is_candidate(GcdAlgorithmVariant variant);
+
+/**
+ * @brief List the dispatcher candidates
+ *
+ * @param variants Array to store variants
+ * @param max_variants Capacity of variants
+ * @return Number of candidates returned
+ */
+MathNatural gcd_dispatch_list_candidates(GcdAlgorithmVariant *variants, MathNatural max_variants);
+
+/**
+ * @brief Fill a table with the built-in defaults
+ *
+ * The lookup table for tiny pairs, modulo for skewed pairs, the ctz binary
+ * GCD elsewhere, and the GCD_DISPATCH_* thresholds.
+ *
+ * @param table Table to fill
+ */
+void gcd_dispatch_default_table(GcdDispatchTable *table);
+
+/**
+ * @brief Install a decision table (copied)
+ *
+ * @param table Table to install (NULL = built-in defaults)
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT if a choice is not a
+ *         candidate or the thresholds are invalid
+ */
+MathStatus gcd_dispatch_set_table(const GcdDispatchTable *table);
+
+/**
+ * @brief Decision table in use
+ *
+ * @return Current table (built-in defaults until one is installed)
+ */
+const GcdDispatchTable *gcd_dispatch_get_table(void);
+
+/**
+ * @brief Variant the dispatcher runs for an operand pair
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @return Chosen variant
+ */
+GcdAlgorithmVariant gcd_dispatch_select(GcdInteger a, GcdInteger b);
+
+/**
+ * @brief Run the kernel the dispatcher chooses for a pair
+ *
+ * Bare kernel of GCD_AUTO for production mode: no validation, no special
+ * cases, no timing.
+ *
+ * @param a First operand (positive, below 2^63)
+ * @param b Second operand (positive, below 2^63)
+ * @return gcd(a, b)
+ */
+GcdInteger gcd_dispatch_gcd(GcdInteger a, GcdInteger b);
+
+// ============================================================================
+// PERSISTENCE
+// ============================================================================
+
+/**
+ * @brief File calibrate writes when no destination is configured
+ *
+ * Written to the working directory and never loaded implicitly: point
+ * GCD_DISPATCH_PROFILE_ENV or --table at it.
+ */
+#define GCD_DISPATCH_DEFAULT_PATH "gcd_dispatch.tbl"
+
+/**
+ * @brief Environment variable naming the profile loaded at startup
+ * (unset or empty = load none)
+ */
+#define GCD_DISPATCH_PROFILE_ENV "GCD_ANALYZER_PROFILE"
+
+/**
+ * @brief Write a decision table as text
+ *
+ * One "<bucket> <median ns> <algorithm name>" line per bucket, after
+ * "cpu <model>" and "threshold <name> <value>" lines; measured costs
+ * follow as "cost <bucket> <median ns> <algorithm name>" lines.
+ *
+ * @param table Table to save
+ * @param path Destination file
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT (unwritable file)
+ */
+MathStatus gcd_dispatch_save(const GcdDispatchTable *table, const char *path);
+
+/**
+ * @brief Read a decision table written by gcd_dispatch_save
+ *
+ * Buckets and thresholds missing from the file keep their defaults.
+ *
+ * @param path Source file
+ * @param table Output table
+ * @return MATH_SUCCESS, MATH_ERROR_NO_SOLUTION (file cannot be opened) or
+ *         MATH_ERROR_INVALID_INPUT (unknown bucket, threshold or algorithm)
+ */
+MathStatus gcd_dispatch_load(const char *path, GcdDispatchTable *table);
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION
+// ============================================================================
+
+/**
+ * @brief Execute the dispatcher with interface
+ *
+ * @param input Input parameters
+ * @return MathResult of the chosen kernel
+ */
+MathResult gcd_auto_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute the dispatcher over a batch, choosing a kernel per pair
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult gcd_auto_compute_batch(const MathBatchInput *input);
+
+/**
+ * @brief Execute the dispatcher on unsigned operands
+ *
+ * Pairs below 2^63 run the kernel of their bucket; wider pairs, which no
+ * bucket was calibrated on, run the binary GCD in full width.
+ *
+ * @param input Unsigned operands
+ * @return MathUnsignedResult of the chosen kernel
+ */
+MathUnsignedResult gcd_auto_compute_unsigned(const MathUnsignedBinaryInput *input);
+
+/**
+ * @brief Execute the dispatcher on big operands
+ *
+ * Runs the half-GCD once the smaller operand reaches the half_gcd_bits
+ * threshold, Lehmer (or Extended Euclid for coefficients) below it.
+ *
+ * @param input Arbitrary-precision input
+ * @return MathResult of the chosen kernel
+ */
+MathResult gcd_auto_compute_big(const MathBigBinaryInput *input);
+
+/**
+ * @brief Implementation specification of GCD_AUTO
+ */
+extern ImplementationSpec gcd_auto_spec;
+
+#endif // GCD_DISPATCHER_H
@@ -0,0 +1,166 @@
+/**
+ * @file gcd_isa.c
+ * @brief Runtime selection among the per-ISA copies of the batch kernels
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Only the copies the build linked are referenced: GCD_ISA_HAVE_<LEVEL>
+ * is defined by the build for each of them.
+ */
+
+#include "gcd_isa.h"
+
+// ============================================================================
+// LINKED COPIES
+// ============================================================================
+
+extern const GcdIsaKernels gcd_isa_kernels_baseline;
+#ifdef GCD_ISA_HAVE_X86_64_V2
+extern const GcdIsaKernels gcd_isa_kernels_x86_64_v2;
+#endif
+#ifdef GCD_ISA_HAVE_X86_64_V3
+extern const GcdIsaKernels gcd_isa_kernels_x86_64_v3;
+#endif
+#ifdef GCD_ISA_HAVE_X86_64_V4
+extern const GcdIsaKernels gcd_isa_kernels_x86_64_v4;
+#endif
+#ifdef GCD_ISA_HAVE_ARMV8_2
+extern const GcdIsaKernels gcd_isa_kernels_armv8_2;
+#endif
+
+/**
+ * @brief Active table and its level (NULL until resolved)
+ */
+static const GcdIsaKernels *g_gcd_isa_kernels = NULL;
+static PlatformIsaLevel g_gcd_isa_level = PLATFORM_ISA_BASELINE;
+
+/**
+ * @brief Get the table compiled for a level
+ *
+ * @param level ISA level
+ * @return Table, or NULL if this build has no copy for the level
+ */
+static const GcdIsaKernels *gcd_isa_table_for_level(PlatformIsaLevel level)
+{
+    switch (level)
+    {
+    case PLATFORM_ISA_BASELINE:
+        return &gcd_isa_kernels_baseline;
+#ifdef GCD_ISA_HAVE_X86_64_V2
+    case PLATFORM_ISA_X86_64_V2:
+        return &gcd_isa_kernels_x86_64_v2;
+#endif
+#ifdef GCD_ISA_HAVE_X86_64_V3
+    case PLATFORM_ISA_X86_64_V3:
+        return &gcd_isa_kernels_x86_64_v3;
+#endif
+#ifdef GCD_ISA_HAVE_X86_64_V4
+    case PLATFORM_ISA_X86_64_V4:
+        return &gcd_isa_kernels_x86_64_v4;
+#endif
+#ifdef GCD_ISA_HAVE_ARMV8_2
+    case PLATFORM_ISA_ARMV8_2:
+        return &gcd_isa_kernels_armv8_2;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+// ============================================================================
+// LEVEL SELECTION
+// ============================================================================
+
+/**
+ * @brief Check whether this build carries kernels for a level
+ *
+ * @param level ISA level
+ * @return true if a copy was compiled and linked for it
+ */
+bool gcd_isa_level_built(PlatformIsaLevel level)
+{
+    return gcd_isa_table_for_level(level) != NULL;
+}
+
+/**
+ * @brief Force the kernels of a level
+ *
+ * @param level ISA level
+ * @return MATH_SUCCESS, or MATH_ERROR_NOT_IMPLEMENTED if unavailable here
+ */
+MathStatus gcd_isa_select_level(PlatformIsaLevel level)
+{
+    const GcdIsaKernels *table = gcd_isa_table_for_level(level);
+    if (table == NULL || !platform_supports_isa_level(level))
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+
+    g_gcd_isa_kernels = table;
+    g_gcd_isa_level = level;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Pick the highest linked level the CPU supports
+ */
+static void gcd_isa_resolve(void)
+{
+    static const PlatformIsaLevel descending[] = {
+        PLATFORM_ISA_X86_64_V4, PLATFORM_ISA_X86_64_V3, PLATFORM_ISA_X86_64_V2, PLATFORM_ISA_ARMV8_2};
+
+    for (size_t i = 0; i < sizeof(descending) / sizeof(descending[0]); i++)
+    {
+        if (gcd_isa_select_level(descending[i]) == MATH_SUCCESS)
+        {
+            return;
+        }
+    }
+    gcd_isa_select_level(PLATFORM_ISA_BASELINE);
+}
+
+/**
+ * @brief Level of the kernels in use (resolving it on first call)
+ *
+ * @return Active ISA level
+ */
+PlatformIsaLevel gcd_isa_active_level(void)
+{
+    if (g_gcd_isa_kernels == NULL)
+    {
+        gcd_isa_resolve();
+    }
+    return g_gcd_isa_level;
+}
+
+// ============================================================================
+// BATCH EXECUTION
+// ============================================================================
+
+/**
+ * @brief Euclid with the remainder operator over a batch, on the active level
+ *
+ * @return Number of rejected pairs
+ */
+MathNatural gcd_isa_batch_modulo(const GcdInteger *a, const GcdInteger *b, GcdInteger *out, MathNatural n)
+{
+    if (g_gcd_isa_kernels == NULL)
+    {
+        gcd_isa_resolve();
+    }
+    return g_gcd_isa_kernels->modulo(a, b, out, n);
+}
+
+/**
+ * @brief Binary GCD over a batch, on the active level
+ *
+ * @return Number of rejected pairs
+ */
+MathNatural gcd_isa_batch_stein(const GcdInteger *a, const GcdInteger *b, GcdInteger *out, MathNatural n)
+{
+    if (g_gcd_isa_kernels == NULL)
+    {
+        gcd_isa_resolve();
+    }
+    return g_gcd_isa_kernels->stein(a, b, out, n);
+}
@@ -0,0 +1,110 @@
+/**
+ * @file gcd_isa.h
+ * @brief Batch GCD kernels multiversioned per instruction set level
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * gcd_isa_kernels.c holds the batch loops of the modulo and ctz binary
+ * GCD variants, written against gcd_inline.h only. The CMake build
+ * compiles it once per ISA level the compiler can target (-march=
+ * x86-64-v2/v3/v4 or armv8.2-a), each copy exporting a kernel table named
+ * after its level, and passes GCD_ISA_HAVE_<LEVEL> to gcd_isa.c for every
+ * copy it linked. The first batch call picks the highest linked level the
+ * CPU supports. Builds without the extra copies (compile.bat) carry the
+ * baseline table only.
+ */
+
+#ifndef GCD_ISA_H
+#define GCD_ISA_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../../../infrastructure/platform/cpu_detection.h"
+#include "../domain_types.h"
+#include <stdbool.h>
+
+// ============================================================================
+// KERNEL TABLES
+// ============================================================================
+
+/**
+ * @brief Batch kernel over operand arrays
+ *
+ * Each result is the non-negative GCD of the pair; pairs with an
+ * LLONG_MIN operand get MATH_INVALID_VALUE.
+ *
+ * @return Number of rejected pairs
+ */
+typedef MathNatural (*GcdIsaBatchFunc)(const GcdInteger *a, const GcdInteger *b, GcdInteger *out, MathNatural n);
+
+/**
+ * @brief Kernels of one ISA level
+ */
+typedef struct
+{
+    GcdIsaBatchFunc modulo; /**< Euclid with the remainder operator */
+    GcdIsaBatchFunc stein;  /**< Binary GCD with count-trailing-zeros */
+} GcdIsaKernels;
+
+/**
+ * @brief Name of the table exported by the copy built for a level suffix
+ */
+#define GCD_ISA_TABLE_NAME(suffix) GCD_ISA_TABLE_NAME_EXPAND(suffix)
+#define GCD_ISA_TABLE_NAME_EXPAND(suffix) gcd_isa_kernels_##suffix
+
+// ============================================================================
+// LEVEL SELECTION
+// ============================================================================
+
+/**
+ * @brief Check whether this build carries kernels for a level
+ *
+ * @param level ISA level
+ * @return true if a copy was compiled and linked for it
+ */
+bool gcd_isa_level_built(PlatformIsaLevel level);
+
+/**
+ * @brief Force the kernels of a level
+ *
+ * Not thread-safe: select before batches run on other threads.
+ *
+ * @param level ISA level
+ * @return MATH_SUCCESS, or MATH_ERROR_NOT_IMPLEMENTED if the level is not
+ *         built or the CPU cannot run it
+ */
+MathStatus gcd_isa_select_level(PlatformIsaLevel level);
+
+/**
+ * @brief Level of the kernels in use (resolving it on first call)
+ *
+ * @return Active ISA level
+ */
+PlatformIsaLevel gcd_isa_active_level(void);
+
+// ============================================================================
+// BATCH EXECUTION
+// ============================================================================
+
+/**
+ * @brief Euclid with the remainder operator over a batch, on the active level
+ *
+ * @param a First operands
+ * @param b Second operands
+ * @param out One GCD per pair
+ * @param n Number of pairs
+ * @return Number of rejected pairs
+ */
+MathNatural gcd_isa_batch_modulo(const GcdInteger *a, const GcdInteger *b, GcdInteger *out, MathNatural n);
+
+/**
+ * @brief Binary GCD over a batch, on the active level
+ *
+ * @param a First operands
+ * @param b Second operands
+ * @param out One GCD per pair
+ * @param n Number of pairs
+ * @return Number of rejected pairs
+ */
+MathNatural gcd_isa_batch_stein(const GcdInteger *a, const GcdInteger *b, GcdInteger *out, MathNatural n);
+
+#endif // GCD_ISA_H
@@ -0,0 +1,50 @@
+/**
+ * @file gcd_isa_kernels.c
+ * @brief Batch GCD kernels compiled once per instruction set level
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The code is the same for every level; the -march flag of each copy
+ * lets the compiler use what the level adds (TZCNT, SHRX and friends on
+ * x86-64-v3, for instance). GCD_ISA_SUFFIX names the exported table and
+ * defaults to the baseline copy.
+ */
+
+#include "gcd_isa.h"
+#include "../gcd_batch.h"
+#include "../gcd_inline.h"
+
+#ifndef GCD_ISA_SUFFIX
+#define GCD_ISA_SUFFIX baseline
+#endif
+
+// ============================================================================
+// BATCH KERNELS
+// ============================================================================
+
+/**
+ * @brief Euclid with the remainder operator over a batch
+ */
+static MathNatural gcd_isa_modulo_kernel(const GcdInteger *a, const GcdInteger *b, GcdInteger *out, MathNatural n)
+{
+    return gcd_batch_pairs(a, b, out, n, gcd_inline_modulo_i64);
+}
+
+/**
+ * @brief Binary GCD with count-trailing-zeros over a batch
+ */
+static MathNatural gcd_isa_stein_kernel(const GcdInteger *a, const GcdInteger *b, GcdInteger *out, MathNatural n)
+{
+    return gcd_batch_pairs(a, b, out, n, gcd_inline_stein_i64);
+}
+
+// ============================================================================
+// KERNEL TABLE
+// ============================================================================
+
+/**
+ * @brief Kernels of this copy's level
+ */
+const GcdIsaKernels GCD_ISA_TABLE_NAME(GCD_ISA_SUFFIX) = {
+    .modulo = gcd_isa_modulo_kernel,
+    .stein = gcd_isa_stein_kernel};
@@ -0,0 +1,149 @@
+/**
+ * @file gcd_protocol.c
+ * @brief Framed binary requests and replies of the resident GCD server
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Headers are encoded byte by byte, like dataset headers, so they read
+ * the same on every host. The operand and GCD records behind them are
+ * sent as they sit in memory, which only matches the protocol on a
+ * little-endian host; the server refuses to start anywhere else.
+ */
+
+#include "gcd_protocol.h"
+#include <stdint.h>
+#include <string.h>
+
+// ============================================================================
+// FRAME FORMAT
+// ============================================================================
+
+/**
+ * @brief Compile-time check: reply status values keep their version 1 numbers
+ */
+typedef char gcd_protocol_status_values_fixed[(MATH_ERROR_NOT_IMPLEMENTED == 8 && MATH_ERROR_UNKNOWN == 9 &&
+                                               MATH_ERROR_CANCELLED == 10 && MATH_ERROR_LIMIT_REACHED == 11)
+                                                  ? 1
+                                                  : -1];
+
+/**
+ * @brief Store the low bytes of a value in little-endian order
+ */
+static void gcd_protocol_store_le(unsigned char *out, uint64_t value, unsigned int bytes)
+{
+    for (unsigned int i = 0; i < bytes; i++)
+    {
+        out[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief Load a little-endian value of a few bytes
+ */
+static uint64_t gcd_protocol_load_le(const unsigned char *in, unsigned int bytes)
+{
+    uint64_t value = 0;
+    for (unsigned int i = 0; i < bytes; i++)
+    {
+        value |= (uint64_t)in[i] << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief Encode a request header
+ *
+ * @param header Header to encode
+ * @param out Destination of GCD_PROTOCOL_HEADER_SIZE bytes
+ */
+void gcd_protocol_encode_request(const GcdRequestHeader *header, unsigned char *out)
+{
+    memset(out, 0, GCD_PROTOCOL_HEADER_SIZE);
+    memcpy(out, GCD_PROTOCOL_REQUEST_MAGIC, 4);
+    gcd_protocol_store_le(out + 4, GCD_PROTOCOL_VERSION, 2);
+    out[6] = (unsigned char)header->algorithm;
+    out[7] = (unsigned char)header->layout;
+    gcd_protocol_store_le(out + 8, header->count, 8);
+    gcd_protocol_store_le(out + 16, header->tag, 8);
+}
+
+/**
+ * @brief Decode and validate a request header
+ *
+ * @param data GCD_PROTOCOL_HEADER_SIZE bytes
+ * @param header Output header
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_NOT_IMPLEMENTED
+ */
+MathStatus gcd_protocol_decode_request(const unsigned char *data, GcdRequestHeader *header)
+{
+    if (data == NULL || header == NULL || memcmp(data, GCD_PROTOCOL_REQUEST_MAGIC, 4) != 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    if (gcd_protocol_load_le(data + 4, 2) != GCD_PROTOCOL_VERSION)
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+    if ((data[7] != GCD_DATASET_AOS && data[7] != GCD_DATASET_SOA) || gcd_protocol_load_le(data + 24, 8) != 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    header->algorithm = data[6];
+    header->layout = (GcdDatasetLayout)data[7];
+    header->count = gcd_protocol_load_le(data + 8, 8);
+    header->tag = gcd_protocol_load_le(data + 16, 8);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Encode a reply header
+ *
+ * @param header Header to encode
+ * @param out Destination of GCD_PROTOCOL_HEADER_SIZE bytes
+ */
+void gcd_protocol_encode_reply(const GcdReplyHeader *header, unsigned char *out)
+{
+    memcpy(out, GCD_PROTOCOL_REPLY_MAGIC, 4);
+    gcd_protocol_store_le(out + 4, GCD_PROTOCOL_VERSION, 2);
+    gcd_protocol_store_le(out + 6, (uint64_t)header->status, 2);
+    gcd_protocol_store_le(out + 8, header->count, 8);
+    gcd_protocol_store_le(out + 16, header->tag, 8);
+    gcd_protocol_store_le(out + 24, header->failed, 8);
+}
+
+/**
+ * @brief Decode and validate a reply header
+ *
+ * @param data GCD_PROTOCOL_HEADER_SIZE bytes
+ * @param header Output header
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_NOT_IMPLEMENTED
+ */
+MathStatus gcd_protocol_decode_reply(const unsigned char *data, GcdReplyHeader *header)
+{
+    if (data == NULL || header == NULL || memcmp(data, GCD_PROTOCOL_REPLY_MAGIC, 4) != 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    if (gcd_protocol_load_le(data + 4, 2) != GCD_PROTOCOL_VERSION)
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+
+    header->status = (MathStatus)gcd_protocol_load_le(data + 6, 2);
+    header->count = gcd_protocol_load_le(data + 8, 8);
+    header->tag = gcd_protocol_load_le(data + 16, 8);
+    header->failed = gcd_protocol_load_le(data + 24, 8);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Check whether records can be sent and received without conversion
+ *
+ * @return true on little-endian hosts
+ */
+bool gcd_protocol_host_supported(void)
+{
+    const uint16_t probe = 1;
+    return *(const unsigned char *)&probe == 1;
+}
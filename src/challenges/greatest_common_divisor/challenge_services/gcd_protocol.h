@@ -0,0 +1,192 @@
+/**
+ * @file gcd_protocol.h
+ * @brief Framed binary requests and replies of the resident GCD server
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * A client sends requests on one connection and reads one reply per
+ * request, in the same order. It may send further requests before
+ * reading earlier replies: the server reads ahead while a large batch is
+ * computing. Every frame is a 32-byte header followed by raw
+ * little-endian int64 records, the same records a dataset file holds.
+ *
+ * Request header (all fields little-endian):
+ *
+ *   offset  size  field
+ *        0     4  magic "GCDQ"
+ *        4     2  version (1)
+ *        6     1  algorithm: GcdAlgorithmVariant, or 255 for the server's default
+ *        7     1  layout: GCD_DATASET_AOS or GCD_DATASET_SOA
+ *        8     8  pair count n
+ *       16     8  tag, echoed in the reply
+ *       24     8  reserved, zero
+ *
+ * followed by 2 * n operands (a0 b0 a1 b1 ... or a0 .. an-1 b0 .. bn-1).
+ *
+ * Reply header:
+ *
+ *   offset  size  field
+ *        0     4  magic "GCDR"
+ *        4     2  version (1)
+ *        6     2  status (MathStatus; MATH_SUCCESS even with rejected pairs)
+ *        8     8  GCD count: n on success, 0 otherwise
+ *       16     8  tag of the request
+ *       24     8  pairs rejected by the algorithm (their GCD is MATH_INVALID_VALUE)
+ *
+ * followed by the GCDs. A request for an unknown algorithm is answered
+ * with MATH_ERROR_NOT_IMPLEMENTED and the connection stays usable. A
+ * malformed header or a count beyond the server's limit is answered with
+ * MATH_ERROR_INVALID_INPUT, after which the server closes the connection.
+ */
+
+#ifndef GCD_PROTOCOL_H
+#define GCD_PROTOCOL_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../domain_types.h"
+#include "gcd_dataset.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// ============================================================================
+// FRAME FORMAT
+// ============================================================================
+
+#define GCD_PROTOCOL_REQUEST_MAGIC "GCDQ"
+#define GCD_PROTOCOL_REPLY_MAGIC "GCDR"
+#define GCD_PROTOCOL_VERSION 1
+#define GCD_PROTOCOL_HEADER_SIZE 32
+
+/**
+ * @brief Algorithm byte asking for the server's default algorithm
+ */
+#define GCD_PROTOCOL_DEFAULT_ALGORITHM 255
+
+/**
+ * @brief Default largest pair count of one request (256 MiB of operands)
+ */
+#define GCD_PROTOCOL_MAX_PAIRS ((MathNatural)1 << 24)
+
+/**
+ * @brief Decoded request header
+ */
+typedef struct
+{
+    unsigned int algorithm;  /**< Variant number or GCD_PROTOCOL_DEFAULT_ALGORITHM */
+    GcdDatasetLayout layout; /**< Operand arrangement */
+    MathNatural count;       /**< Operand pairs that follow */
+    MathNatural tag;         /**< Echoed in the reply */
+} GcdRequestHeader;
+
+/**
+ * @brief Decoded reply header
+ */
+typedef struct
+{
+    MathStatus status;  /**< Outcome of the request */
+    MathNatural count;  /**< GCDs that follow */
+    MathNatural tag;    /**< Tag of the request */
+    MathNatural failed; /**< Pairs rejected by the algorithm */
+} GcdReplyHeader;
+
+/**
+ * @brief Encode a request header
+ *
+ * @param header Header to encode
+ * @param out Destination of GCD_PROTOCOL_HEADER_SIZE bytes
+ */
+void gcd_protocol_encode_request(const GcdRequestHeader *header, unsigned char *out);
+
+/**
+ * @brief Decode and validate a request header
+ *
+ * @param data GCD_PROTOCOL_HEADER_SIZE bytes
+ * @param header Output header
+ * @return MATH_SUCCESS; MATH_ERROR_INVALID_INPUT for a bad magic, reserved
+ *         bytes or layout; MATH_ERROR_NOT_IMPLEMENTED for another version
+ */
+MathStatus gcd_protocol_decode_request(const unsigned char *data, GcdRequestHeader *header);
+
+/**
+ * @brief Encode a reply header
+ *
+ * @param header Header to encode
+ * @param out Destination of GCD_PROTOCOL_HEADER_SIZE bytes
+ */
+void gcd_protocol_encode_reply(const GcdReplyHeader *header, unsigned char *out);
+
+/**
+ * @brief Decode and validate a reply header
+ *
+ * @param data GCD_PROTOCOL_HEADER_SIZE bytes
+ * @param header Output header
+ * @return MATH_SUCCESS; MATH_ERROR_INVALID_INPUT for a bad magic;
+ *         MATH_ERROR_NOT_IMPLEMENTED for another version
+ */
+MathStatus gcd_protocol_decode_reply(const unsigned char *data, GcdReplyHeader *header);
+
+/**
+ * @brief Check whether records can be sent and received without conversion
+ *
+ * @return true on little-endian hosts
+ */
+bool gcd_protocol_host_supported(void);
+
+// ============================================================================
+// SERVER PARAMETERS
+// ============================================================================
+
+/**
+ * @brief Called once the server listens, before the first connection
+ *
+ * @param address Address being served
+ * @param user_data GcdServeOptions.user_data
+ */
+typedef void (*GcdServeReadyCallback)(const char *address, void *user_data);
+
+/**
+ * @brief Default connections served at once
+ */
+#define GCD_SERVE_MAX_CONNECTIONS 64
+
+/**
+ * @brief What the server runs
+ */
+typedef struct
+{
+    const char *address;            /**< "unix:<path>" or "[tcp:]<host>:<port>" */
+    GcdAlgorithmVariant variant;    /**< Algorithm of requests asking for the default */
+    MathNatural thread_count;       /**< Batch workers per request (0 = one per online CPU) */
+    MathNatural max_pairs;          /**< Largest request (0 = GCD_PROTOCOL_MAX_PAIRS) */
+    MathNatural max_connections;    /**< Connections served at once (0 = GCD_SERVE_MAX_CONNECTIONS) */
+    MathNatural connection_limit;   /**< Return after serving this many connections (0 = never) */
+    GcdServeReadyCallback on_ready; /**< Optional: listening has started */
+    void *user_data;                /**< Passed to on_ready */
+} GcdServeOptions;
+
+/**
+ * @brief Serve options initialization macro
+ */
+#define GCD_SERVE_OPTIONS_INIT {                  \
+    .address = NULL,                              \
+    .variant = GCD_AUTO,                          \
+    .thread_count = 0,                            \
+    .max_pairs = GCD_PROTOCOL_MAX_PAIRS,          \
+    .max_connections = GCD_SERVE_MAX_CONNECTIONS, \
+    .connection_limit = 0,                        \
+    .on_ready = NULL,                             \
+    .user_data = NULL}
+
+/**
+ * @brief Summary of a server run
+ */
+typedef struct
+{
+    MathNatural connections; /**< Connections accepted */
+    MathNatural requests;    /**< Requests answered */
+    MathNatural pairs;       /**< Pairs computed */
+    MathNatural failed;      /**< Pairs rejected by the algorithm */
+    MathNatural errors;      /**< Requests answered with an error status */
+} GcdServeStats;
+
+#endif // GCD_PROTOCOL_H
@@ -0,0 +1,535 @@
+/**
+ * @file gcd_stream.c
+ * @brief Buffered operand-pair streams: parse pairs, format GCDs
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The reader keeps the unparsed tail of its block and refills behind it,
+ * so a line split across two reads is parsed once it is complete; only a
+ * line longer than the whole block is rejected. Integers are parsed by
+ * hand: strtoll would need a terminated copy of every field and checks
+ * the locale on every call.
+ */
+
+#include "gcd_stream.h"
+#include "../../../infrastructure/utilities/memory_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Bytes per binary input record (two int64 operands)
+ */
+#define GCD_STREAM_RECORD_SIZE (2 * sizeof(GcdInteger))
+
+/**
+ * @brief Largest magnitude scaled by ten that cannot overflow 2^63
+ */
+#define GCD_STREAM_MAGNITUDE_LIMIT 922337203685477580ull
+
+// ============================================================================
+// PARSING
+// ============================================================================
+
+/**
+ * @brief Field separators of a text line
+ */
+static bool gcd_stream_is_separator(char c)
+{
+    return c == ' ' || c == '\t' || c == ',' || c == '\r';
+}
+
+/**
+ * @brief Parse an optionally signed decimal integer
+ *
+ * @param p First byte of the field
+ * @param end End of the line
+ * @param value Parsed value
+ * @return Byte after the last digit, NULL if there are no digits or the
+ *         value is outside the 64-bit range
+ */
+static const char *gcd_stream_parse_integer(const char *p, const char *end, GcdInteger *value)
+{
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        p++;
+    }
+
+    // The last digit of 2^63 is 8 for negative values, 7 for positive ones
+    unsigned int last_digit_limit = negative ? 8 : 7;
+    const char *digits = p;
+    MathNatural magnitude = 0;
+
+    while (p < end && (unsigned int)(*p - '0') < 10)
+    {
+        unsigned int digit = (unsigned int)(*p - '0');
+        if (magnitude >= GCD_STREAM_MAGNITUDE_LIMIT &&
+            (magnitude > GCD_STREAM_MAGNITUDE_LIMIT || digit > last_digit_limit))
+        {
+            return NULL;
+        }
+        magnitude = magnitude * 10 + digit;
+        p++;
+    }
+
+    if (p == digits)
+    {
+        return NULL;
+    }
+
+    *value = negative ? (GcdInteger)(0 - magnitude) : (GcdInteger)magnitude;
+    return p;
+}
+
+/**
+ * @brief Parse one text line into an operand pair
+ *
+ * @param line First byte of the line
+ * @param end One past its last byte (newline excluded)
+ * @param a First operand output
+ * @param b Second operand output
+ * @param has_pair Set to false for blank and comment lines
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus gcd_stream_parse_line(const char *line, const char *end, GcdInteger *a, GcdInteger *b, bool *has_pair)
+{
+    if (line == NULL || end == NULL || a == NULL || b == NULL || has_pair == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    const char *p = line;
+    while (p < end && gcd_stream_is_separator(*p))
+    {
+        p++;
+    }
+
+    *has_pair = false;
+    if (p == end || *p == '#')
+    {
+        return MATH_SUCCESS;
+    }
+
+    p = gcd_stream_parse_integer(p, end, a);
+    if (p == NULL || p == end || !gcd_stream_is_separator(*p))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    while (p < end && gcd_stream_is_separator(*p))
+    {
+        p++;
+    }
+
+    p = gcd_stream_parse_integer(p, end, b);
+    if (p == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    while (p < end && gcd_stream_is_separator(*p))
+    {
+        p++;
+    }
+    if (p != end)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    *has_pair = true;
+    return MATH_SUCCESS;
+}
+
+// ============================================================================
+// READER
+// ============================================================================
+
+/**
+ * @brief Set up a reader on an open file
+ *
+ * @param reader Reader to initialize
+ * @param file Source file
+ * @param format Record format
+ * @param buffer_size Block size (0 = GCD_STREAM_BUFFER_SIZE)
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_stream_reader_init(GcdStreamReader *reader, FILE *file, GcdStreamFormat format, size_t buffer_size)
+{
+    if (reader == NULL || file == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    memory_clear(reader, sizeof(*reader));
+    reader->capacity = buffer_size > 0 ? buffer_size : GCD_STREAM_BUFFER_SIZE;
+    if (reader->capacity < GCD_STREAM_RECORD_SIZE)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    reader->buffer = (unsigned char *)malloc(reader->capacity);
+    if (reader->buffer == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+    reader->file = file;
+    reader->format = format;
+    reader->status = MATH_SUCCESS;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Release the reader's block (the file stays open)
+ *
+ * @param reader Reader to destroy
+ */
+void gcd_stream_reader_destroy(GcdStreamReader *reader)
+{
+    if (reader == NULL)
+    {
+        return;
+    }
+    free(reader->buffer);
+    memory_clear(reader, sizeof(*reader));
+}
+
+/**
+ * @brief Move the unparsed tail to the front of the block and read behind it
+ *
+ * @param reader Reader (not at end of file)
+ * @return false if nothing could be added: end of file, a read error or a
+ *         full block (reader->status records the last two)
+ */
+static bool gcd_stream_refill(GcdStreamReader *reader)
+{
+    if (reader->start > 0)
+    {
+        memmove(reader->buffer, reader->buffer + reader->start, reader->end - reader->start);
+        reader->end -= reader->start;
+        reader->start = 0;
+    }
+
+    if (reader->end == reader->capacity)
+    {
+        // A text line longer than the block: report it as the current line
+        reader->lines++;
+        reader->status = MATH_ERROR_INVALID_INPUT;
+        return false;
+    }
+
+    size_t read = fread(reader->buffer + reader->end, 1, reader->capacity - reader->end, reader->file);
+    reader->end += read;
+    if (read == 0)
+    {
+        reader->eof = true;
+        if (ferror(reader->file))
+        {
+            reader->status = MATH_ERROR_INVALID_INPUT;
+        }
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Read binary records
+ */
+static MathNatural gcd_stream_read_records(GcdStreamReader *reader, GcdInteger *a, GcdInteger *b,
+                                           MathNatural max_pairs)
+{
+    MathNatural count = 0;
+
+    while (count < max_pairs)
+    {
+        size_t available = (reader->end - reader->start) / GCD_STREAM_RECORD_SIZE;
+        if (available == 0)
+        {
+            if (!reader->eof && gcd_stream_refill(reader))
+            {
+                continue;
+            }
+            if (reader->status == MATH_SUCCESS && reader->start != reader->end)
+            {
+                // Trailing bytes that do not form a whole record
+                reader->status = MATH_ERROR_INVALID_INPUT;
+            }
+            break;
+        }
+
+        MathNatural take = MATH_MIN((MathNatural)available, max_pairs - count);
+        const unsigned char *record = reader->buffer + reader->start;
+        for (MathNatural i = 0; i < take; i++, record += GCD_STREAM_RECORD_SIZE)
+        {
+            memcpy(&a[count + i], record, sizeof(GcdInteger));
+            memcpy(&b[count + i], record + sizeof(GcdInteger), sizeof(GcdInteger));
+        }
+
+        size_t consumed = (size_t)take * GCD_STREAM_RECORD_SIZE;
+        reader->start += consumed;
+        reader->bytes += consumed;
+        count += take;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Read text lines
+ */
+static MathNatural gcd_stream_read_lines(GcdStreamReader *reader, GcdInteger *a, GcdInteger *b,
+                                         MathNatural max_pairs)
+{
+    MathNatural count = 0;
+
+    while (count < max_pairs)
+    {
+        const char *line = (const char *)reader->buffer + reader->start;
+        size_t available = reader->end - reader->start;
+        const char *newline = (const char *)memchr(line, '\n', available);
+        size_t consumed;
+
+        if (newline != NULL)
+        {
+            consumed = (size_t)(newline - line) + 1;
+        }
+        else if (reader->status != MATH_SUCCESS)
+        {
+            break;
+        }
+        else if (!reader->eof)
+        {
+            // The refill moves the tail, so the line is located again
+            gcd_stream_refill(reader);
+            continue;
+        }
+        else if (available == 0)
+        {
+            break;
+        }
+        else
+        {
+            // Last line without a newline
+            newline = line + available;
+            consumed = available;
+        }
+
+        reader->lines++;
+        bool has_pair;
+        MathStatus status = gcd_stream_parse_line(line, newline, &a[count], &b[count], &has_pair);
+        if (status != MATH_SUCCESS)
+        {
+            reader->status = status;
+            break;
+        }
+
+        reader->start += consumed;
+        reader->bytes += consumed;
+        if (has_pair)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Read up to max_pairs operand pairs
+ *
+ * @param reader Reader
+ * @param a Array receiving the first operands
+ * @param b Array receiving the second operands
+ * @param max_pairs Capacity of a and b
+ * @return Number of pairs read (0 at the end of the input or on an error)
+ */
+MathNatural gcd_stream_read_pairs(GcdStreamReader *reader, GcdInteger *a, GcdInteger *b, MathNatural max_pairs)
+{
+    if (reader == NULL || reader->buffer == NULL || a == NULL || b == NULL)
+    {
+        return 0;
+    }
+    if (reader->status != MATH_SUCCESS)
+    {
+        return 0;
+    }
+
+    return reader->format == GCD_STREAM_BINARY ? gcd_stream_read_records(reader, a, b, max_pairs)
+                                               : gcd_stream_read_lines(reader, a, b, max_pairs);
+}
+
+// ============================================================================
+// WRITER
+// ============================================================================
+
+/**
+ * @brief Set up a writer on an open file
+ *
+ * @param writer Writer to initialize
+ * @param file Destination file
+ * @param format Record format
+ * @param buffer_size Block size (0 = GCD_STREAM_BUFFER_SIZE)
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_stream_writer_init(GcdStreamWriter *writer, FILE *file, GcdStreamFormat format, size_t buffer_size)
+{
+    if (writer == NULL || file == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    memory_clear(writer, sizeof(*writer));
+    writer->capacity = buffer_size > 0 ? buffer_size : GCD_STREAM_BUFFER_SIZE;
+    if (writer->capacity < GCD_STREAM_MAX_FORMATTED)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    writer->buffer = (char *)malloc(writer->capacity);
+    if (writer->buffer == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+    writer->file = file;
+    writer->format = format;
+    writer->status = MATH_SUCCESS;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Release the writer's block without flushing it (the file stays open)
+ *
+ * @param writer Writer to destroy
+ */
+void gcd_stream_writer_destroy(GcdStreamWriter *writer)
+{
+    if (writer == NULL)
+    {
+        return;
+    }
+    free(writer->buffer);
+    memory_clear(writer, sizeof(*writer));
+}
+
+/**
+ * @brief Hand the buffered bytes to the file
+ */
+static MathStatus gcd_stream_drain(GcdStreamWriter *writer)
+{
+    if (writer->used > 0 && writer->status == MATH_SUCCESS)
+    {
+        if (fwrite(writer->buffer, 1, writer->used, writer->file) != writer->used)
+        {
+            writer->status = MATH_ERROR_INVALID_INPUT;
+        }
+        else
+        {
+            writer->bytes += writer->used;
+        }
+    }
+    writer->used = 0;
+    return writer->status;
+}
+
+/**
+ * @brief Format an integer in decimal
+ *
+ * Two digits per division, from a table of the hundred digit pairs.
+ *
+ * @param value Value to format
+ * @param out Destination with room for 20 characters (no terminator is written)
+ * @return Number of characters written
+ */
+size_t gcd_stream_format_integer(GcdInteger value, char *out)
+{
+    static const char DIGIT_PAIRS[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    char digits[20];
+    char *p = digits + sizeof(digits);
+    MathNatural magnitude = value < 0 ? 0 - (MathNatural)value : (MathNatural)value;
+
+    while (magnitude >= 100)
+    {
+        unsigned int pair = (unsigned int)(magnitude % 100) * 2;
+        magnitude /= 100;
+        *--p = DIGIT_PAIRS[pair + 1];
+        *--p = DIGIT_PAIRS[pair];
+    }
+    if (magnitude >= 10)
+    {
+        unsigned int pair = (unsigned int)magnitude * 2;
+        *--p = DIGIT_PAIRS[pair + 1];
+        *--p = DIGIT_PAIRS[pair];
+    }
+    else
+    {
+        *--p = (char)('0' + magnitude);
+    }
+
+    size_t length = 0;
+    if (value < 0)
+    {
+        out[length++] = '-';
+    }
+    size_t digit_count = (size_t)(digits + sizeof(digits) - p);
+    memcpy(out + length, p, digit_count);
+    return length + digit_count;
+}
+
+/**
+ * @brief Append GCD values to the output
+ *
+ * @param writer Writer
+ * @param values Values to write
+ * @param count Number of values
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT when the file rejects a write
+ */
+MathStatus gcd_stream_write_values(GcdStreamWriter *writer, const GcdInteger *values, MathNatural count)
+{
+    if (writer == NULL || writer->buffer == NULL || (values == NULL && count > 0))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    for (MathNatural i = 0; i < count && writer->status == MATH_SUCCESS; i++)
+    {
+        if (writer->capacity - writer->used < GCD_STREAM_MAX_FORMATTED)
+        {
+            gcd_stream_drain(writer);
+        }
+
+        if (writer->format == GCD_STREAM_BINARY)
+        {
+            memcpy(writer->buffer + writer->used, &values[i], sizeof(GcdInteger));
+            writer->used += sizeof(GcdInteger);
+        }
+        else
+        {
+            writer->used += gcd_stream_format_integer(values[i], writer->buffer + writer->used);
+            writer->buffer[writer->used++] = '\n';
+        }
+    }
+
+    return writer->status;
+}
+
+/**
+ * @brief Hand the buffered output to the file and flush it
+ *
+ * @param writer Writer
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT when the file rejects a write
+ */
+MathStatus gcd_stream_flush(GcdStreamWriter *writer)
+{
+    if (writer == NULL || writer->buffer == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (gcd_stream_drain(writer) == MATH_SUCCESS && fflush(writer->file) != 0)
+    {
+        writer->status = MATH_ERROR_INVALID_INPUT;
+    }
+    return writer->status;
+}
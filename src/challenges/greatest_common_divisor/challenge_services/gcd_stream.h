@@ -0,0 +1,227 @@
+/**
+ * @file gcd_stream.h
+ * @brief Buffered operand-pair streams: parse pairs, format GCDs
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Readers and writers behind the stream command. A reader pulls its input
+ * in large blocks and parses operand pairs straight out of the block, so a
+ * pair costs a memchr and a digit loop rather than an fgets/sscanf round
+ * trip; a writer formats GCDs into a block of its own and hands it to the
+ * file only when full. The stream loop itself (read a batch, run the batch
+ * API, write the batch) lives in the system coordinator.
+ *
+ * Two record formats:
+ * - text: one pair per line, two decimal integers separated by spaces,
+ *   tabs or a comma; blank lines and lines starting with '#' are skipped.
+ *   Each GCD is written as a decimal line.
+ * - binary: 16-byte records of two native-endian int64 operands; each GCD
+ *   is written as one native-endian int64.
+ *
+ * A pair the algorithm rejects (such as one with LLONG_MIN) produces
+ * MATH_INVALID_VALUE (-1), as in the batch API.
+ */
+
+#ifndef GCD_STREAM_H
+#define GCD_STREAM_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../domain_types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// ============================================================================
+// STREAM PARAMETERS
+// ============================================================================
+
+/**
+ * @brief Default I/O block size of readers and writers
+ */
+#define GCD_STREAM_BUFFER_SIZE ((size_t)1 << 20)
+
+/**
+ * @brief Default operand pairs handed to the batch API at a time
+ */
+#define GCD_STREAM_BATCH_PAIRS 65536
+
+/**
+ * @brief Longest decimal GCD line: sign, 19 digits and the newline
+ */
+#define GCD_STREAM_MAX_FORMATTED 21
+
+/**
+ * @brief Record formats
+ */
+typedef enum
+{
+    GCD_STREAM_TEXT,  /**< Decimal pairs per line in, decimal GCD lines out */
+    GCD_STREAM_BINARY /**< Native-endian int64 pairs in, int64 GCDs out */
+} GcdStreamFormat;
+
+/**
+ * @brief What the stream loop runs
+ */
+typedef struct
+{
+    GcdAlgorithmVariant variant; /**< Algorithm run over each batch */
+    GcdStreamFormat format;      /**< Record format of input and output */
+    MathNatural batch_pairs;     /**< Pairs per batch (0 = GCD_STREAM_BATCH_PAIRS) */
+    MathNatural thread_count;    /**< Batch workers (0 = one per online CPU) */
+} GcdStreamOptions;
+
+/**
+ * @brief Stream options initialization macro
+ */
+#define GCD_STREAM_OPTIONS_INIT {          \
+    .variant = GCD_AUTO,                   \
+    .format = GCD_STREAM_TEXT,             \
+    .batch_pairs = GCD_STREAM_BATCH_PAIRS, \
+    .thread_count = 0}
+
+/**
+ * @brief Summary of one stream run
+ */
+typedef struct
+{
+    MathNatural pairs;         /**< Pairs read and computed */
+    MathNatural failed;        /**< Pairs the algorithm rejected */
+    MathNatural lines;         /**< Text lines consumed (on a parse error: the bad line) */
+    MathNatural bytes_read;    /**< Input bytes consumed */
+    MathNatural bytes_written; /**< Output bytes produced */
+    double compute_time_ms;    /**< Time spent in the batch API */
+    double execution_time_ms;  /**< Wall-clock time of the whole stream */
+} GcdStreamStats;
+
+// ============================================================================
+// READER
+// ============================================================================
+
+/**
+ * @brief Buffered source of operand pairs
+ */
+typedef struct
+{
+    FILE *file;             /**< Source (not owned) */
+    GcdStreamFormat format; /**< Record format */
+    unsigned char *buffer;  /**< Input block */
+    size_t capacity;        /**< Size of buffer */
+    size_t start;           /**< First unparsed byte */
+    size_t end;             /**< End of the bytes read */
+    bool eof;               /**< The file has no more bytes */
+    MathNatural lines;      /**< Text lines consumed */
+    MathNatural bytes;      /**< Bytes consumed */
+    MathStatus status;      /**< First error (MATH_SUCCESS until one occurs) */
+} GcdStreamReader;
+
+/**
+ * @brief Set up a reader on an open file
+ *
+ * @param reader Reader to initialize
+ * @param file Source file
+ * @param format Record format
+ * @param buffer_size Block size (0 = GCD_STREAM_BUFFER_SIZE); also the
+ *        longest text line accepted
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_stream_reader_init(GcdStreamReader *reader, FILE *file, GcdStreamFormat format, size_t buffer_size);
+
+/**
+ * @brief Release the reader's block (the file stays open)
+ *
+ * @param reader Reader to destroy
+ */
+void gcd_stream_reader_destroy(GcdStreamReader *reader);
+
+/**
+ * @brief Read up to max_pairs operand pairs
+ *
+ * Returns fewer pairs only at the end of the input or on an error; after
+ * an error reader->status says what went wrong and reader->lines which
+ * text line it was on.
+ *
+ * @param reader Reader
+ * @param a Array receiving the first operands
+ * @param b Array receiving the second operands
+ * @param max_pairs Capacity of a and b
+ * @return Number of pairs read (0 at the end of the input or on an error)
+ */
+MathNatural gcd_stream_read_pairs(GcdStreamReader *reader, GcdInteger *a, GcdInteger *b, MathNatural max_pairs);
+
+/**
+ * @brief Parse one text line into an operand pair
+ *
+ * @param line First byte of the line
+ * @param end One past its last byte (newline excluded)
+ * @param a First operand output
+ * @param b Second operand output
+ * @param has_pair Set to false for blank and comment lines
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT for a malformed line or
+ *         an operand outside the 64-bit range
+ */
+MathStatus gcd_stream_parse_line(const char *line, const char *end, GcdInteger *a, GcdInteger *b, bool *has_pair);
+
+// ============================================================================
+// WRITER
+// ============================================================================
+
+/**
+ * @brief Buffered sink of GCD values
+ */
+typedef struct
+{
+    FILE *file;             /**< Destination (not owned) */
+    GcdStreamFormat format; /**< Record format */
+    char *buffer;           /**< Output block */
+    size_t capacity;        /**< Size of buffer */
+    size_t used;            /**< Bytes waiting in buffer */
+    MathNatural bytes;      /**< Bytes handed to the file */
+    MathStatus status;      /**< First error (MATH_SUCCESS until one occurs) */
+} GcdStreamWriter;
+
+/**
+ * @brief Set up a writer on an open file
+ *
+ * @param writer Writer to initialize
+ * @param file Destination file
+ * @param format Record format
+ * @param buffer_size Block size (0 = GCD_STREAM_BUFFER_SIZE)
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_stream_writer_init(GcdStreamWriter *writer, FILE *file, GcdStreamFormat format, size_t buffer_size);
+
+/**
+ * @brief Release the writer's block without flushing it (the file stays open)
+ *
+ * @param writer Writer to destroy
+ */
+void gcd_stream_writer_destroy(GcdStreamWriter *writer);
+
+/**
+ * @brief Append GCD values to the output
+ *
+ * @param writer Writer
+ * @param values Values to write
+ * @param count Number of values
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT when the file rejects a write
+ */
+MathStatus gcd_stream_write_values(GcdStreamWriter *writer, const GcdInteger *values, MathNatural count);
+
+/**
+ * @brief Hand the buffered output to the file and flush it
+ *
+ * @param writer Writer
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT when the file rejects a write
+ */
+MathStatus gcd_stream_flush(GcdStreamWriter *writer);
+
+/**
+ * @brief Format an integer in decimal
+ *
+ * @param value Value to format
+ * @param out Destination with room for 20 characters (no terminator is written)
+ * @return Number of characters written
+ */
+size_t gcd_stream_format_integer(GcdInteger value, char *out);
+
+#endif // GCD_STREAM_H
@@ -0,0 +1,292 @@
+/**
+ * @file input_generators.c
+ * @brief Reproducible operand generators for the input classes that rank GCD algorithms
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Every class is drawn from one SplitMix64 stream, so a seed fully
+ * determines the operands. Ranges are mapped with a plain modulo, whose
+ * bias (below 2^-31 for every range used here) is irrelevant for
+ * benchmarking.
+ */
+
+#include "input_generators.h"
+#include "../solutions/binary_family/implementations/stein.h"
+#include "../../../infrastructure/utilities/bignum_utils.h"
+#include <stdint.h>
+
+// ============================================================================
+// RANDOM NUMBER GENERATOR
+// ============================================================================
+
+/**
+ * @brief Seed a generator
+ *
+ * @param rng Generator to seed
+ * @param seed Seed value (any value, including 0)
+ */
+void gcd_random_seed(GcdRandom *rng, MathNatural seed)
+{
+    if (rng != NULL)
+    {
+        rng->state = seed;
+    }
+}
+
+/**
+ * @brief Next 64 random bits
+ *
+ * @param rng Generator
+ * @return Uniform 64-bit value
+ */
+MathNatural gcd_random_next(GcdRandom *rng)
+{
+    MathNatural z = (rng->state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Uniform value in [low, high]
+ *
+ * @param rng Generator
+ * @param low Lower bound (inclusive)
+ * @param high Upper bound (inclusive, >= low)
+ * @return Uniform value in range
+ */
+MathNatural gcd_random_range(GcdRandom *rng, MathNatural low, MathNatural high)
+{
+    MathNatural span = high - low + 1;
+    if (span == 0)
+    {
+        return gcd_random_next(rng); // Full 64-bit range
+    }
+    return low + gcd_random_next(rng) % span;
+}
+
+// ============================================================================
+// INPUT CLASSES
+// ============================================================================
+
+/**
+ * @brief Smallest and largest Fibonacci index used (F(92) is the last below 2^63)
+ */
+#define GENERATOR_FIBONACCI_MIN_INDEX 46
+#define GENERATOR_FIBONACCI_MAX_INDEX 91
+
+/**
+ * @brief Range of the shift applied to the odd parts of 2-adic operands
+ */
+#define GENERATOR_MIN_SHIFT 16
+#define GENERATOR_MAX_SHIFT 40
+
+/**
+ * @brief Range of the gap between near-equal 32-bit operands
+ */
+#define GENERATOR_MIN_GAP (1ull << 16)
+#define GENERATOR_MAX_GAP ((1ull << 17) - 1)
+
+/**
+ * @brief Short name of an input class (used as a column label)
+ *
+ * @param input_class Input class
+ * @return Name such as "fibonacci", or "unknown"
+ */
+const char *gcd_input_class_name(GcdInputClass input_class)
+{
+    switch (input_class)
+    {
+    case GCD_INPUT_RANDOM_32:
+        return "random32";
+    case GCD_INPUT_RANDOM_63:
+        return "random63";
+    case GCD_INPUT_FIBONACCI:
+        return "fibonacci";
+    case GCD_INPUT_POWERS_OF_TWO:
+        return "pow2";
+    case GCD_INPUT_COPRIME:
+        return "coprime";
+    case GCD_INPUT_NEAR_EQUAL:
+        return "near-equal";
+    default:
+        return "unknown";
+    }
+}
+
+/**
+ * @brief One-line description of an input class
+ *
+ * @param input_class Input class
+ * @return Description, or "unknown input class"
+ */
+const char *gcd_input_class_description(GcdInputClass input_class)
+{
+    switch (input_class)
+    {
+    case GCD_INPUT_RANDOM_32:
+        return "uniform 32-bit operands";
+    case GCD_INPUT_RANDOM_63:
+        return "uniform 63-bit operands";
+    case GCD_INPUT_FIBONACCI:
+        return "consecutive Fibonacci numbers (Euclid worst case)";
+    case GCD_INPUT_POWERS_OF_TWO:
+        return "operands with 16-40 trailing zeros (Stein best case)";
+    case GCD_INPUT_COPRIME:
+        return "uniform 63-bit coprime operands";
+    case GCD_INPUT_NEAR_EQUAL:
+        return "32-bit operands a few 2^16 apart (one large quotient)";
+    default:
+        return "unknown input class";
+    }
+}
+
+/**
+ * @brief Whether every partial quotient of a class's pairs is small
+ *
+ * @param input_class Input class
+ * @return true if the subtraction variants finish every pair in a bounded
+ *         number of steps
+ */
+bool gcd_input_class_bounded_quotients(GcdInputClass input_class)
+{
+    // Consecutive Fibonacci numbers have all quotients 1: at most 91 steps
+    return input_class == GCD_INPUT_FIBONACCI;
+}
+
+/**
+ * @brief F(index) for index <= GENERATOR_FIBONACCI_MAX_INDEX + 1
+ */
+static GcdInteger generator_fibonacci(unsigned int index)
+{
+    GcdInteger previous = 0;
+    GcdInteger current = 1;
+    for (unsigned int i = 1; i < index; i++)
+    {
+        GcdInteger next = previous + current;
+        previous = current;
+        current = next;
+    }
+    return index == 0 ? 0 : current;
+}
+
+/**
+ * @brief Random odd value shifted left by 16..40 bits, kept below 2^62
+ */
+static GcdInteger generator_two_adic(GcdRandom *rng)
+{
+    unsigned int shift = (unsigned int)gcd_random_range(rng, GENERATOR_MIN_SHIFT, GENERATOR_MAX_SHIFT);
+    MathNatural odd = gcd_random_range(rng, 0, (1ull << (62 - shift)) - 1) | 1;
+    return (GcdInteger)(odd << shift);
+}
+
+/**
+ * @brief Fill arrays with operand pairs drawn from an input class
+ *
+ * @param input_class Input class
+ * @param rng Generator (advanced by the call)
+ * @param a Array receiving the first operands
+ * @param b Array receiving the second operands
+ * @param n Number of pairs
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus gcd_generate_pairs(GcdInputClass input_class, GcdRandom *rng, GcdInteger *a, GcdInteger *b, MathNatural n)
+{
+    if (rng == NULL || a == NULL || b == NULL || input_class >= GCD_INPUT_CLASS_COUNT)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    for (MathNatural i = 0; i < n; i++)
+    {
+        switch (input_class)
+        {
+        case GCD_INPUT_RANDOM_32:
+            a[i] = (GcdInteger)gcd_random_range(rng, 1, UINT32_MAX);
+            b[i] = (GcdInteger)gcd_random_range(rng, 1, UINT32_MAX);
+            break;
+
+        case GCD_INPUT_RANDOM_63:
+            a[i] = (GcdInteger)gcd_random_range(rng, 1, INT64_MAX);
+            b[i] = (GcdInteger)gcd_random_range(rng, 1, INT64_MAX);
+            break;
+
+        case GCD_INPUT_FIBONACCI:
+        {
+            unsigned int k = (unsigned int)gcd_random_range(rng, GENERATOR_FIBONACCI_MIN_INDEX,
+                                                            GENERATOR_FIBONACCI_MAX_INDEX);
+            a[i] = generator_fibonacci(k + 1);
+            b[i] = generator_fibonacci(k);
+            break;
+        }
+
+        case GCD_INPUT_POWERS_OF_TWO:
+            a[i] = generator_two_adic(rng);
+            b[i] = generator_two_adic(rng);
+            break;
+
+        case GCD_INPUT_COPRIME:
+            // About 61% of random pairs are coprime, so few draws are rejected
+            do
+            {
+                a[i] = (GcdInteger)gcd_random_range(rng, 1, INT64_MAX);
+                b[i] = (GcdInteger)gcd_random_range(rng, 1, INT64_MAX);
+            } while (mdc_stein_ctz(a[i], b[i]) != GCD_IDENTITY);
+            break;
+
+        case GCD_INPUT_NEAR_EQUAL:
+            a[i] = (GcdInteger)gcd_random_range(rng, 1ull << 31, UINT32_MAX);
+            b[i] = a[i] - (GcdInteger)gcd_random_range(rng, GENERATOR_MIN_GAP, GENERATOR_MAX_GAP);
+            break;
+
+        default:
+            return MATH_ERROR_INVALID_INPUT;
+        }
+    }
+
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Allocate and fill uniform arbitrary-precision operand pairs
+ *
+ * @param rng Generator (advanced by the call)
+ * @param bits Operand size in bits (> 0)
+ * @param arena Arena providing the limb storage
+ * @param a Array receiving the first operands
+ * @param b Array receiving the second operands
+ * @param n Number of pairs
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_generate_big_pairs(GcdRandom *rng, MathNatural bits, MemoryArena *arena,
+                                  MathBigInteger *a, MathBigInteger *b, MathNatural n)
+{
+    if (rng == NULL || bits == 0 || arena == NULL || a == NULL || b == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathNatural limbs = bignum_limbs_for_bits(bits);
+    unsigned int top_bits = (unsigned int)(bits - (limbs - 1) * MATH_LIMB_BITS);
+    MathLimb top_mask = top_bits == MATH_LIMB_BITS ? ~(MathLimb)0 : ((MathLimb)1 << top_bits) - 1;
+
+    for (MathNatural i = 0; i < 2 * n; i++)
+    {
+        MathBigInteger *x = (i % 2 == 0) ? &a[i / 2] : &b[i / 2];
+        if (bignum_alloc(x, arena, limbs) != MATH_SUCCESS)
+        {
+            return MATH_ERROR_MEMORY;
+        }
+
+        for (MathNatural j = 0; j < limbs; j++)
+        {
+            x->limbs[j] = (MathLimb)gcd_random_next(rng);
+        }
+        x->limbs[limbs - 1] &= top_mask;
+        x->limbs[limbs - 1] |= (MathLimb)1 << (top_bits - 1);
+        x->size = limbs;
+        x->negative = false;
+    }
+
+    return MATH_SUCCESS;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file input_generators.h
+ * @brief Reproducible operand generators for the input classes that rank GCD algorithms
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * A single operand pair says little about an algorithm: Euclid's worst
+ * case is a pair of consecutive Fibonacci numbers, Stein's best case are
+ * operands with many trailing zeros, and the subtraction variants degrade
+ * with the quotient of the operands. This header declares a seeded
+ * generator for each of those classes, plus random arbitrary-precision
+ * operands, so benchmarks can be repeated on identical inputs.
+ */
+
+#ifndef INPUT_GENERATORS_H
+#define INPUT_GENERATORS_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../domain_types.h"
+#include "../../../infrastructure/utilities/memory_utils.h"
+
+// ============================================================================
+// RANDOM NUMBER GENERATOR
+// ============================================================================
+
+/**
+ * @brief Default seed, so runs without an explicit seed are comparable
+ */
+#define GCD_RANDOM_DEFAULT_SEED 0x243F6A8885A308D3ull
+
+/**
+ * @brief SplitMix64 generator state
+ *
+ * Small, fast and with a full 2^64 period, which is plenty for operand
+ * generation; not suitable for cryptographic use.
+ */
+typedef struct
+{
+    MathNatural state;
+} GcdRandom;
+
+/**
+ * @brief Seed a generator
+ *
+ * @param rng Generator to seed
+ * @param seed Seed value (any value, including 0)
+ */
+void gcd_random_seed(GcdRandom *rng, MathNatural seed);
+
+/**
+ * @brief Next 64 random bits
+ *
+ * @param rng Generator
+ * @return Uniform 64-bit value
+ */
+MathNatural gcd_random_next(GcdRandom *rng);
+
+/**
+ * @brief Uniform value in [low, high]
+ *
+ * @param rng Generator
+ * @param low Lower bound (inclusive)
+ * @param high Upper bound (inclusive, >= low)
+ * @return Uniform value in range
+ */
+MathNatural gcd_random_range(GcdRandom *rng, MathNatural low, MathNatural high);
+
+// ============================================================================
+// INPUT CLASSES
+// ============================================================================
+
+/**
+ * @brief Operand distributions covered by the benchmark suite
+ *
+ * All operands are positive. The subtraction variants take one step per
+ * unit of every partial quotient, so they are only bounded on classes
+ * whose quotients are (see gcd_input_class_bounded_quotients).
+ */
+typedef enum
+{
+    GCD_INPUT_RANDOM_32,     /**< Uniform in [1, 2^32) */
+    GCD_INPUT_RANDOM_63,     /**< Uniform in [1, 2^63) */
+    GCD_INPUT_FIBONACCI,     /**< Consecutive Fibonacci numbers F(k+1), F(k), 46 <= k <= 91 */
+    GCD_INPUT_POWERS_OF_TWO, /**< Odd parts below 2^46 shifted left by 16..40 bits */
+    GCD_INPUT_COPRIME,       /**< Uniform 63-bit pairs with gcd 1 */
+    GCD_INPUT_NEAR_EQUAL,    /**< 32-bit a and b = a - d with 2^16 <= d < 2^17 */
+    GCD_INPUT_CLASS_COUNT    /**< Number of input classes */
+} GcdInputClass;
+
+/**
+ * @brief Short name of an input class (used as a column label)
+ *
+ * @param input_class Input class
+ * @return Name such as "fibonacci", or "unknown"
+ */
+const char *gcd_input_class_name(GcdInputClass input_class);
+
+/**
+ * @brief One-line description of an input class
+ *
+ * @param input_class Input class
+ * @return Description, or "unknown input class"
+ */
+const char *gcd_input_class_description(GcdInputClass input_class);
+
+/**
+ * @brief Whether every partial quotient of a class's pairs is small
+ *
+ * The subtraction variants (COMPLEXITY_LINEAR) finish such pairs in a
+ * bounded number of steps. On the other classes a single pair can take
+ * millions of steps, and the recursive variant as many stack frames.
+ *
+ * @param input_class Input class
+ * @return true if the subtraction variants finish every pair in a bounded
+ *         number of steps
+ */
+bool gcd_input_class_bounded_quotients(GcdInputClass input_class);
+
+/**
+ * @brief Fill arrays with operand pairs drawn from an input class
+ *
+ * @param input_class Input class
+ * @param rng Generator (advanced by the call)
+ * @param a Array receiving the first operands
+ * @param b Array receiving the second operands
+ * @param n Number of pairs
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus gcd_generate_pairs(GcdInputClass input_class, GcdRandom *rng, GcdInteger *a, GcdInteger *b, MathNatural n);
+
+/**
+ * @brief Allocate and fill uniform arbitrary-precision operand pairs
+ *
+ * Every operand has exactly bits bits (top bit set). Limb storage is
+ * carved from arena, which needs 2 * n * (bignum_limbs_for_bits(bits)
+ * limbs + MEMORY_ARENA_DEFAULT_ALIGNMENT) bytes.
+ *
+ * @param rng Generator (advanced by the call)
+ * @param bits Operand size in bits (> 0)
+ * @param arena Arena providing the limb storage
+ * @param a Array receiving the first operands
+ * @param b Array receiving the second operands
+ * @param n Number of pairs
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus gcd_generate_big_pairs(GcdRandom *rng, MathNatural bits, MemoryArena *arena,
+                                  MathBigInteger *a, MathBigInteger *b, MathNatural n);
+
+#endif // INPUT_GENERATORS_H
@@ -10,18 +10,33 @@
  * Focused on practical analysis without over-engineering.
  */
 
+#include "mdc_analyzer.h"
 #include "../challenge_definition.h"
-#include "../solutions/euclidean_family/implementations/classic.h"
 #include "../solutions/euclidean_family/implementations/recursive.h"
-#include "../solutions/binary_family/implementations/stein.h"
+#include "solution_registry.h"
+#include "gcd_dispatcher.h"
+#include "step_counter.h"
 #include "../../../infrastructure/utilities/math_utils.h"
 #include "../../../infrastructure/utilities/memory_utils.h"
+#include "../../../infrastructure/utilities/bignum_utils.h"
 #include <stdio.h>
+#include <stdlib.h>
 
 // ============================================================================
 // ALGORITHM EXECUTION
 // ============================================================================
 
+/**
+ * @brief Resolve the implementation specification for a variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *mdc_analyzer_get_implementation(GcdAlgorithmVariant variant)
+{
+    return gcd_registry_get_implementation(variant);
+}
+
 /**
  * @brief Execute a specific GCD algorithm by variant
  *
@@ -34,25 +49,7 @@ MathResult mdc_analyzer_execute_algorithm(GcdAlgorithmVariant variant, GcdIntege
 {
     MathBinaryInput input = {.operand_a = a, .operand_b = b};
 
-    // Get implementation based on variant
-    const ImplementationSpec *spec = NULL;
-
-    // Try classic Euclidean implementations
-    if (is_classic_euclidean_variant(variant))
-    {
-        spec = classic_euclidean_get_implementation(variant);
-    }
-    // Try recursive Euclidean implementations
-    else if (is_recursive_euclidean_variant(variant))
-    {
-        spec = recursive_euclidean_get_implementation(variant);
-    }
-    // Try binary implementations
-    else if (is_stein_variant(variant))
-    {
-        spec = stein_get_implementation(variant);
-    }
-
+    const ImplementationSpec *spec = mdc_analyzer_get_implementation(variant);
     if (spec == NULL)
     {
         return math_create_error_result(MATH_ERROR_NOT_IMPLEMENTED, 0, 0.0);
@@ -62,6 +59,24 @@ MathResult mdc_analyzer_execute_algorithm(GcdAlgorithmVariant variant, GcdIntege
     return spec->compute(&input);
 }
 
+/**
+ * @brief Execute a GCD algorithm on arbitrary-precision operands
+ *
+ * @param variant Which algorithm to execute
+ * @param input Arbitrary-precision input
+ * @return MathResult whose value is the bit length of the GCD
+ */
+MathResult mdc_analyzer_execute_big(GcdAlgorithmVariant variant, const MathBigBinaryInput *input)
+{
+    const ImplementationSpec *spec = mdc_analyzer_get_implementation(variant);
+    if (spec == NULL || spec->compute_big == NULL)
+    {
+        return math_create_error_result(MATH_ERROR_NOT_IMPLEMENTED, 0, 0.0);
+    }
+
+    return spec->compute_big(input);
+}
+
 /**
  * @brief Execute all available GCD algorithms and compare results
  *
@@ -72,6 +87,22 @@ MathResult mdc_analyzer_execute_algorithm(GcdAlgorithmVariant variant, GcdIntege
  * @return Number of algorithms executed
  */
 MathNatural mdc_analyzer_execute_all(GcdInteger a, GcdInteger b, MathResult *results, MathNatural max_results)
+{
+    return mdc_analyzer_execute_all_counted(a, b, results, NULL, max_results);
+}
+
+/**
+ * @brief Execute all available GCD algorithms, keeping the steps each one performed
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param results Array to store results
+ * @param steps Array to store the step counts matching results (NULL = not kept)
+ * @param max_results Maximum number of results to store
+ * @return Number of algorithms executed
+ */
+MathNatural mdc_analyzer_execute_all_counted(GcdInteger a, GcdInteger b, MathResult *results,
+                                             GcdStepCounts *steps, MathNatural max_results)
 {
     if (results == NULL || max_results == 0)
     {
@@ -80,22 +111,53 @@ MathNatural mdc_analyzer_execute_all(GcdInteger a, GcdInteger b, MathResult *res
 
     MathNatural count = 0;
 
-    // All available algorithm variants
-    GcdAlgorithmVariant variants[] = {
-        GCD_EUCLIDEAN_MODULO,
-        GCD_EUCLIDEAN_SUBTRACTION,
-        GCD_EUCLIDEAN_DIVISION,
-        GCD_RECURSIVE_MODULO,
-        GCD_RECURSIVE_SUBTRACTION,
-        GCD_EXTENDED_EUCLIDEAN,
-        GCD_BINARY_STEIN};
-
-    MathNatural variant_count = sizeof(variants) / sizeof(variants[0]);
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    MathNatural variant_count = mdc_analyzer_list_variants(variants, GCD_VARIANT_CAPACITY);
 
     // Execute each algorithm
     for (MathNatural i = 0; i < variant_count && count < max_results; i++)
     {
+        // Special cases return before the kernel runs, so clear stale counts first
+        gcd_steps_reset();
         results[count] = mdc_analyzer_execute_algorithm(variants[i], a, b);
+        if (steps != NULL)
+        {
+            gcd_steps_read(&steps[count]);
+        }
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Execute all arbitrary-precision GCD algorithms
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param results Array to store results
+ * @param gcd_values Caller-initialized outputs, one per algorithm, each with
+ *        capacity for the larger operand
+ * @param max_results Maximum number of results to store
+ * @return Number of algorithms executed
+ */
+MathNatural mdc_analyzer_execute_all_big(const MathBigInteger *a, const MathBigInteger *b,
+                                         MathResult *results, MathBigInteger *gcd_values,
+                                         MathNatural max_results)
+{
+    if (a == NULL || b == NULL || results == NULL || gcd_values == NULL || max_results == 0)
+    {
+        return 0;
+    }
+
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    MathNatural variant_count = mdc_analyzer_list_big_variants(variants, GCD_VARIANT_CAPACITY);
+
+    MathNatural count = 0;
+    for (MathNatural i = 0; i < variant_count && count < max_results; i++)
+    {
+        MathBigBinaryInput input = MATH_BIG_BINARY_INPUT_INIT(a, b, &gcd_values[count]);
+        results[count] = mdc_analyzer_execute_big(variants[i], &input);
         count++;
     }
 
@@ -180,6 +242,43 @@ bool mdc_analyzer_validate_consistency(GcdInteger a, GcdInteger b, const MathRes
     return true;
 }
 
+/**
+ * @brief Compare arbitrary-precision results for consistency
+ *
+ * @param results Array of results from different algorithms
+ * @param gcd_values GCD outputs matching results
+ * @param result_count Number of results
+ * @return true if at least one result is valid and all valid ones agree
+ */
+bool mdc_analyzer_validate_consistency_big(const MathResult *results, const MathBigInteger *gcd_values,
+                                           MathNatural result_count)
+{
+    if (results == NULL || gcd_values == NULL || result_count == 0)
+    {
+        return false;
+    }
+
+    const MathBigInteger *reference = NULL;
+    for (MathNatural i = 0; i < result_count; i++)
+    {
+        if (!MATH_IS_VALID_RESULT(results[i]))
+        {
+            continue;
+        }
+
+        if (reference == NULL)
+        {
+            reference = &gcd_values[i];
+        }
+        else if (bignum_compare(reference, &gcd_values[i]) != 0)
+        {
+            return false; // Inconsistent result found
+        }
+    }
+
+    return reference != NULL;
+}
+
 // ============================================================================
 // PERFORMANCE ANALYSIS
 // ============================================================================
@@ -199,8 +298,8 @@ double mdc_analyzer_find_fastest(GcdInteger a, GcdInteger b, GcdAlgorithmVariant
         return -1.0;
     }
 
-    MathResult results[10]; // Space for all algorithms
-    MathNatural count = mdc_analyzer_execute_all(a, b, results, 10);
+    MathResult results[GCD_VARIANT_CAPACITY]; // Space for all algorithms
+    MathNatural count = mdc_analyzer_execute_all(a, b, results, GCD_VARIANT_CAPACITY);
 
     if (count == 0)
     {
@@ -209,14 +308,8 @@ double mdc_analyzer_find_fastest(GcdInteger a, GcdInteger b, GcdAlgorithmVariant
 
     // Find algorithm with minimum execution time
     double min_time = -1.0;
-    GcdAlgorithmVariant variants[] = {
-        GCD_EUCLIDEAN_MODULO,
-        GCD_EUCLIDEAN_SUBTRACTION,
-        GCD_EUCLIDEAN_DIVISION,
-        GCD_RECURSIVE_MODULO,
-        GCD_RECURSIVE_SUBTRACTION,
-        GCD_EXTENDED_EUCLIDEAN,
-        GCD_BINARY_STEIN};
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    mdc_analyzer_list_variants(variants, GCD_VARIANT_CAPACITY);
 
     for (MathNatural i = 0; i < count; i++)
     {
@@ -249,29 +342,350 @@ const char *mdc_analyzer_get_algorithm_name(GcdAlgorithmVariant variant)
         return "Euclidean Subtraction";
     case GCD_EUCLIDEAN_DIVISION:
         return "Euclidean Division";
+    case GCD_EUCLIDEAN_LEHMER:
+        return "Euclidean Lehmer";
+    case GCD_EUCLIDEAN_TABLE:
+        return "Euclidean Table Lookup";
     case GCD_RECURSIVE_MODULO:
         return "Recursive Modulo";
     case GCD_RECURSIVE_SUBTRACTION:
         return "Recursive Subtraction";
     case GCD_EXTENDED_EUCLIDEAN:
         return "Extended Euclidean";
+    case GCD_EXTENDED_ITERATIVE:
+        return "Extended Iterative";
     case GCD_BINARY_STEIN:
         return "Stein Binary";
+    case GCD_BINARY_STEIN_CTZ:
+        return "Stein Binary CTZ";
+    case GCD_BINARY_STEIN_SIMD:
+        return "Stein Binary SIMD";
+    case GCD_BINARY_EXTENDED:
+        return "Binary Extended";
+    case GCD_BIGNUM_MODULO:
+        return "Bignum Modulo";
+    case GCD_BIGNUM_LEHMER:
+        return "Bignum Lehmer";
+    case GCD_BIGNUM_EXTENDED:
+        return "Bignum Extended";
+    case GCD_BIGNUM_HALF_GCD:
+        return "Bignum Half-GCD";
+    case GCD_BIGNUM_STEIN:
+        return "Bignum Stein";
+    case GCD_AUTO:
+        return "Auto Dispatch";
     default:
-        return "Unknown";
+        // Runtime registrations only have their registry display name
+        return gcd_registry_get_display_name(variant);
     }
 }
 
+/**
+ * @brief List the variants run by compare/fastest/benchmark, in output order
+ *
+ * @param variants Array to store variants
+ * @param max_variants Maximum number of variants to return
+ * @return Number of variants returned
+ */
+MathNatural mdc_analyzer_list_variants(GcdAlgorithmVariant *variants, MathNatural max_variants)
+{
+    return gcd_registry_list_role(GCD_REGISTRY_ROLE_WORD, variants, max_variants);
+}
+
+/**
+ * @brief List the variants run by the arbitrary-precision compare/benchmark
+ *
+ * @param variants Array to store variants
+ * @param max_variants Maximum number of variants to return
+ * @return Number of variants returned
+ */
+MathNatural mdc_analyzer_list_big_variants(GcdAlgorithmVariant *variants, MathNatural max_variants)
+{
+    return gcd_registry_list_role(GCD_REGISTRY_ROLE_BIG, variants, max_variants);
+}
+
 // ============================================================================
 // SIMPLE BENCHMARKING
 // ============================================================================
 
+/**
+ * @brief Maximum operand pairs handed to one benchmark batch call
+ */
+#define ANALYZER_BENCHMARK_PAIRS 256
+
+/**
+ * @brief State handed to the benchmark body for one algorithm
+ *
+ * The body walks the operand set cyclically, so consecutive samples see
+ * different pairs and the distribution covers the whole set.
+ */
+typedef struct
+{
+    const ImplementationSpec *spec;
+    const GcdInteger *operands_a;
+    const GcdInteger *operands_b;
+    MathNatural pair_count;
+    MathNatural cursor; /**< Next pair to run */
+    GcdInteger results[ANALYZER_BENCHMARK_PAIRS];
+} AnalyzerBenchmarkContext;
+
+/**
+ * @brief Benchmark body: run the algorithm on the next repetitions pairs
+ *
+ * Goes through the batch fast path in runs of up to ANALYZER_BENCHMARK_PAIRS,
+ * so the per-call interface timing is paid once per run rather than once
+ * per GCD. Implementations without a batch path are called one pair at a
+ * time.
+ *
+ * @param context AnalyzerBenchmarkContext
+ * @param repetitions Number of GCDs to compute
+ */
+static void analyzer_benchmark_body(void *context, MathNatural repetitions)
+{
+    AnalyzerBenchmarkContext *benchmark = (AnalyzerBenchmarkContext *)context;
+    const ImplementationSpec *spec = benchmark->spec;
+
+    while (repetitions > 0)
+    {
+        MathNatural cursor = benchmark->cursor;
+        MathNatural count = MATH_MIN(repetitions, benchmark->pair_count - cursor);
+        count = MATH_MIN(count, ANALYZER_BENCHMARK_PAIRS);
+
+        if (spec->compute_batch != NULL)
+        {
+            MathBatchInput input = MATH_BATCH_INPUT_INIT(benchmark->operands_a + cursor,
+                                                         benchmark->operands_b + cursor,
+                                                         benchmark->results, count);
+            spec->compute_batch(&input);
+            BENCHMARK_CLOBBER_MEMORY();
+        }
+        else
+        {
+            for (MathNatural i = 0; i < count; i++)
+            {
+                MathBinaryInput pair = GCD_INPUT(benchmark->operands_a[cursor + i],
+                                                 benchmark->operands_b[cursor + i]);
+                MathResult result = spec->compute(&pair);
+                BENCHMARK_DO_NOT_OPTIMIZE(result.value);
+            }
+        }
+
+        benchmark->cursor = (cursor + count == benchmark->pair_count) ? 0 : cursor + count;
+        repetitions -= count;
+    }
+}
+
+/**
+ * @brief Benchmark one algorithm over a set of operand pairs with the harness
+ *
+ * @param variant Algorithm variant to benchmark
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param n Number of operand pairs
+ * @param config Harness configuration (NULL = BENCHMARK_CONFIG_INIT)
+ * @param stats Output statistics (zeroed unless MATH_SUCCESS)
+ * @return MATH_SUCCESS, MATH_ERROR_NOT_IMPLEMENTED, MATH_ERROR_INVALID_INPUT
+ *         (including a pair the algorithm rejects) or MATH_ERROR_MEMORY
+ */
+MathStatus mdc_analyzer_benchmark_pairs(GcdAlgorithmVariant variant, const GcdInteger *a, const GcdInteger *b,
+                                        MathNatural n, const BenchmarkConfig *config, BenchmarkStats *stats)
+{
+    if (a == NULL || b == NULL || n == 0 || stats == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    *stats = (BenchmarkStats){0};
+
+    AnalyzerBenchmarkContext benchmark = {
+        .spec = mdc_analyzer_get_implementation(variant),
+        .operands_a = a,
+        .operands_b = b,
+        .pair_count = n,
+        .cursor = 0};
+    if (benchmark.spec == NULL)
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // Inputs an algorithm rejects would otherwise be timed as fast failures
+    for (MathNatural i = 0; i < n; i++)
+    {
+        MathBinaryInput pair = GCD_INPUT(a[i], b[i]);
+        if (!MATH_IS_VALID_RESULT(benchmark.spec->compute(&pair)))
+        {
+            return MATH_ERROR_INVALID_INPUT;
+        }
+    }
+
+    MathStatus status = benchmark_run(analyzer_benchmark_body, &benchmark, config, stats);
+    if (status != MATH_SUCCESS)
+    {
+        *stats = (BenchmarkStats){0};
+    }
+    return status;
+}
+
+/**
+ * @brief Benchmark every analyzed algorithm on one operand pair with the harness
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param config Harness configuration (NULL = BENCHMARK_CONFIG_INIT)
+ * @param stats Array receiving one entry per variant, in mdc_analyzer_list_variants order
+ * @param max_results Maximum number of entries
+ * @return Number of entries written
+ */
+MathNatural mdc_analyzer_benchmark_detailed(GcdInteger a, GcdInteger b, const BenchmarkConfig *config,
+                                            BenchmarkStats *stats, MathNatural max_results)
+{
+    if (stats == NULL || max_results == 0)
+    {
+        return 0;
+    }
+
+    // One GCD per pair: a handful of copies fills a batch call
+    GcdInteger operands_a[ANALYZER_BENCHMARK_PAIRS];
+    GcdInteger operands_b[ANALYZER_BENCHMARK_PAIRS];
+    for (MathNatural i = 0; i < ANALYZER_BENCHMARK_PAIRS; i++)
+    {
+        operands_a[i] = a;
+        operands_b[i] = b;
+    }
+
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    MathNatural variant_count = mdc_analyzer_list_variants(variants, GCD_VARIANT_CAPACITY);
+
+    MathNatural result_count = 0;
+    for (; result_count < variant_count && result_count < max_results; result_count++)
+    {
+        // Rejected inputs leave a zeroed entry, keeping entries aligned with the variants
+        mdc_analyzer_benchmark_pairs(variants[result_count], operands_a, operands_b,
+                                     ANALYZER_BENCHMARK_PAIRS, config, &stats[result_count]);
+    }
+
+    return result_count;
+}
+
+/**
+ * @brief State handed to the benchmark body for one arbitrary-precision algorithm
+ */
+typedef struct
+{
+    const ImplementationSpec *spec;
+    const MathBigInteger *operands_a;
+    const MathBigInteger *operands_b;
+    MathNatural pair_count;
+    MathNatural cursor;       /**< Next pair to run */
+    MathBigBinaryInput input; /**< Result and scratch shared by every call */
+} AnalyzerBigBenchmarkContext;
+
+/**
+ * @brief Benchmark body: run the algorithm on the next repetitions big pairs
+ *
+ * @param context AnalyzerBigBenchmarkContext
+ * @param repetitions Number of GCDs to compute
+ */
+static void analyzer_benchmark_big_body(void *context, MathNatural repetitions)
+{
+    AnalyzerBigBenchmarkContext *benchmark = (AnalyzerBigBenchmarkContext *)context;
+
+    for (MathNatural r = 0; r < repetitions; r++)
+    {
+        benchmark->input.operand_a = &benchmark->operands_a[benchmark->cursor];
+        benchmark->input.operand_b = &benchmark->operands_b[benchmark->cursor];
+        MathResult result = benchmark->spec->compute_big(&benchmark->input);
+        BENCHMARK_DO_NOT_OPTIMIZE(result.value);
+
+        if (++benchmark->cursor == benchmark->pair_count)
+        {
+            benchmark->cursor = 0;
+        }
+    }
+}
+
+/**
+ * @brief Benchmark one arbitrary-precision algorithm over a set of operand pairs
+ *
+ * @param variant Algorithm variant to benchmark (must provide compute_big)
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param n Number of operand pairs
+ * @param config Harness configuration (NULL = BENCHMARK_CONFIG_INIT)
+ * @param stats Output statistics (zeroed unless MATH_SUCCESS)
+ * @return MATH_SUCCESS, MATH_ERROR_NOT_IMPLEMENTED, MATH_ERROR_INVALID_INPUT
+ *         or MATH_ERROR_MEMORY
+ */
+MathStatus mdc_analyzer_benchmark_big_pairs(GcdAlgorithmVariant variant, const MathBigInteger *a,
+                                            const MathBigInteger *b, MathNatural n,
+                                            const BenchmarkConfig *config, BenchmarkStats *stats)
+{
+    if (a == NULL || b == NULL || n == 0 || stats == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    *stats = (BenchmarkStats){0};
+
+    const ImplementationSpec *spec = mdc_analyzer_get_implementation(variant);
+    if (spec == NULL || spec->compute_big == NULL)
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // Result and scratch are sized once for the widest pair
+    MathNatural limbs = 1;
+    for (MathNatural i = 0; i < n; i++)
+    {
+        limbs = MATH_MAX(limbs, MATH_MAX(a[i].size, b[i].size) + 1);
+    }
+    MemoryArena arena;
+    if (memory_arena_init(&arena, BIGNUM_SCRATCH_BYTES(limbs) + limbs * sizeof(MathLimb) +
+                                      MEMORY_ARENA_DEFAULT_ALIGNMENT) != MATH_SUCCESS)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+
+    MathBigInteger gcd;
+    bignum_alloc(&gcd, &arena, limbs);
+
+    AnalyzerBigBenchmarkContext benchmark = {
+        .spec = spec,
+        .operands_a = a,
+        .operands_b = b,
+        .pair_count = n,
+        .cursor = 0,
+        .input = MATH_BIG_BINARY_INPUT_INIT(&a[0], &b[0], &gcd)};
+    benchmark.input.scratch = &arena;
+
+    MathStatus status = MATH_SUCCESS;
+    for (MathNatural i = 0; i < n && status == MATH_SUCCESS; i++)
+    {
+        benchmark.input.operand_a = &a[i];
+        benchmark.input.operand_b = &b[i];
+        if (!MATH_IS_VALID_RESULT(spec->compute_big(&benchmark.input)))
+        {
+            status = MATH_ERROR_INVALID_INPUT;
+        }
+    }
+
+    if (status == MATH_SUCCESS)
+    {
+        status = benchmark_run(analyzer_benchmark_big_body, &benchmark, config, stats);
+    }
+    if (status != MATH_SUCCESS)
+    {
+        *stats = (BenchmarkStats){0};
+    }
+
+    memory_arena_destroy(&arena);
+    return status;
+}
+
 /**
  * @brief Run simple benchmark comparing algorithm performance
  *
  * @param a First operand
  * @param b Second operand
- * @param iterations Number of times to run each algorithm
+ * @param iterations Number of timed samples per algorithm
  * @param results Array to store benchmark results
  * @param max_results Maximum number of results
  * @return Number of algorithms benchmarked
@@ -283,28 +697,73 @@ MathNatural mdc_analyzer_benchmark(GcdInteger a, GcdInteger b, MathNatural itera
         return 0;
     }
 
-    GcdAlgorithmVariant variants[] = {
-        GCD_EUCLIDEAN_MODULO,
-        GCD_EUCLIDEAN_SUBTRACTION,
-        GCD_EUCLIDEAN_DIVISION,
-        GCD_RECURSIVE_MODULO,
-        GCD_RECURSIVE_SUBTRACTION,
-        GCD_EXTENDED_EUCLIDEAN,
-        GCD_BINARY_STEIN};
+    BenchmarkStats stats[GCD_VARIANT_CAPACITY];
+    BenchmarkConfig config = BENCHMARK_CONFIG_INIT;
+    config.sample_count = iterations;
+    MathNatural count = mdc_analyzer_benchmark_detailed(a, b, &config, stats, MATH_MIN(max_results, GCD_VARIANT_CAPACITY));
 
-    MathNatural variant_count = sizeof(variants) / sizeof(variants[0]);
-    MathNatural result_count = 0;
+    for (MathNatural i = 0; i < count; i++)
+    {
+        if (stats[i].sample_count > 0)
+        {
+            results[i] = math_create_success_result(0, stats[i].total_operations, stats[i].mean_ns / 1e6);
+        }
+        else
+        {
+            results[i] = math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+        }
+    }
 
-    // Benchmark each algorithm
+    return count;
+}
+
+/**
+ * @brief Benchmark the arbitrary-precision algorithms
+ *
+ * Result and scratch storage are allocated once and rolled back between
+ * runs, so the timings cover the arithmetic only.
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param iterations Number of times to run each algorithm
+ * @param results Array to store benchmark results
+ * @param max_results Maximum number of results
+ * @return Number of algorithms benchmarked
+ */
+MathNatural mdc_analyzer_benchmark_big(const MathBigInteger *a, const MathBigInteger *b, MathNatural iterations,
+                                       MathResult *results, MathNatural max_results)
+{
+    if (a == NULL || b == NULL || results == NULL || max_results == 0 || iterations == 0)
+    {
+        return 0;
+    }
+
+    MathNatural limbs = MATH_MAX(a->size, b->size) + 1;
+    MemoryArena arena;
+    if (memory_arena_init(&arena, BIGNUM_SCRATCH_BYTES(limbs) + limbs * sizeof(MathLimb) +
+                                      MEMORY_ARENA_DEFAULT_ALIGNMENT) != MATH_SUCCESS)
+    {
+        return 0;
+    }
+
+    MathBigInteger gcd;
+    bignum_alloc(&gcd, &arena, limbs);
+
+    MathBigBinaryInput input = MATH_BIG_BINARY_INPUT_INIT(a, b, &gcd);
+    input.scratch = &arena;
+
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    MathNatural variant_count = mdc_analyzer_list_big_variants(variants, GCD_VARIANT_CAPACITY);
+
+    MathNatural result_count = 0;
     for (MathNatural i = 0; i < variant_count && result_count < max_results; i++)
     {
         double total_time = 0.0;
         MathNatural successful_runs = 0;
 
-        // Run multiple iterations
         for (MathNatural j = 0; j < iterations; j++)
         {
-            MathResult single_result = mdc_analyzer_execute_algorithm(variants[i], a, b);
+            MathResult single_result = mdc_analyzer_execute_big(variants[i], &input);
 
             if (MATH_IS_VALID_RESULT(single_result) && single_result.execution_time_ms >= 0)
             {
@@ -313,7 +772,6 @@ MathNatural mdc_analyzer_benchmark(GcdInteger a, GcdInteger b, MathNatural itera
             }
         }
 
-        // Store benchmark result
         if (successful_runs > 0)
         {
             results[result_count].value = 0; // Not relevant for benchmark
@@ -325,6 +783,7 @@ MathNatural mdc_analyzer_benchmark(GcdInteger a, GcdInteger b, MathNatural itera
         }
     }
 
+    memory_arena_destroy(&arena);
     return result_count;
 }
 
@@ -338,27 +797,36 @@ MathNatural mdc_analyzer_benchmark(GcdInteger a, GcdInteger b, MathNatural itera
  * @param a First operand
  * @param b Second operand
  * @param results Array of results from different algorithms
+ * @param steps Step counts matching results (NULL = no step columns)
  * @param result_count Number of results
  */
-void mdc_analyzer_print_comparison(GcdInteger a, GcdInteger b, const MathResult *results, MathNatural result_count)
+void mdc_analyzer_print_comparison(GcdInteger a, GcdInteger b, const MathResult *results,
+                                   const GcdStepCounts *steps, MathNatural result_count)
 {
+    bool show_steps = steps != NULL && GCD_STEP_COUNTING_ENABLED;
+
     printf("=== GCD Algorithm Comparison ===\n");
     printf("Input: gcd(%lld, %lld)\n\n", (long long)a, (long long)b);
 
-    GcdAlgorithmVariant variants[] = {
-        GCD_EUCLIDEAN_MODULO,
-        GCD_EUCLIDEAN_SUBTRACTION,
-        GCD_EUCLIDEAN_DIVISION,
-        GCD_RECURSIVE_MODULO,
-        GCD_RECURSIVE_SUBTRACTION,
-        GCD_EXTENDED_EUCLIDEAN,
-        GCD_BINARY_STEIN};
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    MathNatural variant_count = mdc_analyzer_list_variants(variants, GCD_VARIANT_CAPACITY);
 
-    for (MathNatural i = 0; i < result_count && i < 7; i++)
+    for (MathNatural i = 0; i < result_count && i < variant_count; i++)
     {
         const char *name = mdc_analyzer_get_algorithm_name(variants[i]);
 
-        if (MATH_IS_VALID_RESULT(results[i]))
+        if (MATH_IS_VALID_RESULT(results[i]) && show_steps)
+        {
+            printf("%-20s: GCD = %lld | Time: %.6f ms | Steps: %6llu (div %llu, sub %llu, shift %llu)\n",
+                   name,
+                   (long long)results[i].value,
+                   results[i].execution_time_ms,
+                   (unsigned long long)gcd_steps_total(&steps[i]),
+                   (unsigned long long)steps[i].divisions,
+                   (unsigned long long)steps[i].subtractions,
+                   (unsigned long long)steps[i].shifts);
+        }
+        else if (MATH_IS_VALID_RESULT(results[i]))
         {
             printf("%-20s: GCD = %lld | Time: %.6f ms\n",
                    name,
@@ -374,6 +842,56 @@ void mdc_analyzer_print_comparison(GcdInteger a, GcdInteger b, const MathResult
     printf("\n");
 }
 
+/**
+ * @brief Print arbitrary-precision comparison results to console
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param results Array of results from different algorithms
+ * @param gcd_values GCD outputs matching results
+ * @param result_count Number of results
+ */
+void mdc_analyzer_print_comparison_big(const MathBigInteger *a, const MathBigInteger *b,
+                                       const MathResult *results, const MathBigInteger *gcd_values,
+                                       MathNatural result_count)
+{
+    printf("=== Bignum GCD Algorithm Comparison ===\n");
+    printf("Input: gcd(<%lu bits>, <%lu bits>)\n\n",
+           (unsigned long)bignum_bit_length(a), (unsigned long)bignum_bit_length(b));
+
+    MathNatural limbs = MATH_MAX(a->size, b->size) + 1;
+    size_t text_size = bignum_string_size(a) + bignum_string_size(b);
+    MemoryArena arena;
+    if (memory_arena_init(&arena, text_size + limbs * sizeof(MathLimb) * 4 + 4 * MEMORY_ARENA_DEFAULT_ALIGNMENT) != MATH_SUCCESS)
+    {
+        printf("Error: could not allocate output buffer\n\n");
+        return;
+    }
+
+    char *text = (char *)memory_arena_alloc(&arena, text_size, 1);
+
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    MathNatural variant_count = mdc_analyzer_list_big_variants(variants, GCD_VARIANT_CAPACITY);
+
+    for (MathNatural i = 0; i < result_count && i < variant_count; i++)
+    {
+        const char *name = mdc_analyzer_get_algorithm_name(variants[i]);
+
+        if (MATH_IS_VALID_RESULT(results[i]) &&
+            bignum_to_string(&gcd_values[i], text, text_size, &arena) == MATH_SUCCESS)
+        {
+            printf("%-20s: GCD = %s | Time: %.6f ms\n", name, text, results[i].execution_time_ms);
+        }
+        else
+        {
+            printf("%-20s: ERROR (status: %d)\n", name, results[i].status);
+        }
+    }
+
+    memory_arena_destroy(&arena);
+    printf("\n");
+}
+
 /**
  * @brief Print Extended GCD result to console
  *
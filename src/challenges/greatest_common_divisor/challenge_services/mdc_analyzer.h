@@ -14,12 +14,22 @@
 #include "../challenge_definition.h"
 #include "../../../core/domain/mathematical_types.h"
 #include "../domain_types.h"
+#include "step_counter.h"
+#include "../../../infrastructure/utilities/benchmark_utils.h"
 #include <stdbool.h>
 
 // ============================================================================
 // ALGORITHM EXECUTION
 // ============================================================================
 
+/**
+ * @brief Resolve the implementation specification for a variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *mdc_analyzer_get_implementation(GcdAlgorithmVariant variant);
+
 /**
  * @brief Execute a specific GCD algorithm by variant
  *
@@ -41,6 +51,46 @@ MathResult mdc_analyzer_execute_algorithm(GcdAlgorithmVariant variant, GcdIntege
  */
 MathNatural mdc_analyzer_execute_all(GcdInteger a, GcdInteger b, MathResult *results, MathNatural max_results);
 
+/**
+ * @brief Execute all available GCD algorithms, keeping the steps each one performed
+ *
+ * Steps are only counted in builds with -DGCD_COUNT_STEPS (see
+ * step_counter.h); otherwise every entry of steps is zero.
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param results Array to store results
+ * @param steps Array to store the step counts matching results (NULL = not kept)
+ * @param max_results Maximum number of results to store
+ * @return Number of algorithms executed
+ */
+MathNatural mdc_analyzer_execute_all_counted(GcdInteger a, GcdInteger b, MathResult *results,
+                                             GcdStepCounts *steps, MathNatural max_results);
+
+/**
+ * @brief Execute a GCD algorithm on arbitrary-precision operands
+ *
+ * @param variant Which algorithm to execute (must provide compute_big)
+ * @param input Arbitrary-precision input
+ * @return MathResult whose value is the bit length of the GCD
+ */
+MathResult mdc_analyzer_execute_big(GcdAlgorithmVariant variant, const MathBigBinaryInput *input);
+
+/**
+ * @brief Execute all arbitrary-precision GCD algorithms
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param results Array to store results
+ * @param gcd_values Caller-initialized outputs, one per algorithm, each with
+ *        capacity for the larger operand
+ * @param max_results Maximum number of results to store
+ * @return Number of algorithms executed
+ */
+MathNatural mdc_analyzer_execute_all_big(const MathBigInteger *a, const MathBigInteger *b,
+                                         MathResult *results, MathBigInteger *gcd_values,
+                                         MathNatural max_results);
+
 /**
  * @brief Execute Extended Euclidean algorithm with full result
  *
@@ -77,6 +127,17 @@ bool mdc_analyzer_validate_result(GcdInteger a, GcdInteger b, GcdInteger result)
  */
 bool mdc_analyzer_validate_consistency(GcdInteger a, GcdInteger b, const MathResult *results, MathNatural result_count);
 
+/**
+ * @brief Compare arbitrary-precision results for consistency
+ *
+ * @param results Array of results from different algorithms
+ * @param gcd_values GCD outputs matching results
+ * @param result_count Number of results
+ * @return true if at least one result is valid and all valid ones agree
+ */
+bool mdc_analyzer_validate_consistency_big(const MathResult *results, const MathBigInteger *gcd_values,
+                                           MathNatural result_count);
+
 // ============================================================================
 // PERFORMANCE ANALYSIS
 // ============================================================================
@@ -99,22 +160,119 @@ double mdc_analyzer_find_fastest(GcdInteger a, GcdInteger b, GcdAlgorithmVariant
  */
 const char *mdc_analyzer_get_algorithm_name(GcdAlgorithmVariant variant);
 
+/**
+ * @brief List the variants run by compare/fastest/benchmark, in output order
+ *
+ * These are the registry entries with GCD_REGISTRY_ROLE_WORD, runtime
+ * registrations included, in registration order.
+ *
+ * @param variants Array to store variants
+ * @param max_variants Maximum number of variants to return
+ * @return Number of variants returned
+ */
+MathNatural mdc_analyzer_list_variants(GcdAlgorithmVariant *variants, MathNatural max_variants);
+
+/**
+ * @brief List the variants run by the arbitrary-precision compare/benchmark
+ *
+ * These are the registry entries with GCD_REGISTRY_ROLE_BIG, runtime
+ * registrations included, in registration order.
+ *
+ * @param variants Array to store variants
+ * @param max_variants Maximum number of variants to return
+ * @return Number of variants returned
+ */
+MathNatural mdc_analyzer_list_big_variants(GcdAlgorithmVariant *variants, MathNatural max_variants);
+
 // ============================================================================
 // SIMPLE BENCHMARKING
 // ============================================================================
 
+/**
+ * @brief Benchmark one algorithm over a set of operand pairs with the harness
+ *
+ * Samples walk the set cyclically through the batch path, so the
+ * statistics describe the input distribution rather than a single pair.
+ * Every pair is checked once up front; if the algorithm rejects any of
+ * them nothing is timed.
+ *
+ * @param variant Algorithm variant to benchmark
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param n Number of operand pairs
+ * @param config Harness configuration (NULL = BENCHMARK_CONFIG_INIT)
+ * @param stats Output statistics (zeroed unless MATH_SUCCESS)
+ * @return MATH_SUCCESS, MATH_ERROR_NOT_IMPLEMENTED, MATH_ERROR_INVALID_INPUT
+ *         (including a pair the algorithm rejects) or MATH_ERROR_MEMORY
+ */
+MathStatus mdc_analyzer_benchmark_pairs(GcdAlgorithmVariant variant, const GcdInteger *a, const GcdInteger *b,
+                                        MathNatural n, const BenchmarkConfig *config, BenchmarkStats *stats);
+
+/**
+ * @brief Benchmark one arbitrary-precision algorithm over a set of operand pairs
+ *
+ * Result and scratch storage are allocated once for the widest pair and
+ * rolled back between calls, so the samples cover the arithmetic only.
+ *
+ * @param variant Algorithm variant to benchmark (must provide compute_big)
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param n Number of operand pairs
+ * @param config Harness configuration (NULL = BENCHMARK_CONFIG_INIT)
+ * @param stats Output statistics (zeroed unless MATH_SUCCESS)
+ * @return MATH_SUCCESS, MATH_ERROR_NOT_IMPLEMENTED, MATH_ERROR_INVALID_INPUT
+ *         or MATH_ERROR_MEMORY
+ */
+MathStatus mdc_analyzer_benchmark_big_pairs(GcdAlgorithmVariant variant, const MathBigInteger *a,
+                                            const MathBigInteger *b, MathNatural n,
+                                            const BenchmarkConfig *config, BenchmarkStats *stats);
+
+/**
+ * @brief Benchmark every analyzed algorithm on one operand pair with the harness
+ *
+ * Each algorithm runs through its batch path on the same pair, with
+ * warmup, a calibrated batch size and repeated samples (see
+ * benchmark_run). Algorithms that reject the operands get an entry with
+ * sample_count = 0, so entries stay aligned with mdc_analyzer_list_variants.
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param config Harness configuration (NULL = BENCHMARK_CONFIG_INIT)
+ * @param stats Array receiving one entry per variant
+ * @param max_results Maximum number of entries
+ * @return Number of entries written
+ */
+MathNatural mdc_analyzer_benchmark_detailed(GcdInteger a, GcdInteger b, const BenchmarkConfig *config,
+                                            BenchmarkStats *stats, MathNatural max_results);
+
 /**
  * @brief Run simple benchmark comparing algorithm performance
  *
+ * Summarizes mdc_analyzer_benchmark_detailed: execution_time_ms is the
+ * mean time per GCD and iterations the number of timed GCDs.
+ *
  * @param a First operand
  * @param b Second operand
- * @param iterations Number of times to run each algorithm
+ * @param iterations Number of timed samples per algorithm
  * @param results Array to store benchmark results
  * @param max_results Maximum number of results
  * @return Number of algorithms benchmarked
  */
 MathNatural mdc_analyzer_benchmark(GcdInteger a, GcdInteger b, MathNatural iterations, MathResult *results, MathNatural max_results);
 
+/**
+ * @brief Benchmark the arbitrary-precision algorithms
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param iterations Number of times to run each algorithm
+ * @param results Array to store benchmark results
+ * @param max_results Maximum number of results
+ * @return Number of algorithms benchmarked
+ */
+MathNatural mdc_analyzer_benchmark_big(const MathBigInteger *a, const MathBigInteger *b, MathNatural iterations,
+                                       MathResult *results, MathNatural max_results);
+
 // ============================================================================
 // CONSOLE OUTPUT HELPERS
 // ============================================================================
@@ -122,12 +280,30 @@ MathNatural mdc_analyzer_benchmark(GcdInteger a, GcdInteger b, MathNatural itera
 /**
  * @brief Print comparison results to console
  *
+ * With step counting compiled in, each line also shows the division,
+ * subtraction and shift steps of the algorithm.
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param results Array of results from different algorithms
+ * @param steps Step counts matching results (NULL = no step columns)
+ * @param result_count Number of results
+ */
+void mdc_analyzer_print_comparison(GcdInteger a, GcdInteger b, const MathResult *results,
+                                   const GcdStepCounts *steps, MathNatural result_count);
+
+/**
+ * @brief Print arbitrary-precision comparison results to console
+ *
  * @param a First operand
  * @param b Second operand
  * @param results Array of results from different algorithms
+ * @param gcd_values GCD outputs matching results
  * @param result_count Number of results
  */
-void mdc_analyzer_print_comparison(GcdInteger a, GcdInteger b, const MathResult *results, MathNatural result_count);
+void mdc_analyzer_print_comparison_big(const MathBigInteger *a, const MathBigInteger *b,
+                                       const MathResult *results, const MathBigInteger *gcd_values,
+                                       MathNatural result_count);
 
 /**
  * @brief Print Extended GCD result to console
@@ -0,0 +1,230 @@
+/**
+ * @file modular_arithmetic.c
+ * @brief Modular inverse and Chinese Remainder services built on the extended GCD
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Every inversion goes through euclidean_extended_compute_full on operands
+ * already reduced to [0, m), whose coefficient for the reduced value is
+ * the inverse up to one final reduction. Products of residues use
+ * math_mul_mod, so moduli up to 2^63 - 1 are supported.
+ */
+
+#include "modular_arithmetic.h"
+#include "../solutions/euclidean_family/implementations/recursive.h"
+#include "../../../infrastructure/utilities/math_utils.h"
+#include <limits.h>
+#include <stddef.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Reduce a value to [0, modulus)
+ *
+ * Values already in range, the common case, skip the division.
+ *
+ * @param value Value to reduce
+ * @param modulus Modulus (positive)
+ * @return value mod modulus
+ */
+static GcdInteger modular_reduce(GcdInteger value, GcdInteger modulus)
+{
+    if (value >= 0 && value < modulus)
+    {
+        return value;
+    }
+    GcdInteger reduced = value % modulus;
+    return reduced < 0 ? reduced + modulus : reduced;
+}
+
+/**
+ * @brief Inverse of an already reduced value
+ *
+ * @param reduced Value in [0, modulus)
+ * @param modulus Modulus (positive)
+ * @param inverse Output in [0, modulus)
+ * @return MATH_SUCCESS or MATH_ERROR_NO_SOLUTION
+ */
+static MathStatus modular_inverse_reduced(GcdInteger reduced, GcdInteger modulus, GcdInteger *inverse)
+{
+    GcdInteger x, y;
+    ExtendedGcdResult extended = euclidean_extended_compute_full(reduced, modulus, &x, &y);
+    if (!extended.is_valid || extended.gcd != 1)
+    {
+        return MATH_ERROR_NO_SOLUTION;
+    }
+
+    // |x| <= modulus, so one correction brings it into range
+    *inverse = modular_reduce(x, modulus);
+    return MATH_SUCCESS;
+}
+
+// ============================================================================
+// MODULAR INVERSION
+// ============================================================================
+
+/**
+ * @brief Inverse of a modulo m
+ *
+ * @param a Value to invert
+ * @param modulus Modulus (positive)
+ * @param inverse Output in [0, modulus)
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus modinv(GcdInteger a, GcdInteger modulus, GcdInteger *inverse)
+{
+    if (inverse == NULL || modulus <= 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    // Every value is congruent to its inverse 0 modulo 1
+    if (modulus == 1)
+    {
+        *inverse = 0;
+        return MATH_SUCCESS;
+    }
+
+    return modular_inverse_reduced(modular_reduce(a, modulus), modulus, inverse);
+}
+
+/**
+ * @brief Inverses of count values modulo the same modulus
+ *
+ * Forward pass: inverses[i] = v_0 * ... * v_i. The inverse t of the full
+ * product then gives inverses[i] = t * inverses[i - 1] on the way back,
+ * with t *= v_i after each step.
+ *
+ * @param values Values to invert
+ * @param inverses Output array
+ * @param count Number of values
+ * @param modulus Modulus (positive)
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus modinv_batch(const GcdInteger *values, GcdInteger *inverses, MathNatural count, GcdInteger modulus)
+{
+    if (count == 0)
+    {
+        return MATH_SUCCESS;
+    }
+    if (values == NULL || inverses == NULL || modulus <= 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathNatural m = (MathNatural)modulus;
+
+    // Forward pass: prefix products
+    inverses[0] = modular_reduce(values[0], modulus);
+    for (MathNatural i = 1; i < count; i++)
+    {
+        MathNatural v = (MathNatural)modular_reduce(values[i], modulus);
+        inverses[i] = (GcdInteger)math_mul_mod((MathNatural)inverses[i - 1], v, m);
+    }
+
+    GcdInteger total_inverse;
+    if (modulus == 1)
+    {
+        total_inverse = 0;
+    }
+    else if (modular_inverse_reduced(inverses[count - 1], modulus, &total_inverse) != MATH_SUCCESS)
+    {
+        // Some value shares a factor with the modulus; invert one at a time
+        MathStatus status = MATH_SUCCESS;
+        for (MathNatural i = 0; i < count; i++)
+        {
+            if (modular_inverse_reduced(modular_reduce(values[i], modulus), modulus, &inverses[i]) != MATH_SUCCESS)
+            {
+                inverses[i] = 0;
+                status = MATH_ERROR_NO_SOLUTION;
+            }
+        }
+        return status;
+    }
+
+    // Backward pass: peel one factor off the inverted product per step
+    MathNatural t = (MathNatural)total_inverse;
+    for (MathNatural i = count - 1; i > 0; i--)
+    {
+        MathNatural v = (MathNatural)modular_reduce(values[i], modulus);
+        inverses[i] = (GcdInteger)math_mul_mod(t, (MathNatural)inverses[i - 1], m);
+        t = math_mul_mod(t, v, m);
+    }
+    inverses[0] = (GcdInteger)t;
+
+    return MATH_SUCCESS;
+}
+
+// ============================================================================
+// CHINESE REMAINDER THEOREM
+// ============================================================================
+
+/**
+ * @brief Combine x = residues[i] (mod moduli[i]) into one congruence
+ *
+ * Folds the congruences in one at a time: with x = r (mod M) so far and
+ * g = gcd(M, m_i), the next one holds for x = r + M*k exactly when
+ * (M/g) * k = (r_i - r)/g (mod m_i/g), which the extended GCD of M and
+ * m_i solves. The combined modulus is M * (m_i/g) = lcm(M, m_i).
+ *
+ * @param residues Residues
+ * @param moduli Moduli (positive)
+ * @param count Number of congruences
+ * @param result Output residue
+ * @param modulus Output modulus
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus crt_combine(const GcdInteger *residues, const GcdInteger *moduli, MathNatural count,
+                       GcdInteger *result, GcdInteger *modulus)
+{
+    if (result == NULL || modulus == NULL || (count > 0 && (residues == NULL || moduli == NULL)))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    GcdInteger r = 0;
+    GcdInteger M = 1;
+    for (MathNatural i = 0; i < count; i++)
+    {
+        GcdInteger mi = moduli[i];
+        if (mi <= 0)
+        {
+            return MATH_ERROR_INVALID_INPUT;
+        }
+        GcdInteger ri = modular_reduce(residues[i], mi);
+
+        // M * x = g (mod m_i)
+        GcdInteger x, y;
+        ExtendedGcdResult extended = euclidean_extended_compute_full(modular_reduce(M, mi), mi, &x, &y);
+        GcdInteger g = extended.gcd;
+        if (!extended.is_valid || g <= 0)
+        {
+            return MATH_ERROR_NO_SOLUTION;
+        }
+
+        GcdInteger diff = modular_reduce(ri - modular_reduce(r, mi), mi);
+        if (diff % g != 0)
+        {
+            return MATH_ERROR_NO_SOLUTION;
+        }
+
+        GcdInteger step = mi / g;
+        if (M > GCD_MAX_SAFE_VALUE / step)
+        {
+            return MATH_ERROR_OVERFLOW;
+        }
+
+        // k = (diff / g) * x (mod m_i / g); then r + M*k < M * step fits
+        GcdInteger k = (GcdInteger)math_mul_mod((MathNatural)modular_reduce(diff / g, step),
+                                                (MathNatural)modular_reduce(x, step),
+                                                (MathNatural)step);
+        r += M * k;
+        M *= step;
+    }
+
+    *result = r;
+    *modulus = M;
+    return MATH_SUCCESS;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file modular_arithmetic.h
+ * @brief Modular inverse and Chinese Remainder services built on the extended GCD
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares the two main consumers of the Bezout coefficients:
+ * modular inversion (a single value, or a whole array with Montgomery's
+ * trick) and Chinese Remainder recombination of residue systems.
+ */
+
+#ifndef MODULAR_ARITHMETIC_H
+#define MODULAR_ARITHMETIC_H
+
+#include "../../../core/domain/mathematical_types.h"
+#include "../domain_types.h"
+
+// ============================================================================
+// MODULAR INVERSION
+// ============================================================================
+
+/**
+ * @brief Inverse of a modulo m
+ *
+ * @param a Value to invert (any sign; reduced modulo m first)
+ * @param modulus Modulus (positive)
+ * @param inverse Output in [0, modulus)
+ * @return MATH_SUCCESS, MATH_ERROR_NO_SOLUTION if gcd(a, modulus) != 1,
+ *         or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus modinv(GcdInteger a, GcdInteger modulus, GcdInteger *inverse);
+
+/**
+ * @brief Inverses of count values modulo the same modulus
+ *
+ * Montgomery's trick: the prefix products are inverted with a single
+ * extended GCD and unwound again, for 3(count - 1) modular
+ * multiplications in total. Prefix products are kept in the output array,
+ * so no extra memory is used.
+ *
+ * If some value is not invertible the product is not either; every value
+ * is then inverted on its own, the non-invertible ones receive 0 and the
+ * call returns MATH_ERROR_NO_SOLUTION.
+ *
+ * @param values Values to invert (count elements, must not overlap inverses)
+ * @param inverses Output array (count elements), each in [0, modulus)
+ * @param count Number of values
+ * @param modulus Modulus (positive)
+ * @return MATH_SUCCESS, MATH_ERROR_NO_SOLUTION or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus modinv_batch(const GcdInteger *values, GcdInteger *inverses, MathNatural count, GcdInteger modulus);
+
+// ============================================================================
+// CHINESE REMAINDER THEOREM
+// ============================================================================
+
+/**
+ * @brief Combine x = residues[i] (mod moduli[i]) into one congruence
+ *
+ * Moduli need not be pairwise coprime: the result is taken modulo their
+ * least common multiple, and a system whose residues disagree modulo
+ * some gcd(moduli[i], moduli[j]) has no solution.
+ *
+ * @param residues Residues (count elements, any sign)
+ * @param moduli Moduli (count elements, positive)
+ * @param count Number of congruences (0 gives x = 0 mod 1)
+ * @param result Output in [0, *modulus)
+ * @param modulus Output: least common multiple of the moduli
+ * @return MATH_SUCCESS, MATH_ERROR_NO_SOLUTION if the system is inconsistent,
+ *         MATH_ERROR_OVERFLOW if the lcm exceeds 63 bits, or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus crt_combine(const GcdInteger *residues, const GcdInteger *moduli, MathNatural count,
+                       GcdInteger *result, GcdInteger *modulus);
+
+#endif // MODULAR_ARITHMETIC_H
@@ -14,12 +14,49 @@
 #include "../solutions/binary_family/solution_spec.h"
 #include "../../../infrastructure/utilities/memory_utils.h"
 #include "../../../infrastructure/utilities/math_utils.h"
+#include "../../../infrastructure/utilities/perf_counters.h"
 #include "../solutions/euclidean_family/implementations/classic.h"
 #include "../solutions/euclidean_family/implementations/recursive.h"
+#include "../solutions/euclidean_family/implementations/lehmer.h"
+#include "../solutions/euclidean_family/implementations/table_lookup.h"
+#include "../solutions/euclidean_family/implementations/extended_iterative.h"
 #include "../solutions/binary_family/implementations/stein.h"
+#include "../solutions/binary_family/implementations/stein_simd.h"
+#include "../solutions/binary_family/implementations/binary_extended.h"
+#include "../solutions/euclidean_family/implementations/bignum_euclidean.h"
+#include "../solutions/euclidean_family/implementations/bignum_half_gcd.h"
+#include "../solutions/binary_family/implementations/bignum_stein.h"
+#include "solution_registry.h"
+#include "gcd_dispatcher.h"
+#include "gcd_cache.h"
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+// Platform detection for the registration lock
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || defined(__MINGW32__)
+#ifndef SINGLE_THREADED
+#define HAS_POSIX_THREADS 1
+#endif
+#endif
+
+#ifdef HAS_POSIX_THREADS
+#include <pthread.h>
+#endif
+
+/**
+ * @brief Publication of a registry table: readers load it without the
+ *        lock, so it is released after the table is complete
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define REGISTRY_LOAD_TABLE() __atomic_load_n(&g_registry, __ATOMIC_ACQUIRE)
+#define REGISTRY_PUBLISH_TABLE(t) __atomic_store_n(&g_registry, (t), __ATOMIC_RELEASE)
+#else
+#define REGISTRY_LOAD_TABLE() (g_registry)
+#define REGISTRY_PUBLISH_TABLE(t) ((g_registry) = (t))
+#endif
+
 // ============================================================================
 // REGISTRY STRUCTURE
 // ============================================================================
@@ -27,7 +64,24 @@
 /**
  * @brief Maximum number of implementations that can be registered
  */
-#define MAX_REGISTERED_IMPLEMENTATIONS 16
+#define MAX_REGISTERED_IMPLEMENTATIONS GCD_VARIANT_CAPACITY
+
+/**
+ * @brief Compile-time check: every variant number has a performance counter slot
+ */
+typedef char registry_perf_slots_cover_variants[(GCD_VARIANT_CAPACITY <= PERF_COUNTER_SLOTS) ? 1 : -1];
+
+/**
+ * @brief Slots of the open-addressing name index (power of two, at least
+ *        twice MAX_REGISTERED_IMPLEMENTATIONS so probes stay short)
+ */
+#define REGISTRY_NAME_SLOTS 128
+
+/**
+ * @brief Block sizes of the n-ary reduction (first block, then doubling up to the cap)
+ */
+#define GCD_REDUCE_INITIAL_BLOCK 8
+#define GCD_REDUCE_MAX_BLOCK 256
 
 /**
  * @brief Registry entry for a GCD algorithm implementation
@@ -35,23 +89,157 @@
 typedef struct
 {
     GcdAlgorithmVariant variant;
-    const ImplementationSpec *implementation;
+    ImplementationSpec *implementation;
+    GcdAlgorithmFunc kernel; /**< Bare scalar kernel (positive operands), NULL if none */
     const char *display_name;
+    unsigned int roles; /**< GCD_REGISTRY_ROLE_* flags */
     bool is_available;
 } RegistryEntry;
 
 /**
- * @brief Main registry structure
+ * @brief One published state of the registry
+ *
+ * Entries are kept in registration order, which is the order listings
+ * report. Both indexes hold entry positions plus one (0 = empty), so they
+ * are rebuilt rather than patched when an entry is removed.
+ *
+ * A table is never changed once published. Registration copies the
+ * current table, changes the copy and publishes it, so lookups take no
+ * lock and see the registry either before or after a change. Replaced
+ * tables are kept, linked from their successor: a reader may still be
+ * walking one, and runtime registrations are rare.
  */
-typedef struct
+typedef struct RegistryTable
 {
     RegistryEntry entries[MAX_REGISTERED_IMPLEMENTATIONS];
     MathNatural entry_count;
-    bool is_initialized;
-} GcdSolutionRegistry;
+    unsigned char by_variant[GCD_VARIANT_CAPACITY]; /**< Variant -> entry position + 1 */
+    unsigned char by_name[REGISTRY_NAME_SLOTS];     /**< Name hash slot -> entry position + 1 */
+    const struct RegistryTable *replaced;           /**< Table this one replaced, NULL for the first */
+} RegistryTable;
+
+// Table of the built-in implementations, the first one published
+static RegistryTable g_registry_builtin;
+
+// Published table, NULL until gcd_registry_init
+static const RegistryTable *g_registry = NULL;
+
+#ifdef HAS_POSIX_THREADS
+// Serializes initialization, registration and removal
+static pthread_mutex_t g_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+// ============================================================================
+// REGISTRY INDEXES
+// ============================================================================
+
+/**
+ * @brief FNV-1a hash of an implementation name
+ */
+static uint32_t registry_hash_name(const char *name)
+{
+    uint32_t hash = 2166136261u;
+    for (const unsigned char *c = (const unsigned char *)name; *c != '\0'; c++)
+    {
+        hash = (hash ^ *c) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Find the name index slot holding a name, or the empty slot ending its probe
+ *
+ * @param table Registry table
+ * @param name Implementation name
+ * @return Slot position in table->by_name
+ */
+static unsigned int registry_name_slot(const RegistryTable *table, const char *name)
+{
+    unsigned int slot = registry_hash_name(name) & (REGISTRY_NAME_SLOTS - 1);
+    while (table->by_name[slot] != 0 &&
+           strcmp(table->entries[table->by_name[slot] - 1].implementation->metadata.name, name) != 0)
+    {
+        slot = (slot + 1) & (REGISTRY_NAME_SLOTS - 1);
+    }
+    return slot;
+}
+
+/**
+ * @brief Rebuild the variant and name indexes from the entry list
+ *
+ * The first entry registered under a variant or name wins, as the linear
+ * scans this replaces did.
+ *
+ * @param table Table being built (not yet published)
+ */
+static void registry_rebuild_indexes(RegistryTable *table)
+{
+    memset(table->by_variant, 0, sizeof(table->by_variant));
+    memset(table->by_name, 0, sizeof(table->by_name));
+
+    for (MathNatural i = 0; i < table->entry_count; i++)
+    {
+        const RegistryEntry *entry = &table->entries[i];
+        if (!entry->is_available)
+        {
+            continue;
+        }
+        if ((unsigned int)entry->variant < GCD_VARIANT_CAPACITY && table->by_variant[entry->variant] == 0)
+        {
+            table->by_variant[entry->variant] = (unsigned char)(i + 1);
+        }
+        unsigned int slot = registry_name_slot(table, entry->implementation->metadata.name);
+        if (table->by_name[slot] == 0)
+        {
+            table->by_name[slot] = (unsigned char)(i + 1);
+        }
+    }
+}
+
+/**
+ * @brief Find the available entry of a variant
+ *
+ * @param table Registry table
+ * @param variant Algorithm variant
+ * @return Entry, or NULL if not registered
+ */
+static const RegistryEntry *registry_find_by_variant(const RegistryTable *table, GcdAlgorithmVariant variant)
+{
+    if ((unsigned int)variant >= GCD_VARIANT_CAPACITY || table->by_variant[variant] == 0)
+    {
+        return NULL;
+    }
+    return &table->entries[table->by_variant[variant] - 1];
+}
+
+/**
+ * @brief Find the available entry whose implementation has the given name
+ *
+ * @param table Registry table
+ * @param name Implementation name
+ * @return Entry, or NULL if not found
+ */
+static const RegistryEntry *registry_find_by_name(const RegistryTable *table, const char *name)
+{
+    unsigned int slot = registry_name_slot(table, name);
+    return table->by_name[slot] != 0 ? &table->entries[table->by_name[slot] - 1] : NULL;
+}
 
-// Global registry instance
-static GcdSolutionRegistry g_registry = {0};
+/**
+ * @brief Published table, initializing the registry on first use
+ *
+ * @return Current table (never NULL)
+ */
+static const RegistryTable *registry_table(void)
+{
+    const RegistryTable *table = REGISTRY_LOAD_TABLE();
+    if (table == NULL)
+    {
+        gcd_registry_init();
+        table = REGISTRY_LOAD_TABLE();
+    }
+    return table;
+}
 
 // ============================================================================
 // REGISTRY INITIALIZATION
@@ -64,60 +252,179 @@ static GcdSolutionRegistry g_registry = {0};
  */
 MathStatus gcd_registry_init(void)
 {
-    if (g_registry.is_initialized)
+    if (REGISTRY_LOAD_TABLE() != NULL)
     {
         return MATH_SUCCESS; // Already initialized
     }
 
-    // Clear registry
-    memset(&g_registry, 0, sizeof(GcdSolutionRegistry));
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&g_registry_lock);
+#endif
+    if (g_registry != NULL)
+    {
+#ifdef HAS_POSIX_THREADS
+        pthread_mutex_unlock(&g_registry_lock);
+#endif
+        return MATH_SUCCESS; // Initialized by another thread meanwhile
+    }
+
+    RegistryTable *table = &g_registry_builtin;
+    memset(table, 0, sizeof(RegistryTable));
 
     // Register classic Euclidean implementations
-    g_registry.entries[g_registry.entry_count++] = (RegistryEntry){
+    table->entries[table->entry_count++] = (RegistryEntry){
         .variant = GCD_EUCLIDEAN_MODULO,
         .implementation = &euclidean_modulo_spec,
+        .kernel = mdc_modulo,
         .display_name = "Euclidean (Modulo)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
         .is_available = true};
 
-    g_registry.entries[g_registry.entry_count++] = (RegistryEntry){
+    table->entries[table->entry_count++] = (RegistryEntry){
         .variant = GCD_EUCLIDEAN_SUBTRACTION,
         .implementation = &euclidean_subtraction_spec,
+        .kernel = mdc_subtracao,
         .display_name = "Euclidean (Subtraction)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
         .is_available = true};
 
-    g_registry.entries[g_registry.entry_count++] = (RegistryEntry){
+    table->entries[table->entry_count++] = (RegistryEntry){
         .variant = GCD_EUCLIDEAN_DIVISION,
         .implementation = &euclidean_division_spec,
+        .kernel = mdc_divisao,
         .display_name = "Euclidean (Division)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
+        .is_available = true};
+
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_EUCLIDEAN_LEHMER,
+        .implementation = &euclidean_lehmer_spec,
+        .kernel = mdc_lehmer,
+        .display_name = "Euclidean (Lehmer)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
+        .is_available = true};
+
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_EUCLIDEAN_TABLE,
+        .implementation = &euclidean_table_spec,
+        .kernel = mdc_table,
+        .display_name = "Euclidean (Table Lookup)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
         .is_available = true};
 
     // Register recursive Euclidean implementations
-    g_registry.entries[g_registry.entry_count++] = (RegistryEntry){
+    table->entries[table->entry_count++] = (RegistryEntry){
         .variant = GCD_RECURSIVE_MODULO,
         .implementation = &euclidean_recursive_modulo_spec,
+        .kernel = mdc_mod,
         .display_name = "Recursive Euclidean (Modulo)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
         .is_available = true};
 
-    g_registry.entries[g_registry.entry_count++] = (RegistryEntry){
+    table->entries[table->entry_count++] = (RegistryEntry){
         .variant = GCD_RECURSIVE_SUBTRACTION,
         .implementation = &euclidean_recursive_subtraction_spec,
+        .kernel = mdc_sub,
         .display_name = "Recursive Euclidean (Subtraction)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
         .is_available = true};
 
-    g_registry.entries[g_registry.entry_count++] = (RegistryEntry){
+    table->entries[table->entry_count++] = (RegistryEntry){
         .variant = GCD_EXTENDED_EUCLIDEAN,
         .implementation = &euclidean_extended_spec,
         .display_name = "Extended Euclidean",
+        .roles = GCD_REGISTRY_ROLE_WORD,
+        .is_available = true};
+
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_EXTENDED_ITERATIVE,
+        .implementation = &euclidean_extended_iterative_spec,
+        .display_name = "Extended Euclidean (Iterative)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
         .is_available = true};
 
     // Register binary implementations
-    g_registry.entries[g_registry.entry_count++] = (RegistryEntry){
+    table->entries[table->entry_count++] = (RegistryEntry){
         .variant = GCD_BINARY_STEIN,
         .implementation = &stein_binary_spec,
+        .kernel = mdc_stein,
         .display_name = "Stein Binary GCD",
+        .roles = GCD_REGISTRY_ROLE_WORD,
+        .is_available = true};
+
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_BINARY_STEIN_CTZ,
+        .implementation = &stein_ctz_spec,
+        .kernel = mdc_stein_ctz,
+        .display_name = "Stein Binary GCD (CTZ)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
+        .is_available = true};
+
+    stein_simd_init_spec();
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_BINARY_STEIN_SIMD,
+        .implementation = &stein_simd_spec,
+        .display_name = "Stein Binary GCD (SIMD)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
+        .is_available = true};
+
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_BINARY_EXTENDED,
+        .implementation = &binary_extended_spec,
+        .display_name = "Binary Extended GCD",
+        .roles = GCD_REGISTRY_ROLE_WORD,
+        .is_available = true};
+
+    // Register arbitrary-precision implementations
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_BIGNUM_MODULO,
+        .implementation = &bignum_euclidean_modulo_spec,
+        .display_name = "Bignum Euclidean (Modulo)",
+        .roles = GCD_REGISTRY_ROLE_BIG,
+        .is_available = true};
+
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_BIGNUM_LEHMER,
+        .implementation = &bignum_euclidean_lehmer_spec,
+        .display_name = "Bignum Euclidean (Lehmer)",
+        .roles = GCD_REGISTRY_ROLE_BIG,
+        .is_available = true};
+
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_BIGNUM_EXTENDED,
+        .implementation = &bignum_euclidean_extended_spec,
+        .display_name = "Bignum Extended Euclidean",
+        .roles = GCD_REGISTRY_ROLE_BIG,
+        .is_available = true};
+
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_BIGNUM_HALF_GCD,
+        .implementation = &bignum_half_gcd_spec,
+        .display_name = "Bignum Half-GCD",
+        .roles = GCD_REGISTRY_ROLE_BIG,
+        .is_available = true};
+
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_BIGNUM_STEIN,
+        .implementation = &bignum_stein_spec,
+        .display_name = "Bignum Stein Binary GCD",
+        .roles = GCD_REGISTRY_ROLE_BIG,
+        .is_available = true};
+
+    // Register the dispatcher last: it runs the kernels registered above
+    table->entries[table->entry_count++] = (RegistryEntry){
+        .variant = GCD_AUTO,
+        .implementation = &gcd_auto_spec,
+        .kernel = gcd_dispatch_gcd,
+        .display_name = "Auto (Calibrated Dispatch)",
+        .roles = GCD_REGISTRY_ROLE_WORD,
         .is_available = true};
 
-    g_registry.is_initialized = true;
+    registry_rebuild_indexes(table);
+    REGISTRY_PUBLISH_TABLE(table);
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&g_registry_lock);
+#endif
     return MATH_SUCCESS;
 }
 
@@ -128,7 +435,7 @@ MathStatus gcd_registry_init(void)
  */
 bool gcd_registry_is_initialized(void)
 {
-    return g_registry.is_initialized;
+    return REGISTRY_LOAD_TABLE() != NULL;
 }
 
 // ============================================================================
@@ -143,20 +450,10 @@ bool gcd_registry_is_initialized(void)
  */
 const ImplementationSpec *gcd_registry_get_implementation(GcdAlgorithmVariant variant)
 {
-    if (!gcd_registry_is_initialized())
-    {
-        gcd_registry_init();
-    }
+    const RegistryTable *table = registry_table();
 
-    for (MathNatural i = 0; i < g_registry.entry_count; i++)
-    {
-        if (g_registry.entries[i].variant == variant && g_registry.entries[i].is_available)
-        {
-            return g_registry.entries[i].implementation;
-        }
-    }
-
-    return NULL;
+    const RegistryEntry *entry = registry_find_by_variant(table, variant);
+    return entry != NULL ? entry->implementation : NULL;
 }
 
 /**
@@ -167,28 +464,28 @@ const ImplementationSpec *gcd_registry_get_implementation(GcdAlgorithmVariant va
  */
 const ImplementationSpec *gcd_registry_get_implementation_by_name(const char *name)
 {
-    if (!gcd_registry_is_initialized() || name == NULL)
+    const RegistryTable *table = registry_table();
+    if (name == NULL)
     {
-        if (!gcd_registry_is_initialized())
-        {
-            gcd_registry_init();
-        }
-        if (name == NULL)
-        {
-            return NULL;
-        }
+        return NULL;
     }
 
-    for (MathNatural i = 0; i < g_registry.entry_count; i++)
-    {
-        if (g_registry.entries[i].is_available &&
-            strcmp(g_registry.entries[i].implementation->metadata.name, name) == 0)
-        {
-            return g_registry.entries[i].implementation;
-        }
-    }
+    const RegistryEntry *entry = registry_find_by_name(table, name);
+    return entry != NULL ? entry->implementation : NULL;
+}
 
-    return NULL;
+/**
+ * @brief Get the bare scalar kernel of a variant
+ *
+ * @param variant Algorithm variant
+ * @return Kernel, or NULL if the variant has none or is not registered
+ */
+GcdAlgorithmFunc gcd_registry_get_kernel(GcdAlgorithmVariant variant)
+{
+    const RegistryTable *table = registry_table();
+
+    const RegistryEntry *entry = registry_find_by_variant(table, variant);
+    return entry != NULL ? entry->kernel : NULL;
 }
 
 /**
@@ -208,7 +505,24 @@ MathResult gcd_registry_execute(GcdAlgorithmVariant variant, GcdInteger a, GcdIn
     }
 
     MathBinaryInput input = {.operand_a = a, .operand_b = b};
-    return spec->compute(&input);
+
+    // Repeated pairs come from the result cache, within the variant's input contract
+    GcdInteger cached;
+    if ((spec->validate == NULL || spec->validate(&input)) && gcd_cache_lookup(variant, a, b, &cached))
+    {
+        return math_create_success_result(cached, 0, 0.0);
+    }
+
+    uint64_t start = PERF_TIMER_START();
+    MathResult result = spec->compute(&input);
+    uint64_t stop = PERF_TIMER_STOP();
+
+    if (MATH_IS_VALID_RESULT(result))
+    {
+        PERF_RECORD((unsigned int)variant, stop - start, 1, result.iterations);
+        gcd_cache_store(variant, a, b, result.value);
+    }
+    return result;
 }
 
 /**
@@ -221,14 +535,491 @@ MathResult gcd_registry_execute(GcdAlgorithmVariant variant, GcdInteger a, GcdIn
  */
 MathResult gcd_registry_execute_by_name(const char *name, GcdInteger a, GcdInteger b)
 {
-    const ImplementationSpec *spec = gcd_registry_get_implementation_by_name(name);
+    const RegistryTable *table = registry_table();
+
+    const RegistryEntry *entry = name != NULL ? registry_find_by_name(table, name) : NULL;
+    if (entry == NULL)
+    {
+        return math_create_error_result(MATH_ERROR_NOT_IMPLEMENTED, 0, 0.0);
+    }
+
+    return gcd_registry_execute(entry->variant, a, b);
+}
+
+/**
+ * @brief Execute algorithm by variant on arbitrary-precision operands
+ *
+ * @param variant Algorithm variant to execute
+ * @param input Arbitrary-precision input
+ * @return MathResult whose value is the bit length of the GCD
+ */
+MathResult gcd_registry_execute_big(GcdAlgorithmVariant variant, const MathBigBinaryInput *input)
+{
+    const ImplementationSpec *spec = gcd_registry_get_implementation(variant);
+    if (spec == NULL || spec->compute_big == NULL)
+    {
+        return math_create_error_result(MATH_ERROR_NOT_IMPLEMENTED, 0, 0.0);
+    }
+
+    uint64_t start = PERF_TIMER_START();
+    MathResult result = spec->compute_big(input);
+    uint64_t stop = PERF_TIMER_STOP();
+
+    if (MATH_IS_VALID_RESULT(result))
+    {
+        PERF_RECORD((unsigned int)variant, stop - start, 1, result.iterations);
+    }
+    return result;
+}
+
+/**
+ * @brief Execute algorithm by variant on unsigned operands
+ *
+ * @param variant Algorithm variant to execute
+ * @param a First operand
+ * @param b Second operand
+ * @return MathUnsignedResult with computation result
+ */
+MathUnsignedResult gcd_registry_execute_unsigned(GcdAlgorithmVariant variant, MathWideNatural a, MathWideNatural b)
+{
+    const ImplementationSpec *spec = gcd_registry_get_implementation(variant);
+    if (spec == NULL || spec->compute_unsigned == NULL)
+    {
+        return math_create_unsigned_error_result(MATH_ERROR_NOT_IMPLEMENTED);
+    }
+
+    MathUnsignedBinaryInput input = {.operand_a = a, .operand_b = b};
+    uint64_t start = PERF_TIMER_START();
+    MathUnsignedResult result = spec->compute_unsigned(&input);
+    uint64_t stop = PERF_TIMER_STOP();
+
+    if (result.is_valid && result.status == MATH_SUCCESS)
+    {
+        PERF_RECORD((unsigned int)variant, stop - start, 1, result.iterations);
+    }
+    return result;
+}
+
+/**
+ * @brief Run a validated batch through an implementation
+ *
+ * Uses the implementation's batch fast path when it provides one, and
+ * otherwise falls back to a per-pair loop over its compute function.
+ *
+ * @param spec Implementation to run
+ * @param input Validated batch input
+ * @return Batch summary result
+ */
+static MathResult registry_execute_batch_spec(const ImplementationSpec *spec, const MathBatchInput *input)
+{
+    if (spec->compute_batch != NULL)
+    {
+        return spec->compute_batch(input);
+    }
+
+    // Generic fallback for implementations without a batch fast path
+    MathNatural failed = 0;
+    double start_time = math_get_time_ms();
+    for (MathNatural i = 0; i < input->count; i++)
+    {
+        MathBinaryInput pair = {.operand_a = input->operands_a[i], .operand_b = input->operands_b[i]};
+        MathResult result = spec->compute(&pair);
+        if (MATH_IS_VALID_RESULT(result))
+        {
+            input->results[i] = result.value;
+        }
+        else
+        {
+            input->results[i] = MATH_INVALID_VALUE;
+            failed++;
+        }
+    }
+    double end_time = math_get_time_ms();
+
+    return math_create_batch_result(input->count, failed, math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Execute algorithm by variant over a batch of operand pairs
+ *
+ * @param variant Algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @return Batch summary result (value = pairs computed successfully)
+ */
+MathResult gcd_registry_execute_batch(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    MathNatural n)
+{
+    const ImplementationSpec *spec = gcd_registry_get_implementation(variant);
     if (spec == NULL)
     {
         return math_create_error_result(MATH_ERROR_NOT_IMPLEMENTED, 0, 0.0);
     }
 
-    MathBinaryInput input = {.operand_a = a, .operand_b = b};
-    return spec->compute(&input);
+    MathBatchInput input = MATH_BATCH_INPUT_INIT(a, b, out, n);
+    if (!memory_validate_batch_input(&input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    uint64_t start = PERF_TIMER_START();
+    MathResult result = registry_execute_batch_spec(spec, &input);
+    uint64_t stop = PERF_TIMER_STOP();
+
+    // Every computed pair counts as one call of the average latency
+    if (result.value > 0)
+    {
+        PERF_RECORD((unsigned int)variant, stop - start, (MathNatural)result.value, 0);
+    }
+    return result;
+}
+
+/**
+ * @brief Execute an extended algorithm over a batch, returning Bezout coefficients
+ *
+ * @param variant Extended algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param x Output array receiving the coefficient of each a[i]
+ * @param y Output array receiving the coefficient of each b[i]
+ * @param n Number of operand pairs
+ * @return Batch summary result (value = pairs computed successfully)
+ */
+MathResult gcd_registry_execute_batch_extended(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    GcdInteger *x,
+    GcdInteger *y,
+    MathNatural n)
+{
+    const ImplementationSpec *spec = gcd_registry_get_implementation(variant);
+    if (spec == NULL || spec->compute_batch == NULL || !GCD_VARIANT_HAS_COEFFICIENTS(variant))
+    {
+        return math_create_error_result(MATH_ERROR_NOT_IMPLEMENTED, 0, 0.0);
+    }
+
+    MathBatchInput input = MATH_BATCH_INPUT_INIT(a, b, out, n);
+    input.coefficients_x = x;
+    input.coefficients_y = y;
+    if (!memory_validate_batch_input(&input) || (n > 0 && (x == NULL || y == NULL)))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    uint64_t start = PERF_TIMER_START();
+    MathResult result = spec->compute_batch(&input);
+    uint64_t stop = PERF_TIMER_STOP();
+
+    if (result.value > 0)
+    {
+        PERF_RECORD((unsigned int)variant, stop - start, (MathNatural)result.value, 0);
+    }
+    return result;
+}
+
+/**
+ * @brief Compute one level of the reduction tree: results[i] = gcd(values[i], operands[i])
+ *
+ * results may alias values, which every batch kernel allows since it
+ * reads a pair before writing its result.
+ *
+ * @param spec Implementation to run
+ * @param values First operands (half elements)
+ * @param operands Second operands (half elements)
+ * @param results Output (half elements)
+ * @param half Number of pairs
+ * @return true if every pair was computed
+ */
+static bool registry_reduce_level(const ImplementationSpec *spec, const GcdInteger *values,
+                                  const GcdInteger *operands, GcdInteger *results, MathNatural half)
+{
+    MathBatchInput input = MATH_BATCH_INPUT_INIT(values, operands, results, half);
+    MathResult result = registry_execute_batch_spec(spec, &input);
+    return result.value >= 0 && (MathNatural)result.value == half;
+}
+
+/**
+ * @brief Reduce an array to the GCD of all its values
+ *
+ * Values are consumed in blocks. Each block is reduced by a pairwise tree
+ * of batch calls (block/2 + block/4 + ... pairs, one call per level) into
+ * a scratch buffer, and the block GCD is then folded into the running
+ * GCD. Blocks start small and double up to GCD_REDUCE_MAX_BLOCK, so data
+ * that reaches GCD_IDENTITY after a few values (most random data) stops
+ * almost immediately while long runs still amortize the per-call cost.
+ *
+ * @param variant Algorithm variant to execute
+ * @param values Values to reduce
+ * @param n Number of values
+ * @return MathResult with value = GCD and iterations = values consumed
+ */
+MathResult gcd_registry_execute_reduce(GcdAlgorithmVariant variant, const GcdInteger *values, MathNatural n)
+{
+    const ImplementationSpec *spec = gcd_registry_get_implementation(variant);
+    if (spec == NULL)
+    {
+        return math_create_error_result(MATH_ERROR_NOT_IMPLEMENTED, 0, 0.0);
+    }
+    if (values == NULL && n > 0)
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    GcdInteger scratch[GCD_REDUCE_MAX_BLOCK / 2 + 1];
+    GcdInteger running = GCD_UNDEFINED; // gcd(0, x) = |x|
+    MathNatural block_size = GCD_REDUCE_INITIAL_BLOCK;
+    MathNatural consumed = 0;
+    bool valid = true;
+
+    double start_time = math_get_time_ms();
+    while (consumed < n && running != GCD_IDENTITY)
+    {
+        const GcdInteger *block = values + consumed;
+        MathNatural length = MATH_MIN(block_size, n - consumed);
+        consumed += length;
+        block_size = MATH_MIN(block_size * 2, GCD_REDUCE_MAX_BLOCK);
+
+        // First level reads the caller's array, later levels work in place
+        MathNatural half = length / 2;
+        if (half == 0)
+        {
+            scratch[0] = block[0];
+            half = 1;
+        }
+        else
+        {
+            valid = registry_reduce_level(spec, block, block + half, scratch, half);
+            if (length % 2 != 0)
+            {
+                scratch[half++] = block[length - 1];
+            }
+        }
+        while (valid && half > 1)
+        {
+            MathNatural next = half / 2;
+            valid = registry_reduce_level(spec, scratch, scratch + next, scratch, next);
+            if (half % 2 != 0)
+            {
+                scratch[next++] = scratch[half - 1];
+            }
+            half = next;
+        }
+
+        // Also normalizes the sign of a single-value block
+        valid = valid && registry_reduce_level(spec, &running, scratch, &running, 1);
+        if (!valid)
+        {
+            break;
+        }
+    }
+    double end_time = math_get_time_ms();
+
+    if (!valid)
+    {
+        return math_create_error_result(MATH_ERROR_OVERFLOW, consumed, math_elapsed_time_ms(start_time, end_time));
+    }
+    return math_create_success_result(running, consumed, math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Merge externally collected performance metrics into an implementation
+ *
+ * @param variant Algorithm variant whose metrics are updated
+ * @param metrics Metrics to merge (e.g. aggregated from worker threads)
+ * @return MATH_SUCCESS, or MATH_ERROR_NOT_IMPLEMENTED if variant is unknown
+ */
+MathStatus gcd_registry_merge_performance(GcdAlgorithmVariant variant, const MathPerformanceMetrics *metrics)
+{
+    if (metrics == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    const RegistryTable *table = registry_table();
+
+    const RegistryEntry *entry = registry_find_by_variant(table, variant);
+    if (entry == NULL)
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+
+    math_merge_performance_metrics(&entry->implementation->performance, metrics);
+    return MATH_SUCCESS;
+}
+
+// ============================================================================
+// RUNTIME REGISTRATION
+// ============================================================================
+
+/**
+ * @brief Copy the published table as the start of its replacement
+ *
+ * Called with the registration lock held.
+ *
+ * @return New unpublished table, or NULL if out of memory
+ */
+static RegistryTable *registry_copy_table(void)
+{
+    const RegistryTable *current = g_registry;
+    RegistryTable *table = (RegistryTable *)malloc(sizeof(RegistryTable));
+    if (table != NULL)
+    {
+        *table = *current;
+        table->replaced = current;
+    }
+    return table;
+}
+
+/**
+ * @brief Register an implementation under a new runtime variant
+ *
+ * @param spec Implementation (must provide compute and a unique name)
+ * @param kernel Bare scalar kernel, or NULL if none
+ * @param display_name Display name, or NULL to use the implementation name
+ * @param roles GCD_REGISTRY_ROLE_* flags
+ * @param variant Output for the assigned variant
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT, MATH_ERROR_OVERFLOW or
+ *         MATH_ERROR_MEMORY
+ */
+MathStatus gcd_registry_register(ImplementationSpec *spec, GcdAlgorithmFunc kernel,
+                                 const char *display_name, unsigned int roles, GcdAlgorithmVariant *variant)
+{
+    if (spec == NULL || spec->compute == NULL || spec->metadata.name[0] == '\0' || variant == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    gcd_registry_init();
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&g_registry_lock);
+#endif
+
+    const RegistryTable *current = g_registry;
+    unsigned int id = GCD_VARIANT_COUNT;
+    while (id < GCD_VARIANT_CAPACITY && current->by_variant[id] != 0)
+    {
+        id++;
+    }
+
+    MathStatus status = MATH_SUCCESS;
+    RegistryTable *table = NULL;
+    if (registry_find_by_name(current, spec->metadata.name) != NULL)
+    {
+        status = MATH_ERROR_INVALID_INPUT;
+    }
+    else if (id == GCD_VARIANT_CAPACITY || current->entry_count == MAX_REGISTERED_IMPLEMENTATIONS)
+    {
+        status = MATH_ERROR_OVERFLOW;
+    }
+    else if ((table = registry_copy_table()) == NULL)
+    {
+        status = MATH_ERROR_MEMORY;
+    }
+    else
+    {
+        table->entries[table->entry_count++] = (RegistryEntry){
+            .variant = (GcdAlgorithmVariant)id,
+            .implementation = spec,
+            .kernel = kernel,
+            .display_name = display_name != NULL ? display_name : spec->metadata.name,
+            .roles = roles,
+            .is_available = true};
+        registry_rebuild_indexes(table);
+        REGISTRY_PUBLISH_TABLE(table);
+        *variant = (GcdAlgorithmVariant)id;
+    }
+
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&g_registry_lock);
+#endif
+    return status;
+}
+
+/**
+ * @brief Remove an implementation registered at runtime
+ *
+ * @param variant Variant returned by gcd_registry_register
+ * @return MATH_SUCCESS; MATH_ERROR_INVALID_INPUT for a built-in variant;
+ *         MATH_ERROR_NOT_IMPLEMENTED if the variant is not registered;
+ *         MATH_ERROR_MEMORY if the new table cannot be allocated
+ */
+MathStatus gcd_registry_unregister(GcdAlgorithmVariant variant)
+{
+    if ((unsigned int)variant < GCD_VARIANT_COUNT)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    gcd_registry_init();
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&g_registry_lock);
+#endif
+
+    const RegistryEntry *entry = registry_find_by_variant(g_registry, variant);
+    MathStatus status = MATH_SUCCESS;
+    RegistryTable *table = NULL;
+    if (entry == NULL)
+    {
+        status = MATH_ERROR_NOT_IMPLEMENTED;
+    }
+    else if ((table = registry_copy_table()) == NULL)
+    {
+        status = MATH_ERROR_MEMORY;
+    }
+    else
+    {
+        MathNatural position = (MathNatural)(entry - g_registry->entries);
+        memmove(&table->entries[position], &table->entries[position + 1],
+                (size_t)(table->entry_count - position - 1) * sizeof(RegistryEntry));
+        table->entry_count--;
+        registry_rebuild_indexes(table);
+        REGISTRY_PUBLISH_TABLE(table);
+
+        // The number is reused by the next registration, which must start
+        // from zero counts and must not see this implementation's results
+        perf_reset((unsigned int)variant);
+        gcd_cache_invalidate_variant(variant);
+    }
+
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&g_registry_lock);
+#endif
+    return status;
+}
+
+/**
+ * @brief Find the variant of an implementation name
+ *
+ * @param name Implementation name
+ * @param variant Output variant
+ * @return true if the name is registered
+ */
+bool gcd_registry_find_variant(const char *name, GcdAlgorithmVariant *variant)
+{
+    if (name == NULL || variant == NULL)
+    {
+        return false;
+    }
+
+    const RegistryTable *table = registry_table();
+
+    const RegistryEntry *entry = registry_find_by_name(table, name);
+    if (entry == NULL)
+    {
+        return false;
+    }
+
+    *variant = entry->variant;
+    return true;
 }
 
 // ============================================================================
@@ -244,22 +1035,48 @@ MathResult gcd_registry_execute_by_name(const char *name, GcdInteger a, GcdInteg
  */
 MathNatural gcd_registry_list_variants(GcdAlgorithmVariant *variants, MathNatural max_variants)
 {
-    if (!gcd_registry_is_initialized())
+    const RegistryTable *table = registry_table();
+
+    if (variants == NULL || max_variants == 0)
     {
-        gcd_registry_init();
+        return table->entry_count; // Return count without filling array
     }
 
-    if (variants == NULL || max_variants == 0)
+    MathNatural count = 0;
+    for (MathNatural i = 0; i < table->entry_count && count < max_variants; i++)
+    {
+        if (table->entries[i].is_available)
+        {
+            variants[count++] = table->entries[i].variant;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Get the available variants taking part in a role, in registration order
+ *
+ * @param role GCD_REGISTRY_ROLE_* flag
+ * @param variants Array to store variants
+ * @param max_variants Maximum number of variants to return
+ * @return Number of variants stored
+ */
+MathNatural gcd_registry_list_role(unsigned int role, GcdAlgorithmVariant *variants, MathNatural max_variants)
+{
+    const RegistryTable *table = registry_table();
+
+    if (variants == NULL)
     {
-        return g_registry.entry_count; // Return count without filling array
+        return 0;
     }
 
     MathNatural count = 0;
-    for (MathNatural i = 0; i < g_registry.entry_count && count < max_variants; i++)
+    for (MathNatural i = 0; i < table->entry_count && count < max_variants; i++)
     {
-        if (g_registry.entries[i].is_available)
+        if (table->entries[i].is_available && (table->entries[i].roles & role) != 0)
         {
-            variants[count++] = g_registry.entries[i].variant;
+            variants[count++] = table->entries[i].variant;
         }
     }
 
@@ -275,22 +1092,19 @@ MathNatural gcd_registry_list_variants(GcdAlgorithmVariant *variants, MathNatura
  */
 MathNatural gcd_registry_list_names(const char **names, MathNatural max_names)
 {
-    if (!gcd_registry_is_initialized())
-    {
-        gcd_registry_init();
-    }
+    const RegistryTable *table = registry_table();
 
     if (names == NULL || max_names == 0)
     {
-        return g_registry.entry_count; // Return count without filling array
+        return table->entry_count; // Return count without filling array
     }
 
     MathNatural count = 0;
-    for (MathNatural i = 0; i < g_registry.entry_count && count < max_names; i++)
+    for (MathNatural i = 0; i < table->entry_count && count < max_names; i++)
     {
-        if (g_registry.entries[i].is_available)
+        if (table->entries[i].is_available)
         {
-            names[count++] = g_registry.entries[i].implementation->metadata.name;
+            names[count++] = table->entries[i].implementation->metadata.name;
         }
     }
 
@@ -305,20 +1119,10 @@ MathNatural gcd_registry_list_names(const char **names, MathNatural max_names)
  */
 const char *gcd_registry_get_display_name(GcdAlgorithmVariant variant)
 {
-    if (!gcd_registry_is_initialized())
-    {
-        gcd_registry_init();
-    }
+    const RegistryTable *table = registry_table();
 
-    for (MathNatural i = 0; i < g_registry.entry_count; i++)
-    {
-        if (g_registry.entries[i].variant == variant && g_registry.entries[i].is_available)
-        {
-            return g_registry.entries[i].display_name;
-        }
-    }
-
-    return "Unknown";
+    const RegistryEntry *entry = registry_find_by_variant(table, variant);
+    return entry != NULL ? entry->display_name : "Unknown";
 }
 
 /**
@@ -328,15 +1132,12 @@ const char *gcd_registry_get_display_name(GcdAlgorithmVariant variant)
  */
 MathNatural gcd_registry_get_count(void)
 {
-    if (!gcd_registry_is_initialized())
-    {
-        gcd_registry_init();
-    }
+    const RegistryTable *table = registry_table();
 
     MathNatural count = 0;
-    for (MathNatural i = 0; i < g_registry.entry_count; i++)
+    for (MathNatural i = 0; i < table->entry_count; i++)
     {
-        if (g_registry.entries[i].is_available)
+        if (table->entries[i].is_available)
         {
             count++;
         }
@@ -358,10 +1159,7 @@ MathNatural gcd_registry_get_count(void)
  */
 MathNatural gcd_registry_list_euclidean_variants(GcdAlgorithmVariant *variants, MathNatural max_variants)
 {
-    if (!gcd_registry_is_initialized())
-    {
-        gcd_registry_init();
-    }
+    const RegistryTable *table = registry_table();
 
     if (variants == NULL || max_variants == 0)
     {
@@ -369,15 +1167,12 @@ MathNatural gcd_registry_list_euclidean_variants(GcdAlgorithmVariant *variants,
     }
 
     MathNatural count = 0;
-    for (MathNatural i = 0; i < g_registry.entry_count && count < max_variants; i++)
+    for (MathNatural i = 0; i < table->entry_count && count < max_variants; i++)
     {
-        if (g_registry.entries[i].is_available)
+        if (table->entries[i].is_available &&
+            table->entries[i].implementation->metadata.family == ALGORITHM_FAMILY_EUCLIDEAN)
         {
-            GcdAlgorithmVariant variant = g_registry.entries[i].variant;
-            if (is_classic_euclidean_variant(variant) || is_recursive_euclidean_variant(variant))
-            {
-                variants[count++] = variant;
-            }
+            variants[count++] = table->entries[i].variant;
         }
     }
 
@@ -393,10 +1188,7 @@ MathNatural gcd_registry_list_euclidean_variants(GcdAlgorithmVariant *variants,
  */
 MathNatural gcd_registry_list_binary_variants(GcdAlgorithmVariant *variants, MathNatural max_variants)
 {
-    if (!gcd_registry_is_initialized())
-    {
-        gcd_registry_init();
-    }
+    const RegistryTable *table = registry_table();
 
     if (variants == NULL || max_variants == 0)
     {
@@ -404,15 +1196,12 @@ MathNatural gcd_registry_list_binary_variants(GcdAlgorithmVariant *variants, Mat
     }
 
     MathNatural count = 0;
-    for (MathNatural i = 0; i < g_registry.entry_count && count < max_variants; i++)
+    for (MathNatural i = 0; i < table->entry_count && count < max_variants; i++)
     {
-        if (g_registry.entries[i].is_available)
+        if (table->entries[i].is_available &&
+            table->entries[i].implementation->metadata.family == ALGORITHM_FAMILY_BINARY)
         {
-            GcdAlgorithmVariant variant = g_registry.entries[i].variant;
-            if (is_stein_variant(variant))
-            {
-                variants[count++] = variant;
-            }
+            variants[count++] = table->entries[i].variant;
         }
     }
 
@@ -424,44 +1213,51 @@ MathNatural gcd_registry_list_binary_variants(GcdAlgorithmVariant *variants, Mat
 // ============================================================================
 
 /**
- * @brief Print all available implementations to console
+ * @brief Print the available implementations of one family
+ *
+ * @param table Registry table
+ * @param family Algorithm family
  */
-void gcd_registry_print_all(void)
+static void registry_print_family(const RegistryTable *table, MathAlgorithmFamily family)
 {
-    if (!gcd_registry_is_initialized())
+    for (MathNatural i = 0; i < table->entry_count; i++)
     {
-        gcd_registry_init();
+        if (table->entries[i].is_available && table->entries[i].implementation->metadata.family == family)
+        {
+            printf("  - %-25s (%s)\n",
+                   table->entries[i].display_name,
+                   table->entries[i].implementation->metadata.name);
+        }
     }
+}
+
+/**
+ * @brief Print all available implementations to console
+ */
+void gcd_registry_print_all(void)
+{
+    const RegistryTable *table = registry_table();
 
     printf("=== Available GCD Algorithm Implementations ===\n\n");
 
     printf("Euclidean Family:\n");
-    for (MathNatural i = 0; i < g_registry.entry_count; i++)
-    {
-        if (g_registry.entries[i].is_available)
-        {
-            GcdAlgorithmVariant variant = g_registry.entries[i].variant;
-            if (is_classic_euclidean_variant(variant) || is_recursive_euclidean_variant(variant))
-            {
-                printf("  - %-25s (%s)\n",
-                       g_registry.entries[i].display_name,
-                       g_registry.entries[i].implementation->metadata.name);
-            }
-        }
-    }
+    registry_print_family(table, ALGORITHM_FAMILY_EUCLIDEAN);
 
     printf("\nBinary Family:\n");
-    for (MathNatural i = 0; i < g_registry.entry_count; i++)
+    registry_print_family(table, ALGORITHM_FAMILY_BINARY);
+
+    printf("\nAdaptive:\n");
+    registry_print_family(table, ALGORITHM_FAMILY_ADAPTIVE);
+
+    // Runtime registrations may leave the family unclassified
+    for (MathNatural i = 0; i < table->entry_count; i++)
     {
-        if (g_registry.entries[i].is_available)
+        if (table->entries[i].is_available &&
+            table->entries[i].implementation->metadata.family == ALGORITHM_FAMILY_UNKNOWN)
         {
-            GcdAlgorithmVariant variant = g_registry.entries[i].variant;
-            if (is_stein_variant(variant))
-            {
-                printf("  - %-25s (%s)\n",
-                       g_registry.entries[i].display_name,
-                       g_registry.entries[i].implementation->metadata.name);
-            }
+            printf("\nOther:\n");
+            registry_print_family(table, ALGORITHM_FAMILY_UNKNOWN);
+            break;
         }
     }
 
@@ -486,7 +1282,23 @@ void gcd_registry_print_implementation_info(GcdAlgorithmVariant variant)
     printf("Name: %s\n", spec->metadata.name);
     printf("Display Name: %s\n", gcd_registry_get_display_name(variant));
     printf("Description: %s\n", spec->metadata.description);
-    printf("Family: %s\n", (spec->metadata.family == ALGORITHM_FAMILY_EUCLIDEAN) ? "Euclidean" : "Binary");
+    const char *family;
+    switch (spec->metadata.family)
+    {
+    case ALGORITHM_FAMILY_EUCLIDEAN:
+        family = "Euclidean";
+        break;
+    case ALGORITHM_FAMILY_BINARY:
+        family = "Binary";
+        break;
+    case ALGORITHM_FAMILY_ADAPTIVE:
+        family = "Adaptive";
+        break;
+    default:
+        family = "Unknown";
+        break;
+    }
+    printf("Family: %s\n", family);
     printf("Recursive: %s\n", spec->metadata.is_recursive ? "Yes" : "No");
 
     const char *complexity;
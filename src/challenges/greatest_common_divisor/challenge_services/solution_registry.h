@@ -7,6 +7,12 @@
  * This header defines a registry service that organizes and provides access
  * to all available GCD algorithm implementations. Simple and focused on
  * providing easy access to algorithms.
+ *
+ * Lookups by variant and by name are constant time. Further
+ * implementations can be registered and removed at runtime, also while
+ * batches, jobs or the server run on other threads: each change publishes
+ * a new copy of the registry, so lookups take no lock and see it either
+ * before or after the change.
  */
 
 #ifndef SOLUTION_REGISTRY_H
@@ -18,6 +24,16 @@
 #include "../../../core/domain/mathematical_types.h"
 #include <stdbool.h>
 
+// ============================================================================
+// REGISTRY ROLES
+// ============================================================================
+
+/**
+ * @brief Roles an implementation takes part in (combinable flags)
+ */
+#define GCD_REGISTRY_ROLE_WORD 0x1u /**< Compared and benchmarked on 64-bit operands */
+#define GCD_REGISTRY_ROLE_BIG 0x2u  /**< Compared and benchmarked on arbitrary-precision operands */
+
 // ============================================================================
 // REGISTRY INITIALIZATION
 // ============================================================================
@@ -56,9 +72,27 @@ const ImplementationSpec *gcd_registry_get_implementation(GcdAlgorithmVariant va
  */
 const ImplementationSpec *gcd_registry_get_implementation_by_name(const char *name);
 
+/**
+ * @brief Get the bare scalar kernel of a variant
+ *
+ * The kernel is the function the implementation's compute wraps, without
+ * validation, special cases, timing or counters: it must be called with
+ * positive operands below 2^63 and returns their GCD. Variants with no
+ * scalar kernel (extended, SIMD batch-only and arbitrary-precision
+ * variants) return NULL.
+ *
+ * @param variant Algorithm variant
+ * @return Kernel, or NULL if the variant has none or is not registered
+ */
+GcdAlgorithmFunc gcd_registry_get_kernel(GcdAlgorithmVariant variant);
+
 /**
  * @brief Execute algorithm by variant
  *
+ * Pairs the variant accepts are answered from the result cache
+ * (gcd_cache.h) when it is enabled and holds them; hits report no
+ * iterations or time and are not recorded in the performance counters.
+ *
  * @param variant Algorithm variant to execute
  * @param a First operand
  * @param b Second operand
@@ -76,6 +110,153 @@ MathResult gcd_registry_execute(GcdAlgorithmVariant variant, GcdInteger a, GcdIn
  */
 MathResult gcd_registry_execute_by_name(const char *name, GcdInteger a, GcdInteger b);
 
+/**
+ * @brief Execute algorithm by variant on arbitrary-precision operands
+ *
+ * Only implementations that provide compute_big take part; others
+ * report MATH_ERROR_NOT_IMPLEMENTED.
+ *
+ * @param variant Algorithm variant to execute
+ * @param input Arbitrary-precision input
+ * @return MathResult whose value is the bit length of the GCD
+ */
+MathResult gcd_registry_execute_big(GcdAlgorithmVariant variant, const MathBigBinaryInput *input);
+
+/**
+ * @brief Execute algorithm by variant on unsigned operands
+ *
+ * Only implementations that provide compute_unsigned take part; others
+ * report MATH_ERROR_NOT_IMPLEMENTED. The result cache is not consulted.
+ *
+ * @param variant Algorithm variant to execute
+ * @param a First operand (any MathWideNatural)
+ * @param b Second operand (any MathWideNatural)
+ * @return MathUnsignedResult with computation result
+ */
+MathUnsignedResult gcd_registry_execute_unsigned(GcdAlgorithmVariant variant, MathWideNatural a, MathWideNatural b);
+
+/**
+ * @brief Execute algorithm by variant over a batch of operand pairs
+ *
+ * Uses the implementation's batch fast path when it provides one, and
+ * otherwise falls back to a per-pair loop over its compute function.
+ * The batch is timed once as a whole.
+ *
+ * @param variant Algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @return Batch summary result (value = pairs computed successfully)
+ */
+MathResult gcd_registry_execute_batch(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    MathNatural n);
+
+/**
+ * @brief Execute an extended algorithm over a batch, returning Bezout coefficients
+ *
+ * Only variants satisfying GCD_VARIANT_HAS_COEFFICIENTS are accepted. For
+ * every pair a[i] * x[i] + b[i] * y[i] = out[i], with out[i] >= 0.
+ *
+ * @param variant Extended algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param x Output array receiving the coefficient of each a[i]
+ * @param y Output array receiving the coefficient of each b[i]
+ * @param n Number of operand pairs
+ * @return Batch summary result (value = pairs computed successfully)
+ */
+MathResult gcd_registry_execute_batch_extended(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    GcdInteger *x,
+    GcdInteger *y,
+    MathNatural n);
+
+/**
+ * @brief Reduce an array to the GCD of all its values
+ *
+ * Runs a pairwise tree of batch calls over blocks of the array, so each
+ * value costs one GCD inside a batch kernel rather than one dispatch,
+ * and stops as soon as the running GCD reaches GCD_IDENTITY. An empty
+ * array gives GCD_UNDEFINED. Not timed per value and not recorded in the
+ * implementation's performance metrics.
+ *
+ * @param variant Algorithm variant to execute
+ * @param values Values to reduce (any sign)
+ * @param n Number of values
+ * @return MathResult with value = gcd(values) >= 0 and iterations = values
+ *         consumed before stopping; MATH_ERROR_OVERFLOW if a value is LLONG_MIN
+ */
+MathResult gcd_registry_execute_reduce(GcdAlgorithmVariant variant, const GcdInteger *values, MathNatural n);
+
+/**
+ * @brief Merge externally collected performance metrics into an implementation
+ *
+ * Not thread-safe: call from a single thread once parallel work has finished.
+ *
+ * @param variant Algorithm variant whose metrics are updated
+ * @param metrics Metrics to merge (e.g. aggregated from worker threads)
+ * @return MATH_SUCCESS, or MATH_ERROR_NOT_IMPLEMENTED if variant is unknown
+ */
+MathStatus gcd_registry_merge_performance(GcdAlgorithmVariant variant, const MathPerformanceMetrics *metrics);
+
+// ============================================================================
+// RUNTIME REGISTRATION
+// ============================================================================
+
+/**
+ * @brief Register an implementation under a new runtime variant
+ *
+ * The specification and display name are referenced, not copied: they
+ * must outlive the registration. The variant is reported by listings,
+ * the analyzer and name lookups like a built-in one. Thread-safe.
+ *
+ * @param spec Implementation (must provide compute and a unique name)
+ * @param kernel Bare scalar kernel, or NULL if none
+ * @param display_name Display name, or NULL to use the implementation name
+ * @param roles GCD_REGISTRY_ROLE_* flags
+ * @param variant Output for the assigned variant (>= GCD_VARIANT_COUNT)
+ * @return MATH_SUCCESS; MATH_ERROR_INVALID_INPUT for a missing spec,
+ *         compute or name, or a name already registered;
+ *         MATH_ERROR_OVERFLOW when GCD_RUNTIME_VARIANT_COUNT are registered;
+ *         MATH_ERROR_MEMORY if the new registry copy cannot be allocated
+ */
+MathStatus gcd_registry_register(ImplementationSpec *spec, GcdAlgorithmFunc kernel,
+                                 const char *display_name, unsigned int roles, GcdAlgorithmVariant *variant);
+
+/**
+ * @brief Remove an implementation registered at runtime
+ *
+ * Its variant number may be handed out again, with its performance
+ * counters and cached results cleared. Thread-safe, but calls that
+ * already looked the implementation up may still be running it: the
+ * specification must stay valid until they return, and a result they
+ * record meanwhile may survive the reset.
+ *
+ * @param variant Variant returned by gcd_registry_register
+ * @return MATH_SUCCESS; MATH_ERROR_INVALID_INPUT for a built-in variant;
+ *         MATH_ERROR_NOT_IMPLEMENTED if the variant is not registered;
+ *         MATH_ERROR_MEMORY if the new registry copy cannot be allocated
+ */
+MathStatus gcd_registry_unregister(GcdAlgorithmVariant variant);
+
+/**
+ * @brief Find the variant of an implementation name
+ *
+ * @param name Implementation name
+ * @param variant Output variant
+ * @return true if the name is registered
+ */
+bool gcd_registry_find_variant(const char *name, GcdAlgorithmVariant *variant);
+
 // ============================================================================
 // REGISTRY LISTING AND INFORMATION
 // ============================================================================
@@ -89,6 +270,16 @@ MathResult gcd_registry_execute_by_name(const char *name, GcdInteger a, GcdInteg
  */
 MathNatural gcd_registry_list_variants(GcdAlgorithmVariant *variants, MathNatural max_variants);
 
+/**
+ * @brief Get the available variants taking part in a role, in registration order
+ *
+ * @param role GCD_REGISTRY_ROLE_* flag
+ * @param variants Array to store variants
+ * @param max_variants Maximum number of variants to return
+ * @return Number of variants stored
+ */
+MathNatural gcd_registry_list_role(unsigned int role, GcdAlgorithmVariant *variants, MathNatural max_variants);
+
 /**
  * @brief Get list of all available implementation names
  *
@@ -0,0 +1,60 @@
+/**
+ * @file step_counter.c
+ * @brief Instrumented builds: count the division, subtraction and shift steps of GCD kernels
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ */
+
+#include "step_counter.h"
+#include "../../../infrastructure/utilities/memory_utils.h"
+
+#ifdef GCD_COUNT_STEPS
+GCD_STEP_THREAD_LOCAL GcdStepCounts gcd_step_counts;
+#endif
+
+// ============================================================================
+// STEP COUNTS
+// ============================================================================
+
+/**
+ * @brief Total steps of all kinds
+ *
+ * @param counts Counts to sum
+ * @return divisions + subtractions + shifts (0 for NULL)
+ */
+MathNatural gcd_steps_total(const GcdStepCounts *counts)
+{
+    if (counts == NULL)
+    {
+        return 0;
+    }
+    return counts->divisions + counts->subtractions + counts->shifts;
+}
+
+/**
+ * @brief Clear the calling thread's counts
+ */
+void gcd_steps_reset(void)
+{
+#ifdef GCD_COUNT_STEPS
+    memory_clear(&gcd_step_counts, sizeof(gcd_step_counts));
+#endif
+}
+
+/**
+ * @brief Read the calling thread's counts
+ *
+ * @param counts Output counts (all zero when counting is compiled out)
+ */
+void gcd_steps_read(GcdStepCounts *counts)
+{
+    if (counts == NULL)
+    {
+        return;
+    }
+#ifdef GCD_COUNT_STEPS
+    *counts = gcd_step_counts;
+#else
+    memory_clear(counts, sizeof(*counts));
+#endif
+}
@@ -0,0 +1,103 @@
+/**
+ * @file step_counter.h
+ * @brief Instrumented builds: count the division, subtraction and shift steps of GCD kernels
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Building with -DGCD_COUNT_STEPS makes every 64-bit kernel count its
+ * steps in a thread-local GcdStepCounts: one division per quotient or
+ * remainder computed, one subtraction per subtractive reduction and one
+ * shift per shift of an operand (a count-trailing-zeros shift counts
+ * once, however many bits it removes). The interface wrappers reset the
+ * counts before the kernel runs and report their total as the result's
+ * iterations, so compare can rank algorithms by work done instead of by
+ * timer readings that are noise at these sizes. The SIMD kernel is not
+ * instrumented (its lanes step in lockstep) and reports no steps.
+ *
+ * Without the flag the counting macros expand to nothing, the kernels
+ * are unchanged and results report 0 iterations as before.
+ */
+
+#ifndef GCD_STEP_COUNTER_H
+#define GCD_STEP_COUNTER_H
+
+#include "../../../core/domain/mathematical_types.h"
+
+// ============================================================================
+// STEP COUNTS
+// ============================================================================
+
+/**
+ * @brief Steps performed by one kernel call
+ */
+typedef struct
+{
+    MathNatural divisions;    /**< Quotients or remainders computed */
+    MathNatural subtractions; /**< Subtractive reductions */
+    MathNatural shifts;       /**< Operand shifts (a multi-bit shift counts once) */
+} GcdStepCounts;
+
+/**
+ * @brief Total steps of all kinds
+ *
+ * @param counts Counts to sum
+ * @return divisions + subtractions + shifts (0 for NULL)
+ */
+MathNatural gcd_steps_total(const GcdStepCounts *counts);
+
+/**
+ * @brief Clear the calling thread's counts
+ */
+void gcd_steps_reset(void);
+
+/**
+ * @brief Read the calling thread's counts
+ *
+ * @param counts Output counts (all zero when counting is compiled out)
+ */
+void gcd_steps_read(GcdStepCounts *counts);
+
+// ============================================================================
+// COUNTING (compiled in with -DGCD_COUNT_STEPS)
+// ============================================================================
+
+#ifdef GCD_COUNT_STEPS
+
+#define GCD_STEP_COUNTING_ENABLED 1
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GCD_STEP_THREAD_LOCAL __thread
+#else
+#define GCD_STEP_THREAD_LOCAL
+#endif
+
+/**
+ * @brief Counts of the calling thread (updated by the macros below)
+ */
+extern GCD_STEP_THREAD_LOCAL GcdStepCounts gcd_step_counts;
+
+#define GCD_COUNT_DIVISION() (gcd_step_counts.divisions++)
+#define GCD_COUNT_SUBTRACTION() (gcd_step_counts.subtractions++)
+#define GCD_COUNT_SHIFT() (gcd_step_counts.shifts++)
+
+/**
+ * @brief Bracket a kernel call in an interface wrapper
+ *
+ * GCD_STEPS_BEGIN clears the counts; GCD_STEPS_END yields their total,
+ * to be reported as the result's iterations.
+ */
+#define GCD_STEPS_BEGIN() gcd_steps_reset()
+#define GCD_STEPS_END() gcd_steps_total(&gcd_step_counts)
+
+#else
+
+#define GCD_STEP_COUNTING_ENABLED 0
+#define GCD_COUNT_DIVISION() ((void)0)
+#define GCD_COUNT_SUBTRACTION() ((void)0)
+#define GCD_COUNT_SHIFT() ((void)0)
+#define GCD_STEPS_BEGIN() ((void)0)
+#define GCD_STEPS_END() ((MathNatural)0)
+
+#endif // GCD_COUNT_STEPS
+
+#endif // GCD_STEP_COUNTER_H
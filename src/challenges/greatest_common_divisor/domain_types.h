@@ -57,9 +57,38 @@ typedef enum
     GCD_BINARY_STEIN,          /**< Binary GCD (Stein's algorithm) */
     GCD_RECURSIVE_MODULO,      /**< Recursive Euclidean with modulo */
     GCD_RECURSIVE_SUBTRACTION, /**< Recursive Euclidean with subtraction */
-    GCD_EXTENDED_EUCLIDEAN     /**< Extended Euclidean algorithm */
+    GCD_EXTENDED_EUCLIDEAN,    /**< Extended Euclidean algorithm */
+    GCD_BINARY_STEIN_SIMD,     /**< Binary GCD vectorized across SIMD lanes */
+    GCD_BINARY_STEIN_CTZ,      /**< Binary GCD with count-trailing-zeros (hybrid) */
+    GCD_EUCLIDEAN_LEHMER,      /**< Lehmer's GCD on leading machine digits */
+    GCD_EXTENDED_ITERATIVE,    /**< Extended Euclidean without recursion */
+    GCD_BINARY_EXTENDED,       /**< Binary extended GCD (shifts and subtractions) */
+    GCD_BIGNUM_MODULO,         /**< Arbitrary-precision Euclidean with long division */
+    GCD_BIGNUM_LEHMER,         /**< Arbitrary-precision Lehmer's GCD */
+    GCD_BIGNUM_EXTENDED,       /**< Arbitrary-precision Extended Euclidean */
+    GCD_BIGNUM_STEIN,          /**< Arbitrary-precision binary GCD (Stein's algorithm) */
+    GCD_EUCLIDEAN_TABLE,       /**< Euclidean GCD finished from a precomputed small-operand table */
+    GCD_BIGNUM_HALF_GCD,       /**< Arbitrary-precision subquadratic half-GCD (Knuth-Schönhage) */
+    GCD_AUTO                   /**< Per-input choice among the variants above (calibrated dispatch) */
 } GcdAlgorithmVariant;
 
+/**
+ * @brief Number of algorithm variants (bound for per-variant arrays)
+ */
+#define GCD_VARIANT_COUNT (GCD_AUTO + 1)
+
+/**
+ * @brief Variants that can be registered at runtime (gcd_registry_register)
+ *
+ * Runtime variants are numbered from GCD_VARIANT_COUNT upwards.
+ */
+#define GCD_RUNTIME_VARIANT_COUNT 32
+
+/**
+ * @brief Bound on every variant number, built-in or runtime
+ */
+#define GCD_VARIANT_CAPACITY (GCD_VARIANT_COUNT + GCD_RUNTIME_VARIANT_COUNT)
+
 // ============================================================================
 // GCD-SPECIFIC CONSTANTS
 // ============================================================================
@@ -109,6 +138,13 @@ typedef struct
 #define GCD_IS_VALID_POSITIVE(result) \
     (MATH_IS_VALID_RESULT(result) && (result).value > 0)
 
+/**
+ * @brief Check if a variant's batch path can write Bezout coefficients
+ */
+#define GCD_VARIANT_HAS_COEFFICIENTS(variant) ((variant) == GCD_EXTENDED_EUCLIDEAN || \
+                                               (variant) == GCD_EXTENDED_ITERATIVE || \
+                                               (variant) == GCD_BINARY_EXTENDED)
+
 /**
  * @brief Initialize Extended GCD result
  */
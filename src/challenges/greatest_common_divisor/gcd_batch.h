@@ -0,0 +1,173 @@
+/**
+ * @file gcd_batch.h
+ * @brief Shared driver for the batch implementations of the GCD variants
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Every variant's compute_batch runs the same loop: validate the batch,
+ * reject pairs with an LLONG_MIN operand (its absolute value does not fit
+ * a GcdInteger), run the kernel on the absolute values of every other
+ * pair and time the whole batch once. The drivers are static inline and
+ * take the kernel as a constant argument, so the compiler inlines the
+ * kernel into the loop as if it had been written out by hand.
+ */
+
+#ifndef GCD_BATCH_H
+#define GCD_BATCH_H
+
+#include "domain_types.h"
+#include "../../infrastructure/utilities/math_utils.h"
+#include "../../infrastructure/utilities/memory_utils.h"
+#include <limits.h>
+
+// ============================================================================
+// KERNEL TYPES
+// ============================================================================
+
+/**
+ * @brief GCD of two non-negative operands
+ */
+typedef GcdInteger (*GcdBatchPairKernel)(GcdInteger a, GcdInteger b);
+
+/**
+ * @brief GCD and Bezout coefficients of two non-negative operands
+ */
+typedef GcdInteger (*GcdBatchExtendedKernel)(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y);
+
+/**
+ * @brief Whole-array kernel (see gcd_batch_pairs for the contract)
+ *
+ * @return Number of rejected pairs
+ */
+typedef MathNatural (*GcdBatchArrayKernel)(const GcdInteger *a, const GcdInteger *b, GcdInteger *out, MathNatural n);
+
+// ============================================================================
+// PAIR LOOPS
+// ============================================================================
+
+/**
+ * @brief Run a pair kernel over operand arrays
+ *
+ * Pairs with an LLONG_MIN operand get MATH_INVALID_VALUE; the kernel sees
+ * the absolute values of the others.
+ *
+ * @return Number of rejected pairs
+ */
+static inline MathNatural gcd_batch_pairs(const GcdInteger *a, const GcdInteger *b, GcdInteger *out, MathNatural n,
+                                          GcdBatchPairKernel kernel)
+{
+    MathNatural failed = 0;
+    for (MathNatural i = 0; i < n; i++)
+    {
+        if (a[i] == LLONG_MIN || b[i] == LLONG_MIN)
+        {
+            out[i] = MATH_INVALID_VALUE;
+            failed++;
+            continue;
+        }
+        out[i] = kernel(MATH_ABS(a[i]), MATH_ABS(b[i]));
+    }
+    return failed;
+}
+
+// ============================================================================
+// BATCH DRIVERS
+// ============================================================================
+
+/**
+ * @brief Validate, run and time a whole-array kernel over a batch
+ *
+ * @param input Batch input
+ * @param kernel Array kernel
+ * @return Batch summary result
+ */
+static inline MathResult gcd_batch_run_array(const MathBatchInput *input, GcdBatchArrayKernel kernel)
+{
+    if (!memory_validate_batch_input(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    double start_time = math_get_time_ms();
+    MathNatural failed = kernel(input->operands_a, input->operands_b, input->results, input->count);
+    double end_time = math_get_time_ms();
+
+    return math_create_batch_result(input->count, failed, math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Validate, run and time a pair kernel over a batch
+ *
+ * @param input Batch input
+ * @param kernel Pair kernel (receives non-negative operands)
+ * @return Batch summary result
+ */
+static inline MathResult gcd_batch_run(const MathBatchInput *input, GcdBatchPairKernel kernel)
+{
+    if (!memory_validate_batch_input(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    double start_time = math_get_time_ms();
+    MathNatural failed = gcd_batch_pairs(input->operands_a, input->operands_b, input->results, input->count, kernel);
+    double end_time = math_get_time_ms();
+
+    return math_create_batch_result(input->count, failed, math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Validate, run and time an extended kernel over a batch
+ *
+ * Coefficients are written when the batch provides coefficient arrays,
+ * with signs flipped to match the signed operands (rejected pairs get 0).
+ *
+ * @param input Batch input
+ * @param kernel Extended kernel (receives non-negative operands)
+ * @return Batch summary result
+ */
+static inline MathResult gcd_batch_run_extended(const MathBatchInput *input, GcdBatchExtendedKernel kernel)
+{
+    if (!memory_validate_batch_input(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    const GcdInteger *operands_a = input->operands_a;
+    const GcdInteger *operands_b = input->operands_b;
+    GcdInteger *coefficients_x = input->coefficients_x;
+    GcdInteger *coefficients_y = input->coefficients_y;
+    MathNatural failed = 0;
+
+    double start_time = math_get_time_ms();
+    for (MathNatural i = 0; i < input->count; i++)
+    {
+        GcdInteger a = operands_a[i];
+        GcdInteger b = operands_b[i];
+        GcdInteger x = 0, y = 0;
+        if (a == LLONG_MIN || b == LLONG_MIN)
+        {
+            input->results[i] = MATH_INVALID_VALUE;
+            failed++;
+        }
+        else
+        {
+            input->results[i] = kernel(MATH_ABS(a), MATH_ABS(b), &x, &y);
+            x = a < 0 ? -x : x;
+            y = b < 0 ? -y : y;
+        }
+        if (coefficients_x != NULL)
+        {
+            coefficients_x[i] = x;
+        }
+        if (coefficients_y != NULL)
+        {
+            coefficients_y[i] = y;
+        }
+    }
+    double end_time = math_get_time_ms();
+
+    return math_create_batch_result(input->count, failed, math_elapsed_time_ms(start_time, end_time));
+}
+
+#endif // GCD_BATCH_H
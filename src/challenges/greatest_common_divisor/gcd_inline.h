@@ -0,0 +1,468 @@
+/**
+ * @file gcd_inline.h
+ * @brief Header-only GCD kernels for inlining into hot loops
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The registry runs every algorithm through ImplementationSpec.compute, an
+ * indirect call the compiler cannot see through. For loops where that
+ * call is the cost, this header provides the core kernels as static
+ * inline functions specialized per operand width:
+ *
+ * - gcd_inline_modulo_*: Euclid with the remainder operator
+ * - gcd_inline_stein_*: binary GCD with count-trailing-zeros
+ * - gcd_inline_extended_*: iterative Extended Euclid (Bezout coefficients)
+ *
+ * Widths are u32, u64 and, where the compiler has it, u128 (unsigned
+ * __int128), plus i64 wrappers that take GcdInteger operands of any sign.
+ * With C11 generic selection (or GCC 4.9+/Clang in C99 mode) the
+ * gcd_inline_modulo(a, b), gcd_inline_stein(a, b) and
+ * gcd_inline_extended(a, b, x, y) macros pick the width from the usual
+ * arithmetic conversion of a and b, so the call never leaves the caller.
+ *
+ * Kernels compute the same values as the registered variants but count no
+ * steps and take no timings; the registry path stays the one to analyze
+ * algorithms with.
+ */
+
+#ifndef GCD_INLINE_H
+#define GCD_INLINE_H
+
+#include "domain_types.h"
+#include <limits.h>
+#include <stdint.h>
+
+#if defined(__SIZEOF_INT128__)
+#define GCD_INLINE_HAS_UINT128 1
+#endif
+
+#if (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L) || defined(__clang__) || \
+    (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define GCD_INLINE_HAS_GENERIC 1
+#endif
+
+// ============================================================================
+// BIT SCANS
+// ============================================================================
+
+/**
+ * @brief Count trailing zeros of a non-zero 32-bit value
+ */
+static inline unsigned int gcd_inline_ctz32(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_ctz(x);
+#else
+    unsigned int n = 0;
+    while ((x & 1u) == 0)
+    {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Count trailing zeros of a non-zero 64-bit value
+ */
+static inline unsigned int gcd_inline_ctz64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_ctzll(x);
+#else
+    unsigned int n = 0;
+    while ((x & 1u) == 0)
+    {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+#ifdef GCD_INLINE_HAS_UINT128
+/**
+ * @brief Count trailing zeros of a non-zero 128-bit value
+ */
+static inline unsigned int gcd_inline_ctz128(unsigned __int128 x)
+{
+    uint64_t low = (uint64_t)x;
+    return low != 0 ? gcd_inline_ctz64(low) : 64u + gcd_inline_ctz64((uint64_t)(x >> 64));
+}
+#endif
+
+// ============================================================================
+// EUCLID (MODULO)
+// ============================================================================
+
+/**
+ * @brief Euclid with the remainder operator on 32-bit operands
+ */
+static inline uint32_t gcd_inline_modulo_u32(uint32_t a, uint32_t b)
+{
+    while (b != 0)
+    {
+        uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/**
+ * @brief Euclid with the remainder operator on 64-bit operands
+ */
+static inline uint64_t gcd_inline_modulo_u64(uint64_t a, uint64_t b)
+{
+    while (b != 0)
+    {
+        uint64_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+#ifdef GCD_INLINE_HAS_UINT128
+/**
+ * @brief Euclid with the remainder operator on 128-bit operands
+ *
+ * 128-bit division is a library call, so the kernel switches to 64-bit
+ * steps as soon as both operands fit in 64 bits.
+ */
+static inline unsigned __int128 gcd_inline_modulo_u128(unsigned __int128 a, unsigned __int128 b)
+{
+    while (((a | b) >> 64) != 0)
+    {
+        if (b == 0)
+        {
+            return a;
+        }
+        unsigned __int128 r = a % b;
+        a = b;
+        b = r;
+    }
+    return gcd_inline_modulo_u64((uint64_t)a, (uint64_t)b);
+}
+#endif
+
+// ============================================================================
+// BINARY GCD (COUNT TRAILING ZEROS)
+// ============================================================================
+// After both operands are made odd, each step replaces the larger one by
+// the (even) difference and strips its factors of two in one shift. The
+// compare-and-swap has no data-dependent branch once compiled to
+// conditional moves, and the loop exits on u == v, which keeps the shift
+// off the path of the exit test. Unlike mdc_stein_ctz the difference is
+// taken in unsigned arithmetic, so the full width of each type works.
+
+/**
+ * @brief Binary GCD on 32-bit operands
+ */
+static inline uint32_t gcd_inline_stein_u32(uint32_t u, uint32_t v)
+{
+    if (u == 0 || v == 0)
+    {
+        return u | v;
+    }
+    unsigned int shift = gcd_inline_ctz32(u | v);
+    u >>= gcd_inline_ctz32(u);
+    v >>= gcd_inline_ctz32(v);
+    while (u != v)
+    {
+        uint32_t smaller = u < v ? u : v;
+        v = u < v ? v - u : u - v;
+        u = smaller;
+        v >>= gcd_inline_ctz32(v);
+    }
+    return u << shift;
+}
+
+/**
+ * @brief Binary GCD on 64-bit operands
+ */
+static inline uint64_t gcd_inline_stein_u64(uint64_t u, uint64_t v)
+{
+    if (u == 0 || v == 0)
+    {
+        return u | v;
+    }
+    unsigned int shift = gcd_inline_ctz64(u | v);
+    u >>= gcd_inline_ctz64(u);
+    v >>= gcd_inline_ctz64(v);
+    while (u != v)
+    {
+        uint64_t smaller = u < v ? u : v;
+        v = u < v ? v - u : u - v;
+        u = smaller;
+        v >>= gcd_inline_ctz64(v);
+    }
+    return u << shift;
+}
+
+#ifdef GCD_INLINE_HAS_UINT128
+/**
+ * @brief Binary GCD on 128-bit operands
+ */
+static inline unsigned __int128 gcd_inline_stein_u128(unsigned __int128 u, unsigned __int128 v)
+{
+    if (u == 0 || v == 0)
+    {
+        return u | v;
+    }
+    unsigned int shift = gcd_inline_ctz128(u | v);
+    u >>= gcd_inline_ctz128(u);
+    v >>= gcd_inline_ctz128(v);
+    while (u != v)
+    {
+        // Both odd and below 2^64: finish in 64-bit arithmetic
+        if (((u | v) >> 64) == 0)
+        {
+            return (unsigned __int128)gcd_inline_stein_u64((uint64_t)u, (uint64_t)v) << shift;
+        }
+        unsigned __int128 smaller = u < v ? u : v;
+        v = u < v ? v - u : u - v;
+        u = smaller;
+        v >>= gcd_inline_ctz128(v);
+    }
+    return u << shift;
+}
+#endif
+
+// ============================================================================
+// EXTENDED EUCLID
+// ============================================================================
+// The cosequences are updated in wrap-around unsigned arithmetic. Their
+// last values can exceed the signed range, but the coefficients returned
+// satisfy |x| <= b / (2g) and |y| <= a / (2g) (or are 0 and 1), so the
+// result modulo 2^width read back as a signed value is the exact one.
+// a * x + b * y = g holds for every width.
+
+/**
+ * @brief Extended Euclid on 32-bit operands
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param x Output coefficient of a
+ * @param y Output coefficient of b
+ * @return gcd(a, b)
+ */
+static inline uint32_t gcd_inline_extended_u32(uint32_t a, uint32_t b, int32_t *x, int32_t *y)
+{
+    uint32_t old_s = 1, s = 0, old_t = 0, t = 1;
+    while (b != 0)
+    {
+        uint32_t q = a / b;
+        uint32_t r = a - q * b;
+        uint32_t next_s = old_s - q * s;
+        uint32_t next_t = old_t - q * t;
+        a = b;
+        b = r;
+        old_s = s;
+        s = next_s;
+        old_t = t;
+        t = next_t;
+    }
+    *x = (int32_t)old_s;
+    *y = (int32_t)old_t;
+    return a;
+}
+
+/**
+ * @brief Extended Euclid on 64-bit operands
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param x Output coefficient of a
+ * @param y Output coefficient of b
+ * @return gcd(a, b)
+ */
+static inline uint64_t gcd_inline_extended_u64(uint64_t a, uint64_t b, int64_t *x, int64_t *y)
+{
+    uint64_t old_s = 1, s = 0, old_t = 0, t = 1;
+    while (b != 0)
+    {
+        uint64_t q = a / b;
+        uint64_t r = a - q * b;
+        uint64_t next_s = old_s - q * s;
+        uint64_t next_t = old_t - q * t;
+        a = b;
+        b = r;
+        old_s = s;
+        s = next_s;
+        old_t = t;
+        t = next_t;
+    }
+    *x = (int64_t)old_s;
+    *y = (int64_t)old_t;
+    return a;
+}
+
+#ifdef GCD_INLINE_HAS_UINT128
+/**
+ * @brief Extended Euclid on 128-bit operands
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param x Output coefficient of a
+ * @param y Output coefficient of b
+ * @return gcd(a, b)
+ */
+static inline unsigned __int128 gcd_inline_extended_u128(unsigned __int128 a, unsigned __int128 b, __int128 *x,
+                                                         __int128 *y)
+{
+    unsigned __int128 old_s = 1, s = 0, old_t = 0, t = 1;
+    while (b != 0)
+    {
+        unsigned __int128 q = a / b;
+        unsigned __int128 r = a - q * b;
+        unsigned __int128 next_s = old_s - q * s;
+        unsigned __int128 next_t = old_t - q * t;
+        a = b;
+        b = r;
+        old_s = s;
+        s = next_s;
+        old_t = t;
+        t = next_t;
+    }
+    *x = (__int128)old_s;
+    *y = (__int128)old_t;
+    return a;
+}
+#endif
+
+// ============================================================================
+// SIGNED OPERANDS
+// ============================================================================
+// Magnitudes are taken in unsigned arithmetic; results are non-negative.
+// LLONG_MIN is not supported, as in the registered 64-bit variants.
+
+/**
+ * @brief Magnitude of a signed operand
+ */
+static inline uint64_t gcd_inline_magnitude(GcdInteger a)
+{
+    return a < 0 ? 0 - (uint64_t)a : (uint64_t)a;
+}
+
+/**
+ * @brief Euclid with the remainder operator on signed 64-bit operands
+ */
+static inline GcdInteger gcd_inline_modulo_i64(GcdInteger a, GcdInteger b)
+{
+    return (GcdInteger)gcd_inline_modulo_u64(gcd_inline_magnitude(a), gcd_inline_magnitude(b));
+}
+
+/**
+ * @brief Binary GCD on signed 64-bit operands
+ */
+static inline GcdInteger gcd_inline_stein_i64(GcdInteger a, GcdInteger b)
+{
+    return (GcdInteger)gcd_inline_stein_u64(gcd_inline_magnitude(a), gcd_inline_magnitude(b));
+}
+
+/**
+ * @brief Extended Euclid on signed 64-bit operands
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param x Output coefficient of a
+ * @param y Output coefficient of b
+ * @return gcd(a, b), with a * x + b * y equal to it
+ */
+static inline GcdInteger gcd_inline_extended_i64(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y)
+{
+    int64_t coefficient_a;
+    int64_t coefficient_b;
+    uint64_t g = gcd_inline_extended_u64(gcd_inline_magnitude(a), gcd_inline_magnitude(b), &coefficient_a,
+                                         &coefficient_b);
+    *x = a < 0 ? -coefficient_a : coefficient_a;
+    *y = b < 0 ? -coefficient_b : coefficient_b;
+    return (GcdInteger)g;
+}
+
+// ============================================================================
+// WIDEST NATIVE OPERANDS
+// ============================================================================
+// MathWideNatural is unsigned __int128 exactly when GCD_INLINE_HAS_UINT128
+// is defined; the u128 kernels already drop to 64-bit steps once both
+// operands fit.
+
+/**
+ * @brief Euclid with the remainder operator on MathWideNatural operands
+ */
+static inline MathWideNatural gcd_inline_modulo_wide(MathWideNatural a, MathWideNatural b)
+{
+#ifdef GCD_INLINE_HAS_UINT128
+    return gcd_inline_modulo_u128(a, b);
+#else
+    return gcd_inline_modulo_u64(a, b);
+#endif
+}
+
+/**
+ * @brief Binary GCD on MathWideNatural operands
+ */
+static inline MathWideNatural gcd_inline_stein_wide(MathWideNatural a, MathWideNatural b)
+{
+#ifdef GCD_INLINE_HAS_UINT128
+    return gcd_inline_stein_u128(a, b);
+#else
+    return gcd_inline_stein_u64(a, b);
+#endif
+}
+
+// ============================================================================
+// GENERIC SELECTION
+// ============================================================================
+// Signed and narrow types go to the i64 and u32 kernels. unsigned long is
+// routed by its width, since it is the same size as either uint32_t or
+// uint64_t depending on the data model.
+
+#ifdef GCD_INLINE_HAS_GENERIC
+
+#if ULONG_MAX == UINT32_MAX
+#define GCD_INLINE_ULONG(kernel) kernel##_u32
+#else
+#define GCD_INLINE_ULONG(kernel) kernel##_u64
+#endif
+
+#ifdef GCD_INLINE_HAS_UINT128
+#define GCD_INLINE_SELECT_UINT128(kernel) , unsigned __int128 : kernel##_u128
+#else
+#define GCD_INLINE_SELECT_UINT128(kernel)
+#endif
+
+/**
+ * @brief Kernel for the common type of two operands
+ */
+#define GCD_INLINE_SELECT(kernel, a, b) _Generic((a) + (b), \
+    unsigned int: kernel##_u32,                           \
+    unsigned long: GCD_INLINE_ULONG(kernel),              \
+    unsigned long long: kernel##_u64                      \
+    GCD_INLINE_SELECT_UINT128(kernel),                    \
+    default: kernel##_i64)
+
+/**
+ * @brief GCD by Euclid's remainder loop at the width of the operands
+ */
+#define gcd_inline_modulo(a, b) GCD_INLINE_SELECT(gcd_inline_modulo, a, b)((a), (b))
+
+/**
+ * @brief GCD by the ctz binary algorithm at the width of the operands
+ */
+#define gcd_inline_stein(a, b) GCD_INLINE_SELECT(gcd_inline_stein, a, b)((a), (b))
+
+/**
+ * @brief Extended GCD at the width of the operands
+ *
+ * x and y must point to the signed type of the selected width: int32_t
+ * for unsigned int, int64_t (GcdInteger) for 64-bit and signed operands,
+ * __int128 for unsigned __int128.
+ */
+#define gcd_inline_extended(a, b, x, y) GCD_INLINE_SELECT(gcd_inline_extended, a, b)((a), (b), (x), (y))
+
+#endif // GCD_INLINE_HAS_GENERIC
+
+#endif // GCD_INLINE_H
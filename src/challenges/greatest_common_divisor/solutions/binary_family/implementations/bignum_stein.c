@@ -0,0 +1,182 @@
+/**
+ * @file bignum_stein.c
+ * @brief Arbitrary-precision binary GCD implementation
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Stein's algorithm over MathBigInteger: the common power of two is
+ * factored out once, then both operands are kept odd and the larger is
+ * replaced by the (even) difference with its trailing zeros shifted out.
+ * Every step is a linear pass over the limbs with no division at all.
+ */
+
+#include "bignum_stein.h"
+#include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+
+// ============================================================================
+// ALGORITHM IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Stein's binary GCD on big integers
+ *
+ * @param input Arbitrary-precision input (result capacity >= larger operand)
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of subtract-and-shift steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_stein(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps)
+{
+    if (input == NULL || input->operand_a == NULL || input->operand_b == NULL ||
+        input->result == NULL || scratch == NULL || steps == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    *steps = 0;
+
+    if (bignum_is_zero(input->operand_a) || bignum_is_zero(input->operand_b))
+    {
+        const MathBigInteger *other = bignum_is_zero(input->operand_a) ? input->operand_b : input->operand_a;
+        MathStatus status = bignum_copy(input->result, other);
+        input->result->negative = false;
+        return status;
+    }
+
+    MathNatural capacity = MATH_MAX(input->operand_a->size, input->operand_b->size) + 1;
+    MathBigInteger work[2];
+    MathStatus status = bignum_alloc(&work[0], scratch, capacity);
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&work[1], scratch, capacity);
+    }
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    MathBigInteger *u = &work[0];
+    MathBigInteger *v = &work[1];
+    bignum_copy(u, input->operand_a);
+    bignum_copy(v, input->operand_b);
+    u->negative = false;
+    v->negative = false;
+
+    // gcd(2^i * u, 2^j * v) = 2^min(i, j) * gcd(u, v) for odd u, v
+    MathNatural u_zeros = bignum_trailing_zeros(u);
+    MathNatural v_zeros = bignum_trailing_zeros(v);
+    MathNatural shift = MATH_MIN(u_zeros, v_zeros);
+    bignum_shift_right(u, u_zeros);
+    bignum_shift_right(v, v_zeros);
+
+    for (;;)
+    {
+        int order = bignum_compare_abs(u, v);
+        if (order == 0)
+        {
+            break;
+        }
+
+        if (order > 0)
+        {
+            MathBigInteger *swap = u;
+            u = v;
+            v = swap;
+        }
+
+        // v > u, both odd: v - u is even and non-zero
+        bignum_sub_abs(v, v, u);
+        bignum_shift_right(v, bignum_trailing_zeros(v));
+        (*steps)++;
+    }
+
+    status = bignum_copy(input->result, u);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    return bignum_shift_left(input->result, shift);
+}
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Validate input for bignum Stein
+ *
+ * @param input Input parameters
+ * @return true if input is valid
+ */
+static bool bignum_stein_validate(const MathBinaryInput *input)
+{
+    // Every 64-bit operand pair is representable
+    return input != NULL;
+}
+
+/**
+ * @brief Execute bignum Stein on 64-bit operands
+ */
+MathResult bignum_stein_compute(const MathBinaryInput *input)
+{
+    return bignum_run_gcd_kernel_word(mdc_big_stein, input);
+}
+
+/**
+ * @brief Execute bignum Stein on big operands
+ */
+MathResult bignum_stein_compute_big(const MathBigBinaryInput *input)
+{
+    return bignum_run_gcd_kernel(mdc_big_stein, input);
+}
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (Global Variable)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for bignum Stein
+ */
+ImplementationSpec bignum_stein_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Bignum Stein Binary",
+        "Arbitrary-precision binary GCD: limb-wise subtraction and trailing-zero shifts",
+        ALGORITHM_FAMILY_BINARY,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = bignum_stein_compute,
+    .validate = bignum_stein_validate,
+    .compute_big = bignum_stein_compute_big,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *bignum_stein_get_implementation(GcdAlgorithmVariant variant)
+{
+    if (variant == GCD_BIGNUM_STEIN)
+    {
+        return &bignum_stein_spec;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Check if variant is the arbitrary-precision binary GCD
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is bignum Stein
+ */
+bool is_bignum_stein_variant(GcdAlgorithmVariant variant)
+{
+    return variant == GCD_BIGNUM_STEIN;
+}
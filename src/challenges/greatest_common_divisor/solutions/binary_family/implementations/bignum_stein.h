@@ -0,0 +1,75 @@
+/**
+ * @file bignum_stein.h
+ * @brief Arbitrary-precision binary GCD implementation
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares Stein's binary GCD over MathBigInteger operands and
+ * its implementation specification.
+ */
+
+#ifndef BIGNUM_STEIN_IMPLEMENTATIONS_H
+#define BIGNUM_STEIN_IMPLEMENTATIONS_H
+
+#include "../../../../../core/interfaces/implementation_interface.h"
+#include "../../../../../infrastructure/utilities/bignum_utils.h"
+#include "../../../domain_types.h"
+
+// ============================================================================
+// ALGORITHM DECLARATION
+// ============================================================================
+
+/**
+ * @brief Stein's binary GCD on big integers
+ *
+ * @param input Arbitrary-precision input (result capacity >= larger operand)
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of subtract-and-shift steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_stein(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps);
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Execute bignum Stein on 64-bit operands
+ */
+MathResult bignum_stein_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute bignum Stein on big operands
+ */
+MathResult bignum_stein_compute_big(const MathBigBinaryInput *input);
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (EXTERN DECLARATION)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for bignum Stein
+ */
+extern ImplementationSpec bignum_stein_spec;
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *bignum_stein_get_implementation(GcdAlgorithmVariant variant);
+
+/**
+ * @brief Check if variant is the arbitrary-precision binary GCD
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is bignum Stein
+ */
+bool is_bignum_stein_variant(GcdAlgorithmVariant variant);
+
+#endif // BIGNUM_STEIN_IMPLEMENTATIONS_H
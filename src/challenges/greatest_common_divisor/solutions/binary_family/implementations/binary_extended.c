@@ -0,0 +1,300 @@
+/**
+ * @file binary_extended.c
+ * @brief Binary extended GCD implementation
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Common factors of two are removed first, leaving x, y of which at
+ * least one is odd; call the odd one y. The loop reduces (u, v) = (x, y)
+ * as Stein's algorithm does while keeping, for each working value, the
+ * coefficient of x as a residue modulo y:
+ *
+ *   u = A*x (mod y),  v = C*x (mod y),  0 <= A, C <= y
+ *
+ * Dividing u by 2^k divides A by 2^k modulo y, which needs no division
+ * since y is odd. When u reaches zero, v is the GCD and its coefficient
+ * of y, D = (v - C*x) / y, is an exact quotient in [-x, 1]; it is obtained
+ * by multiplying with the inverse of y modulo 2^64. All arithmetic stays
+ * in unsigned 64-bit words, so every operand except LLONG_MIN is handled.
+ */
+
+#include "binary_extended.h"
+#include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+#include "../../../gcd_batch.h"
+#include "../../../challenge_services/step_counter.h"
+#include <limits.h>
+
+// ============================================================================
+// ALGORITHM IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Count trailing zeros of a non-zero 64-bit value
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define BINARY_EXTENDED_CTZ64(x) ((unsigned int)__builtin_ctzll(x))
+#else
+#define BINARY_EXTENDED_CTZ64(x) ((unsigned int)math_count_trailing_zeros((MathInteger)(x)))
+#endif
+
+/**
+ * @brief Remove the factors of two from u and divide its coefficient by the same power modulo y
+ *
+ * y is odd, so A / 2^k mod y = (A + m*y) / 2^k for the m < 2^k that makes
+ * the sum divisible by 2^k, namely m = -A * y^-1 mod 2^k. With a double
+ * limb of 128 bits the whole run is divided at once; otherwise A is halved
+ * bit by bit, adding y when A is odd (a mask rather than a branch, since
+ * the parity is effectively random).
+ */
+#if MATH_LIMB_BITS == 64
+#define BINARY_EXTENDED_STRIP(u, A, y, y_inverse)                                      \
+    do                                                                                 \
+    {                                                                                  \
+        unsigned int zeros_ = BINARY_EXTENDED_CTZ64((MathNatural)(u));                 \
+        MathNatural m_ = (0 - (A) * (y_inverse)) & ((((MathNatural)1) << zeros_) - 1); \
+        (u) >>= zeros_;                                                                \
+        (A) = (MathNatural)(((MathDoubleLimb)m_ * (y) + (A)) >> zeros_);               \
+    } while (0)
+#else
+#define BINARY_EXTENDED_STRIP(u, A, y, y_inverse)                      \
+    do                                                                 \
+    {                                                                  \
+        unsigned int zeros_ = BINARY_EXTENDED_CTZ64((MathNatural)(u)); \
+        (u) >>= zeros_;                                                \
+        for (unsigned int k_ = 0; k_ < zeros_; k_++)                   \
+        {                                                              \
+            (A) = ((A) + ((y) & (0 - ((A) & 1)))) >> 1;                \
+        }                                                              \
+        (void)(y_inverse);                                             \
+    } while (0)
+#endif
+
+/**
+ * @brief Inverse of an odd value modulo 2^64
+ *
+ * Newton's iteration inv = inv * (2 - y * inv) doubles the number of
+ * correct low bits; (3 * y) ^ 2 is already correct to five bits.
+ */
+static MathNatural binary_extended_inverse_2_64(MathNatural y)
+{
+    MathNatural inv = (3 * y) ^ 2;
+    for (int i = 0; i < 4; i++)
+    {
+        inv *= 2 - y * inv;
+    }
+    return inv;
+}
+
+/**
+ * @brief Division-free extended GCD core
+ *
+ * Only the coefficient of x is tracked, as a residue modulo y in [0, y];
+ * the two working values are kept odd, so each step is one swap into
+ * order, one subtraction and one shift of the (even) difference. The
+ * coefficient of y is recovered at the end from D = (g - C*x) / y, which
+ * is exact, so it can be computed modulo 2^64 with the inverse of y.
+ *
+ * @param x First operand (positive)
+ * @param y Second operand (odd)
+ * @param cx Coefficient for x
+ * @param cy Coefficient for y
+ * @return gcd(x, y), with *cx in [0, y] and *cy in [-x, 1]
+ */
+static GcdInteger binary_extended_core(GcdInteger x, GcdInteger y, GcdInteger *cx, GcdInteger *cy)
+{
+    MathNatural ux = (MathNatural)x, uy = (MathNatural)y;
+    MathNatural u = ux, v = uy;
+    MathNatural A = 1, C = 0;
+    MathNatural y_inverse = binary_extended_inverse_2_64(uy);
+
+    GCD_COUNT_SHIFT();
+    BINARY_EXTENDED_STRIP(u, A, uy, y_inverse);
+
+    for (;;)
+    {
+        if (u < v)
+        {
+            MathNatural t = u;
+            u = v;
+            v = t;
+            t = A;
+            A = C;
+            C = t;
+        }
+
+        GCD_COUNT_SUBTRACTION();
+        u -= v;
+        A = A >= C ? A - C : A + uy - C;
+        if (u == 0)
+        {
+            break;
+        }
+
+        GCD_COUNT_SHIFT();
+        BINARY_EXTENDED_STRIP(u, A, uy, y_inverse);
+    }
+
+    *cx = (GcdInteger)C;
+    *cy = (GcdInteger)((v - C * ux) * y_inverse);
+    return (GcdInteger)v;
+}
+
+/**
+ * @brief Binary extended GCD on 64-bit operands
+ *
+ * Runs on absolute values and flips the coefficient signs afterwards, so
+ * the GCD is always non-negative.
+ */
+GcdInteger mdc_ext_binary(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y)
+{
+    GcdInteger sign_a = a < 0 ? -1 : 1;
+    GcdInteger sign_b = b < 0 ? -1 : 1;
+    GcdInteger abs_a = MATH_ABS(a);
+    GcdInteger abs_b = MATH_ABS(b);
+
+    // gcd(a, 0) = |a| = sign(a) * a, including gcd(0, 0) = 0
+    if (abs_b == 0)
+    {
+        *x = abs_a == 0 ? 0 : sign_a;
+        *y = 0;
+        return abs_a;
+    }
+    if (abs_a == 0)
+    {
+        *x = 0;
+        *y = sign_b;
+        return abs_b;
+    }
+
+    // Factors of two shared by both operands do not change the coefficients
+    unsigned int shift = BINARY_EXTENDED_CTZ64((MathNatural)(abs_a | abs_b));
+    GCD_COUNT_SHIFT();
+    abs_a >>= shift;
+    abs_b >>= shift;
+
+    // The core needs its second operand odd; at least one of them is
+    GcdInteger cx, cy, gcd;
+    if ((abs_b & 1) != 0)
+    {
+        gcd = binary_extended_core(abs_a, abs_b, &cx, &cy);
+    }
+    else
+    {
+        gcd = binary_extended_core(abs_b, abs_a, &cy, &cx);
+    }
+
+    *x = sign_a * cx;
+    *y = sign_b * cy;
+    return gcd << shift;
+}
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Validate input for the binary extended GCD
+ *
+ * @param input Input parameters
+ * @return true if input is valid
+ */
+static bool binary_extended_validate(const MathBinaryInput *input)
+{
+    if (input == NULL)
+    {
+        return false;
+    }
+
+    // Absolute values must fit in 63 bits
+    return input->operand_a != LLONG_MIN && input->operand_b != LLONG_MIN;
+}
+
+/**
+ * @brief Execute binary extended GCD with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult binary_extended_compute(const MathBinaryInput *input)
+{
+    if (!binary_extended_validate(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    // Handle special cases first
+    MathResult special_result;
+    if (math_handle_gcd_special_cases(input->operand_a, input->operand_b, &special_result))
+    {
+        return special_result;
+    }
+
+    GCD_STEPS_BEGIN();
+    double start_time = math_get_time_ms();
+    GcdInteger x, y;
+    GcdInteger result = mdc_ext_binary(input->operand_a, input->operand_b, &x, &y);
+    double end_time = math_get_time_ms();
+
+    return math_create_success_result(result, GCD_STEPS_END(), math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Execute binary extended GCD over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult binary_extended_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run_extended(input, mdc_ext_binary);
+}
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (Global Variable)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the binary extended GCD
+ */
+ImplementationSpec binary_extended_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Binary Extended GCD",
+        "Division-free extended GCD tracking Bezout coefficients through shifts and subtractions",
+        ALGORITHM_FAMILY_BINARY,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = binary_extended_compute,
+    .validate = binary_extended_validate,
+    .compute_batch = binary_extended_compute_batch,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *binary_extended_get_implementation(GcdAlgorithmVariant variant)
+{
+    if (variant == GCD_BINARY_EXTENDED)
+    {
+        return &binary_extended_spec;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Check if variant is the binary extended GCD
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is the binary extended GCD
+ */
+bool is_binary_extended_variant(GcdAlgorithmVariant variant)
+{
+    return variant == GCD_BINARY_EXTENDED;
+}
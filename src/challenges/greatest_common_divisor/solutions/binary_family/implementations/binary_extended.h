@@ -0,0 +1,86 @@
+/**
+ * @file binary_extended.h
+ * @brief Binary extended GCD implementation
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares the binary extended GCD (Menezes et al., Handbook
+ * of Applied Cryptography, algorithm 14.61). Like Stein's algorithm it
+ * uses only shifts, subtractions and parity tests, and it also tracks the
+ * Bezout coefficients, so no division is executed at all.
+ */
+
+#ifndef BINARY_EXTENDED_IMPLEMENTATIONS_H
+#define BINARY_EXTENDED_IMPLEMENTATIONS_H
+
+#include "../../../../../core/interfaces/implementation_interface.h"
+#include "../../../domain_types.h"
+
+// ============================================================================
+// ALGORITHM DECLARATION
+// ============================================================================
+
+/**
+ * @brief Binary extended GCD on 64-bit operands
+ *
+ * @param a First operand (LLONG_MIN not supported)
+ * @param b Second operand (LLONG_MIN not supported)
+ * @param x Pointer to store coefficient for a
+ * @param y Pointer to store coefficient for b
+ * @return Greatest common divisor (non-negative), with a*x + b*y equal to it
+ */
+GcdInteger mdc_ext_binary(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y);
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Execute binary extended GCD with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult binary_extended_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute binary extended GCD over a batch of operand pairs
+ *
+ * When the coefficient arrays are given they receive x, y with
+ * a*x + b*y = gcd for the signed operands.
+ *
+ * @param input Batch input (operand arrays, output and coefficient buffers)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult binary_extended_compute_batch(const MathBatchInput *input);
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (EXTERN DECLARATION)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the binary extended GCD
+ */
+extern ImplementationSpec binary_extended_spec;
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *binary_extended_get_implementation(GcdAlgorithmVariant variant);
+
+/**
+ * @brief Check if variant is the binary extended GCD
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is the binary extended GCD
+ */
+bool is_binary_extended_variant(GcdAlgorithmVariant variant);
+
+#endif // BINARY_EXTENDED_IMPLEMENTATIONS_H
@@ -13,8 +13,14 @@
 #include "../../../../../core/interfaces/implementation_interface.h"
 #include "../../../domain_types.h"
 #include "../solution_spec.h"
+#include "stein_simd.h"
 #include <limits.h>
 #include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+#include "../../../gcd_batch.h"
+#include "../../../challenge_services/step_counter.h"
+#include "../../../challenge_services/gcd_isa.h"
+#include "../../../gcd_inline.h"
 
 // ============================================================================
 // ORIGINAL ALGORITHM IMPLEMENTATION
@@ -40,6 +46,7 @@ GcdInteger mdc_stein(GcdInteger a, GcdInteger b)
     // Factor out common factors of 2
     while (((a | b) & 1) == 0)
     {
+        GCD_COUNT_SHIFT();
         a >>= 1;
         b >>= 1;
         shift++;
@@ -47,31 +54,91 @@ GcdInteger mdc_stein(GcdInteger a, GcdInteger b)
 
     // Remove all factors of 2 from a
     while ((a & 1) == 0)
+    {
+        GCD_COUNT_SHIFT();
         a >>= 1;
+    }
 
     // From here on, a is always odd
     while (b != 0)
     {
         // Remove all factors of 2 from b
         while ((b & 1) == 0)
+        {
+            GCD_COUNT_SHIFT();
             b >>= 1;
+        }
 
         // Now a and b are both odd. Swap if necessary so a <= b,
         // then set b = b - a (which is even)
         if (a > b)
         {
-            a = a - b;
-        }
-        else
-        {
-            b = b - a;
+            GcdInteger t = a;
+            a = b;
+            b = t;
         }
+        GCD_COUNT_SUBTRACTION();
+        b = b - a;
     }
 
     // Restore common factors of 2
     return a << shift;
 }
 
+// ============================================================================
+// CTZ-BASED (HYBRID) BINARY GCD
+// ============================================================================
+
+/**
+ * @brief Count trailing zeros of a non-zero 64-bit value
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define STEIN_CTZ64(x) ((unsigned int)__builtin_ctzll(x))
+#else
+#define STEIN_CTZ64(x) ((unsigned int)math_count_trailing_zeros((MathInteger)(x)))
+#endif
+
+/**
+ * @brief Binary GCD using count-trailing-zeros and a branchless min/|diff| step
+ *
+ * Each factor-of-two run is removed with a single shift instead of a
+ * bit-at-a-time loop, and the compare/swap is replaced by sign-mask
+ * arithmetic so the loop body has no data-dependent branches.
+ * Operands are taken by absolute value; LLONG_MIN must be rejected by
+ * the caller.
+ */
+GcdInteger mdc_stein_ctz(GcdInteger a, GcdInteger b)
+{
+    MathNatural u = (MathNatural)MATH_ABS(a);
+    MathNatural v = (MathNatural)MATH_ABS(b);
+
+    if (u == 0)
+        return (GcdInteger)v;
+    if (v == 0)
+        return (GcdInteger)u;
+
+    unsigned int shift = STEIN_CTZ64(u | v);
+    GCD_COUNT_SHIFT();
+    u >>= STEIN_CTZ64(u);
+    GCD_COUNT_SHIFT();
+    v >>= STEIN_CTZ64(v);
+
+    // u and v are odd and below 2^63, so their difference fits in a signed word
+    while (u != v)
+    {
+        GCD_COUNT_SUBTRACTION();
+        GCD_COUNT_SHIFT();
+        GcdInteger diff = (GcdInteger)(v - u);
+        GcdInteger sign = diff >> 63; // All ones if v < u
+
+        u += (MathNatural)(diff & sign);            // u = min(u, v)
+        v = (MathNatural)((diff + sign) ^ sign);    // v = |v - u|, even and non-zero
+        v >>= STEIN_CTZ64(v);
+    }
+
+    return (GcdInteger)(u << shift);
+}
+
 // ============================================================================
 // INTERFACE IMPLEMENTATION
 // ============================================================================
@@ -114,14 +181,94 @@ MathResult stein_binary_compute(const MathBinaryInput *input)
         return special_result;
     }
 
+    // The subtraction loop only terminates for non-negative operands
+    MathInteger abs_a, abs_b;
+    if (math_safe_abs(input->operand_a, &abs_a) != MATH_SUCCESS ||
+        math_safe_abs(input->operand_b, &abs_b) != MATH_SUCCESS)
+    {
+        return math_create_error_result(MATH_ERROR_OVERFLOW, 0, 0.0);
+    }
+
     // Execute algorithm with timing
+    GCD_STEPS_BEGIN();
     double start_time = math_get_time_ms();
-    GcdInteger result = mdc_stein(input->operand_a, input->operand_b);
+    GcdInteger result = mdc_stein(abs_a, abs_b);
     double end_time = math_get_time_ms();
 
     double execution_time = (end_time >= 0 && start_time >= 0) ? (end_time - start_time) : 0.0;
 
-    return math_create_success_result(result, 0, execution_time);
+    return math_create_success_result(result, GCD_STEPS_END(), execution_time);
+}
+
+/**
+ * @brief Execute Stein's binary GCD algorithm over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult stein_binary_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run(input, mdc_stein);
+}
+
+/**
+ * @brief Execute the ctz-based binary GCD with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult stein_ctz_compute(const MathBinaryInput *input)
+{
+    if (!stein_validate(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    // Handle special cases first
+    MathResult special_result;
+    if (math_handle_gcd_special_cases(input->operand_a, input->operand_b, &special_result))
+    {
+        return special_result;
+    }
+
+    GCD_STEPS_BEGIN();
+    double start_time = math_get_time_ms();
+    GcdInteger result = mdc_stein_ctz(input->operand_a, input->operand_b);
+    double end_time = math_get_time_ms();
+
+    return math_create_success_result(result, GCD_STEPS_END(), math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Execute the ctz-based binary GCD over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult stein_ctz_compute_batch(const MathBatchInput *input)
+{
+    // Multiversioned loop: the copy built for this CPU's ISA level runs
+    return gcd_batch_run_array(input, gcd_isa_batch_stein);
+}
+
+/**
+ * @brief Execute the ctz-based binary GCD on unsigned operands
+ *
+ * @param input Unsigned operands
+ * @return MathUnsignedResult with computation result and timing
+ */
+MathUnsignedResult stein_ctz_compute_unsigned(const MathUnsignedBinaryInput *input)
+{
+    if (input == NULL)
+    {
+        return math_create_unsigned_error_result(MATH_ERROR_INVALID_INPUT);
+    }
+
+    double start_time = math_get_time_ms();
+    MathWideNatural result = gcd_inline_stein_wide(input->operand_a, input->operand_b);
+    double end_time = math_get_time_ms();
+
+    return math_create_unsigned_result(result, 0, math_elapsed_time_ms(start_time, end_time));
 }
 
 // ============================================================================
@@ -140,6 +287,23 @@ ImplementationSpec stein_binary_spec = {
         false),
     .compute = stein_binary_compute,
     .validate = stein_validate,
+    .compute_batch = stein_binary_compute_batch,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
+
+/**
+ * @brief Implementation specification for the ctz-based binary GCD
+ */
+ImplementationSpec stein_ctz_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Stein Binary GCD (CTZ)",
+        "Hybrid binary GCD: trailing zeros removed in one shift, branchless min/abs-diff step",
+        ALGORITHM_FAMILY_BINARY,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = stein_ctz_compute,
+    .validate = stein_validate,
+    .compute_batch = stein_ctz_compute_batch,
+    .compute_unsigned = stein_ctz_compute_unsigned,
     .performance = MATH_PERFORMANCE_METRICS_INIT};
 
 // ============================================================================
@@ -170,7 +334,15 @@ bool stein_is_suitable_input(GcdInteger a, GcdInteger b)
 /**
  * @brief Estimate performance advantage of Stein's over Euclidean
  *
- * Simple heuristic to estimate when Stein's algorithm might be faster.
+ * Tuned against the ctz-based variant (mdc_stein_ctz) versus Euclidean
+ * modulo. Binary GCD costs roughly one step per bit of the larger operand,
+ * while each modulo step is about twice as expensive but removes on
+ * average a couple of bits of the smaller one. Measured on random inputs:
+ * - balanced operands of 8..63 bits: ctz Stein about 2x faster
+ * - skewed operands (e.g. 63 vs 16 bits): modulo faster, its first
+ *   division discards the whole length difference at once
+ * - operands below 8 bits: both are a handful of steps, modulo slightly
+ *   ahead because it has less setup
  *
  * @param a First operand
  * @param b Second operand
@@ -178,16 +350,20 @@ bool stein_is_suitable_input(GcdInteger a, GcdInteger b)
  */
 bool stein_likely_faster(GcdInteger a, GcdInteger b)
 {
-    // Simple heuristic: Stein's may be faster for larger numbers
-    // where division/modulo operations become expensive
+    if (a == LLONG_MIN || b == LLONG_MIN)
+    {
+        return false;
+    }
 
-    GcdInteger max_operand = MATH_MAX(MATH_ABS(a), MATH_ABS(b));
+    MathNatural bits_a = math_bit_length((MathNatural)MATH_ABS(a));
+    MathNatural bits_b = math_bit_length((MathNatural)MATH_ABS(b));
+    MathNatural min_bits = MATH_MIN(bits_a, bits_b);
+    MathNatural max_bits = MATH_MAX(bits_a, bits_b);
 
-    // Arbitrary threshold - in practice, this depends on the specific
-    // system and compiler optimizations
-    const GcdInteger THRESHOLD = 1000000; // 1 million
+    // Minimum size where the binary loop beats modulo's lower setup cost
+    const MathNatural MIN_BITS_THRESHOLD = 8;
 
-    return max_operand > THRESHOLD;
+    return min_bits >= MIN_BITS_THRESHOLD && max_bits < 2 * min_bits;
 }
 
 /**
@@ -239,6 +415,14 @@ const ImplementationSpec *stein_get_implementation(GcdAlgorithmVariant variant)
     {
         return &stein_binary_spec;
     }
+    if (variant == GCD_BINARY_STEIN_CTZ)
+    {
+        return &stein_ctz_spec;
+    }
+    if (variant == GCD_BINARY_STEIN_SIMD)
+    {
+        return &stein_simd_spec;
+    }
     return NULL;
 }
 
@@ -258,8 +442,17 @@ MathNatural stein_get_all_implementations(
         return 0;
     }
 
-    specs[0] = &stein_binary_spec;
-    return 1;
+    MathNatural count = 0;
+    specs[count++] = &stein_binary_spec;
+    if (count < max_specs)
+    {
+        specs[count++] = &stein_ctz_spec;
+    }
+    if (count < max_specs)
+    {
+        specs[count++] = &stein_simd_spec;
+    }
+    return count;
 }
 
 /**
@@ -270,7 +463,9 @@ MathNatural stein_get_all_implementations(
  */
 bool is_stein_variant(GcdAlgorithmVariant variant)
 {
-    return (variant == GCD_BINARY_STEIN);
+    return (variant == GCD_BINARY_STEIN ||
+            variant == GCD_BINARY_STEIN_CTZ ||
+            variant == GCD_BINARY_STEIN_SIMD);
 }
 
 // ============================================================================
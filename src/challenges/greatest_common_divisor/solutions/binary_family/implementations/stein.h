@@ -26,6 +26,15 @@
  */
 GcdInteger mdc_stein(GcdInteger a, GcdInteger b);
 
+/**
+ * @brief Hybrid binary GCD using count-trailing-zeros and a branchless step
+ *
+ * @param a First operand (LLONG_MIN not supported)
+ * @param b Second operand (LLONG_MIN not supported)
+ * @return Greatest common divisor (non-negative)
+ */
+GcdInteger mdc_stein_ctz(GcdInteger a, GcdInteger b);
+
 // ============================================================================
 // INTERFACE IMPLEMENTATION
 // ============================================================================
@@ -38,6 +47,41 @@ GcdInteger mdc_stein(GcdInteger a, GcdInteger b);
  */
 MathResult stein_binary_compute(const MathBinaryInput *input);
 
+/**
+ * @brief Execute Stein's binary GCD algorithm over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult stein_binary_compute_batch(const MathBatchInput *input);
+
+/**
+ * @brief Execute the ctz-based binary GCD with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult stein_ctz_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute the ctz-based binary GCD over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult stein_ctz_compute_batch(const MathBatchInput *input);
+
+/**
+ * @brief Execute the ctz-based binary GCD on unsigned operands
+ *
+ * The unsigned difference covers the full MathWideNatural range, in
+ * 64-bit arithmetic once both operands fit. Steps are not counted.
+ *
+ * @param input Unsigned operands
+ * @return MathUnsignedResult with computation result and timing
+ */
+MathUnsignedResult stein_ctz_compute_unsigned(const MathUnsignedBinaryInput *input);
+
 // ============================================================================
 // IMPLEMENTATION SPECIFICATION (EXTERN DECLARATION)
 // ============================================================================
@@ -47,6 +91,11 @@ MathResult stein_binary_compute(const MathBinaryInput *input);
  */
 extern ImplementationSpec stein_binary_spec;
 
+/**
+ * @brief Implementation specification for the ctz-based binary GCD
+ */
+extern ImplementationSpec stein_ctz_spec;
+
 // ============================================================================
 // BINARY ALGORITHM CHARACTERISTICS
 // ============================================================================
@@ -0,0 +1,624 @@
+/**
+ * @file stein_simd.c
+ * @brief SIMD-vectorized Stein binary GCD for batched inputs
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This file implements Stein's binary GCD across vector lanes. Each lane holds
+ * one operand pair; all lanes run the same shift/min/subtract sequence and the
+ * loop ends when every lane has reached zero. Finished lanes are masked so
+ * they keep their result while the slower lanes continue.
+ *
+ * Kernels:
+ * - AVX-512 F/CD: 8 lanes, trailing zeros via lzcnt of the lowest set bit
+ * - AVX2: 4 lanes, trailing zeros stripped with a 6-step binary search
+ *   (AVX2 has no 64-bit lzcnt/tzcnt and no unsigned 64-bit min)
+ * - NEON (AArch64): 2 lanes, same binary search as AVX2
+ * - Scalar: mdc_stein_ctz per pair, used when no SIMD extension is available
+ *
+ * x86 kernels are compiled with function-level target attributes, so the
+ * file builds without -mavx2 and the kernel is chosen at runtime.
+ */
+
+#include "stein_simd.h"
+#include "stein.h"
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+#include "../../../gcd_batch.h"
+
+// Platform detection for vector intrinsics
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define STEIN_SIMD_HAS_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define STEIN_SIMD_HAS_NEON 1
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief Widest lane count of any kernel (size of the tail buffer)
+ */
+#define STEIN_SIMD_MAX_LANES 8
+
+// ============================================================================
+// SCALAR KERNEL
+// ============================================================================
+
+/**
+ * @brief Portable fallback kernel: ctz-based binary GCD on each pair
+ */
+static MathNatural stein_simd_kernel_scalar(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results,
+    MathNatural count)
+{
+    MathNatural failed = 0;
+
+    for (MathNatural i = 0; i < count; i++)
+    {
+        GcdInteger a = operands_a[i];
+        GcdInteger b = operands_b[i];
+        if (a == LLONG_MIN || b == LLONG_MIN)
+        {
+            results[i] = MATH_INVALID_VALUE;
+            failed++;
+            continue;
+        }
+        results[i] = mdc_stein_ctz(a, b);
+    }
+
+    return failed;
+}
+
+/**
+ * @brief Run a vector group kernel over an array, padding the tail
+ *
+ * The last partial group is copied into a lane-sized buffer filled with
+ * gcd(1, 1) pairs, so the group kernel never reads past the input.
+ */
+#define STEIN_SIMD_FOR_EACH_GROUP(group_fn, lanes, operands_a, operands_b, results, count, failed) \
+    do                                                                                               \
+    {                                                                                                \
+        MathNatural index_ = 0;                                                                      \
+        for (; index_ + (lanes) <= (count); index_ += (lanes))                                       \
+        {                                                                                            \
+            (failed) += group_fn((operands_a) + index_, (operands_b) + index_, (results) + index_);  \
+        }                                                                                            \
+        if (index_ < (count))                                                                        \
+        {                                                                                            \
+            GcdInteger tail_a_[STEIN_SIMD_MAX_LANES];                                                \
+            GcdInteger tail_b_[STEIN_SIMD_MAX_LANES];                                                \
+            GcdInteger tail_out_[STEIN_SIMD_MAX_LANES];                                              \
+            MathNatural remaining_ = (count) - index_;                                               \
+            for (MathNatural lane_ = 0; lane_ < (lanes); lane_++)                                    \
+            {                                                                                        \
+                tail_a_[lane_] = lane_ < remaining_ ? (operands_a)[index_ + lane_] : 1;              \
+                tail_b_[lane_] = lane_ < remaining_ ? (operands_b)[index_ + lane_] : 1;              \
+            }                                                                                        \
+            (failed) += group_fn(tail_a_, tail_b_, tail_out_);                                       \
+            memcpy((results) + index_, tail_out_, remaining_ * sizeof(GcdInteger));                  \
+        }                                                                                            \
+    } while (0)
+
+// ============================================================================
+// AVX2 KERNEL (4 LANES)
+// ============================================================================
+
+#ifdef STEIN_SIMD_HAS_X86
+
+/**
+ * @brief Shift every lane right by its trailing zero count
+ *
+ * Binary search over 32/16/8/4/2/1-bit windows; zero lanes stay zero.
+ *
+ * @param x Lanes to normalize
+ * @param count Accumulates the number of bits removed per lane
+ * @return Lanes with all factors of two removed
+ */
+__attribute__((target("avx2"))) static inline __m256i stein_avx2_strip_twos(__m256i x, __m256i *count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i is_zero;
+
+    is_zero = _mm256_cmpeq_epi64(_mm256_and_si256(x, _mm256_set1_epi64x(0xFFFFFFFFLL)), zero);
+    x = _mm256_blendv_epi8(x, _mm256_srli_epi64(x, 32), is_zero);
+    *count = _mm256_add_epi64(*count, _mm256_and_si256(is_zero, _mm256_set1_epi64x(32)));
+
+    is_zero = _mm256_cmpeq_epi64(_mm256_and_si256(x, _mm256_set1_epi64x(0xFFFFLL)), zero);
+    x = _mm256_blendv_epi8(x, _mm256_srli_epi64(x, 16), is_zero);
+    *count = _mm256_add_epi64(*count, _mm256_and_si256(is_zero, _mm256_set1_epi64x(16)));
+
+    is_zero = _mm256_cmpeq_epi64(_mm256_and_si256(x, _mm256_set1_epi64x(0xFFLL)), zero);
+    x = _mm256_blendv_epi8(x, _mm256_srli_epi64(x, 8), is_zero);
+    *count = _mm256_add_epi64(*count, _mm256_and_si256(is_zero, _mm256_set1_epi64x(8)));
+
+    is_zero = _mm256_cmpeq_epi64(_mm256_and_si256(x, _mm256_set1_epi64x(0xFLL)), zero);
+    x = _mm256_blendv_epi8(x, _mm256_srli_epi64(x, 4), is_zero);
+    *count = _mm256_add_epi64(*count, _mm256_and_si256(is_zero, _mm256_set1_epi64x(4)));
+
+    is_zero = _mm256_cmpeq_epi64(_mm256_and_si256(x, _mm256_set1_epi64x(0x3LL)), zero);
+    x = _mm256_blendv_epi8(x, _mm256_srli_epi64(x, 2), is_zero);
+    *count = _mm256_add_epi64(*count, _mm256_and_si256(is_zero, _mm256_set1_epi64x(2)));
+
+    is_zero = _mm256_cmpeq_epi64(_mm256_and_si256(x, _mm256_set1_epi64x(0x1LL)), zero);
+    x = _mm256_blendv_epi8(x, _mm256_srli_epi64(x, 1), is_zero);
+    *count = _mm256_add_epi64(*count, _mm256_and_si256(is_zero, _mm256_set1_epi64x(1)));
+
+    return x;
+}
+
+/**
+ * @brief Compute 4 GCDs with AVX2
+ *
+ * Absolute values fit in 63 bits, so signed 64-bit compares order the
+ * lanes correctly.
+ */
+__attribute__((target("avx2"))) static inline MathNatural stein_avx2_group(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i min_value = _mm256_set1_epi64x(LLONG_MIN);
+
+    __m256i va = _mm256_loadu_si256((const __m256i *)operands_a);
+    __m256i vb = _mm256_loadu_si256((const __m256i *)operands_b);
+
+    // LLONG_MIN has no 64-bit absolute value
+    __m256i invalid = _mm256_or_si256(_mm256_cmpeq_epi64(va, min_value), _mm256_cmpeq_epi64(vb, min_value));
+
+    // Absolute values: (x ^ sign) - sign
+    __m256i sign_a = _mm256_cmpgt_epi64(zero, va);
+    __m256i sign_b = _mm256_cmpgt_epi64(zero, vb);
+    va = _mm256_sub_epi64(_mm256_xor_si256(va, sign_a), sign_a);
+    vb = _mm256_sub_epi64(_mm256_xor_si256(vb, sign_b), sign_b);
+
+    // gcd(a, 0) = a: resolve these lanes up front and run them as gcd(1, 1)
+    __m256i trivial = _mm256_or_si256(_mm256_cmpeq_epi64(va, zero), _mm256_cmpeq_epi64(vb, zero));
+    trivial = _mm256_or_si256(trivial, invalid);
+    __m256i trivial_result = _mm256_or_si256(va, vb);
+    va = _mm256_blendv_epi8(va, one, trivial);
+    vb = _mm256_blendv_epi8(vb, one, trivial);
+
+    // Common factors of two, then make a odd
+    __m256i shift = zero;
+    __m256i discarded = zero;
+    stein_avx2_strip_twos(_mm256_or_si256(va, vb), &shift);
+    va = stein_avx2_strip_twos(va, &discarded);
+
+    while (!_mm256_testz_si256(vb, vb))
+    {
+        __m256i finished = _mm256_cmpeq_epi64(vb, zero);
+        vb = stein_avx2_strip_twos(vb, &discarded);
+
+        // Both odd: a = min(a, b), b = |a - b|
+        __m256i a_greater = _mm256_cmpgt_epi64(va, vb);
+        __m256i smaller = _mm256_blendv_epi8(va, vb, a_greater);
+        __m256i larger = _mm256_blendv_epi8(vb, va, a_greater);
+
+        va = _mm256_blendv_epi8(smaller, va, finished);
+        vb = _mm256_blendv_epi8(_mm256_sub_epi64(larger, smaller), zero, finished);
+    }
+
+    __m256i result = _mm256_sllv_epi64(va, shift);
+    result = _mm256_blendv_epi8(result, trivial_result, trivial);
+    result = _mm256_blendv_epi8(result, _mm256_set1_epi64x(MATH_INVALID_VALUE), invalid);
+    _mm256_storeu_si256((__m256i *)results, result);
+
+    return (MathNatural)__builtin_popcount((unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(invalid)));
+}
+
+/**
+ * @brief AVX2 kernel entry point
+ */
+__attribute__((target("avx2"))) static MathNatural stein_simd_kernel_avx2(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results,
+    MathNatural count)
+{
+    MathNatural failed = 0;
+    STEIN_SIMD_FOR_EACH_GROUP(stein_avx2_group, 4, operands_a, operands_b, results, count, failed);
+    return failed;
+}
+
+// ============================================================================
+// AVX-512 KERNEL (8 LANES)
+// ============================================================================
+
+/**
+ * @brief Per-lane trailing zero count: 63 - lzcnt(x & -x)
+ *
+ * Zero lanes yield an out-of-range count, which variable shifts map to 0.
+ */
+__attribute__((target("avx512f,avx512cd"))) static inline __m512i stein_avx512_ctz(__m512i x)
+{
+    __m512i lowest_bit = _mm512_and_si512(x, _mm512_sub_epi64(_mm512_setzero_si512(), x));
+    return _mm512_sub_epi64(_mm512_set1_epi64(63), _mm512_lzcnt_epi64(lowest_bit));
+}
+
+/**
+ * @brief Compute 8 GCDs with AVX-512
+ */
+__attribute__((target("avx512f,avx512cd"))) static inline MathNatural stein_avx512_group(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i min_value = _mm512_set1_epi64(LLONG_MIN);
+
+    __m512i va = _mm512_loadu_si512((const void *)operands_a);
+    __m512i vb = _mm512_loadu_si512((const void *)operands_b);
+
+    __mmask8 invalid = _mm512_cmpeq_epi64_mask(va, min_value) | _mm512_cmpeq_epi64_mask(vb, min_value);
+    va = _mm512_abs_epi64(va);
+    vb = _mm512_abs_epi64(vb);
+
+    __mmask8 trivial = _mm512_cmpeq_epi64_mask(va, zero) | _mm512_cmpeq_epi64_mask(vb, zero) | invalid;
+    __m512i trivial_result = _mm512_or_si512(va, vb);
+    va = _mm512_mask_mov_epi64(va, trivial, one);
+    vb = _mm512_mask_mov_epi64(vb, trivial, one);
+
+    __m512i shift = stein_avx512_ctz(_mm512_or_si512(va, vb));
+    va = _mm512_srlv_epi64(va, stein_avx512_ctz(va));
+
+    __mmask8 active = _mm512_cmpneq_epi64_mask(vb, zero);
+    while (active)
+    {
+        vb = _mm512_srlv_epi64(vb, stein_avx512_ctz(vb));
+
+        __m512i smaller = _mm512_min_epu64(va, vb);
+        __m512i larger = _mm512_max_epu64(va, vb);
+        va = _mm512_mask_mov_epi64(va, active, smaller);
+        vb = _mm512_mask_sub_epi64(vb, active, larger, smaller);
+
+        active = _mm512_cmpneq_epi64_mask(vb, zero);
+    }
+
+    __m512i result = _mm512_sllv_epi64(va, shift);
+    result = _mm512_mask_mov_epi64(result, trivial, trivial_result);
+    result = _mm512_mask_mov_epi64(result, invalid, _mm512_set1_epi64(MATH_INVALID_VALUE));
+    _mm512_storeu_si512((void *)results, result);
+
+    return (MathNatural)__builtin_popcount((unsigned int)invalid);
+}
+
+/**
+ * @brief AVX-512 kernel entry point
+ */
+__attribute__((target("avx512f,avx512cd"))) static MathNatural stein_simd_kernel_avx512(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results,
+    MathNatural count)
+{
+    MathNatural failed = 0;
+    STEIN_SIMD_FOR_EACH_GROUP(stein_avx512_group, 8, operands_a, operands_b, results, count, failed);
+    return failed;
+}
+
+#endif // STEIN_SIMD_HAS_X86
+
+// ============================================================================
+// NEON KERNEL (2 LANES)
+// ============================================================================
+
+#ifdef STEIN_SIMD_HAS_NEON
+
+/**
+ * @brief Binary-search one window of trailing zeros (NEON)
+ */
+#define STEIN_NEON_STRIP_STEP(x, count, bits)                                                 \
+    do                                                                                        \
+    {                                                                                         \
+        uint64x2_t is_zero_ = vceqq_u64(vandq_u64((x), vdupq_n_u64((1ULL << (bits)) - 1)),    \
+                                        vdupq_n_u64(0));                                      \
+        (x) = vbslq_u64(is_zero_, vshrq_n_u64((x), (bits)), (x));                             \
+        (count) = vaddq_u64((count), vandq_u64(is_zero_, vdupq_n_u64(bits)));                 \
+    } while (0)
+
+/**
+ * @brief Shift every lane right by its trailing zero count (NEON)
+ */
+static inline uint64x2_t stein_neon_strip_twos(uint64x2_t x, uint64x2_t *count)
+{
+    STEIN_NEON_STRIP_STEP(x, *count, 32);
+    STEIN_NEON_STRIP_STEP(x, *count, 16);
+    STEIN_NEON_STRIP_STEP(x, *count, 8);
+    STEIN_NEON_STRIP_STEP(x, *count, 4);
+    STEIN_NEON_STRIP_STEP(x, *count, 2);
+    STEIN_NEON_STRIP_STEP(x, *count, 1);
+    return x;
+}
+
+/**
+ * @brief Compute 2 GCDs with NEON
+ */
+static inline MathNatural stein_neon_group(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results)
+{
+    const uint64x2_t zero = vdupq_n_u64(0);
+    const uint64x2_t one = vdupq_n_u64(1);
+    const int64x2_t min_value = vdupq_n_s64(LLONG_MIN);
+
+    int64x2_t signed_a = vld1q_s64(operands_a);
+    int64x2_t signed_b = vld1q_s64(operands_b);
+
+    uint64x2_t invalid = vorrq_u64(vceqq_s64(signed_a, min_value), vceqq_s64(signed_b, min_value));
+    uint64x2_t va = vreinterpretq_u64_s64(vabsq_s64(signed_a));
+    uint64x2_t vb = vreinterpretq_u64_s64(vabsq_s64(signed_b));
+
+    uint64x2_t trivial = vorrq_u64(vorrq_u64(vceqq_u64(va, zero), vceqq_u64(vb, zero)), invalid);
+    uint64x2_t trivial_result = vorrq_u64(va, vb);
+    va = vbslq_u64(trivial, one, va);
+    vb = vbslq_u64(trivial, one, vb);
+
+    uint64x2_t shift = zero;
+    uint64x2_t discarded = zero;
+    stein_neon_strip_twos(vorrq_u64(va, vb), &shift);
+    va = stein_neon_strip_twos(va, &discarded);
+
+    while ((vgetq_lane_u64(vb, 0) | vgetq_lane_u64(vb, 1)) != 0)
+    {
+        uint64x2_t finished = vceqq_u64(vb, zero);
+        vb = stein_neon_strip_twos(vb, &discarded);
+
+        uint64x2_t a_greater = vcgtq_u64(va, vb);
+        uint64x2_t smaller = vbslq_u64(a_greater, vb, va);
+        uint64x2_t larger = vbslq_u64(a_greater, va, vb);
+
+        va = vbslq_u64(finished, va, smaller);
+        vb = vbslq_u64(finished, zero, vsubq_u64(larger, smaller));
+    }
+
+    uint64x2_t result = vshlq_u64(va, vreinterpretq_s64_u64(shift));
+    result = vbslq_u64(trivial, trivial_result, result);
+    result = vbslq_u64(invalid, vdupq_n_u64((uint64_t)MATH_INVALID_VALUE), result);
+    vst1q_s64(results, vreinterpretq_s64_u64(result));
+
+    return (vgetq_lane_u64(invalid, 0) & 1) + (vgetq_lane_u64(invalid, 1) & 1);
+}
+
+/**
+ * @brief NEON kernel entry point
+ */
+static MathNatural stein_simd_kernel_neon(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results,
+    MathNatural count)
+{
+    MathNatural failed = 0;
+    STEIN_SIMD_FOR_EACH_GROUP(stein_neon_group, 2, operands_a, operands_b, results, count, failed);
+    return failed;
+}
+
+#endif // STEIN_SIMD_HAS_NEON
+
+// ============================================================================
+// KERNEL DISPATCH
+// ============================================================================
+
+/**
+ * @brief Active kernel and its level (NULL until resolved)
+ */
+static SteinSimdKernelFunc g_stein_simd_kernel = NULL;
+static PlatformSimdLevel g_stein_simd_level = PLATFORM_SIMD_NONE;
+
+/**
+ * @brief Get the kernel compiled for a SIMD level
+ *
+ * @param level SIMD level
+ * @return Kernel, or NULL if not built for this architecture
+ */
+static SteinSimdKernelFunc stein_simd_kernel_for_level(PlatformSimdLevel level)
+{
+    switch (level)
+    {
+    case PLATFORM_SIMD_NONE:
+        return stein_simd_kernel_scalar;
+#ifdef STEIN_SIMD_HAS_X86
+    case PLATFORM_SIMD_AVX2:
+        return stein_simd_kernel_avx2;
+    case PLATFORM_SIMD_AVX512:
+        return stein_simd_kernel_avx512;
+#endif
+#ifdef STEIN_SIMD_HAS_NEON
+    case PLATFORM_SIMD_NEON:
+        return stein_simd_kernel_neon;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * @brief Force a specific kernel level
+ *
+ * @param level SIMD level to use
+ * @return MATH_SUCCESS, or MATH_ERROR_NOT_IMPLEMENTED if unsupported here
+ */
+MathStatus stein_simd_select_level(PlatformSimdLevel level)
+{
+    SteinSimdKernelFunc kernel = stein_simd_kernel_for_level(level);
+    if (kernel == NULL || !platform_supports_simd_level(level))
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+
+    g_stein_simd_kernel = kernel;
+    g_stein_simd_level = level;
+
+    snprintf(stein_simd_spec.metadata.description, MATH_MAX_DESCRIPTION_LENGTH,
+             "Stein's binary GCD, %lu x 64-bit lanes per step (active kernel: %s)",
+             (unsigned long)stein_simd_get_lane_count(level),
+             platform_simd_level_name(level));
+
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Select the kernel for the best SIMD level of this CPU
+ */
+void stein_simd_init_spec(void)
+{
+    if (stein_simd_select_level(platform_detect_simd_level()) != MATH_SUCCESS)
+    {
+        stein_simd_select_level(PLATFORM_SIMD_NONE);
+    }
+}
+
+/**
+ * @brief Get the SIMD level of the active kernel
+ *
+ * @return Active SIMD level
+ */
+PlatformSimdLevel stein_simd_get_active_level(void)
+{
+    if (g_stein_simd_kernel == NULL)
+    {
+        stein_simd_init_spec();
+    }
+    return g_stein_simd_level;
+}
+
+/**
+ * @brief Get the number of 64-bit lanes processed per vector step
+ *
+ * @param level SIMD level
+ * @return Lane count (1 for the scalar kernel)
+ */
+MathNatural stein_simd_get_lane_count(PlatformSimdLevel level)
+{
+    switch (level)
+    {
+    case PLATFORM_SIMD_AVX512:
+        return 8;
+    case PLATFORM_SIMD_AVX2:
+        return 4;
+    case PLATFORM_SIMD_NEON:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+// ============================================================================
+// DIRECT INTERFACE
+// ============================================================================
+
+/**
+ * @brief Compute GCDs of many operand pairs with the active kernel
+ *
+ * @param operands_a First operands
+ * @param operands_b Second operands
+ * @param results Output buffer
+ * @param count Number of operand pairs
+ * @return Number of pairs that could not be computed
+ */
+MathNatural stein_simd_compute_array(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results,
+    MathNatural count)
+{
+    if (g_stein_simd_kernel == NULL)
+    {
+        stein_simd_init_spec();
+    }
+    return g_stein_simd_kernel(operands_a, operands_b, results, count);
+}
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Validate input for the vectorized Stein algorithm
+ *
+ * @param input Input parameters
+ * @return true if input is valid
+ */
+static bool stein_simd_validate(const MathBinaryInput *input)
+{
+    return input != NULL;
+}
+
+/**
+ * @brief Execute the vectorized Stein kernel on a single pair
+ *
+ * A single pair occupies one lane of a padded group; this path exists so
+ * the variant can take part in compare/benchmark runs.
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult stein_simd_compute(const MathBinaryInput *input)
+{
+    if (!stein_simd_validate(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    MathResult special_result;
+    if (math_handle_gcd_special_cases(input->operand_a, input->operand_b, &special_result))
+    {
+        return special_result;
+    }
+
+    GcdInteger result = MATH_INVALID_VALUE;
+    double start_time = math_get_time_ms();
+    MathNatural failed = stein_simd_compute_array(&input->operand_a, &input->operand_b, &result, 1);
+    double end_time = math_get_time_ms();
+
+    if (failed > 0)
+    {
+        return math_create_error_result(MATH_ERROR_OVERFLOW, 0, math_elapsed_time_ms(start_time, end_time));
+    }
+
+    return math_create_success_result(result, 0, math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Execute the vectorized Stein kernel over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult stein_simd_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run_array(input, stein_simd_compute_array);
+}
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (Global Variable)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the vectorized Stein algorithm
+ *
+ * The description is rewritten by stein_simd_select_level() to report the
+ * active kernel.
+ */
+ImplementationSpec stein_simd_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Stein Binary GCD (SIMD)",
+        "Stein's binary GCD across vector lanes, kernel selected at runtime",
+        ALGORITHM_FAMILY_BINARY,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = stein_simd_compute,
+    .validate = stein_simd_validate,
+    .compute_batch = stein_simd_compute_batch,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
@@ -0,0 +1,119 @@
+/**
+ * @file stein_simd.h
+ * @brief SIMD-vectorized Stein binary GCD for batched inputs
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares a lane-parallel version of Stein's binary GCD. Several
+ * operand pairs are reduced at once in vector registers; the kernel (AVX-512,
+ * AVX2, NEON or scalar) is selected at runtime from the CPU capabilities.
+ */
+
+#ifndef STEIN_SIMD_IMPLEMENTATIONS_H
+#define STEIN_SIMD_IMPLEMENTATIONS_H
+
+#include "../../../../../core/interfaces/implementation_interface.h"
+#include "../../../../../infrastructure/platform/cpu_detection.h"
+#include "../../../domain_types.h"
+
+// ============================================================================
+// KERNEL DISPATCH
+// ============================================================================
+
+/**
+ * @brief Signature shared by all vectorized Stein kernels
+ *
+ * Operands may be negative; LLONG_MIN lanes produce MATH_INVALID_VALUE.
+ *
+ * @param operands_a First operands
+ * @param operands_b Second operands
+ * @param results Output buffer
+ * @param count Number of operand pairs
+ * @return Number of pairs that could not be computed
+ */
+typedef MathNatural (*SteinSimdKernelFunc)(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results,
+    MathNatural count);
+
+/**
+ * @brief Select the kernel for the best SIMD level of this CPU
+ *
+ * Called once by the registry during initialization; the compute functions
+ * also resolve the kernel lazily if used before that.
+ */
+void stein_simd_init_spec(void);
+
+/**
+ * @brief Force a specific kernel level
+ *
+ * @param level SIMD level to use
+ * @return MATH_SUCCESS, or MATH_ERROR_NOT_IMPLEMENTED if unsupported here
+ */
+MathStatus stein_simd_select_level(PlatformSimdLevel level);
+
+/**
+ * @brief Get the SIMD level of the active kernel
+ *
+ * @return Active SIMD level
+ */
+PlatformSimdLevel stein_simd_get_active_level(void);
+
+/**
+ * @brief Get the number of 64-bit lanes processed per vector step
+ *
+ * @param level SIMD level
+ * @return Lane count (1 for the scalar kernel)
+ */
+MathNatural stein_simd_get_lane_count(PlatformSimdLevel level);
+
+// ============================================================================
+// DIRECT INTERFACE
+// ============================================================================
+
+/**
+ * @brief Compute GCDs of many operand pairs with the active kernel
+ *
+ * @param operands_a First operands
+ * @param operands_b Second operands
+ * @param results Output buffer
+ * @param count Number of operand pairs
+ * @return Number of pairs that could not be computed
+ */
+MathNatural stein_simd_compute_array(
+    const GcdInteger *operands_a,
+    const GcdInteger *operands_b,
+    GcdInteger *results,
+    MathNatural count);
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Execute the vectorized Stein kernel on a single pair
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult stein_simd_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute the vectorized Stein kernel over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult stein_simd_compute_batch(const MathBatchInput *input);
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (EXTERN DECLARATION)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the vectorized Stein algorithm
+ */
+extern ImplementationSpec stein_simd_spec;
+
+#endif // STEIN_SIMD_IMPLEMENTATIONS_H
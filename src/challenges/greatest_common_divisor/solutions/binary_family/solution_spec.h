@@ -111,7 +111,7 @@ bool binary_family_is_binary_variant(GcdAlgorithmVariant variant);
 /**
  * @brief Number of algorithms in Binary family
  */
-#define BINARY_FAMILY_ALGORITHM_COUNT 1
+#define BINARY_FAMILY_ALGORITHM_COUNT 4
 
 /**
  * @brief Family identification
@@ -123,7 +123,10 @@ bool binary_family_is_binary_variant(GcdAlgorithmVariant variant);
  * @brief Binary algorithm variants (subset of GcdAlgorithmVariant)
  */
 #define BINARY_VARIANTS { \
-    GCD_BINARY_STEIN}
+    GCD_BINARY_STEIN,      \
+    GCD_BINARY_STEIN_CTZ,  \
+    GCD_BINARY_STEIN_SIMD, \
+    GCD_BINARY_EXTENDED}
 
 // ============================================================================
 // ALGORITHM FUNCTION DECLARATIONS
@@ -155,7 +158,9 @@ extern GcdInteger mdc_stein(GcdInteger a, GcdInteger b);
 /**
  * @brief Check if algorithm variant is Stein's algorithm
  */
-#define IS_STEIN_ALGORITHM(variant) ((variant) == GCD_BINARY_STEIN)
+#define IS_STEIN_ALGORITHM(variant) ((variant) == GCD_BINARY_STEIN ||     \
+                                     (variant) == GCD_BINARY_STEIN_CTZ || \
+                                     (variant) == GCD_BINARY_STEIN_SIMD)
 
 /**
  * @brief Check if algorithm variant uses bit manipulation
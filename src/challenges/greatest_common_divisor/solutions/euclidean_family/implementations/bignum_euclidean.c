@@ -0,0 +1,496 @@
+/**
+ * @file bignum_euclidean.c
+ * @brief Arbitrary-precision Euclidean GCD implementations
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * MathBigInteger versions of the Euclidean family. All temporaries are
+ * carved from the scratch arena and rotated by pointer swaps, so a whole
+ * GCD runs without touching the heap.
+ *
+ * The Lehmer variant drives lehmer_compute_cofactors (shared with the
+ * 64-bit implementation) with the leading 32 bits of the operands: each
+ * accepted matrix replaces several long divisions by two single-pass
+ * linear combinations. Once the smaller operand fits in 64 bits the last
+ * steps run in native arithmetic.
+ */
+
+#include "bignum_euclidean.h"
+#include "bignum_half_gcd.h"
+#include "lehmer.h"
+#include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+
+// ============================================================================
+// WORKING STORAGE
+// ============================================================================
+
+/**
+ * @brief Carve a set of equally sized temporaries from the scratch arena
+ */
+static MathStatus bignum_euclidean_alloc(MemoryArena *scratch, MathNatural capacity,
+                                         MathBigInteger *values, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        MathStatus status = bignum_alloc(&values[i], scratch, capacity);
+        if (status != MATH_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Copy the magnitude of an operand into a temporary
+ */
+static MathStatus bignum_euclidean_load_abs(MathBigInteger *dest, const MathBigInteger *src)
+{
+    MathStatus status = bignum_copy(dest, src);
+    dest->negative = false;
+    return status;
+}
+
+/**
+ * @brief Validate the operand and result pointers of a big input
+ */
+static bool bignum_euclidean_validate_big(const MathBigBinaryInput *input)
+{
+    return input != NULL && input->operand_a != NULL && input->operand_b != NULL &&
+           input->result != NULL;
+}
+
+// ============================================================================
+// ALGORITHM IMPLEMENTATIONS
+// ============================================================================
+
+/**
+ * @brief Euclidean GCD on big integers using long division
+ *
+ * @param input Arbitrary-precision input (result capacity >= larger operand)
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of division steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_modulo(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps)
+{
+    if (!bignum_euclidean_validate_big(input) || scratch == NULL || steps == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathNatural capacity = MATH_MAX(input->operand_a->size, input->operand_b->size) + 2;
+    MathBigInteger work[3];
+    MathStatus status = bignum_euclidean_alloc(scratch, capacity, work, 3);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    MathBigInteger *u = &work[0];
+    MathBigInteger *v = &work[1];
+    MathBigInteger *r = &work[2];
+    bignum_euclidean_load_abs(u, input->operand_a);
+    bignum_euclidean_load_abs(v, input->operand_b);
+
+    *steps = 0;
+    while (!bignum_is_zero(v))
+    {
+        status = bignum_divmod(NULL, r, u, v, scratch);
+        if (status != MATH_SUCCESS)
+        {
+            return status;
+        }
+
+        // (u, v) <- (v, u mod v)
+        MathBigInteger *old_u = u;
+        u = v;
+        v = r;
+        r = old_u;
+        (*steps)++;
+    }
+
+    return bignum_copy(input->result, u);
+}
+
+/**
+ * @brief Lehmer's GCD on big integers
+ *
+ * @param input Arbitrary-precision input (result capacity >= larger operand)
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of matrix or division steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_lehmer(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps)
+{
+    if (!bignum_euclidean_validate_big(input) || scratch == NULL || steps == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathNatural capacity = MATH_MAX(input->operand_a->size, input->operand_b->size) + 2;
+    MathBigInteger work[4];
+    MathStatus status = bignum_euclidean_alloc(scratch, capacity, work, 4);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    MathBigInteger *u = &work[0];
+    MathBigInteger *v = &work[1];
+    MathBigInteger *next_u = &work[2];
+    MathBigInteger *next_v = &work[3];
+    bignum_euclidean_load_abs(u, input->operand_a);
+    bignum_euclidean_load_abs(v, input->operand_b);
+
+    if (bignum_compare_abs(u, v) < 0)
+    {
+        MathBigInteger *swap = u;
+        u = v;
+        v = swap;
+    }
+
+    *steps = 0;
+    while (bignum_bit_length(v) > 64)
+    {
+        // Leading digit of u and the bits of v at the same position
+        MathNatural shift = bignum_bit_length(u) - LEHMER_DIGIT_BITS;
+        MathNatural u_hat = bignum_extract_bits(u, shift, LEHMER_DIGIT_BITS);
+        MathNatural v_hat = bignum_extract_bits(v, shift, LEHMER_DIGIT_BITS);
+
+        LehmerCofactorMatrix matrix;
+        if (lehmer_compute_cofactors(u_hat, v_hat, &matrix) == 0)
+        {
+            // Quotient too large to simulate: take one full division step
+            status = bignum_divmod(NULL, next_u, u, v, scratch);
+            if (status != MATH_SUCCESS)
+            {
+                return status;
+            }
+
+            MathBigInteger *old_u = u;
+            u = v;
+            v = next_u;
+            next_u = old_u;
+        }
+        else
+        {
+            status = bignum_linear_combination(next_u, u, matrix.a, v, matrix.b);
+            if (status == MATH_SUCCESS)
+            {
+                status = bignum_linear_combination(next_v, u, matrix.c, v, matrix.d);
+            }
+            if (status != MATH_SUCCESS)
+            {
+                return status;
+            }
+
+            MathBigInteger *swap = u;
+            u = next_u;
+            next_u = swap;
+            swap = v;
+            v = next_v;
+            next_v = swap;
+        }
+
+        (*steps)++;
+    }
+
+    if (bignum_is_zero(v))
+    {
+        return bignum_copy(input->result, u);
+    }
+
+    // One long division brings u below 2^64 as well; finish natively
+    status = bignum_divmod(NULL, next_u, u, v, scratch);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    MathNatural x = bignum_to_natural(v);
+    MathNatural y = bignum_to_natural(next_u);
+    (*steps)++;
+
+    while (y != 0)
+    {
+        MathNatural t = x % y;
+        x = y;
+        y = t;
+        (*steps)++;
+    }
+
+    return bignum_set_natural(input->result, x);
+}
+
+/**
+ * @brief Extended Euclidean algorithm on big integers
+ *
+ * Maintains the cosequences r_i = s_i*|a| + t_i*|b| alongside the
+ * remainders, then restores the operand signs on the coefficients.
+ *
+ * @param input Arbitrary-precision input
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of division steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_extended(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps)
+{
+    if (!bignum_euclidean_validate_big(input) || scratch == NULL || steps == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathNatural capacity = MATH_MAX(input->operand_a->size, input->operand_b->size) + 2;
+    MathBigInteger work[9];
+    MathBigInteger product;
+    MathStatus status = bignum_euclidean_alloc(scratch, capacity, work, 9);
+    if (status == MATH_SUCCESS)
+    {
+        // Quotient times coefficient may briefly need both widths
+        status = bignum_alloc(&product, scratch, 2 * capacity);
+    }
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    MathBigInteger *r0 = &work[0], *r1 = &work[1], *r2 = &work[2];
+    MathBigInteger *s0 = &work[3], *s1 = &work[4], *s2 = &work[5];
+    MathBigInteger *t0 = &work[6], *t1 = &work[7], *t2 = &work[8];
+    MathBigInteger quotient;
+    status = bignum_alloc(&quotient, scratch, capacity);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    bignum_euclidean_load_abs(r0, input->operand_a);
+    bignum_euclidean_load_abs(r1, input->operand_b);
+    bignum_set_int(s0, 1);
+    bignum_set_zero(s1);
+    bignum_set_zero(t0);
+    bignum_set_int(t1, 1);
+
+    *steps = 0;
+    while (!bignum_is_zero(r1))
+    {
+        status = bignum_divmod(&quotient, r2, r0, r1, scratch);
+
+        // s2 = s0 - q*s1, t2 = t0 - q*t1
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_mul(&product, &quotient, s1);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_sub(s2, s0, &product);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_mul(&product, &quotient, t1);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_sub(t2, t0, &product);
+        }
+        if (status != MATH_SUCCESS)
+        {
+            return status;
+        }
+
+        MathBigInteger *rotate = r0;
+        r0 = r1;
+        r1 = r2;
+        r2 = rotate;
+        rotate = s0;
+        s0 = s1;
+        s1 = s2;
+        s2 = rotate;
+        rotate = t0;
+        t0 = t1;
+        t1 = t2;
+        t2 = rotate;
+        (*steps)++;
+    }
+
+    // Coefficients were computed for |a| and |b|
+    if (input->operand_a->negative && s0->size > 0)
+    {
+        s0->negative = !s0->negative;
+    }
+    if (input->operand_b->negative && t0->size > 0)
+    {
+        t0->negative = !t0->negative;
+    }
+
+    if (input->coefficient_x != NULL)
+    {
+        status = bignum_copy(input->coefficient_x, s0);
+    }
+    if (status == MATH_SUCCESS && input->coefficient_y != NULL)
+    {
+        status = bignum_copy(input->coefficient_y, t0);
+    }
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    return bignum_copy(input->result, r0);
+}
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Validate input for the bignum Euclidean implementations
+ *
+ * @param input Input parameters
+ * @return true if input is valid
+ */
+static bool bignum_euclidean_validate(const MathBinaryInput *input)
+{
+    // Every 64-bit operand pair is representable
+    return input != NULL;
+}
+
+/**
+ * @brief Execute bignum modulo Euclid on 64-bit operands
+ */
+MathResult bignum_euclidean_modulo_compute(const MathBinaryInput *input)
+{
+    return bignum_run_gcd_kernel_word(mdc_big_modulo, input);
+}
+
+/**
+ * @brief Execute bignum modulo Euclid on big operands
+ */
+MathResult bignum_euclidean_modulo_compute_big(const MathBigBinaryInput *input)
+{
+    return bignum_run_gcd_kernel(mdc_big_modulo, input);
+}
+
+/**
+ * @brief Execute bignum Lehmer on 64-bit operands
+ */
+MathResult bignum_euclidean_lehmer_compute(const MathBinaryInput *input)
+{
+    return bignum_run_gcd_kernel_word(mdc_big_lehmer, input);
+}
+
+/**
+ * @brief Execute bignum Lehmer on big operands
+ */
+MathResult bignum_euclidean_lehmer_compute_big(const MathBigBinaryInput *input)
+{
+    return bignum_run_gcd_kernel(mdc_big_lehmer, input);
+}
+
+/**
+ * @brief Execute bignum Extended Euclidean on 64-bit operands (GCD only)
+ */
+MathResult bignum_euclidean_extended_compute(const MathBinaryInput *input)
+{
+    return bignum_run_gcd_kernel_word(mdc_big_extended, input);
+}
+
+/**
+ * @brief Execute bignum Extended Euclidean on big operands
+ */
+MathResult bignum_euclidean_extended_compute_big(const MathBigBinaryInput *input)
+{
+    return bignum_run_gcd_kernel(mdc_big_extended, input);
+}
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATIONS (Global Variables)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for bignum modulo Euclid
+ */
+ImplementationSpec bignum_euclidean_modulo_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Bignum Euclidean Modulo",
+        "Arbitrary-precision Euclidean algorithm using Knuth long division",
+        ALGORITHM_FAMILY_EUCLIDEAN,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = bignum_euclidean_modulo_compute,
+    .validate = bignum_euclidean_validate,
+    .compute_big = bignum_euclidean_modulo_compute_big,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
+
+/**
+ * @brief Implementation specification for bignum Lehmer
+ */
+ImplementationSpec bignum_euclidean_lehmer_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Bignum Euclidean Lehmer",
+        "Arbitrary-precision Lehmer's GCD: 32-bit leading-digit cofactor matrices applied across limbs",
+        ALGORITHM_FAMILY_EUCLIDEAN,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = bignum_euclidean_lehmer_compute,
+    .validate = bignum_euclidean_validate,
+    .compute_big = bignum_euclidean_lehmer_compute_big,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
+
+/**
+ * @brief Implementation specification for bignum Extended Euclidean
+ */
+ImplementationSpec bignum_euclidean_extended_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Bignum Extended Euclidean",
+        "Arbitrary-precision Extended Euclidean algorithm producing Bezout coefficients",
+        ALGORITHM_FAMILY_EUCLIDEAN,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = bignum_euclidean_extended_compute,
+    .validate = bignum_euclidean_validate,
+    .compute_big = bignum_euclidean_extended_compute_big,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *bignum_euclidean_get_implementation(GcdAlgorithmVariant variant)
+{
+    switch (variant)
+    {
+    case GCD_BIGNUM_MODULO:
+        return &bignum_euclidean_modulo_spec;
+    case GCD_BIGNUM_LEHMER:
+        return &bignum_euclidean_lehmer_spec;
+    case GCD_BIGNUM_EXTENDED:
+        return &bignum_euclidean_extended_spec;
+    case GCD_BIGNUM_HALF_GCD:
+        return &bignum_half_gcd_spec;
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * @brief Check if variant is an arbitrary-precision Euclidean algorithm
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is a bignum Euclidean variant
+ */
+bool is_bignum_euclidean_variant(GcdAlgorithmVariant variant)
+{
+    return variant == GCD_BIGNUM_MODULO ||
+           variant == GCD_BIGNUM_LEHMER ||
+           variant == GCD_BIGNUM_EXTENDED ||
+           variant == GCD_BIGNUM_HALF_GCD;
+}
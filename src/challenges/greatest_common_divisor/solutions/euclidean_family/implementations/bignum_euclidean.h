@@ -0,0 +1,133 @@
+/**
+ * @file bignum_euclidean.h
+ * @brief Arbitrary-precision Euclidean GCD implementations
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares the MathBigInteger versions of the Euclidean family:
+ * modulo Euclid with long division, Lehmer's GCD on leading limbs and the
+ * Extended Euclidean algorithm. Each also serves the regular 64-bit
+ * compute entry point so it can take part in the standard comparisons.
+ */
+
+#ifndef BIGNUM_EUCLIDEAN_IMPLEMENTATIONS_H
+#define BIGNUM_EUCLIDEAN_IMPLEMENTATIONS_H
+
+#include "../../../../../core/interfaces/implementation_interface.h"
+#include "../../../../../infrastructure/utilities/bignum_utils.h"
+#include "../../../domain_types.h"
+
+// ============================================================================
+// ALGORITHM DECLARATIONS
+// ============================================================================
+
+/**
+ * @brief Euclidean GCD on big integers using long division
+ *
+ * @param input Arbitrary-precision input (result capacity >= larger operand)
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of division steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_modulo(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps);
+
+/**
+ * @brief Lehmer's GCD on big integers
+ *
+ * Reuses lehmer_compute_cofactors on the leading LEHMER_DIGIT_BITS bits and
+ * applies each cofactor matrix in one pass over the limbs.
+ *
+ * @param input Arbitrary-precision input (result capacity >= larger operand)
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of matrix or division steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_lehmer(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps);
+
+/**
+ * @brief Extended Euclidean algorithm on big integers
+ *
+ * Writes a*x + b*y = gcd coefficients to input->coefficient_x/_y when they
+ * are non-NULL (capacity >= larger operand).
+ *
+ * @param input Arbitrary-precision input
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of division steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_extended(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps);
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Execute bignum modulo Euclid on 64-bit operands
+ */
+MathResult bignum_euclidean_modulo_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute bignum modulo Euclid on big operands
+ */
+MathResult bignum_euclidean_modulo_compute_big(const MathBigBinaryInput *input);
+
+/**
+ * @brief Execute bignum Lehmer on 64-bit operands
+ */
+MathResult bignum_euclidean_lehmer_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute bignum Lehmer on big operands
+ */
+MathResult bignum_euclidean_lehmer_compute_big(const MathBigBinaryInput *input);
+
+/**
+ * @brief Execute bignum Extended Euclidean on 64-bit operands (GCD only)
+ */
+MathResult bignum_euclidean_extended_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute bignum Extended Euclidean on big operands
+ */
+MathResult bignum_euclidean_extended_compute_big(const MathBigBinaryInput *input);
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATIONS (EXTERN DECLARATIONS)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for bignum modulo Euclid
+ */
+extern ImplementationSpec bignum_euclidean_modulo_spec;
+
+/**
+ * @brief Implementation specification for bignum Lehmer
+ */
+extern ImplementationSpec bignum_euclidean_lehmer_spec;
+
+/**
+ * @brief Implementation specification for bignum Extended Euclidean
+ */
+extern ImplementationSpec bignum_euclidean_extended_spec;
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *bignum_euclidean_get_implementation(GcdAlgorithmVariant variant);
+
+/**
+ * @brief Check if variant is an arbitrary-precision Euclidean algorithm
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is a bignum Euclidean variant
+ */
+bool is_bignum_euclidean_variant(GcdAlgorithmVariant variant);
+
+#endif // BIGNUM_EUCLIDEAN_IMPLEMENTATIONS_H
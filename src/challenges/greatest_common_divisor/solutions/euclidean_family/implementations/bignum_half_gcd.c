@@ -0,0 +1,863 @@
+/**
+ * @file bignum_half_gcd.c
+ * @brief Subquadratic half-GCD (Knuth-Schönhage) for big integers
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The half-GCD of an n-limb pair reduces it while both values stay above
+ * B^s, s = n/2 + 1, and returns the matrix M of the reduction:
+ * (a; b) = M (alpha; beta). It follows Möller's formulation ("On
+ * Schönhage's algorithm and subquadratic integer GCD computation"):
+ *
+ * - a reduction of the top n/2 limbs, computed recursively, is also a
+ *   reduction of the full pair, and is applied to the low limbs with two
+ *   Karatsuba products per value;
+ * - a second recursive call on what is left above B^s finishes the job;
+ * - below BIGNUM_HALF_GCD_THRESHOLD, Lehmer steps on the leading 32 bits
+ *   (lehmer_compute_cofactors, as in mdc_big_lehmer) and single division
+ *   steps do the reduction directly.
+ *
+ * The pair is never swapped: a step reduces whichever value is larger,
+ * so every matrix has non-negative entries and determinant 1. A result
+ * is only accepted when both values stay above the floor, which also
+ * keeps every matrix entry below B^(n-s).
+ *
+ * The GCD loop runs a half-GCD on the leading third of the pair, and a
+ * plain division when that makes no progress, until the smaller value
+ * has fewer than BIGNUM_HALF_GCD_FINISH_LIMBS limbs; Lehmer (or Extended
+ * Euclid) finishes. For Bezout coefficients the matrices are multiplied
+ * together and applied to the coefficients of the finishing call.
+ */
+
+#include "bignum_half_gcd.h"
+#include "bignum_euclidean.h"
+#include "lehmer.h"
+#include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+#include <string.h>
+
+// ============================================================================
+// WORKING STORAGE
+// ============================================================================
+
+/**
+ * @brief Pair being reduced, with buffers the next pair is built in
+ *
+ * Either value may be the larger one. Results are swapped in by
+ * exchanging buffers, so every buffer of a pair has the same capacity.
+ */
+typedef struct
+{
+    MathBigInteger value[2]; /**< Current pair */
+    MathBigInteger spare[2]; /**< Buffers for the next pair */
+    MathBigInteger quotient; /**< Quotient of a division step */
+} HalfGcdPair;
+
+/**
+ * @brief Reduction matrix: (a; b) = M (alpha; beta)
+ *
+ * (a, b) is the pair the reduction started from and (alpha, beta) the
+ * current pair. Entries are non-negative and det(M) = 1, so
+ * M^-1 = (m11, -m01; -m10, m00).
+ */
+typedef struct
+{
+    MathBigInteger m[2][2];  /**< Entries, row-major */
+    MathBigInteger spare;    /**< Buffer for the next value of an entry */
+    MathBigInteger product;  /**< Product of an entry and a factor */
+} HalfGcdMatrix;
+
+/**
+ * @brief State shared by every level of one GCD
+ */
+typedef struct
+{
+    MemoryArena *scratch; /**< Arena every temporary comes from */
+    MathNatural steps;    /**< Lehmer matrices and division steps taken */
+} HalfGcdContext;
+
+/**
+ * @brief Carve a set of equally sized temporaries from the scratch arena
+ */
+static MathStatus half_gcd_alloc(MemoryArena *scratch, MathNatural capacity,
+                                 MathBigInteger *values, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        MathStatus status = bignum_alloc(&values[i], scratch, capacity);
+        if (status != MATH_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Exchange the storage of two big integers
+ */
+static void half_gcd_swap(MathBigInteger *x, MathBigInteger *y)
+{
+    MathBigInteger swap = *x;
+    *x = *y;
+    *y = swap;
+}
+
+/**
+ * @brief Allocate a pair whose buffers hold capacity limbs
+ */
+static MathStatus half_gcd_pair_init(HalfGcdPair *pair, MemoryArena *scratch, MathNatural capacity)
+{
+    MathStatus status = half_gcd_alloc(scratch, capacity, pair->value, 2);
+    if (status == MATH_SUCCESS)
+    {
+        status = half_gcd_alloc(scratch, capacity, pair->spare, 2);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&pair->quotient, scratch, capacity);
+    }
+    return status;
+}
+
+/**
+ * @brief Size in limbs of the larger value of a pair
+ */
+static MathNatural half_gcd_pair_size(const HalfGcdPair *pair)
+{
+    return MATH_MAX(pair->value[0].size, pair->value[1].size);
+}
+
+/**
+ * @brief Position of the larger value of a pair
+ */
+static MathNatural half_gcd_pair_larger(const HalfGcdPair *pair)
+{
+    return bignum_compare_abs(&pair->value[0], &pair->value[1]) >= 0 ? 0 : 1;
+}
+
+/**
+ * @brief Allocate an identity matrix whose entries hold capacity limbs
+ */
+static MathStatus half_gcd_matrix_init(HalfGcdMatrix *matrix, MemoryArena *scratch, MathNatural capacity)
+{
+    MathStatus status = MATH_SUCCESS;
+    for (MathNatural i = 0; i < 2 && status == MATH_SUCCESS; i++)
+    {
+        status = half_gcd_alloc(scratch, capacity, matrix->m[i], 2);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&matrix->spare, scratch, capacity);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&matrix->product, scratch, capacity);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        bignum_set_natural(&matrix->m[0][0], 1);
+        bignum_set_natural(&matrix->m[1][1], 1);
+    }
+    return status;
+}
+
+/**
+ * @brief Check whether a matrix is still the identity
+ */
+static bool half_gcd_matrix_is_identity(const HalfGcdMatrix *matrix)
+{
+    // With det = 1 and non-negative entries, zero off-diagonals leave ones
+    return matrix->m[0][1].size == 0 && matrix->m[1][0].size == 0;
+}
+
+// ============================================================================
+// MATRIX UPDATES
+// ============================================================================
+
+/**
+ * @brief M <- M * F for a matrix F of single-limb, non-negative entries
+ */
+static MathStatus half_gcd_matrix_mul_small(HalfGcdMatrix *matrix, const MathNatural factor[2][2])
+{
+    for (MathNatural i = 0; i < 2; i++)
+    {
+        MathBigInteger *row = matrix->m[i];
+        MathStatus status = bignum_linear_combination(&matrix->spare, &row[0], (MathInteger)factor[0][0],
+                                                      &row[1], (MathInteger)factor[1][0]);
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_linear_combination(&row[1], &row[0], (MathInteger)factor[0][1],
+                                               &row[1], (MathInteger)factor[1][1]);
+        }
+        if (status != MATH_SUCCESS)
+        {
+            return status;
+        }
+        half_gcd_swap(&row[0], &matrix->spare);
+    }
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Record a quotient step: value k of the pair lost q times the other
+ *
+ * (alpha; beta) was (1, q; 0, 1) or (1, 0; q, 1) times the new pair, so
+ * q times column k is added to the other column.
+ */
+static MathStatus half_gcd_matrix_add_quotient(HalfGcdMatrix *matrix, MathNatural k, const MathBigInteger *q,
+                                               MemoryArena *scratch)
+{
+    for (MathNatural i = 0; i < 2; i++)
+    {
+        MathStatus status = bignum_mul_karatsuba(&matrix->product, q, &matrix->m[i][k], scratch);
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_add(&matrix->m[i][1 - k], &matrix->m[i][1 - k], &matrix->product);
+        }
+        if (status != MATH_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief M <- M * F for a full matrix F
+ */
+static MathStatus half_gcd_matrix_mul(HalfGcdMatrix *matrix, const HalfGcdMatrix *factor, MemoryArena *scratch)
+{
+    MathStatus status = MATH_SUCCESS;
+    if (half_gcd_matrix_is_identity(matrix))
+    {
+        for (MathNatural i = 0; i < 4 && status == MATH_SUCCESS; i++)
+        {
+            status = bignum_copy(&matrix->m[i / 2][i % 2], &factor->m[i / 2][i % 2]);
+        }
+        return status;
+    }
+
+    MemoryArenaMark mark = memory_arena_save(scratch);
+    MathBigInteger term;
+    status = bignum_alloc(&term, scratch, matrix->spare.capacity);
+
+    for (MathNatural i = 0; i < 2 && status == MATH_SUCCESS; i++)
+    {
+        MathBigInteger *row = matrix->m[i];
+
+        // spare = m_i0 f00 + m_i1 f10, then m_i1 = m_i0 f01 + m_i1 f11
+        status = bignum_mul_karatsuba(&matrix->spare, &row[0], &factor->m[0][0], scratch);
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_mul_karatsuba(&matrix->product, &row[1], &factor->m[1][0], scratch);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_add(&matrix->spare, &matrix->spare, &matrix->product);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_mul_karatsuba(&matrix->product, &row[0], &factor->m[0][1], scratch);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_mul_karatsuba(&term, &row[1], &factor->m[1][1], scratch);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_add(&row[1], &term, &matrix->product);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            half_gcd_swap(&row[0], &matrix->spare);
+        }
+    }
+
+    memory_arena_restore(scratch, mark);
+    return status;
+}
+
+// ============================================================================
+// REDUCTION STEPS
+// ============================================================================
+
+/**
+ * @brief Try a Lehmer step on the leading digits that keeps both values above B^s
+ *
+ * @param taken Output: whether the step was taken
+ */
+static MathStatus half_gcd_lehmer_step(HalfGcdContext *context, HalfGcdPair *pair, MathNatural s,
+                                       HalfGcdMatrix *matrix, bool *taken)
+{
+    *taken = false;
+    MathNatural big = half_gcd_pair_larger(pair);
+    const MathBigInteger *u = &pair->value[big];
+    const MathBigInteger *v = &pair->value[1 - big];
+
+    MathNatural bits = bignum_bit_length(u);
+    if (bits <= LEHMER_DIGIT_BITS)
+    {
+        return MATH_SUCCESS;
+    }
+
+    MathNatural shift = bits - LEHMER_DIGIT_BITS;
+    LehmerCofactorMatrix cofactors;
+    if (lehmer_compute_cofactors(bignum_extract_bits(u, shift, LEHMER_DIGIT_BITS),
+                                 bignum_extract_bits(v, shift, LEHMER_DIGIT_BITS), &cofactors) == 0)
+    {
+        return MATH_SUCCESS;
+    }
+
+    // u' = a u + b v and v' = c u + d v are consecutive remainders, v' < u'
+    MathStatus status = bignum_linear_combination(&pair->spare[0], u, cofactors.a, v, cofactors.b);
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_linear_combination(&pair->spare[1], u, cofactors.c, v, cofactors.d);
+    }
+    if (status != MATH_SUCCESS || pair->spare[1].size <= s)
+    {
+        return status;
+    }
+
+    // (u; v) = (|d|, |b|; |c|, |a|) (u'; v'); its determinant is that of the
+    // cofactor matrix, computed modulo 2^64 where +1 and -1 are distinct
+    MathNatural determinant = (MathNatural)cofactors.a * (MathNatural)cofactors.d -
+                              (MathNatural)cofactors.b * (MathNatural)cofactors.c;
+    bool positive = (determinant == 1) == (big == 0);
+
+    MathNatural row_u[2] = {(MathNatural)MATH_ABS(cofactors.d), (MathNatural)MATH_ABS(cofactors.b)};
+    MathNatural row_v[2] = {(MathNatural)MATH_ABS(cofactors.c), (MathNatural)MATH_ABS(cofactors.a)};
+    const MathNatural *rows[2] = {big == 0 ? row_u : row_v, big == 0 ? row_v : row_u};
+
+    // A negative determinant is fixed by storing the new pair the other way round
+    MathNatural factor[2][2];
+    for (MathNatural i = 0; i < 2; i++)
+    {
+        factor[i][0] = rows[i][positive ? 0 : 1];
+        factor[i][1] = rows[i][positive ? 1 : 0];
+    }
+
+    if (matrix != NULL)
+    {
+        status = half_gcd_matrix_mul_small(matrix, factor);
+        if (status != MATH_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    half_gcd_swap(&pair->value[0], &pair->spare[positive ? 0 : 1]);
+    half_gcd_swap(&pair->value[1], &pair->spare[positive ? 1 : 0]);
+    context->steps++;
+    *taken = true;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief One division step that keeps both values above B^s
+ *
+ * The larger value is reduced modulo the smaller one; when the remainder
+ * would drop to B^s or below, one subtraction fewer is taken.
+ *
+ * @param taken Output: whether the step was taken
+ */
+static MathStatus half_gcd_division_step(HalfGcdContext *context, HalfGcdPair *pair, MathNatural s,
+                                         HalfGcdMatrix *matrix, bool *taken)
+{
+    *taken = false;
+    MathNatural big = half_gcd_pair_larger(pair);
+    const MathBigInteger *v = &pair->value[1 - big];
+    if (v->size <= s)
+    {
+        return MATH_SUCCESS;
+    }
+
+    MathStatus status = bignum_divmod(&pair->quotient, &pair->spare[0], &pair->value[big], v, context->scratch);
+    if (status == MATH_SUCCESS && pair->spare[0].size <= s)
+    {
+        MathLimb one_limb = 1;
+        MathBigInteger one = {.limbs = &one_limb, .size = 1, .capacity = 1, .negative = false};
+
+        status = bignum_add(&pair->spare[0], &pair->spare[0], v);
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_sub(&pair->quotient, &pair->quotient, &one);
+        }
+        if (status != MATH_SUCCESS || bignum_is_zero(&pair->quotient))
+        {
+            return status;
+        }
+    }
+    if (status == MATH_SUCCESS && matrix != NULL)
+    {
+        status = half_gcd_matrix_add_quotient(matrix, big, &pair->quotient, context->scratch);
+    }
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    half_gcd_swap(&pair->value[big], &pair->spare[0]);
+    context->steps++;
+    *taken = true;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief One Lehmer or division step that keeps both values above B^s
+ *
+ * @param taken Output: whether a step was taken (false: nothing is left
+ *        to reduce above B^s)
+ */
+static MathStatus half_gcd_step(HalfGcdContext *context, HalfGcdPair *pair, MathNatural s,
+                                HalfGcdMatrix *matrix, bool *taken)
+{
+    MathStatus status = half_gcd_lehmer_step(context, pair, s, matrix, taken);
+    if (status == MATH_SUCCESS && !*taken)
+    {
+        status = half_gcd_division_step(context, pair, s, matrix, taken);
+    }
+    return status;
+}
+
+// ============================================================================
+// HALF-GCD RECURSION
+// ============================================================================
+
+static MathStatus half_gcd_reduce(HalfGcdContext *context, HalfGcdPair *pair, HalfGcdMatrix *matrix,
+                                  bool *reduced);
+
+/**
+ * @brief Apply a reduction of the high limbs of a pair to the whole pair
+ *
+ * With value0 = a1 B^p + a0, value1 = b1 B^p + b0 and M reducing (a1, b1)
+ * to (alpha1, beta1):
+ *   alpha = alpha1 B^p + m11 a0 - m01 b0
+ *   beta  = beta1 B^p + m00 b0 - m10 a0
+ *
+ * @param floor Both new values must keep more than floor limbs
+ * @param accepted Output: whether the pair was replaced
+ */
+static MathStatus half_gcd_adjust(HalfGcdContext *context, HalfGcdPair *pair, MathNatural p,
+                                  const HalfGcdMatrix *factor, const HalfGcdPair *high,
+                                  MathNatural floor, bool *accepted)
+{
+    *accepted = false;
+    MemoryArenaMark mark = memory_arena_save(context->scratch);
+
+    MathBigInteger term[2];
+    MathStatus status = half_gcd_alloc(context->scratch, pair->spare[0].capacity, term, 2);
+
+    // Low limbs of each value, read in place
+    MathBigInteger low[2];
+    for (MathNatural r = 0; r < 2; r++)
+    {
+        low[r] = pair->value[r];
+        low[r].size = MATH_MIN(low[r].size, p);
+        bignum_normalize(&low[r]);
+    }
+
+    for (MathNatural r = 0; r < 2 && status == MATH_SUCCESS; r++)
+    {
+        const MathBigInteger *own = &factor->m[1 - r][1 - r];
+        const MathBigInteger *other = &factor->m[r][1 - r];
+        MathBigInteger *out = &pair->spare[r];
+
+        status = bignum_mul_karatsuba(&term[0], own, &low[r], context->scratch);
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_mul_karatsuba(&term[1], other, &low[1 - r], context->scratch);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_sub(out, &term[0], &term[1]);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_copy(&term[0], &high->value[r]);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_shift_left(&term[0], p * MATH_LIMB_BITS);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_add(out, out, &term[0]);
+        }
+    }
+
+    memory_arena_restore(context->scratch, mark);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    // Möller's lemma guarantees this; checking keeps the pair valid regardless
+    for (MathNatural r = 0; r < 2; r++)
+    {
+        if (pair->spare[r].negative || pair->spare[r].size <= floor)
+        {
+            return MATH_SUCCESS;
+        }
+    }
+
+    half_gcd_swap(&pair->value[0], &pair->spare[0]);
+    half_gcd_swap(&pair->value[1], &pair->spare[1]);
+    *accepted = true;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Reduce a pair with the half-GCD of its limbs from p upwards
+ *
+ * @param floor Both reduced values must keep more than floor limbs
+ * @param matrix Matrix the reduction is multiplied into (NULL = not tracked)
+ * @param reduced Output: whether the pair changed
+ */
+static MathStatus half_gcd_reduce_high(HalfGcdContext *context, HalfGcdPair *pair, MathNatural p,
+                                       MathNatural floor, HalfGcdMatrix *matrix, bool *reduced)
+{
+    *reduced = false;
+    MathNatural n = half_gcd_pair_size(pair);
+    if (n <= p)
+    {
+        return MATH_SUCCESS;
+    }
+
+    MathNatural m = n - p;
+    MemoryArenaMark mark = memory_arena_save(context->scratch);
+
+    // Entries of the high reduction stay below B^(m - m/2 - 1)
+    HalfGcdPair high;
+    HalfGcdMatrix factor;
+    MathStatus status = half_gcd_pair_init(&high, context->scratch, m + 2);
+    if (status == MATH_SUCCESS)
+    {
+        status = half_gcd_matrix_init(&factor, context->scratch, m - m / 2 + 1);
+    }
+
+    for (MathNatural r = 0; r < 2 && status == MATH_SUCCESS; r++)
+    {
+        const MathBigInteger *value = &pair->value[r];
+        MathNatural size = value->size > p ? value->size - p : 0;
+        memcpy(high.value[r].limbs, value->limbs + p, (size_t)size * sizeof(MathLimb));
+        high.value[r].size = size;
+    }
+
+    bool high_reduced = false;
+    if (status == MATH_SUCCESS)
+    {
+        status = half_gcd_reduce(context, &high, &factor, &high_reduced);
+    }
+    if (status == MATH_SUCCESS && high_reduced)
+    {
+        status = half_gcd_adjust(context, pair, p, &factor, &high, floor, reduced);
+    }
+    if (status == MATH_SUCCESS && *reduced && matrix != NULL)
+    {
+        status = half_gcd_matrix_mul(matrix, &factor, context->scratch);
+    }
+
+    memory_arena_restore(context->scratch, mark);
+    return status;
+}
+
+/**
+ * @brief Half-GCD: reduce a pair while both values stay above B^s, s = n/2 + 1
+ *
+ * @param matrix Identity on entry; receives the reduction
+ * @param reduced Output: whether the pair changed
+ */
+static MathStatus half_gcd_reduce(HalfGcdContext *context, HalfGcdPair *pair, HalfGcdMatrix *matrix,
+                                  bool *reduced)
+{
+    *reduced = false;
+    MathNatural n = half_gcd_pair_size(pair);
+    MathNatural s = n / 2 + 1;
+    if (n <= s)
+    {
+        return MATH_SUCCESS;
+    }
+
+    MathStatus status = MATH_SUCCESS;
+    bool taken = false;
+
+    if (n >= BIGNUM_HALF_GCD_THRESHOLD)
+    {
+        // The top half of the limbs gives about a quarter of the reduction
+        status = half_gcd_reduce_high(context, pair, n / 2, s, matrix, &taken);
+        *reduced = taken;
+
+        // Single steps until the pair is down to about 3n/4 limbs
+        MathNatural target = 3 * n / 4 + 1;
+        while (status == MATH_SUCCESS && half_gcd_pair_size(pair) > target)
+        {
+            status = half_gcd_step(context, pair, s, matrix, &taken);
+            if (!taken)
+            {
+                return status;
+            }
+            *reduced = true;
+        }
+
+        // What is left above B^s is reduced by a second recursive call
+        MathNatural size = half_gcd_pair_size(pair);
+        if (status == MATH_SUCCESS && size > s + 2)
+        {
+            status = half_gcd_reduce_high(context, pair, 2 * s - size + 1, s, matrix, &taken);
+            *reduced = *reduced || taken;
+        }
+    }
+
+    while (status == MATH_SUCCESS)
+    {
+        status = half_gcd_step(context, pair, s, matrix, &taken);
+        if (!taken)
+        {
+            break;
+        }
+        *reduced = true;
+    }
+    return status;
+}
+
+// ============================================================================
+// ALGORITHM IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Full Euclidean step of the GCD loop: larger value modulo the smaller
+ */
+static MathStatus half_gcd_remainder_step(HalfGcdContext *context, HalfGcdPair *pair, HalfGcdMatrix *matrix)
+{
+    MathNatural big = half_gcd_pair_larger(pair);
+    MathStatus status = bignum_divmod(&pair->quotient, &pair->spare[0], &pair->value[big],
+                                      &pair->value[1 - big], context->scratch);
+    if (status == MATH_SUCCESS && matrix != NULL)
+    {
+        status = half_gcd_matrix_add_quotient(matrix, big, &pair->quotient, context->scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        half_gcd_swap(&pair->value[big], &pair->spare[0]);
+        context->steps++;
+    }
+    return status;
+}
+
+/**
+ * @brief Bezout coefficients of the operands from those of the reduced pair
+ *
+ * With (alpha; beta) = M^-1 (|a|; |b|) and g = x' alpha + y' beta:
+ * x = x' m11 - y' m10 and y = y' m00 - x' m01.
+ */
+static MathStatus half_gcd_compose(const HalfGcdMatrix *matrix, MathBigInteger *x, MathBigInteger *y,
+                                   MemoryArena *scratch)
+{
+    MemoryArenaMark mark = memory_arena_save(scratch);
+    MathNatural capacity = x->capacity + matrix->m[0][0].capacity;
+
+    MathBigInteger term[4];
+    MathStatus status = half_gcd_alloc(scratch, capacity, term, 4);
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&term[0], x, &matrix->m[1][1], scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&term[1], y, &matrix->m[1][0], scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&term[2], y, &matrix->m[0][0], scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&term[3], x, &matrix->m[0][1], scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_sub(&term[0], &term[0], &term[1]);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_sub(&term[2], &term[2], &term[3]);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_copy(x, &term[0]);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_copy(y, &term[2]);
+    }
+
+    memory_arena_restore(scratch, mark);
+    return status;
+}
+
+/**
+ * @brief Half-GCD on big integers
+ *
+ * @param input Arbitrary-precision input (result capacity >= larger operand)
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of matrix or division steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_half_gcd(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps)
+{
+    if (input == NULL || input->operand_a == NULL || input->operand_b == NULL || input->result == NULL ||
+        scratch == NULL || steps == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    bool extended = input->coefficient_x != NULL || input->coefficient_y != NULL;
+    MathNatural capacity = MATH_MAX(input->operand_a->size, input->operand_b->size) + 2;
+    HalfGcdContext context = {.scratch = scratch, .steps = 0};
+
+    HalfGcdPair pair;
+    HalfGcdMatrix cofactors;
+    MathStatus status = half_gcd_pair_init(&pair, scratch, capacity);
+    if (status == MATH_SUCCESS && extended)
+    {
+        status = half_gcd_matrix_init(&cofactors, scratch, capacity);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_copy(&pair.value[0], input->operand_a);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_copy(&pair.value[1], input->operand_b);
+    }
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+    pair.value[0].negative = false;
+    pair.value[1].negative = false;
+
+    HalfGcdMatrix *tracked = extended ? &cofactors : NULL;
+    while (status == MATH_SUCCESS &&
+           MATH_MIN(pair.value[0].size, pair.value[1].size) >= BIGNUM_HALF_GCD_FINISH_LIMBS)
+    {
+        // The half-GCD of the leading third removes about a sixth of the limbs
+        bool reduced = false;
+        status = half_gcd_reduce_high(&context, &pair, 2 * half_gcd_pair_size(&pair) / 3, 0, tracked, &reduced);
+        if (status == MATH_SUCCESS && !reduced)
+        {
+            status = half_gcd_remainder_step(&context, &pair, tracked);
+        }
+    }
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    MathBigBinaryInput rest = MATH_BIG_BINARY_INPUT_INIT(&pair.value[0], &pair.value[1], input->result);
+    rest.scratch = scratch;
+    MathNatural finish_steps = 0;
+
+    if (!extended)
+    {
+        status = mdc_big_lehmer(&rest, scratch, &finish_steps);
+        *steps = context.steps + finish_steps;
+        return status;
+    }
+
+    // Coefficients of the reduced pair, mapped back through the matrix
+    MathBigInteger x, y;
+    status = bignum_alloc(&x, scratch, capacity);
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&y, scratch, capacity);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        rest.coefficient_x = &x;
+        rest.coefficient_y = &y;
+        status = mdc_big_extended(&rest, scratch, &finish_steps);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = half_gcd_compose(&cofactors, &x, &y, scratch);
+    }
+    *steps = context.steps + finish_steps;
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    // Coefficients were computed for |a| and |b|
+    if (input->operand_a->negative && x.size > 0)
+    {
+        x.negative = !x.negative;
+    }
+    if (input->operand_b->negative && y.size > 0)
+    {
+        y.negative = !y.negative;
+    }
+
+    if (input->coefficient_x != NULL)
+    {
+        status = bignum_copy(input->coefficient_x, &x);
+    }
+    if (status == MATH_SUCCESS && input->coefficient_y != NULL)
+    {
+        status = bignum_copy(input->coefficient_y, &y);
+    }
+    return status;
+}
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Validate input for the bignum half-GCD
+ *
+ * @param input Input parameters
+ * @return true if input is valid
+ */
+static bool bignum_half_gcd_validate(const MathBinaryInput *input)
+{
+    // Every 64-bit operand pair is representable
+    return input != NULL;
+}
+
+/**
+ * @brief Execute the bignum half-GCD on 64-bit operands
+ */
+MathResult bignum_half_gcd_compute(const MathBinaryInput *input)
+{
+    return bignum_run_gcd_kernel_word(mdc_big_half_gcd, input);
+}
+
+/**
+ * @brief Execute the bignum half-GCD on big operands
+ */
+MathResult bignum_half_gcd_compute_big(const MathBigBinaryInput *input)
+{
+    return bignum_run_gcd_kernel(mdc_big_half_gcd, input);
+}
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (Global Variable)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the bignum half-GCD
+ */
+ImplementationSpec bignum_half_gcd_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Bignum Half-GCD",
+        "Subquadratic Knuth-Schönhage half-GCD: recursive quotient matrices applied with Karatsuba products",
+        ALGORITHM_FAMILY_EUCLIDEAN,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = bignum_half_gcd_compute,
+    .validate = bignum_half_gcd_validate,
+    .compute_big = bignum_half_gcd_compute_big,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
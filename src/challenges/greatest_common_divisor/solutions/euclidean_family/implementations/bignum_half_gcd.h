@@ -0,0 +1,80 @@
+/**
+ * @file bignum_half_gcd.h
+ * @brief Subquadratic half-GCD (Knuth-Schönhage) for big integers
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares the half-GCD member of the Euclidean family. It
+ * computes the matrix of the first half of the Euclidean quotient
+ * sequence from the leading half of the operands, recursively, and
+ * applies it to the full operands with Karatsuba products, so the GCD
+ * costs O(M(n) log n) instead of the O(n^2) of Euclid and Lehmer. Bezout
+ * coefficients come from the same matrices, which keeps modular
+ * inversion of large operands subquadratic too.
+ */
+
+#ifndef BIGNUM_HALF_GCD_IMPLEMENTATIONS_H
+#define BIGNUM_HALF_GCD_IMPLEMENTATIONS_H
+
+#include "../../../../../core/interfaces/implementation_interface.h"
+#include "../../../../../infrastructure/utilities/bignum_utils.h"
+#include "../../../domain_types.h"
+
+// ============================================================================
+// PARAMETERS
+// ============================================================================
+
+/**
+ * @brief Size in limbs from which the half-GCD recursion splits its operands
+ *
+ * Smaller reductions run Lehmer steps directly.
+ */
+#define BIGNUM_HALF_GCD_THRESHOLD 64
+
+/**
+ * @brief Size in limbs of the smaller operand below which the GCD is
+ *        finished by Lehmer's algorithm (or Extended Euclid for coefficients)
+ */
+#define BIGNUM_HALF_GCD_FINISH_LIMBS (2 * BIGNUM_HALF_GCD_THRESHOLD)
+
+// ============================================================================
+// ALGORITHM DECLARATION
+// ============================================================================
+
+/**
+ * @brief Half-GCD on big integers
+ *
+ * Writes a*x + b*y = gcd coefficients to input->coefficient_x/_y when they
+ * are non-NULL (capacity >= larger operand).
+ *
+ * @param input Arbitrary-precision input (result capacity >= larger operand)
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of matrix or division steps
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus mdc_big_half_gcd(const MathBigBinaryInput *input, MemoryArena *scratch, MathNatural *steps);
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Execute the bignum half-GCD on 64-bit operands
+ */
+MathResult bignum_half_gcd_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute the bignum half-GCD on big operands
+ */
+MathResult bignum_half_gcd_compute_big(const MathBigBinaryInput *input);
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (EXTERN DECLARATION)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the bignum half-GCD
+ */
+extern ImplementationSpec bignum_half_gcd_spec;
+
+#endif // BIGNUM_HALF_GCD_IMPLEMENTATIONS_H
@@ -14,6 +14,11 @@
 #include "../../../domain_types.h"
 #include "../solution_spec.h"
 #include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+#include "../../../gcd_batch.h"
+#include "../../../challenge_services/step_counter.h"
+#include "../../../challenge_services/gcd_isa.h"
+#include "../../../gcd_inline.h"
 #include <limits.h>
 
 // ============================================================================
@@ -34,6 +39,7 @@ GcdInteger mdc_modulo(GcdInteger a, GcdInteger b)
     while (b != 0)
     {
         GcdInteger temp = b;
+        GCD_COUNT_DIVISION();
         b = a % b;
         a = temp;
     }
@@ -55,6 +61,7 @@ GcdInteger mdc_subtracao(GcdInteger a, GcdInteger b)
         return 0;
     while (a != b)
     {
+        GCD_COUNT_SUBTRACTION();
         if (a > b)
             a = a - b;
         else
@@ -75,6 +82,7 @@ GcdInteger mdc_divisao(GcdInteger a, GcdInteger b)
     GcdInteger quociente, resto;
     while (b != 0)
     {
+        GCD_COUNT_DIVISION();
         quociente = a / b;
         resto = a - b * quociente;
         a = b;
@@ -126,13 +134,14 @@ MathResult euclidean_modulo_compute(const MathBinaryInput *input)
     }
 
     // Execute algorithm with timing
+    GCD_STEPS_BEGIN();
     double start_time = math_get_time_ms();
     GcdInteger result = mdc_modulo(input->operand_a, input->operand_b);
     double end_time = math_get_time_ms();
 
     double execution_time = (end_time >= 0 && start_time >= 0) ? (end_time - start_time) : 0.0;
 
-    return math_create_success_result(result, 0, execution_time);
+    return math_create_success_result(result, GCD_STEPS_END(), execution_time);
 }
 
 /**
@@ -156,13 +165,14 @@ MathResult euclidean_subtraction_compute(const MathBinaryInput *input)
     }
 
     // Execute algorithm with timing
+    GCD_STEPS_BEGIN();
     double start_time = math_get_time_ms();
     GcdInteger result = mdc_subtracao(input->operand_a, input->operand_b);
     double end_time = math_get_time_ms();
 
     double execution_time = (end_time >= 0 && start_time >= 0) ? (end_time - start_time) : 0.0;
 
-    return math_create_success_result(result, 0, execution_time);
+    return math_create_success_result(result, GCD_STEPS_END(), execution_time);
 }
 
 /**
@@ -186,13 +196,91 @@ MathResult euclidean_division_compute(const MathBinaryInput *input)
     }
 
     // Execute algorithm with timing
+    GCD_STEPS_BEGIN();
     double start_time = math_get_time_ms();
     GcdInteger result = mdc_divisao(input->operand_a, input->operand_b);
     double end_time = math_get_time_ms();
 
     double execution_time = (end_time >= 0 && start_time >= 0) ? (end_time - start_time) : 0.0;
 
-    return math_create_success_result(result, 0, execution_time);
+    return math_create_success_result(result, GCD_STEPS_END(), execution_time);
+}
+
+// ============================================================================
+// BATCH INTERFACE IMPLEMENTATIONS
+// ============================================================================
+
+/**
+ * @brief Subtraction kernel of the batch loop
+ *
+ * Subtraction never terminates with a single zero operand.
+ */
+static GcdInteger euclidean_subtraction_batch_kernel(GcdInteger a, GcdInteger b)
+{
+    if (a == 0 || b == 0)
+    {
+        return a | b;
+    }
+    return mdc_subtracao(a, b);
+}
+
+/**
+ * @brief Execute Euclidean modulo algorithm over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult euclidean_modulo_compute_batch(const MathBatchInput *input)
+{
+    // Multiversioned loop: the copy built for this CPU's ISA level runs
+    return gcd_batch_run_array(input, gcd_isa_batch_modulo);
+}
+
+/**
+ * @brief Execute Euclidean subtraction algorithm over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult euclidean_subtraction_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run(input, euclidean_subtraction_batch_kernel);
+}
+
+/**
+ * @brief Execute Euclidean division algorithm over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult euclidean_division_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run(input, mdc_divisao);
+}
+
+// ============================================================================
+// UNSIGNED INTERFACE IMPLEMENTATIONS
+// ============================================================================
+
+/**
+ * @brief Execute Euclidean modulo algorithm on unsigned operands
+ *
+ * @param input Unsigned operands
+ * @return MathUnsignedResult with computation result and timing
+ */
+MathUnsignedResult euclidean_modulo_compute_unsigned(const MathUnsignedBinaryInput *input)
+{
+    if (input == NULL)
+    {
+        return math_create_unsigned_error_result(MATH_ERROR_INVALID_INPUT);
+    }
+
+    // Unsigned remainders: no magnitudes to take and a cheaper divide
+    double start_time = math_get_time_ms();
+    MathWideNatural result = gcd_inline_modulo_wide(input->operand_a, input->operand_b);
+    double end_time = math_get_time_ms();
+
+    return math_create_unsigned_result(result, 0, math_elapsed_time_ms(start_time, end_time));
 }
 
 // ============================================================================
@@ -211,6 +299,8 @@ ImplementationSpec euclidean_modulo_spec = {
         false),
     .compute = euclidean_modulo_compute,
     .validate = classic_euclidean_validate,
+    .compute_batch = euclidean_modulo_compute_batch,
+    .compute_unsigned = euclidean_modulo_compute_unsigned,
     .performance = MATH_PERFORMANCE_METRICS_INIT};
 
 /**
@@ -225,6 +315,7 @@ ImplementationSpec euclidean_subtraction_spec = {
         false),
     .compute = euclidean_subtraction_compute,
     .validate = classic_euclidean_validate,
+    .compute_batch = euclidean_subtraction_compute_batch,
     .performance = MATH_PERFORMANCE_METRICS_INIT};
 
 /**
@@ -239,6 +330,7 @@ ImplementationSpec euclidean_division_spec = {
         false),
     .compute = euclidean_division_compute,
     .validate = classic_euclidean_validate,
+    .compute_batch = euclidean_division_compute_batch,
     .performance = MATH_PERFORMANCE_METRICS_INIT};
 
 // ============================================================================
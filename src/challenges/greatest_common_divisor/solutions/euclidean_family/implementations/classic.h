@@ -73,6 +73,49 @@ MathResult euclidean_subtraction_compute(const MathBinaryInput *input);
  */
 MathResult euclidean_division_compute(const MathBinaryInput *input);
 
+// ============================================================================
+// BATCH INTERFACE IMPLEMENTATIONS
+// ============================================================================
+
+/**
+ * @brief Execute Euclidean modulo algorithm over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult euclidean_modulo_compute_batch(const MathBatchInput *input);
+
+/**
+ * @brief Execute Euclidean subtraction algorithm over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult euclidean_subtraction_compute_batch(const MathBatchInput *input);
+
+/**
+ * @brief Execute Euclidean division algorithm over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult euclidean_division_compute_batch(const MathBatchInput *input);
+
+// ============================================================================
+// UNSIGNED INTERFACE IMPLEMENTATIONS
+// ============================================================================
+
+/**
+ * @brief Execute Euclidean modulo algorithm on unsigned operands
+ *
+ * Covers the full MathWideNatural range with unsigned remainders, in
+ * 64-bit arithmetic once both operands fit. Steps are not counted.
+ *
+ * @param input Unsigned operands
+ * @return MathUnsignedResult with computation result and timing
+ */
+MathUnsignedResult euclidean_modulo_compute_unsigned(const MathUnsignedBinaryInput *input);
+
 // ============================================================================
 // IMPLEMENTATION SPECIFICATIONS (EXTERN DECLARATIONS)
 // ============================================================================
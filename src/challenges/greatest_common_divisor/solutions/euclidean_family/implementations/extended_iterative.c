@@ -0,0 +1,172 @@
+/**
+ * @file extended_iterative.c
+ * @brief Iterative Extended Euclidean algorithm implementation
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The recursive mdc_ext computes the Bezout coefficients on the way back
+ * up from the base case, so it needs one stack frame per quotient step
+ * and cannot be inlined into a batch loop. Running the cosequences
+ * forwards gives exactly the same coefficients:
+ *
+ *   r_{i+1} = r_{i-1} - q_i r_i,  s_{i+1} = s_{i-1} - q_i s_i,  t_{i+1} = t_{i-1} - q_i t_i
+ *
+ * with r_i = a*s_i + b*t_i at every step. Only six words of state are
+ * live, so the whole loop stays in registers.
+ */
+
+#include "extended_iterative.h"
+#include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+#include "../../../gcd_batch.h"
+#include "../../../challenge_services/step_counter.h"
+#include <limits.h>
+
+// ============================================================================
+// ALGORITHM IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Extended Euclidean algorithm (iterative)
+ *
+ * Coefficients stay bounded by |b/gcd| and |a/gcd|, so nothing overflows
+ * for operands other than LLONG_MIN.
+ */
+GcdInteger mdc_ext_iterative(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y)
+{
+    GcdInteger r0 = a, r1 = b;
+    GcdInteger s0 = 1, s1 = 0;
+    GcdInteger t0 = 0, t1 = 1;
+
+    while (r1 != 0)
+    {
+        GCD_COUNT_DIVISION();
+        GcdInteger q = r0 / r1;
+        GcdInteger r2 = r0 - q * r1;
+        GcdInteger s2 = s0 - q * s1;
+        GcdInteger t2 = t0 - q * t1;
+        r0 = r1;
+        r1 = r2;
+        s0 = s1;
+        s1 = s2;
+        t0 = t1;
+        t1 = t2;
+    }
+
+    *x = s0;
+    *y = t0;
+    return r0;
+}
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Validate input for the iterative Extended Euclidean algorithm
+ *
+ * @param input Input parameters
+ * @return true if input is valid
+ */
+static bool extended_iterative_validate(const MathBinaryInput *input)
+{
+    if (input == NULL)
+    {
+        return false;
+    }
+
+    // Quotients of LLONG_MIN by -1 overflow
+    return input->operand_a != LLONG_MIN && input->operand_b != LLONG_MIN;
+}
+
+/**
+ * @brief Execute iterative Extended Euclidean algorithm with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult euclidean_extended_iterative_compute(const MathBinaryInput *input)
+{
+    if (!extended_iterative_validate(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    // Handle special cases first
+    MathResult special_result;
+    if (math_handle_gcd_special_cases(input->operand_a, input->operand_b, &special_result))
+    {
+        return special_result;
+    }
+
+    GCD_STEPS_BEGIN();
+    double start_time = math_get_time_ms();
+    GcdInteger x, y;
+    GcdInteger result = mdc_ext_iterative(MATH_ABS(input->operand_a), MATH_ABS(input->operand_b), &x, &y);
+    double end_time = math_get_time_ms();
+
+    return math_create_success_result(result, GCD_STEPS_END(), math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Execute iterative Extended Euclidean algorithm over a batch of operand pairs
+ *
+ * The kernel runs on absolute values; the coefficient signs are then
+ * flipped to match the signed operands.
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult euclidean_extended_iterative_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run_extended(input, mdc_ext_iterative);
+}
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (Global Variable)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the iterative Extended Euclidean algorithm
+ */
+ImplementationSpec euclidean_extended_iterative_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Iterative Extended Euclidean",
+        "Extended Euclidean algorithm with forward cosequences, no recursion",
+        ALGORITHM_FAMILY_EUCLIDEAN,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = euclidean_extended_iterative_compute,
+    .validate = extended_iterative_validate,
+    .compute_batch = euclidean_extended_iterative_compute_batch,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *extended_iterative_get_implementation(GcdAlgorithmVariant variant)
+{
+    if (variant == GCD_EXTENDED_ITERATIVE)
+    {
+        return &euclidean_extended_iterative_spec;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Check if variant is the iterative Extended Euclidean algorithm
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is the iterative Extended Euclidean algorithm
+ */
+bool is_extended_iterative_variant(GcdAlgorithmVariant variant)
+{
+    return variant == GCD_EXTENDED_ITERATIVE;
+}
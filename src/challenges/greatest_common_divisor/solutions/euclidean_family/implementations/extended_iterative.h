@@ -0,0 +1,90 @@
+/**
+ * @file extended_iterative.h
+ * @brief Iterative Extended Euclidean algorithm implementation
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares the non-recursive Extended Euclidean algorithm.
+ * It follows the same quotient sequence as mdc_ext and returns the same
+ * Bezout coefficients, but keeps the cosequences in local variables
+ * instead of one stack frame per quotient step.
+ */
+
+#ifndef EXTENDED_ITERATIVE_IMPLEMENTATIONS_H
+#define EXTENDED_ITERATIVE_IMPLEMENTATIONS_H
+
+#include "../../../../../core/interfaces/implementation_interface.h"
+#include "../../../domain_types.h"
+
+// ============================================================================
+// ALGORITHM DECLARATION
+// ============================================================================
+
+/**
+ * @brief Extended Euclidean algorithm (iterative)
+ *
+ * Drop-in replacement for mdc_ext: for every input (including negative
+ * operands, where C's truncating division decides the signs) it returns
+ * the same GCD and coefficients.
+ *
+ * @param a First operand (LLONG_MIN not supported)
+ * @param b Second operand (LLONG_MIN not supported)
+ * @param x Pointer to store coefficient for a
+ * @param y Pointer to store coefficient for b
+ * @return Greatest common divisor
+ */
+GcdInteger mdc_ext_iterative(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y);
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Execute iterative Extended Euclidean algorithm with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult euclidean_extended_iterative_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute iterative Extended Euclidean algorithm over a batch of operand pairs
+ *
+ * GCDs are non-negative; when the coefficient arrays are given they
+ * receive x, y with a*x + b*y = gcd for the signed operands.
+ *
+ * @param input Batch input (operand arrays, output and coefficient buffers)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult euclidean_extended_iterative_compute_batch(const MathBatchInput *input);
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (EXTERN DECLARATION)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the iterative Extended Euclidean algorithm
+ */
+extern ImplementationSpec euclidean_extended_iterative_spec;
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *extended_iterative_get_implementation(GcdAlgorithmVariant variant);
+
+/**
+ * @brief Check if variant is the iterative Extended Euclidean algorithm
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is the iterative Extended Euclidean algorithm
+ */
+bool is_extended_iterative_variant(GcdAlgorithmVariant variant);
+
+#endif // EXTENDED_ITERATIVE_IMPLEMENTATIONS_H
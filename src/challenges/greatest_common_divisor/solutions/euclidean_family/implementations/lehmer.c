@@ -0,0 +1,267 @@
+/**
+ * @file lehmer.c
+ * @brief Lehmer's GCD algorithm implementation
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Lehmer's algorithm replaces most full-width divisions of the Euclidean
+ * algorithm by arithmetic on the leading LEHMER_DIGIT_BITS bits. Several
+ * quotient steps are simulated on these small approximations and collected
+ * in a 2x2 cofactor matrix, which is then applied to the full operands
+ * with four multiplications. Once both operands fit in a single digit the
+ * remaining steps run as a plain 32-bit Euclidean loop.
+ *
+ * For 64-bit operands this halves the width of almost every division;
+ * for multi-precision operands it replaces most long divisions entirely.
+ */
+
+#include "lehmer.h"
+#include "../solution_spec.h"
+#include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+#include "../../../gcd_batch.h"
+#include "../../../challenge_services/step_counter.h"
+#include <limits.h>
+
+// ============================================================================
+// LEHMER COFACTOR STEP
+// ============================================================================
+
+/**
+ * @brief Simulate Euclidean quotient steps on leading digits
+ *
+ * Runs the Euclidean algorithm on the approximations and tracks the
+ * cosequences. Collins' stopping condition (Jebelean 1993, section 4.2)
+ * a2 >= v2 && a1 - a2 >= v1 + v2 guarantees the quotients so far are also
+ * quotients of the full operands, with one division per step. Cosequences
+ * are kept as magnitudes with a parity flag, since their signs alternate.
+ *
+ * @param u_hat Leading bits of the larger operand
+ * @param v_hat Bits of the smaller operand at the same position
+ * @param matrix Output cofactor matrix
+ * @return Number of quotient steps the matrix performs (0 if none)
+ */
+MathNatural lehmer_compute_cofactors(
+    MathNatural u_hat,
+    MathNatural v_hat,
+    LehmerCofactorMatrix *matrix)
+{
+    // Both digits fit in 32 bits, so a 32-bit division is enough
+    uint32_t a1 = (uint32_t)u_hat;
+    uint32_t a2 = (uint32_t)v_hat;
+    MathNatural u0 = 0, u1 = 1, u2 = 0;
+    MathNatural v0 = 0, v1 = 0, v2 = 1;
+    MathNatural steps = 0;
+    bool even = false;
+
+    while (a2 >= v2 && a1 - a2 >= v1 + v2)
+    {
+        GCD_COUNT_DIVISION();
+        uint32_t q = a1 / a2;
+        uint32_t r = a1 % a2;
+        a1 = a2;
+        a2 = r;
+
+        MathNatural t = u1 + q * u2;
+        u0 = u1;
+        u1 = u2;
+        u2 = t;
+
+        t = v1 + q * v2;
+        v0 = v1;
+        v1 = v2;
+        v2 = t;
+
+        even = !even;
+        steps++;
+    }
+
+    // The rows lag one step behind the last quotient: with fewer than two
+    // steps the matrix is still the identity
+    if (v0 == 0)
+    {
+        *matrix = (LehmerCofactorMatrix){.a = 1, .b = 0, .c = 0, .d = 1};
+        return 0;
+    }
+
+    matrix->a = even ? (MathInteger)u0 : -(MathInteger)u0;
+    matrix->b = even ? -(MathInteger)v0 : (MathInteger)v0;
+    matrix->c = even ? -(MathInteger)u1 : (MathInteger)u1;
+    matrix->d = even ? (MathInteger)v1 : -(MathInteger)v1;
+    return steps - 1;
+}
+
+// ============================================================================
+// ALGORITHM IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Lehmer's GCD on 64-bit operands
+ *
+ * The cofactor matrix is applied with wrap-around unsigned arithmetic:
+ * the intermediate products exceed 64 bits, but the exact results are
+ * consecutive Euclidean remainders below 2^63, so the value modulo 2^64
+ * is already the correct one.
+ */
+GcdInteger mdc_lehmer(GcdInteger a, GcdInteger b)
+{
+    MathNatural u = (MathNatural)MATH_ABS(a);
+    MathNatural v = (MathNatural)MATH_ABS(b);
+
+    if (u < v)
+    {
+        MathNatural t = u;
+        u = v;
+        v = t;
+    }
+
+    // Multi-digit phase: v needs more than one digit for Lehmer steps to pay off
+    while ((v >> LEHMER_DIGIT_BITS) != 0)
+    {
+        MathNatural shift = math_bit_length(u) - LEHMER_DIGIT_BITS;
+        LehmerCofactorMatrix m;
+
+        if (lehmer_compute_cofactors(u >> shift, v >> shift, &m) == 0)
+        {
+            // Quotient too large to simulate: one full-precision step
+            GCD_COUNT_DIVISION();
+            MathNatural r = u % v;
+            u = v;
+            v = r;
+            continue;
+        }
+
+        MathNatural next_u = (MathNatural)m.a * u + (MathNatural)m.b * v;
+        MathNatural next_v = (MathNatural)m.c * u + (MathNatural)m.d * v;
+        u = next_u;
+        v = next_v;
+    }
+
+    if (v == 0)
+    {
+        return (GcdInteger)u;
+    }
+
+    // Single-digit phase: one wide reduction, then 32-bit divisions
+    GCD_COUNT_DIVISION();
+    uint32_t x = (uint32_t)v;
+    uint32_t y = (uint32_t)(u % v);
+    while (y != 0)
+    {
+        GCD_COUNT_DIVISION();
+        uint32_t r = x % y;
+        x = y;
+        y = r;
+    }
+
+    return (GcdInteger)x;
+}
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Validate input for Lehmer's algorithm
+ *
+ * @param input Input parameters
+ * @return true if input is valid
+ */
+static bool lehmer_euclidean_validate(const MathBinaryInput *input)
+{
+    if (input == NULL)
+    {
+        return false;
+    }
+
+    // Absolute values must fit in 63 bits
+    return input->operand_a != LLONG_MIN && input->operand_b != LLONG_MIN;
+}
+
+/**
+ * @brief Execute Lehmer's GCD algorithm with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult euclidean_lehmer_compute(const MathBinaryInput *input)
+{
+    if (!lehmer_euclidean_validate(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    // Handle special cases first
+    MathResult special_result;
+    if (math_handle_gcd_special_cases(input->operand_a, input->operand_b, &special_result))
+    {
+        return special_result;
+    }
+
+    GCD_STEPS_BEGIN();
+    double start_time = math_get_time_ms();
+    GcdInteger result = mdc_lehmer(input->operand_a, input->operand_b);
+    double end_time = math_get_time_ms();
+
+    return math_create_success_result(result, GCD_STEPS_END(), math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Execute Lehmer's GCD algorithm over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult euclidean_lehmer_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run(input, mdc_lehmer);
+}
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (Global Variable)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for Lehmer's GCD algorithm
+ */
+ImplementationSpec euclidean_lehmer_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Euclidean Lehmer",
+        "Lehmer's GCD: quotient steps simulated on leading 32-bit digits and applied as a 2x2 matrix",
+        ALGORITHM_FAMILY_EUCLIDEAN,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = euclidean_lehmer_compute,
+    .validate = lehmer_euclidean_validate,
+    .compute_batch = euclidean_lehmer_compute_batch,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *lehmer_euclidean_get_implementation(GcdAlgorithmVariant variant)
+{
+    if (variant == GCD_EUCLIDEAN_LEHMER)
+    {
+        return &euclidean_lehmer_spec;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Check if variant is Lehmer's algorithm
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is Lehmer's algorithm
+ */
+bool is_lehmer_euclidean_variant(GcdAlgorithmVariant variant)
+{
+    return variant == GCD_EUCLIDEAN_LEHMER;
+}
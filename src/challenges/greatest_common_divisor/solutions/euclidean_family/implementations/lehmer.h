@@ -0,0 +1,121 @@
+/**
+ * @file lehmer.h
+ * @brief Lehmer's GCD algorithm implementation
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares Lehmer's GCD and the leading-digit cofactor step it
+ * is built on. The cofactor step only looks at single-word approximations,
+ * so the same routine drives both the 64-bit and multi-precision versions.
+ */
+
+#ifndef LEHMER_IMPLEMENTATIONS_H
+#define LEHMER_IMPLEMENTATIONS_H
+
+#include "../../../../../core/interfaces/implementation_interface.h"
+#include "../../../domain_types.h"
+
+// ============================================================================
+// LEHMER COFACTOR STEP
+// ============================================================================
+
+/**
+ * @brief Number of leading bits used for the single-precision simulation
+ */
+#define LEHMER_DIGIT_BITS 32
+
+/**
+ * @brief 2x2 cofactor matrix accumulated from several quotient steps
+ *
+ * Applying it to the full operands (u, v) gives the pair reached after
+ * those steps of the Euclidean sequence:
+ *   u' = a*u + b*v,  v' = c*u + d*v
+ * Entries have alternating signs and magnitudes below 2^LEHMER_DIGIT_BITS.
+ */
+typedef struct
+{
+    MathInteger a; /**< Row 0, column 0 */
+    MathInteger b; /**< Row 0, column 1 */
+    MathInteger c; /**< Row 1, column 0 */
+    MathInteger d; /**< Row 1, column 1 */
+} LehmerCofactorMatrix;
+
+/**
+ * @brief Simulate Euclidean quotient steps on leading digits
+ *
+ * Uses Collins' stopping condition, so every step contained in the matrix
+ * is also a step of the full-precision Euclidean sequence.
+ *
+ * @param u_hat Leading LEHMER_DIGIT_BITS bits of the larger operand
+ * @param v_hat Bits of the smaller operand at the same position
+ * @param matrix Output cofactor matrix
+ * @return Number of quotient steps accepted (0 means a full division is needed)
+ */
+MathNatural lehmer_compute_cofactors(
+    MathNatural u_hat,
+    MathNatural v_hat,
+    LehmerCofactorMatrix *matrix);
+
+// ============================================================================
+// ALGORITHM DECLARATION
+// ============================================================================
+
+/**
+ * @brief Lehmer's GCD on 64-bit operands
+ *
+ * @param a First operand (LLONG_MIN not supported)
+ * @param b Second operand (LLONG_MIN not supported)
+ * @return Greatest common divisor (non-negative)
+ */
+GcdInteger mdc_lehmer(GcdInteger a, GcdInteger b);
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Execute Lehmer's GCD algorithm with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult euclidean_lehmer_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute Lehmer's GCD algorithm over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult euclidean_lehmer_compute_batch(const MathBatchInput *input);
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (EXTERN DECLARATION)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for Lehmer's GCD algorithm
+ */
+extern ImplementationSpec euclidean_lehmer_spec;
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *lehmer_euclidean_get_implementation(GcdAlgorithmVariant variant);
+
+/**
+ * @brief Check if variant is Lehmer's algorithm
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is Lehmer's algorithm
+ */
+bool is_lehmer_euclidean_variant(GcdAlgorithmVariant variant);
+
+#endif // LEHMER_IMPLEMENTATIONS_H
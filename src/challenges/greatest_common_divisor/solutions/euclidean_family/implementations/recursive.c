@@ -13,7 +13,11 @@
 #include "../../../../../core/interfaces/implementation_interface.h"
 #include "../../../domain_types.h"
 #include "../solution_spec.h"
+#include "extended_iterative.h"
 #include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+#include "../../../gcd_batch.h"
+#include "../../../challenge_services/step_counter.h"
 #include <limits.h>
 
 // ============================================================================
@@ -31,6 +35,7 @@ GcdInteger mdc_mod(GcdInteger a, GcdInteger b)
 {
     if (b == 0)
         return a;
+    GCD_COUNT_DIVISION();
     return mdc_mod(b, a % b);
 }
 
@@ -43,6 +48,7 @@ GcdInteger mdc_sub(GcdInteger a, GcdInteger b)
 {
     if (a == b)
         return a;
+    GCD_COUNT_SUBTRACTION();
     if (a > b)
         return mdc_sub(a - b, b);
     return mdc_sub(a, b - a);
@@ -62,6 +68,7 @@ GcdInteger mdc_ext(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y)
         return a;
     }
     GcdInteger x1, y1;
+    GCD_COUNT_DIVISION();
     GcdInteger gcd = mdc_ext(b, a % b, &x1, &y1);
     *x = y1;
     *y = x1 - (a / b) * y1;
@@ -112,13 +119,14 @@ MathResult euclidean_recursive_modulo_compute(const MathBinaryInput *input)
     }
 
     // Execute algorithm with timing
+    GCD_STEPS_BEGIN();
     double start_time = math_get_time_ms();
     GcdInteger result = mdc_mod(input->operand_a, input->operand_b);
     double end_time = math_get_time_ms();
 
     double execution_time = (end_time >= 0 && start_time >= 0) ? (end_time - start_time) : 0.0;
 
-    return math_create_success_result(result, 0, execution_time);
+    return math_create_success_result(result, GCD_STEPS_END(), execution_time);
 }
 
 /**
@@ -141,14 +149,23 @@ MathResult euclidean_recursive_subtraction_compute(const MathBinaryInput *input)
         return special_result;
     }
 
+    // The subtraction recursion only terminates for non-negative operands
+    MathInteger abs_a, abs_b;
+    if (math_safe_abs(input->operand_a, &abs_a) != MATH_SUCCESS ||
+        math_safe_abs(input->operand_b, &abs_b) != MATH_SUCCESS)
+    {
+        return math_create_error_result(MATH_ERROR_OVERFLOW, 0, 0.0);
+    }
+
     // Execute algorithm with timing
+    GCD_STEPS_BEGIN();
     double start_time = math_get_time_ms();
-    GcdInteger result = mdc_sub(input->operand_a, input->operand_b);
+    GcdInteger result = mdc_sub(abs_a, abs_b);
     double end_time = math_get_time_ms();
 
     double execution_time = (end_time >= 0 && start_time >= 0) ? (end_time - start_time) : 0.0;
 
-    return math_create_success_result(result, 0, execution_time);
+    return math_create_success_result(result, GCD_STEPS_END(), execution_time);
 }
 
 /**
@@ -172,6 +189,7 @@ MathResult euclidean_extended_compute(const MathBinaryInput *input)
     }
 
     // Execute algorithm with timing
+    GCD_STEPS_BEGIN();
     double start_time = math_get_time_ms();
     GcdInteger x, y;
     GcdInteger result = mdc_ext(input->operand_a, input->operand_b, &x, &y);
@@ -183,7 +201,61 @@ MathResult euclidean_extended_compute(const MathBinaryInput *input)
     // only returns the GCD value. For full extended results, use the direct
     // mdc_ext function or create a separate extended interface.
 
-    return math_create_success_result(result, 0, execution_time);
+    return math_create_success_result(result, GCD_STEPS_END(), execution_time);
+}
+
+// ============================================================================
+// BATCH INTERFACE IMPLEMENTATIONS
+// ============================================================================
+
+/**
+ * @brief Subtraction kernel of the batch loop
+ *
+ * Subtraction never terminates with a single zero operand.
+ */
+static GcdInteger euclidean_recursive_subtraction_batch_kernel(GcdInteger a, GcdInteger b)
+{
+    if (a == 0 || b == 0)
+    {
+        return a | b;
+    }
+    return mdc_sub(a, b);
+}
+
+/**
+ * @brief Execute recursive Euclidean modulo algorithm over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult euclidean_recursive_modulo_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run(input, mdc_mod);
+}
+
+/**
+ * @brief Execute recursive Euclidean subtraction algorithm over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult euclidean_recursive_subtraction_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run(input, euclidean_recursive_subtraction_batch_kernel);
+}
+
+/**
+ * @brief Execute extended Euclidean algorithm over a batch of operand pairs
+ *
+ * Coefficients are written when the batch provides coefficient arrays,
+ * with signs matching the signed operands.
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult euclidean_extended_compute_batch(const MathBatchInput *input)
+{
+    return gcd_batch_run_extended(input, mdc_ext);
 }
 
 // ============================================================================
@@ -214,8 +286,8 @@ ExtendedGcdResult euclidean_extended_compute_full(GcdInteger a, GcdInteger b, Gc
         return EXTENDED_GCD_INIT(0, 0, 0);
     }
 
-    // Execute extended algorithm
-    GcdInteger gcd_result = mdc_ext(a, b, x, y);
+    // Same coefficients as mdc_ext, without one stack frame per quotient step
+    GcdInteger gcd_result = mdc_ext_iterative(a, b, x, y);
 
     return EXTENDED_GCD_INIT(gcd_result, *x, *y);
 }
@@ -236,6 +308,7 @@ ImplementationSpec euclidean_recursive_modulo_spec = {
         true),
     .compute = euclidean_recursive_modulo_compute,
     .validate = recursive_euclidean_validate,
+    .compute_batch = euclidean_recursive_modulo_compute_batch,
     .performance = MATH_PERFORMANCE_METRICS_INIT};
 
 /**
@@ -250,6 +323,7 @@ ImplementationSpec euclidean_recursive_subtraction_spec = {
         true),
     .compute = euclidean_recursive_subtraction_compute,
     .validate = recursive_euclidean_validate,
+    .compute_batch = euclidean_recursive_subtraction_compute_batch,
     .performance = MATH_PERFORMANCE_METRICS_INIT};
 
 /**
@@ -264,6 +338,7 @@ ImplementationSpec euclidean_extended_spec = {
         true),
     .compute = euclidean_extended_compute,
     .validate = recursive_euclidean_validate,
+    .compute_batch = euclidean_extended_compute_batch,
     .performance = MATH_PERFORMANCE_METRICS_INIT};
 
 // ============================================================================
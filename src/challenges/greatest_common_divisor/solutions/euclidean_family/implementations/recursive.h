@@ -75,6 +75,36 @@ MathResult euclidean_recursive_subtraction_compute(const MathBinaryInput *input)
  */
 MathResult euclidean_extended_compute(const MathBinaryInput *input);
 
+// ============================================================================
+// BATCH INTERFACE IMPLEMENTATIONS
+// ============================================================================
+
+/**
+ * @brief Execute recursive Euclidean modulo algorithm over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult euclidean_recursive_modulo_compute_batch(const MathBatchInput *input);
+
+/**
+ * @brief Execute recursive Euclidean subtraction algorithm over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult euclidean_recursive_subtraction_compute_batch(const MathBatchInput *input);
+
+/**
+ * @brief Execute extended Euclidean algorithm over a batch of operand pairs
+ *
+ * Writes the Bezout coefficients too when the coefficient arrays are set.
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult euclidean_extended_compute_batch(const MathBatchInput *input);
+
 /**
  * @brief Execute extended Euclidean algorithm and return full result
  *
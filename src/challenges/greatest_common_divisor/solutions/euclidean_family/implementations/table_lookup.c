@@ -0,0 +1,301 @@
+/**
+ * @file table_lookup.c
+ * @brief Table-driven GCD for small operands
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The Euclidean algorithm spends its last few steps on values that fit in
+ * a byte. This variant stops dividing as soon as the larger operand drops
+ * below 2^GCD_TABLE_BITS and reads the answer from a triangular table
+ * instead. Pairs that start small, the common case for sieving-style or
+ * fraction-reduction workloads, cost one bounds check and one L1 load.
+ *
+ * Wider operands run 64-bit modulo steps until they fit in 32 bits and
+ * cheaper 32-bit steps after that, like the tail of Lehmer's algorithm.
+ * The table is built once, on first use, from the recurrence
+ * gcd(x, y) = gcd(y, x mod y), filling rows in increasing order of x so
+ * every entry only reads rows already written.
+ */
+
+#include "table_lookup.h"
+#include "../solution_spec.h"
+#include "../../../../../infrastructure/utilities/math_utils.h"
+#include "../../../../../infrastructure/utilities/memory_utils.h"
+#include "../../../gcd_batch.h"
+#include "../../../challenge_services/step_counter.h"
+#include <limits.h>
+#include <stdint.h>
+
+// Platform detection for one-time table construction
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || defined(__MINGW32__)
+#ifndef SINGLE_THREADED
+#define HAS_POSIX_THREADS 1
+#endif
+#endif
+
+#ifdef HAS_POSIX_THREADS
+#include <pthread.h>
+#endif
+
+/**
+ * @brief Publication of the built table: readers skip the once-guard
+ *        after seeing the flag, so it is released after the last store
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define GCD_TABLE_LOAD_READY(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define GCD_TABLE_STORE_READY(x) __atomic_store_n(&(x), true, __ATOMIC_RELEASE)
+#define GCD_TABLE_ALIGNED __attribute__((aligned(64)))
+#else
+#define GCD_TABLE_LOAD_READY(x) (x)
+#define GCD_TABLE_STORE_READY(x) ((x) = true)
+#define GCD_TABLE_ALIGNED
+#endif
+
+// ============================================================================
+// LOOKUP TABLE
+// ============================================================================
+
+/**
+ * @brief Operands covered by the table (exclusive bound)
+ */
+#define GCD_TABLE_SIZE (1u << GCD_TABLE_BITS)
+
+/**
+ * @brief Entries of the triangle x > y
+ */
+#define GCD_TABLE_ENTRIES (GCD_TABLE_SIZE * (GCD_TABLE_SIZE - 1) / 2)
+
+/**
+ * @brief Position of gcd(x, y) for y < x < GCD_TABLE_SIZE
+ *
+ * Row x starts after the x * (x - 1) / 2 entries of rows 1 .. x - 1.
+ */
+#define GCD_TABLE_INDEX(x, y) (((x) * ((x) - 1) >> 1) + (y))
+
+// Cache-line aligned so the triangle spans the fewest lines
+static GCD_TABLE_ALIGNED uint8_t g_gcd_table[GCD_TABLE_ENTRIES];
+static bool g_gcd_table_ready = false;
+
+#ifdef HAS_POSIX_THREADS
+static pthread_once_t g_gcd_table_once = PTHREAD_ONCE_INIT;
+#endif
+
+/**
+ * @brief Fill the table from the Euclidean recurrence
+ */
+static void gcd_table_build(void)
+{
+    for (uint32_t x = 1; x < GCD_TABLE_SIZE; x++)
+    {
+        g_gcd_table[GCD_TABLE_INDEX(x, 0)] = (uint8_t)x;
+        for (uint32_t y = 1; y < x; y++)
+        {
+            g_gcd_table[GCD_TABLE_INDEX(x, y)] = g_gcd_table[GCD_TABLE_INDEX(y, x % y)];
+        }
+    }
+    GCD_TABLE_STORE_READY(g_gcd_table_ready);
+}
+
+/**
+ * @brief Build the lookup table (thread-safe, later calls are no-ops)
+ */
+void gcd_table_init(void)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_once(&g_gcd_table_once, gcd_table_build);
+#else
+    if (!GCD_TABLE_LOAD_READY(g_gcd_table_ready))
+    {
+        gcd_table_build();
+    }
+#endif
+}
+
+// ============================================================================
+// ALGORITHM IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Reduce an ordered pair with modulo steps, then look it up
+ *
+ * @param u Larger magnitude
+ * @param v Smaller magnitude
+ * @return gcd(u, v); the table must already be built
+ */
+static inline GcdInteger table_gcd_ordered(MathNatural u, MathNatural v)
+{
+    // Wide phase: 64-bit divisions until the pair fits in a machine word
+    while ((u >> 32) != 0)
+    {
+        if (v == 0)
+        {
+            return (GcdInteger)u;
+        }
+        GCD_COUNT_DIVISION();
+        MathNatural r = u % v;
+        u = v;
+        v = r;
+    }
+
+    // Narrow phase: 32-bit divisions until the pair fits in the table
+    uint32_t x = (uint32_t)u;
+    uint32_t y = (uint32_t)v;
+    while (x >= GCD_TABLE_SIZE)
+    {
+        if (y == 0)
+        {
+            return (GcdInteger)x;
+        }
+        GCD_COUNT_DIVISION();
+        uint32_t r = x % y;
+        x = y;
+        y = r;
+    }
+
+    // Equal operands (including 0, 0) lie on the diagonal the table omits
+    if (x == y)
+    {
+        return (GcdInteger)x;
+    }
+    return (GcdInteger)g_gcd_table[GCD_TABLE_INDEX(x, y)];
+}
+
+/**
+ * @brief GCD on 64-bit operands, finished by a table lookup
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @return Greatest common divisor (non-negative)
+ */
+GcdInteger mdc_table(GcdInteger a, GcdInteger b)
+{
+    if (!GCD_TABLE_LOAD_READY(g_gcd_table_ready))
+    {
+        gcd_table_init();
+    }
+
+    MathNatural u = (MathNatural)MATH_ABS(a);
+    MathNatural v = (MathNatural)MATH_ABS(b);
+    return u >= v ? table_gcd_ordered(u, v) : table_gcd_ordered(v, u);
+}
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Validate input for the table-driven GCD
+ *
+ * @param input Input parameters
+ * @return true if input is valid
+ */
+static bool table_lookup_validate(const MathBinaryInput *input)
+{
+    if (input == NULL)
+    {
+        return false;
+    }
+
+    // Absolute values must fit in 63 bits
+    return input->operand_a != LLONG_MIN && input->operand_b != LLONG_MIN;
+}
+
+/**
+ * @brief Execute the table-driven GCD with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult euclidean_table_compute(const MathBinaryInput *input)
+{
+    if (!table_lookup_validate(input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    // Handle special cases first
+    MathResult special_result;
+    if (math_handle_gcd_special_cases(input->operand_a, input->operand_b, &special_result))
+    {
+        return special_result;
+    }
+
+    gcd_table_init();
+    GCD_STEPS_BEGIN();
+    double start_time = math_get_time_ms();
+    GcdInteger result = mdc_table(input->operand_a, input->operand_b);
+    double end_time = math_get_time_ms();
+
+    return math_create_success_result(result, GCD_STEPS_END(), math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Table kernel of the batch loop
+ */
+static GcdInteger euclidean_table_batch_kernel(GcdInteger a, GcdInteger b)
+{
+    MathNatural u = (MathNatural)a;
+    MathNatural v = (MathNatural)b;
+    return u >= v ? table_gcd_ordered(u, v) : table_gcd_ordered(v, u);
+}
+
+/**
+ * @brief Execute the table-driven GCD over a batch of operand pairs
+ *
+ * @param input Batch input
+ * @return Batch summary result
+ */
+MathResult euclidean_table_compute_batch(const MathBatchInput *input)
+{
+    gcd_table_init();
+    return gcd_batch_run(input, euclidean_table_batch_kernel);
+}
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (Global Variable)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the table-driven GCD
+ */
+ImplementationSpec euclidean_table_spec = {
+    .metadata = IMPLEMENTATION_METADATA(
+        "Euclidean Table Lookup",
+        "Euclidean GCD finished from a precomputed 8-bit gcd table once both operands are below 256",
+        ALGORITHM_FAMILY_EUCLIDEAN,
+        COMPLEXITY_LOGARITHMIC,
+        false),
+    .compute = euclidean_table_compute,
+    .validate = table_lookup_validate,
+    .compute_batch = euclidean_table_compute_batch,
+    .performance = MATH_PERFORMANCE_METRICS_INIT};
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *table_lookup_get_implementation(GcdAlgorithmVariant variant)
+{
+    if (variant == GCD_EUCLIDEAN_TABLE)
+    {
+        return &euclidean_table_spec;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Check if variant is the table-driven GCD
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is the table-driven GCD
+ */
+bool is_table_lookup_variant(GcdAlgorithmVariant variant)
+{
+    return variant == GCD_EUCLIDEAN_TABLE;
+}
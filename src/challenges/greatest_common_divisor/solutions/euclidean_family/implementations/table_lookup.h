@@ -0,0 +1,102 @@
+/**
+ * @file table_lookup.h
+ * @brief Table-driven GCD for small operands
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares a Euclidean GCD that finishes from a precomputed
+ * table of gcd(x, y) for all x, y below 2^GCD_TABLE_BITS. Wider operands
+ * are reduced by ordinary modulo steps until they fit, so every input is
+ * accepted, but the variant only pays off when most pairs are small.
+ */
+
+#ifndef TABLE_LOOKUP_IMPLEMENTATIONS_H
+#define TABLE_LOOKUP_IMPLEMENTATIONS_H
+
+#include "../../../../../core/interfaces/implementation_interface.h"
+#include "../../../domain_types.h"
+
+// ============================================================================
+// LOOKUP TABLE
+// ============================================================================
+
+/**
+ * @brief Operand bits covered by the table
+ *
+ * Only pairs x > y are stored, one byte each: 256 * 255 / 2 = 32640 bytes,
+ * small enough to stay resident in a 32 KB L1 data cache alongside the
+ * operand stream.
+ */
+#define GCD_TABLE_BITS 8
+
+/**
+ * @brief Build the lookup table (thread-safe, later calls are no-ops)
+ *
+ * mdc_table() builds it on first use; calling this up front keeps the
+ * one-time cost out of timed regions.
+ */
+void gcd_table_init(void);
+
+// ============================================================================
+// ALGORITHM DECLARATION
+// ============================================================================
+
+/**
+ * @brief GCD on 64-bit operands, finished by a table lookup
+ *
+ * @param a First operand (LLONG_MIN not supported)
+ * @param b Second operand (LLONG_MIN not supported)
+ * @return Greatest common divisor (non-negative)
+ */
+GcdInteger mdc_table(GcdInteger a, GcdInteger b);
+
+// ============================================================================
+// INTERFACE IMPLEMENTATION
+// ============================================================================
+
+/**
+ * @brief Execute the table-driven GCD with interface
+ *
+ * @param input Input parameters
+ * @return MathResult with computation result and timing
+ */
+MathResult euclidean_table_compute(const MathBinaryInput *input);
+
+/**
+ * @brief Execute the table-driven GCD over a batch of operand pairs
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return Batch summary result, timed once for the whole batch
+ */
+MathResult euclidean_table_compute_batch(const MathBatchInput *input);
+
+// ============================================================================
+// IMPLEMENTATION SPECIFICATION (EXTERN DECLARATION)
+// ============================================================================
+
+/**
+ * @brief Implementation specification for the table-driven GCD
+ */
+extern ImplementationSpec euclidean_table_spec;
+
+// ============================================================================
+// FAMILY INTEGRATION FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Get implementation specification by variant
+ *
+ * @param variant Algorithm variant
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *table_lookup_get_implementation(GcdAlgorithmVariant variant);
+
+/**
+ * @brief Check if variant is the table-driven GCD
+ *
+ * @param variant Algorithm variant to check
+ * @return true if variant is the table-driven GCD
+ */
+bool is_table_lookup_variant(GcdAlgorithmVariant variant);
+
+#endif // TABLE_LOOKUP_IMPLEMENTATIONS_H
@@ -29,13 +29,15 @@ typedef struct
     GcdAlgorithmFunc modulo;      /**< mdc_modulo function */
     GcdAlgorithmFunc subtraction; /**< mdc_subtracao function */
     GcdAlgorithmFunc division;    /**< mdc_divisao function */
+    GcdAlgorithmFunc lehmer;      /**< mdc_lehmer function (leading-digit quotient steps) */
 
     // Recursive implementations (from recursivo.c)
     GcdAlgorithmFunc recursive_modulo;      /**< mdc_mod function */
     GcdAlgorithmFunc recursive_subtraction; /**< mdc_sub function */
 
     // Extended algorithm (from recursivo.c)
-    ExtendedGcdAlgorithmFunc extended; /**< mdc_ext function */
+    ExtendedGcdAlgorithmFunc extended;           /**< mdc_ext function */
+    ExtendedGcdAlgorithmFunc extended_iterative; /**< mdc_ext_iterative function (no recursion) */
 
     // Family metadata
     const char *family_name;
@@ -123,7 +125,7 @@ bool euclidean_family_is_euclidean_variant(GcdAlgorithmVariant variant);
 /**
  * @brief Number of algorithms in Euclidean family
  */
-#define EUCLIDEAN_FAMILY_ALGORITHM_COUNT 6
+#define EUCLIDEAN_FAMILY_ALGORITHM_COUNT 8
 
 /**
  * @brief Family identification
@@ -138,9 +140,12 @@ bool euclidean_family_is_euclidean_variant(GcdAlgorithmVariant variant);
     GCD_EUCLIDEAN_MODULO,      \
     GCD_EUCLIDEAN_SUBTRACTION, \
     GCD_EUCLIDEAN_DIVISION,    \
+    GCD_EUCLIDEAN_LEHMER,      \
     GCD_RECURSIVE_MODULO,      \
     GCD_RECURSIVE_SUBTRACTION, \
-    GCD_EXTENDED_EUCLIDEAN}
+    GCD_EXTENDED_EUCLIDEAN,    \
+    GCD_EXTENDED_ITERATIVE,    \
+    GCD_EUCLIDEAN_TABLE}
 
 // ============================================================================
 // ALGORITHM FUNCTION DECLARATIONS
@@ -158,11 +163,20 @@ extern GcdInteger mdc_modulo(GcdInteger a, GcdInteger b);
 extern GcdInteger mdc_subtracao(GcdInteger a, GcdInteger b);
 extern GcdInteger mdc_divisao(GcdInteger a, GcdInteger b);
 
+// From lehmer.c
+extern GcdInteger mdc_lehmer(GcdInteger a, GcdInteger b);
+
+// From table_lookup.c
+extern GcdInteger mdc_table(GcdInteger a, GcdInteger b);
+
 // From recursivo.c
 extern GcdInteger mdc_mod(GcdInteger a, GcdInteger b);
 extern GcdInteger mdc_sub(GcdInteger a, GcdInteger b);
 extern GcdInteger mdc_ext(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y);
 
+// From extended_iterative.c
+extern GcdInteger mdc_ext_iterative(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y);
+
 // ============================================================================
 // HELPER MACROS
 // ============================================================================
@@ -174,9 +188,11 @@ extern GcdInteger mdc_ext(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger
     .modulo = mdc_modulo,                               \
     .subtraction = mdc_subtracao,                       \
     .division = mdc_divisao,                            \
+    .lehmer = mdc_lehmer,                               \
     .recursive_modulo = mdc_mod,                        \
     .recursive_subtraction = mdc_sub,                   \
     .extended = mdc_ext,                                \
+    .extended_iterative = mdc_ext_iterative,            \
     .family_name = EUCLIDEAN_FAMILY_NAME,               \
     .family_description = EUCLIDEAN_FAMILY_DESCRIPTION, \
     .algorithm_count = EUCLIDEAN_FAMILY_ALGORITHM_COUNT}
@@ -184,7 +200,8 @@ extern GcdInteger mdc_ext(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger
 /**
  * @brief Check if algorithm variant requires coefficients (extended)
  */
-#define IS_EXTENDED_EUCLIDEAN(variant) ((variant) == GCD_EXTENDED_EUCLIDEAN)
+#define IS_EXTENDED_EUCLIDEAN(variant) ((variant) == GCD_EXTENDED_EUCLIDEAN || \
+                                       (variant) == GCD_EXTENDED_ITERATIVE)
 
 /**
  * @brief Check if algorithm variant is recursive
@@ -51,7 +51,8 @@ typedef uint64_t MathNatural;
  * @brief Status codes for mathematical computations
  *
  * Provides standardized return codes for all mathematical operations
- * to enable consistent error handling and result validation.
+ * to enable consistent error handling and result validation. The values
+ * are sent in server replies, so new codes are appended at the end.
  */
 typedef enum
 {
@@ -64,7 +65,9 @@ typedef enum
     MATH_ERROR_TIMEOUT,          /**< Operation exceeded time limit */
     MATH_ERROR_MEMORY,           /**< Memory allocation failed */
     MATH_ERROR_NOT_IMPLEMENTED,  /**< Feature not yet implemented */
-    MATH_ERROR_UNKNOWN           /**< Unknown error occurred */
+    MATH_ERROR_UNKNOWN,          /**< Unknown error occurred */
+    MATH_ERROR_CANCELLED,        /**< Operation cancelled before it finished */
+    MATH_ERROR_LIMIT_REACHED     /**< Operation stopped at its iteration budget */
 } MathStatus;
 
 /**
@@ -107,6 +110,130 @@ typedef struct
     double timeout_ms;          /**< Timeout in milliseconds */
 } MathBinaryInput;
 
+/**
+ * @brief Input parameters for batched binary operations
+ *
+ * Structure-of-arrays layout: operand pairs are read from two contiguous
+ * arrays and results are written to a caller-provided output array, so a
+ * whole batch is processed with a single call and a single timing window.
+ * Extended variants also fill the optional coefficient arrays, so that
+ * operands_a[i] * coefficients_x[i] + operands_b[i] * coefficients_y[i]
+ * equals results[i]; other variants ignore them.
+ */
+typedef struct
+{
+    const MathInteger *operands_a; /**< First operands (count elements) */
+    const MathInteger *operands_b; /**< Second operands (count elements) */
+    MathInteger *results;          /**< Output buffer (count elements) */
+    MathInteger *coefficients_x;   /**< Optional Bezout coefficients for operands_a (NULL = discard) */
+    MathInteger *coefficients_y;   /**< Optional Bezout coefficients for operands_b (NULL = discard) */
+    MathNatural count;             /**< Number of operand pairs */
+} MathBatchInput;
+
+// ============================================================================
+// UNSIGNED OPERANDS
+// ============================================================================
+
+/**
+ * @brief Widest native unsigned integer
+ *
+ * unsigned __int128 when the compiler provides it, uint64_t otherwise.
+ * MATH_WIDE_BITS gives its width.
+ */
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 MathWideNatural;
+#define MATH_WIDE_BITS 128
+#else
+typedef uint64_t MathWideNatural;
+#define MATH_WIDE_BITS 64
+#endif
+
+/**
+ * @brief Input parameters for unsigned binary operations
+ *
+ * Operands span the whole range of MathWideNatural, so there is no sign
+ * to strip and no magnitude that fails to fit. Implementations run 64-bit
+ * arithmetic while both operands fit in 64 bits and wide arithmetic only
+ * above that.
+ */
+typedef struct
+{
+    MathWideNatural operand_a; /**< First operand */
+    MathWideNatural operand_b; /**< Second operand */
+} MathUnsignedBinaryInput;
+
+/**
+ * @brief Container for unsigned computation results
+ *
+ * MathResult with a MathWideNatural value, for GCDs that do not fit in
+ * MathInteger.
+ */
+typedef struct
+{
+    MathWideNatural value;    /**< Primary result value */
+    MathStatus status;        /**< Computation status code */
+    bool is_valid;            /**< Whether result is mathematically valid */
+    MathNatural iterations;   /**< Number of iterations performed */
+    double execution_time_ms; /**< Execution time in milliseconds */
+} MathUnsignedResult;
+
+// ============================================================================
+// ARBITRARY-PRECISION INTEGERS
+// ============================================================================
+
+/**
+ * @brief Limb type for arbitrary-precision integers
+ *
+ * 64-bit limbs with a 128-bit double limb when the compiler provides
+ * unsigned __int128; otherwise 32-bit limbs with a 64-bit double limb.
+ * Define MATH_BIGINT_32BIT_LIMBS to force the portable layout.
+ */
+#if defined(__SIZEOF_INT128__) && !defined(MATH_BIGINT_32BIT_LIMBS)
+typedef uint64_t MathLimb;
+__extension__ typedef unsigned __int128 MathDoubleLimb;
+#define MATH_LIMB_BITS 64
+#else
+typedef uint32_t MathLimb;
+typedef uint64_t MathDoubleLimb;
+#define MATH_LIMB_BITS 32
+#endif
+
+/**
+ * @brief Arbitrary-precision signed integer
+ *
+ * Sign-magnitude representation over a little-endian limb array. The
+ * limb storage is owned by the caller (typically carved from a
+ * MemoryArena); size never exceeds capacity and the most significant
+ * limb in use is always non-zero, so zero is represented by size == 0.
+ */
+typedef struct
+{
+    MathLimb *limbs;      /**< Magnitude, least significant limb first */
+    MathNatural size;     /**< Number of limbs in use */
+    MathNatural capacity; /**< Number of limbs available */
+    bool negative;        /**< Sign flag (always false for zero) */
+} MathBigInteger;
+
+struct MemoryArena;
+
+/**
+ * @brief Input parameters for arbitrary-precision binary operations
+ *
+ * The result (and, for extended variants, the Bezout coefficients) are
+ * written to caller-provided integers. Temporaries are carved from the
+ * scratch arena when one is given, otherwise the implementation sizes and
+ * allocates its own.
+ */
+typedef struct
+{
+    const MathBigInteger *operand_a; /**< First operand */
+    const MathBigInteger *operand_b; /**< Second operand */
+    MathBigInteger *result;          /**< GCD output */
+    MathBigInteger *coefficient_x;   /**< Optional Bezout coefficient for operand_a */
+    MathBigInteger *coefficient_y;   /**< Optional Bezout coefficient for operand_b */
+    struct MemoryArena *scratch;     /**< Optional scratch arena (NULL = internal) */
+} MathBigBinaryInput;
+
 /**
  * @brief Performance metrics for algorithm analysis
  *
@@ -119,7 +246,7 @@ typedef struct
     double min_time_ms;          /**< Minimum execution time recorded */
     double max_time_ms;          /**< Maximum execution time recorded */
     double stddev_time_ms;       /**< Standard deviation of execution times */
-    double execution_time_ms;    /**< Last execution time (for compatibility) */
+    double execution_time_ms;    /**< Total execution time of the runs (summed when merged) */
     MathNatural total_runs;      /**< Total number of executions */
     MathNatural successful_runs; /**< Number of successful runs */
     double success_rate;         /**< Success rate (successful_runs / total_runs) */
@@ -158,6 +285,7 @@ typedef enum
 {
     ALGORITHM_FAMILY_EUCLIDEAN, /**< Based on Euclidean algorithm (modulo, subtraction) */
     ALGORITHM_FAMILY_BINARY,    /**< Binary/bit manipulation based (Stein's algorithm) */
+    ALGORITHM_FAMILY_ADAPTIVE,  /**< Dispatches each input to an algorithm of another family */
     ALGORITHM_FAMILY_UNKNOWN    /**< Unknown or not yet classified */
 } MathAlgorithmFamily;
 
@@ -210,6 +338,28 @@ typedef enum
     .max_iterations = MATH_DEFAULT_MAX_ITERATIONS, \
     .timeout_ms = MATH_DEFAULT_TIMEOUT_MS}
 
+/**
+ * @brief Batch input initialization macro
+ */
+#define MATH_BATCH_INPUT_INIT(a_array, b_array, out_array, n) { \
+    .operands_a = (a_array),                                    \
+    .operands_b = (b_array),                                    \
+    .results = (out_array),                                     \
+    .coefficients_x = NULL,                                     \
+    .coefficients_y = NULL,                                     \
+    .count = (n)}
+
+/**
+ * @brief Arbitrary-precision input initialization macro
+ */
+#define MATH_BIG_BINARY_INPUT_INIT(a, b, out) { \
+    .operand_a = (a),                            \
+    .operand_b = (b),                            \
+    .result = (out),                             \
+    .coefficient_x = NULL,                       \
+    .coefficient_y = NULL,                       \
+    .scratch = NULL}
+
 /**
  * @brief Performance metrics initialization macro
  */
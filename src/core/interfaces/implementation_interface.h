@@ -82,6 +82,47 @@ typedef MathResult (*ImplementationComputeFunc)(
 typedef bool (*ImplementationValidateFunc)(
     const MathBinaryInput *input);
 
+/**
+ * @brief Batch computation function signature
+ *
+ * Optional fast path that processes a whole array of operand pairs in
+ * one call. Special cases are handled inline and the batch is timed once,
+ * so the per-pair cost is only the algorithm itself.
+ *
+ * @param input Batch input (operand arrays and output buffer)
+ * @return MathResult whose value is the number of pairs computed successfully,
+ *         iterations is the number of pairs processed and execution_time_ms
+ *         covers the whole batch
+ */
+typedef MathResult (*ImplementationBatchComputeFunc)(
+    const MathBatchInput *input);
+
+/**
+ * @brief Arbitrary-precision computation function signature
+ *
+ * Optional entry point for implementations that operate on MathBigInteger
+ * operands. The GCD itself is written to input->result.
+ *
+ * @param input Arbitrary-precision input (operands, outputs, scratch arena)
+ * @return MathResult whose value is the bit length of the GCD, iterations is
+ *         the number of reduction steps and execution_time_ms covers the call
+ */
+typedef MathResult (*ImplementationBigComputeFunc)(
+    const MathBigBinaryInput *input);
+
+/**
+ * @brief Unsigned computation function signature
+ *
+ * Optional entry point for implementations with unsigned kernels. Every
+ * pair of MathWideNatural operands is valid, LLONG_MIN-sized magnitudes
+ * and 128-bit operands included.
+ *
+ * @param input Unsigned operands
+ * @return MathUnsignedResult with the GCD; execution_time_ms covers the call
+ */
+typedef MathUnsignedResult (*ImplementationUnsignedComputeFunc)(
+    const MathUnsignedBinaryInput *input);
+
 // ============================================================================
 // IMPLEMENTATION SPECIFICATION STRUCTURE
 // ============================================================================
@@ -100,6 +141,9 @@ struct ImplementationSpec
     // Function pointers
     ImplementationComputeFunc compute;
     ImplementationValidateFunc validate;
+    ImplementationBatchComputeFunc compute_batch; /**< Optional, NULL if not provided */
+    ImplementationBigComputeFunc compute_big;     /**< Optional, NULL if not provided */
+    ImplementationUnsignedComputeFunc compute_unsigned; /**< Optional, NULL if not provided */
 
     // Runtime state
     MathPerformanceMetrics performance;
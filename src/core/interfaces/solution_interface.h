@@ -30,8 +30,11 @@ typedef struct SolutionRegistry SolutionRegistry;
 
 /**
  * @brief Maximum number of implementations per solution family
+ *
+ * The Euclidean family alone has outgrown 8 built-in implementations,
+ * and runtime registrations join a family too.
  */
-#define MAX_IMPLEMENTATIONS_PER_FAMILY 8
+#define MAX_IMPLEMENTATIONS_PER_FAMILY 32
 
 /**
  * @brief Solution family characteristics and metadata
@@ -12,10 +12,20 @@
  * convenience functions for common use cases.
  */
 
+#include "system_internal.h"
 #include "../../challenges/greatest_common_divisor/challenge_services/solution_registry.h"
 #include "../../challenges/greatest_common_divisor/challenge_services/mdc_analyzer.h"
+#include "../../challenges/greatest_common_divisor/gcd_inline.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/gcd_isa.h"
+#include "../../challenges/greatest_common_divisor/solutions/euclidean_family/implementations/classic.h"
+#include "../../challenges/greatest_common_divisor/solutions/euclidean_family/implementations/table_lookup.h"
 #include "../../infrastructure/utilities/math_utils.h"
 #include "../../infrastructure/utilities/memory_utils.h"
+#include "../../infrastructure/utilities/bignum_utils.h"
+#include "../../infrastructure/platform/cpu_detection.h"
+#include "../../infrastructure/platform/cycle_counter.h"
+#include "../../infrastructure/platform/socket_io.h"
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -32,17 +42,110 @@ typedef struct
     bool is_initialized;
     bool registry_ready;
     bool analyzer_ready;
-    MathNatural total_executions;
-    double total_execution_time;
+    MathNatural total_executions; /**< Guarded by g_stats_lock */
+    double total_execution_time;  /**< Guarded by g_stats_lock */
+    ReportFormat report_format; /**< Output format of the analysis commands */
+    FILE *report_stream;        /**< Destination of JSON/CSV reports (NULL = stdout) */
+    SystemProfileStatus profile_status; /**< Outcome of the last profile load */
+    char profile_path[256];             /**< File the profile was looked up in */
+    unsigned int small_operand_bits;    /**< Width of the GCD_AUTO fast path (0 = off) */
+    SystemExecutionMode execution_mode; /**< Instrumented or bare kernels */
 } SystemState;
 
 // Global system state
-static SystemState g_system = {0};
+static SystemState g_system = {.small_operand_bits = SYSTEM_SMALL_OPERAND_BITS};
+
+#ifdef HAS_POSIX_THREADS
+// Session totals may be updated by several caller threads
+static pthread_mutex_t g_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * @brief Add executions to the session totals
+ *
+ * Per-call timing and counts live in the per-thread counters of
+ * perf_counters.h; the session totals only sum whole API calls.
+ *
+ * @param executions GCDs computed
+ * @param time_ms Time spent computing them
+ */
+static void system_account(MathNatural executions, double time_ms)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&g_stats_lock);
+#endif
+    g_system.total_executions += executions;
+    g_system.total_execution_time += time_ms;
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&g_stats_lock);
+#endif
+}
 
 // ============================================================================
 // SYSTEM INITIALIZATION
 // ============================================================================
 
+/**
+ * @brief File of the per-host dispatch profile
+ *
+ * @return $GCD_ANALYZER_PROFILE, or NULL if it is unset or empty (no profile)
+ */
+const char *system_profile_path(void)
+{
+    // Only an explicit setting: a table that happens to sit in the working
+    // directory must not change how every command dispatches
+    const char *path = getenv(GCD_DISPATCH_PROFILE_ENV);
+    return (path != NULL && path[0] != '\0') ? path : NULL;
+}
+
+/**
+ * @brief Install the per-host profile if it exists and matches this CPU
+ */
+static void system_load_startup_profile(void)
+{
+    const char *path = system_profile_path();
+    if (path == NULL)
+    {
+        g_system.profile_status = SYSTEM_PROFILE_DEFAULTS;
+        return;
+    }
+    memory_safe_strcpy(g_system.profile_path, path, sizeof(g_system.profile_path));
+
+    GcdDispatchTable table;
+    MathStatus status = gcd_dispatch_load(path, &table);
+    if (status == MATH_ERROR_NO_SOLUTION)
+    {
+        g_system.profile_status = SYSTEM_PROFILE_MISSING;
+        return;
+    }
+
+    // Costs measured on another CPU model say nothing about this one
+    char cpu[GCD_DISPATCH_CPU_LENGTH];
+    platform_cpu_model(cpu, sizeof(cpu));
+    if (status == MATH_SUCCESS && table.calibrated && strcmp(table.cpu, cpu) != 0)
+    {
+        g_system.profile_status = SYSTEM_PROFILE_OTHER_CPU;
+        return;
+    }
+
+    if (status != MATH_SUCCESS || gcd_dispatch_set_table(&table) != MATH_SUCCESS)
+    {
+        g_system.profile_status = SYSTEM_PROFILE_INVALID;
+        return;
+    }
+    g_system.profile_status = SYSTEM_PROFILE_LOADED;
+}
+
+/**
+ * @brief Outcome of the last profile load
+ *
+ * @return Profile status (SYSTEM_PROFILE_DEFAULTS before system_init)
+ */
+SystemProfileStatus system_get_profile_status(void)
+{
+    return g_system.profile_status;
+}
+
 /**
  * @brief Initialize the entire GCD algorithm analysis system
  *
@@ -66,6 +169,9 @@ MathStatus system_init(void)
     // Analyzer doesn't need explicit initialization
     g_system.analyzer_ready = true;
 
+    // Measured dispatch choices, if this host has been calibrated
+    system_load_startup_profile();
+
     // Reset counters
     g_system.total_executions = 0;
     g_system.total_execution_time = 0.0;
@@ -93,6 +199,9 @@ bool system_is_ready(void)
  */
 bool system_get_status(MathNatural *total_executions, double *total_time)
 {
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&g_stats_lock);
+#endif
     if (total_executions != NULL)
     {
         *total_executions = g_system.total_executions;
@@ -101,9 +210,257 @@ bool system_get_status(MathNatural *total_executions, double *total_time)
     {
         *total_time = g_system.total_execution_time;
     }
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&g_stats_lock);
+#endif
     return system_is_ready();
 }
 
+/**
+ * @brief Select the output format of compare, fastest, benchmark and bench-suite
+ *
+ * @param format REPORT_FORMAT_TEXT (console tables) or a machine-readable format
+ * @param stream Destination of JSON/CSV reports (NULL = stdout)
+ */
+void system_set_report_output(ReportFormat format, FILE *stream)
+{
+    g_system.report_format = format;
+    g_system.report_stream = stream;
+}
+
+/**
+ * @brief Stream receiving machine-readable reports
+ */
+static FILE *system_report_stream(void)
+{
+    return g_system.report_stream != NULL ? g_system.report_stream : stdout;
+}
+
+// ============================================================================
+// SMALL-OPERAND FAST PATH
+// ============================================================================
+
+/**
+ * @brief Configure the small-operand fast path of system_execute_gcd
+ *
+ * @param bits Operand width, 0 to disable the fast path
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus system_set_small_operand_bits(unsigned int bits)
+{
+    if (bits > SYSTEM_SMALL_OPERAND_MAX_BITS)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    g_system.small_operand_bits = bits;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Operand width of the small-operand fast path
+ *
+ * @return Configured width (0 = disabled)
+ */
+unsigned int system_get_small_operand_bits(void)
+{
+    return g_system.small_operand_bits;
+}
+
+/**
+ * @brief Enable, resize or disable the result cache
+ *
+ * @param entries Entries per thread (0 disables)
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus system_set_result_cache(MathNatural entries)
+{
+    return gcd_cache_configure(entries);
+}
+
+/**
+ * @brief Check whether both magnitudes fit the fast path
+ *
+ * Negating in unsigned arithmetic keeps LLONG_MIN well defined; its
+ * magnitude of 2^63 is never small.
+ */
+static bool system_is_small_pair(GcdInteger a, GcdInteger b)
+{
+    MathNatural u = a < 0 ? 0 - (MathNatural)a : (MathNatural)a;
+    MathNatural v = b < 0 ? 0 - (MathNatural)b : (MathNatural)b;
+    unsigned int bits = g_system.small_operand_bits;
+    return bits != 0 && ((u | v) >> bits) == 0;
+}
+
+// ============================================================================
+// EXECUTION MODE
+// ============================================================================
+// Production mode calls the registry's bare kernels directly. Operands are
+// reduced to magnitudes and zero operands answered here, which is all the
+// special-casing the kernels need once LLONG_MIN has been ruled out.
+
+/**
+ * @brief Select the execution mode of the whole system
+ *
+ * @param mode SYSTEM_MODE_INSTRUMENTED or SYSTEM_MODE_PRODUCTION
+ */
+void system_set_execution_mode(SystemExecutionMode mode)
+{
+    g_system.execution_mode = mode;
+}
+
+/**
+ * @brief Execution mode selected by system_set_execution_mode
+ *
+ * @return Current mode (SYSTEM_MODE_INSTRUMENTED by default)
+ */
+SystemExecutionMode system_get_execution_mode(void)
+{
+    return g_system.execution_mode;
+}
+
+/**
+ * @brief Bare kernel of a variant (system initialized)
+ *
+ * @return Kernel, or NULL if the variant has none
+ */
+static GcdAlgorithmFunc system_kernel(GcdAlgorithmVariant variant)
+{
+    // The registry indexes kernels by variant, so this is a table load
+    return gcd_registry_get_kernel(variant);
+}
+
+/**
+ * @brief GCD of two operands other than LLONG_MIN through a bare kernel
+ */
+static inline GcdInteger system_kernel_gcd(GcdAlgorithmFunc kernel, GcdInteger a, GcdInteger b)
+{
+    GcdInteger u = MATH_ABS(a);
+    GcdInteger v = MATH_ABS(b);
+    if (u == 0 || v == 0)
+    {
+        return u | v;
+    }
+    return kernel(u, v);
+}
+
+/**
+ * @brief Check that no operand of an array is LLONG_MIN
+ *
+ * The scan has no early exit so that it vectorizes; it costs a fraction
+ * of a nanosecond per operand next to tens for the GCDs themselves.
+ */
+static bool system_operands_in_range(const GcdInteger *values, MathNatural n)
+{
+    bool in_range = true;
+    for (MathNatural i = 0; i < n; i++)
+    {
+        in_range &= values[i] != LLONG_MIN;
+    }
+    return in_range;
+}
+
+/**
+ * @brief Run a bare kernel over a batch already checked for LLONG_MIN
+ */
+static void system_kernel_batch(GcdAlgorithmFunc kernel, const GcdInteger *a, const GcdInteger *b, GcdInteger *out,
+                                MathNatural n)
+{
+    for (MathNatural i = 0; i < n; i++)
+    {
+        out[i] = system_kernel_gcd(kernel, a[i], b[i]);
+    }
+}
+
+/**
+ * @brief Kernel a batch runs in production mode
+ *
+ * @param variant Algorithm variant
+ * @param a First operands
+ * @param b Second operands
+ * @param n Operands in each array
+ * @return Bare kernel, or NULL to run the batch instrumented (instrumented
+ *         mode, no kernel, or an LLONG_MIN operand)
+ */
+static GcdAlgorithmFunc system_production_kernel(GcdAlgorithmVariant variant, const GcdInteger *a,
+                                                 const GcdInteger *b, MathNatural n)
+{
+    if (g_system.execution_mode != SYSTEM_MODE_PRODUCTION)
+    {
+        return NULL;
+    }
+    GcdAlgorithmFunc kernel = system_kernel(variant);
+    if (kernel == NULL || !system_operands_in_range(a, n) || !system_operands_in_range(b, n))
+    {
+        return NULL;
+    }
+    return kernel;
+}
+
+/**
+ * @brief Compute one GCD on the production path, whatever the system mode
+ *
+ * @param variant Algorithm variant with a bare kernel
+ * @param a First operand
+ * @param b Second operand
+ * @return gcd(|a|, |b|), or MATH_INVALID_VALUE for LLONG_MIN operands and
+ *         variants without a bare kernel
+ */
+GcdInteger system_gcd(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b)
+{
+    if (!g_system.is_initialized && system_init() != MATH_SUCCESS)
+    {
+        return MATH_INVALID_VALUE;
+    }
+
+    GcdAlgorithmFunc kernel = system_kernel(variant);
+    if (kernel == NULL || a == LLONG_MIN || b == LLONG_MIN)
+    {
+        return MATH_INVALID_VALUE;
+    }
+    return system_kernel_gcd(kernel, a, b);
+}
+
+/**
+ * @brief Compute a batch of GCDs on the production path, whatever the system mode
+ *
+ * @param variant Algorithm variant with a bare kernel
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_NOT_IMPLEMENTED
+ */
+MathStatus system_gcd_batch(GcdAlgorithmVariant variant, const GcdInteger *a, const GcdInteger *b, GcdInteger *out,
+                            MathNatural n)
+{
+    if (!g_system.is_initialized)
+    {
+        MathStatus init_status = system_init();
+        if (init_status != MATH_SUCCESS)
+        {
+            return init_status;
+        }
+    }
+
+    MathBatchInput input = MATH_BATCH_INPUT_INIT(a, b, out, n);
+    if (!memory_validate_batch_input(&input))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    GcdAlgorithmFunc kernel = system_kernel(variant);
+    if (kernel == NULL)
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+    if (!system_operands_in_range(a, n) || !system_operands_in_range(b, n))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    system_kernel_batch(kernel, a, b, out, n);
+    return MATH_SUCCESS;
+}
+
 // ============================================================================
 // HIGH-LEVEL EXECUTION INTERFACE
 // ============================================================================
@@ -112,6 +469,8 @@ bool system_get_status(MathNatural *total_executions, double *total_time)
  * @brief Execute a GCD algorithm by variant (main interface)
  *
  * Automatically initializes system if needed and tracks usage statistics.
+ * Small GCD_AUTO pairs take the table-driven fast path. In production
+ * mode variants with a bare kernel skip the registry altogether.
  *
  * @param variant Algorithm variant to execute
  * @param a First operand
@@ -130,17 +489,31 @@ MathResult system_execute_gcd(GcdAlgorithmVariant variant, GcdInteger a, GcdInte
         }
     }
 
+    // Production mode: the bare kernel, nothing timed or recorded
+    GcdAlgorithmFunc kernel = g_system.execution_mode == SYSTEM_MODE_PRODUCTION ? system_kernel(variant) : NULL;
+    if (kernel != NULL)
+    {
+        if (a == LLONG_MIN || b == LLONG_MIN)
+        {
+            return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+        }
+        return math_create_success_result(system_kernel_gcd(kernel, a, b), 0, 0.0);
+    }
+
+    // Answer small dispatched pairs without the registry or a timer
+    if (variant == GCD_AUTO && system_is_small_pair(a, b))
+    {
+        system_account(1, 0.0);
+        return math_create_success_result(mdc_table(a, b), 0, 0.0);
+    }
+
     // Execute through registry
     MathResult result = gcd_registry_execute(variant, a, b);
 
     // Update statistics
     if (MATH_IS_VALID_RESULT(result))
     {
-        g_system.total_executions++;
-        if (result.execution_time_ms >= 0)
-        {
-            g_system.total_execution_time += result.execution_time_ms;
-        }
+        system_account(1, result.execution_time_ms >= 0 ? result.execution_time_ms : 0.0);
     }
 
     return result;
@@ -172,357 +545,3218 @@ MathResult system_execute_gcd_by_name(const char *algorithm_name, GcdInteger a,
     // Update statistics
     if (MATH_IS_VALID_RESULT(result))
     {
-        g_system.total_executions++;
-        if (result.execution_time_ms >= 0)
-        {
-            g_system.total_execution_time += result.execution_time_ms;
-        }
+        system_account(1, result.execution_time_ms >= 0 ? result.execution_time_ms : 0.0);
     }
 
     return result;
 }
 
 /**
- * @brief Execute Extended Euclidean algorithm (convenience wrapper)
+ * @brief Execute a GCD algorithm on arbitrary-precision operands
  *
- * @param a First operand
- * @param b Second operand
- * @param x Pointer to store coefficient for a
- * @param y Pointer to store coefficient for b
- * @return ExtendedGcdResult with GCD and coefficients
+ * @param variant Algorithm variant to execute (must provide compute_big)
+ * @param input Arbitrary-precision input
+ * @return MathResult whose value is the bit length of the GCD
  */
-ExtendedGcdResult system_execute_extended_gcd(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y)
+MathResult system_execute_gcd_big(GcdAlgorithmVariant variant, const MathBigBinaryInput *input)
 {
     // Auto-initialize if needed
     if (!system_is_ready())
     {
-        system_init();
+        MathStatus init_status = system_init();
+        if (init_status != MATH_SUCCESS)
+        {
+            return math_create_error_result(init_status, 0, 0.0);
+        }
     }
 
-    ExtendedGcdResult result = mdc_analyzer_execute_extended(a, b, x, y);
+    MathResult result = gcd_registry_execute_big(variant, input);
 
-    // Update statistics (count as one execution)
-    if (result.is_valid)
+    // Update statistics
+    if (MATH_IS_VALID_RESULT(result))
     {
-        g_system.total_executions++;
+        system_account(1, result.execution_time_ms >= 0 ? result.execution_time_ms : 0.0);
     }
 
     return result;
 }
 
-// ============================================================================
-// COMPARISON AND ANALYSIS INTERFACE
-// ============================================================================
-
 /**
- * @brief Compare all available GCD algorithms (main comparison interface)
+ * @brief Execute a GCD algorithm on unsigned operands
  *
+ * @param variant Algorithm variant to execute (must provide compute_unsigned)
  * @param a First operand
  * @param b Second operand
- * @param print_results Whether to print results to console
- * @return Number of algorithms compared
+ * @return MathUnsignedResult with computation result and timing
  */
-MathNatural system_compare_all_algorithms(GcdInteger a, GcdInteger b, bool print_results)
+MathUnsignedResult system_execute_gcd_unsigned(GcdAlgorithmVariant variant, MathWideNatural a, MathWideNatural b)
 {
     // Auto-initialize if needed
     if (!system_is_ready())
     {
-        system_init();
+        MathStatus init_status = system_init();
+        if (init_status != MATH_SUCCESS)
+        {
+            return math_create_unsigned_error_result(init_status);
+        }
     }
 
-    MathResult results[16]; // Space for all possible algorithms
-    MathNatural count = mdc_analyzer_execute_all(a, b, results, 16);
+    MathUnsignedResult result = gcd_registry_execute_unsigned(variant, a, b);
 
     // Update statistics
-    g_system.total_executions += count;
-    for (MathNatural i = 0; i < count; i++)
+    if (result.is_valid && result.status == MATH_SUCCESS)
     {
-        if (MATH_IS_VALID_RESULT(results[i]) && results[i].execution_time_ms >= 0)
-        {
-            g_system.total_execution_time += results[i].execution_time_ms;
-        }
+        system_account(1, result.execution_time_ms >= 0 ? result.execution_time_ms : 0.0);
     }
 
-    // Print results if requested
-    if (print_results)
-    {
-        mdc_analyzer_print_comparison(a, b, results, count);
+    return result;
+}
 
-        // Validate consistency
-        bool consistent = mdc_analyzer_validate_consistency(a, b, results, count);
-        if (consistent)
-        {
-            printf("✓ All algorithms produced consistent results\n");
-        }
-        else
-        {
-            printf("✗ WARNING: Inconsistent results detected!\n");
-        }
-        printf("\n");
+/**
+ * @brief Fold the timing of one batch call into a metrics accumulator
+ *
+ * The batch is treated as result->iterations samples of equal per-pair time.
+ *
+ * @param metrics Accumulator to update
+ * @param result Summary result returned by a batch call
+ */
+static void system_record_batch_sample(MathPerformanceMetrics *metrics, const MathResult *result)
+{
+    if (result->iterations == 0)
+    {
+        return;
     }
 
-    return count;
+    double per_pair_ms = result->execution_time_ms / (double)result->iterations;
+    MathPerformanceMetrics sample = {
+        .avg_time_ms = per_pair_ms,
+        .min_time_ms = per_pair_ms,
+        .max_time_ms = per_pair_ms,
+        .stddev_time_ms = 0.0,
+        .execution_time_ms = result->execution_time_ms,
+        .total_runs = result->iterations,
+        .successful_runs = (result->value > 0) ? (MathNatural)result->value : 0,
+        .success_rate = 0.0};
+    math_merge_performance_metrics(metrics, &sample);
 }
 
 /**
- * @brief Find the fastest algorithm for given input
+ * @brief Execute a GCD algorithm over a batch of operand pairs
  *
- * @param a First operand
- * @param b Second operand
- * @param print_results Whether to print results to console
- * @return The fastest algorithm variant
+ * @param variant Algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @return Batch summary result (value = pairs computed successfully)
  */
-GcdAlgorithmVariant system_find_fastest_algorithm(GcdInteger a, GcdInteger b, bool print_results)
+MathResult system_execute_gcd_batch(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    MathNatural n)
 {
     // Auto-initialize if needed
     if (!system_is_ready())
     {
-        system_init();
+        MathStatus init_status = system_init();
+        if (init_status != MATH_SUCCESS)
+        {
+            return math_create_error_result(init_status, 0, 0.0);
+        }
+    }
+
+    // Production mode: one range check and one timer for the whole batch
+    MathBatchInput input = MATH_BATCH_INPUT_INIT(a, b, out, n);
+    GcdAlgorithmFunc kernel = memory_validate_batch_input(&input) ? system_production_kernel(variant, a, b, n) : NULL;
+    if (kernel != NULL)
+    {
+        double start_time = math_get_time_ms();
+        system_kernel_batch(kernel, a, b, out, n);
+        double elapsed_ms = math_elapsed_time_ms(start_time, math_get_time_ms());
+        system_account(n, elapsed_ms);
+        return math_create_batch_result(n, 0, elapsed_ms);
     }
 
-    GcdAlgorithmVariant fastest;
-    double fastest_time = mdc_analyzer_find_fastest(a, b, &fastest);
+    MathResult result = gcd_registry_execute_batch(variant, a, b, out, n);
 
-    if (print_results)
+    // Update statistics (count every successfully computed pair)
+    if (result.value > 0)
     {
-        if (fastest_time >= 0)
-        {
-            printf("=== Fastest Algorithm Analysis ===\n");
-            printf("Input: gcd(%lld, %lld)\n", (long long)a, (long long)b);
-            printf("Fastest: %s\n", mdc_analyzer_get_algorithm_name(fastest));
-            printf("Time: %.6f ms\n\n", fastest_time);
-        }
-        else
-        {
-            printf("Error: Could not determine fastest algorithm\n\n");
-        }
+        system_account((MathNatural)result.value, result.execution_time_ms);
+
+        MathPerformanceMetrics metrics = MATH_PERFORMANCE_METRICS_INIT;
+        system_record_batch_sample(&metrics, &result);
+        gcd_registry_merge_performance(variant, &metrics);
     }
 
-    return fastest;
+    return result;
 }
 
 /**
- * @brief Run simple benchmark comparing algorithms
+ * @brief Execute an extended GCD algorithm over a batch, returning Bezout coefficients
  *
- * @param a First operand
- * @param b Second operand
- * @param iterations Number of iterations for each algorithm
- * @param print_results Whether to print results to console
- * @return Number of algorithms benchmarked
+ * @param variant Extended algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param x Output array receiving the coefficient of each a[i]
+ * @param y Output array receiving the coefficient of each b[i]
+ * @param n Number of operand pairs
+ * @return Batch summary result (value = pairs computed successfully)
  */
-MathNatural system_benchmark_algorithms(GcdInteger a, GcdInteger b, MathNatural iterations, bool print_results)
+MathResult system_execute_extended_gcd_batch(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    GcdInteger *x,
+    GcdInteger *y,
+    MathNatural n)
 {
     // Auto-initialize if needed
     if (!system_is_ready())
     {
-        system_init();
+        MathStatus init_status = system_init();
+        if (init_status != MATH_SUCCESS)
+        {
+            return math_create_error_result(init_status, 0, 0.0);
+        }
     }
 
-    MathResult benchmarks[16];
-    MathNatural count = mdc_analyzer_benchmark(a, b, iterations, benchmarks, 16);
-
-    // Update statistics (multiply by iterations since that's how many were actually run)
-    g_system.total_executions += count * iterations;
+    MathResult result = gcd_registry_execute_batch_extended(variant, a, b, out, x, y, n);
 
-    if (print_results)
+    // Update statistics (count every successfully computed pair)
+    if (result.value > 0)
     {
-        printf("=== Algorithm Benchmark ===\n");
-        printf("Input: gcd(%lld, %lld)\n", (long long)a, (long long)b);
-        printf("Iterations per algorithm: %lu\n\n", (unsigned long)iterations);
+        system_account((MathNatural)result.value, result.execution_time_ms);
 
-        GcdAlgorithmVariant variants[] = {
-            GCD_EUCLIDEAN_MODULO, GCD_EUCLIDEAN_SUBTRACTION, GCD_EUCLIDEAN_DIVISION,
-            GCD_RECURSIVE_MODULO, GCD_RECURSIVE_SUBTRACTION, GCD_EXTENDED_EUCLIDEAN,
-            GCD_BINARY_STEIN};
-
-        for (MathNatural i = 0; i < count && i < 7; i++)
-        {
-            printf("%-20s: Avg Time: %.6f ms | Runs: %lu\n",
-                   mdc_analyzer_get_algorithm_name(variants[i]),
-                   benchmarks[i].execution_time_ms,
-                   (unsigned long)benchmarks[i].iterations);
-        }
-        printf("\n");
+        MathPerformanceMetrics metrics = MATH_PERFORMANCE_METRICS_INIT;
+        system_record_batch_sample(&metrics, &result);
+        gcd_registry_merge_performance(variant, &metrics);
     }
 
-    return count;
+    return result;
 }
 
 // ============================================================================
-// INFORMATION AND LISTING INTERFACE
+// PARALLEL BATCH EXECUTION
 // ============================================================================
+// Work-stealing scheduler: the operand range is cut into fixed-size chunks
+// and each worker starts with a contiguous share of them. A worker pops
+// chunks from the front of its own queue; once empty it steals half of the
+// remaining chunks from the back of another worker's queue. Results and
+// performance counters stay in per-worker storage and are merged by the
+// calling thread after all workers have finished.
+//
+// The calling thread is worker 0; the other workers are resident pool
+// threads started on first use and parked on a condition variable between
+// jobs. A job offers its worker slots to the pool, and threads that come
+// too late for a slot leave their share of the chunks to be stolen. Idle
+// threads also run queued tasks (submitted jobs), slots of running jobs
+// first.
+//
+// The same pool runs n-ary reductions: each chunk is reduced to one
+// partial GCD, and a chunk reaching GCD_IDENTITY stops every worker
+// before it takes another chunk.
 
 /**
- * @brief List all available algorithms
+ * @brief Work queue of chunk indices owned by one worker
+ */
+typedef struct
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_t lock;
+#endif
+    MathNatural next_chunk; /**< Next chunk the owner will take */
+    MathNatural end_chunk;  /**< One past the last chunk; thieves take from here */
+} BatchWorkQueue;
+
+typedef struct BatchJob BatchJob;
+
+/**
+ * @brief Per-worker state
  *
- * @param print_details Whether to print detailed information
+ * batch_job_run allocates the workers as one array aligned to
+ * SYSTEM_CACHE_LINE_SIZE, and each worker ends with a full line of
+ * padding, so no cache line holds fields of two workers.
  */
-void system_list_algorithms(bool print_details)
+typedef struct
 {
-    // Auto-initialize if needed
-    if (!system_is_ready())
+    BatchWorkQueue queue;
+    MathPerformanceMetrics metrics; /**< Per-pair timing collected by this worker */
+    MathNatural successful;         /**< Pairs computed successfully */
+    MathNatural failed;             /**< Pairs rejected (e.g. overflow) */
+    MathNatural steals;             /**< Number of successful steals */
+    double busy_time_ms;            /**< Time spent inside batch kernels */
+    GcdInteger *scratch;            /**< Interleaved jobs: 2 * chunk_size gathered operands */
+    MathNatural index;
+    BatchJob *job;
+    char padding[SYSTEM_CACHE_LINE_SIZE]; /**< Keeps the next worker's fields off this worker's lines */
+} BatchWorker;
+
+/**
+ * @brief Shared, read-only description of a parallel batch
+ */
+struct BatchJob
+{
+    GcdAlgorithmVariant variant;
+    const GcdInteger *operands_a;
+    const GcdInteger *operands_b;
+    GcdInteger *results;
+    GcdAlgorithmFunc kernel; /**< Production mode: bare kernel for every chunk (NULL = registry batch path) */
+    SystemJob *control;   /**< Submitted jobs: cancellation and limits checked per chunk (NULL = none) */
+    bool reduction;       /**< Reduce operands_a to one GCD instead of computing pairs */
+    bool interleaved;     /**< operands_a holds pairs a0 b0 a1 b1 ... (operands_b unused) */
+    GcdInteger *partials; /**< Reduction jobs: one GCD per chunk (set up by batch_job_run) */
+    GcdInteger *scratch;  /**< Interleaved jobs: gather buffers of all workers */
+    MemoryScratch memory; /**< Scope holding workers, partials and gather buffers */
+    MathNatural count;
+    MathNatural chunk_size;
+    MathNatural chunk_count;
+    BatchWorker *workers;
+    MathNatural worker_count;
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_t stop_lock;
+#endif
+    bool stop_requested; /**< Set once the outcome is known; guarded by stop_lock */
+#ifdef HAS_POSIX_THREADS
+    BatchJob *next_pending;      /**< Next job offering slots to the pool; guarded by the pool lock */
+    MathNatural next_slot;       /**< Next worker slot a pool thread takes; guarded by the pool lock */
+    MathNatural helpers_running; /**< Pool threads inside this job; guarded by the pool lock */
+#endif
+};
+
+static void batch_queue_lock(BatchWorkQueue *queue)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&queue->lock);
+#else
+    (void)queue;
+#endif
+}
+
+static void batch_queue_unlock(BatchWorkQueue *queue)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&queue->lock);
+#else
+    (void)queue;
+#endif
+}
+
+/**
+ * @brief Check whether a worker has asked the whole job to stop
+ *
+ * @param job Running job
+ * @return true if no further chunks should be taken
+ */
+static bool batch_job_stop_requested(BatchJob *job)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&job->stop_lock);
+    bool stop = job->stop_requested;
+    pthread_mutex_unlock(&job->stop_lock);
+    return stop;
+#else
+    return job->stop_requested;
+#endif
+}
+
+/**
+ * @brief Ask every worker to stop after its current chunk
+ *
+ * @param job Running job
+ */
+static void batch_job_request_stop(BatchJob *job)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&job->stop_lock);
+    job->stop_requested = true;
+    pthread_mutex_unlock(&job->stop_lock);
+#else
+    job->stop_requested = true;
+#endif
+}
+
+/**
+ * @brief Take the next chunk for a worker, stealing when its queue is empty
+ *
+ * @param worker Worker asking for work
+ * @param chunk Pointer to store the chunk index
+ * @return true if a chunk was obtained, false when no work is left
+ */
+static bool batch_worker_next_chunk(BatchWorker *worker, MathNatural *chunk)
+{
+    BatchJob *job = worker->job;
+
+    if (batch_job_stop_requested(job))
     {
-        system_init();
+        return false;
     }
 
-    if (print_details)
+    batch_queue_lock(&worker->queue);
+    if (worker->queue.next_chunk < worker->queue.end_chunk)
     {
-        gcd_registry_print_all();
+        *chunk = worker->queue.next_chunk++;
+        batch_queue_unlock(&worker->queue);
+        return true;
     }
-    else
-    {
-        printf("Available GCD Algorithms:\n");
+    batch_queue_unlock(&worker->queue);
 
-        GcdAlgorithmVariant variants[16];
-        MathNatural count = gcd_registry_list_variants(variants, 16);
+    // Own queue drained: steal half of a victim's remaining chunks
+    for (MathNatural k = 1; k < job->worker_count; k++)
+    {
+        BatchWorker *victim = &job->workers[(worker->index + k) % job->worker_count];
 
-        for (MathNatural i = 0; i < count; i++)
+        batch_queue_lock(&victim->queue);
+        MathNatural remaining = victim->queue.end_chunk - victim->queue.next_chunk;
+        if (victim->queue.next_chunk < victim->queue.end_chunk)
         {
-            printf("  %lu. %s\n", (unsigned long)(i + 1), gcd_registry_get_display_name(variants[i]));
+            MathNatural stolen = (remaining + 1) / 2;
+            victim->queue.end_chunk -= stolen;
+            MathNatural stolen_begin = victim->queue.end_chunk;
+            batch_queue_unlock(&victim->queue);
+
+            batch_queue_lock(&worker->queue);
+            worker->queue.next_chunk = stolen_begin + 1;
+            worker->queue.end_chunk = stolen_begin + stolen;
+            batch_queue_unlock(&worker->queue);
+
+            worker->steals++;
+            *chunk = stolen_begin;
+            return true;
         }
-        printf("\nTotal: %lu algorithms\n\n", (unsigned long)count);
+        batch_queue_unlock(&victim->queue);
     }
+
+    return false;
 }
 
 /**
- * @brief Get information about a specific algorithm
+ * @brief Worker loop: process chunks until no work is left anywhere
  *
- * @param variant Algorithm variant to describe
- * @param print_info Whether to print information to console
- * @return Pointer to implementation spec, NULL if not found
+ * @param arg Pointer to the worker's BatchWorker
+ * @return NULL
  */
-const ImplementationSpec *system_get_algorithm_info(GcdAlgorithmVariant variant, bool print_info)
+static void *batch_worker_main(void *arg)
 {
-    // Auto-initialize if needed
-    if (!system_is_ready())
+    BatchWorker *worker = (BatchWorker *)arg;
+    BatchJob *job = worker->job;
+    MathNatural chunk;
+
+    while (batch_worker_next_chunk(worker, &chunk))
     {
-        system_init();
+        MathNatural offset = chunk * job->chunk_size;
+        MathNatural length = MATH_MIN(job->chunk_size, job->count - offset);
+
+        if (job->reduction)
+        {
+            MathResult result = gcd_registry_execute_reduce(job->variant, job->operands_a + offset, length);
+            worker->busy_time_ms += result.execution_time_ms;
+            worker->successful += result.iterations;
+            if (!MATH_IS_VALID_RESULT(result))
+            {
+                worker->failed++;
+                batch_job_request_stop(job);
+                continue;
+            }
+
+            job->partials[chunk] = result.value;
+            if (result.value == GCD_IDENTITY)
+            {
+                batch_job_request_stop(job);
+            }
+            continue;
+        }
+
+        length = system_job_admit(job->control, length);
+        if (length == 0)
+        {
+            batch_job_request_stop(job);
+            break;
+        }
+
+        const GcdInteger *chunk_a = job->operands_a + offset;
+        const GcdInteger *chunk_b = job->operands_b + offset;
+        if (job->interleaved)
+        {
+            // Gather the chunk's pairs into columns the batch kernels can stream
+            const GcdInteger *pairs = job->operands_a + 2 * offset;
+            GcdInteger *column_a = worker->scratch;
+            GcdInteger *column_b = worker->scratch + job->chunk_size;
+            for (MathNatural i = 0; i < length; i++)
+            {
+                column_a[i] = pairs[2 * i];
+                column_b[i] = pairs[2 * i + 1];
+            }
+            chunk_a = column_a;
+            chunk_b = column_b;
+        }
+
+        if (job->kernel != NULL)
+        {
+            system_kernel_batch(job->kernel, chunk_a, chunk_b, job->results + offset, length);
+            worker->successful += length;
+            continue;
+        }
+
+        MathResult result = gcd_registry_execute_batch(
+            job->variant,
+            chunk_a,
+            chunk_b,
+            job->results + offset,
+            length);
+
+        MathNatural successful = (result.value > 0) ? (MathNatural)result.value : 0;
+        worker->successful += successful;
+        worker->failed += length - successful;
+        worker->busy_time_ms += result.execution_time_ms;
+        system_record_batch_sample(&worker->metrics, &result);
     }
 
-    const ImplementationSpec *spec = gcd_registry_get_implementation(variant);
+    return NULL;
+}
 
-    if (print_info)
+/**
+ * @brief Get the default number of worker threads (online CPUs)
+ *
+ * @return Number of worker threads used when thread_count is 0
+ */
+MathNatural system_get_default_thread_count(void)
+{
+#ifdef HAS_POSIX_THREADS
+    MathNatural cpus = platform_cpu_count();
+#else
+    MathNatural cpus = 1; // Batches run on the caller only
+#endif
+
+    if (cpus > SYSTEM_MAX_WORKER_THREADS)
     {
-        gcd_registry_print_implementation_info(variant);
+        cpus = SYSTEM_MAX_WORKER_THREADS;
     }
-
-    return spec;
+    return cpus;
 }
 
-// ============================================================================
-// CONVENIENCE FUNCTIONS
-// ============================================================================
+#ifdef HAS_POSIX_THREADS
+/**
+ * @brief Resident worker threads shared by all parallel jobs
+ */
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t work_posted; /**< Parked threads wait here for a job with free slots */
+    pthread_cond_t helper_done; /**< Callers wait here for the pool threads inside their job */
+    BatchJob *pending;          /**< Jobs with free worker slots, oldest first */
+    SystemPoolTask *tasks;      /**< Queued tasks, oldest first */
+    SystemPoolTask **tasks_tail; /**< Link the next queued task is stored in */
+    MathNatural thread_count;   /**< Threads started so far; they never exit */
+} BatchPool;
+
+static BatchPool g_batch_pool = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .work_posted = PTHREAD_COND_INITIALIZER,
+    .helper_done = PTHREAD_COND_INITIALIZER,
+    .tasks_tail = &g_batch_pool.tasks};
 
 /**
- * @brief Quick GCD computation using default algorithm (Euclidean Modulo)
+ * @brief Pool thread: take a free worker slot of the oldest pending job, or else the oldest task, and run it
  *
- * @param a First operand
- * @param b Second operand
- * @return GCD result, or MATH_INVALID_VALUE on error
+ * @param arg Unused
+ * @return Never returns
  */
-GcdInteger system_quick_gcd(GcdInteger a, GcdInteger b)
+static void *batch_pool_main(void *arg)
 {
-    MathResult result = system_execute_gcd(GCD_EUCLIDEAN_MODULO, a, b);
-    return MATH_IS_VALID_RESULT(result) ? result.value : MATH_INVALID_VALUE;
+    (void)arg;
+    BatchPool *pool = &g_batch_pool;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;)
+    {
+        BatchJob *job = pool->pending;
+        if (job == NULL && pool->tasks != NULL)
+        {
+            // Copy the task out: it may be freed as soon as it has run
+            SystemPoolTask *task = pool->tasks;
+            void (*run)(void *) = task->run;
+            void *context = task->context;
+            pool->tasks = task->next;
+            if (pool->tasks == NULL)
+            {
+                pool->tasks_tail = &pool->tasks;
+            }
+            pthread_mutex_unlock(&pool->lock);
+
+            run(context);
+
+            pthread_mutex_lock(&pool->lock);
+            continue;
+        }
+        if (job == NULL)
+        {
+            pthread_cond_wait(&pool->work_posted, &pool->lock);
+            continue;
+        }
+
+        MathNatural slot = job->next_slot++;
+        if (job->next_slot == job->worker_count)
+        {
+            pool->pending = job->next_pending; // Last slot taken
+        }
+        job->helpers_running++;
+        pthread_mutex_unlock(&pool->lock);
+
+        batch_worker_main(&job->workers[slot]);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--job->helpers_running == 0)
+        {
+            pthread_cond_broadcast(&pool->helper_done);
+        }
+    }
+    return NULL;
 }
 
 /**
- * @brief Validate that two algorithms produce the same result
+ * @brief Start pool threads until there are at least @p target, as far as the system allows
  *
- * @param variant1 First algorithm variant
- * @param variant2 Second algorithm variant
- * @param a First operand
- * @param b Second operand
- * @return true if both algorithms produce the same result
+ * Called with the pool lock held.
+ *
+ * @param target Wanted number of pool threads
  */
-bool system_validate_algorithms(GcdAlgorithmVariant variant1, GcdAlgorithmVariant variant2, GcdInteger a, GcdInteger b)
+static void batch_pool_grow(MathNatural target)
 {
-    MathResult result1 = system_execute_gcd(variant1, a, b);
-    MathResult result2 = system_execute_gcd(variant2, a, b);
+    BatchPool *pool = &g_batch_pool;
 
-    if (!MATH_IS_VALID_RESULT(result1) || !MATH_IS_VALID_RESULT(result2))
+    while (pool->thread_count < target)
     {
-        return false;
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, batch_pool_main, NULL) != 0)
+        {
+            break;
+        }
+        pthread_detach(thread);
+        pool->thread_count++;
     }
-
-    return result1.value == result2.value;
 }
 
-// ============================================================================
-// SYSTEM DIAGNOSTICS
-// ============================================================================
-
 /**
- * @brief Print system status and statistics
+ * @brief Offer worker slots 1 .. worker_count - 1 of a set-up job to the pool
+ *
+ * Starts pool threads until there is one per slot, as far as the system
+ * allows; slots no thread takes are drained by stealing.
+ *
+ * @param job Job whose workers are set up
  */
-void system_print_status(void)
+static void batch_pool_post(BatchJob *job)
 {
-    printf("=== System Status ===\n");
-    printf("Initialized: %s\n", g_system.is_initialized ? "Yes" : "No");
-    printf("Registry Ready: %s\n", g_system.registry_ready ? "Yes" : "No");
-    printf("Analyzer Ready: %s\n", g_system.analyzer_ready ? "Yes" : "No");
+    BatchPool *pool = &g_batch_pool;
+    MathNatural helpers = job->worker_count - 1;
 
-    if (system_is_ready())
+    pthread_mutex_lock(&pool->lock);
+    batch_pool_grow(helpers);
+
+    job->next_slot = 1;
+    job->helpers_running = 0;
+    job->next_pending = NULL;
+    BatchJob **tail = &pool->pending;
+    while (*tail != NULL)
     {
-        printf("Total Executions: %lu\n", (unsigned long)g_system.total_executions);
-        printf("Total Execution Time: %.6f ms\n", g_system.total_execution_time);
+        tail = &(*tail)->next_pending;
+    }
+    *tail = job;
+    for (MathNatural h = 0; h < helpers; h++)
+    {
+        pthread_cond_signal(&pool->work_posted);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
 
-        if (g_system.total_executions > 0)
+/**
+ * @brief Stop offering a job's slots and wait for the pool threads inside it
+ *
+ * @param job Job posted with batch_pool_post() whose worker 0 has returned
+ */
+static void batch_pool_withdraw(BatchJob *job)
+{
+    BatchPool *pool = &g_batch_pool;
+
+    pthread_mutex_lock(&pool->lock);
+    for (BatchJob **link = &pool->pending; *link != NULL; link = &(*link)->next_pending)
+    {
+        if (*link == job)
         {
-            double avg_time = g_system.total_execution_time / g_system.total_executions;
-            printf("Average Execution Time: %.6f ms\n", avg_time);
+            *link = job->next_pending;
+            break;
         }
-
-        printf("Available Algorithms: %lu\n", (unsigned long)gcd_registry_get_count());
     }
+    while (job->helpers_running > 0)
+    {
+        pthread_cond_wait(&pool->helper_done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
 
-    printf("\n");
+/**
+ * @brief Queue a task for the resident pool threads
+ *
+ * The pool grows to one thread per online CPU for tasks, so at most one
+ * task per pool thread runs at once and the rest wait their turn. A task
+ * must not wait for a task queued after it.
+ *
+ * @param task Task to run; must stay valid until its function has started
+ * @return MATH_SUCCESS, or MATH_ERROR_MEMORY if no pool thread could be started
+ */
+MathStatus system_pool_submit(SystemPoolTask *task)
+{
+    BatchPool *pool = &g_batch_pool;
+
+    pthread_mutex_lock(&pool->lock);
+    batch_pool_grow(system_get_default_thread_count());
+    if (pool->thread_count == 0)
+    {
+        pthread_mutex_unlock(&pool->lock);
+        return MATH_ERROR_MEMORY;
+    }
+    task->next = NULL;
+    *pool->tasks_tail = task;
+    pool->tasks_tail = &task->next;
+    pthread_cond_signal(&pool->work_posted);
+    pthread_mutex_unlock(&pool->lock);
+    return MATH_SUCCESS;
 }
+#endif
 
 /**
- * @brief Run system self-test
+ * @brief Get the number of resident batch worker threads started so far
  *
- * @return true if all tests pass
+ * @return Pool threads (0 without thread support)
  */
-bool system_self_test(void)
+static MathNatural batch_pool_thread_count(void)
 {
-    printf("=== System Self-Test ===\n");
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&g_batch_pool.lock);
+    MathNatural count = g_batch_pool.thread_count;
+    pthread_mutex_unlock(&g_batch_pool.lock);
+    return count;
+#else
+    return 0;
+#endif
+}
 
-    // Initialize system
-    if (system_init() != MATH_SUCCESS)
+/**
+ * @brief Run a job on job->worker_count workers, the calling thread acting as worker 0
+ *
+ * Every worker starts with a contiguous share of the chunks; workers 1 and
+ * up run on the resident pool threads. The caller
+ * merges the per-worker results from job->workers (and job->partials) and
+ * then calls batch_job_release(). Workers, partials and gather buffers
+ * come from one scratch scope of the calling thread, cache-line aligned.
+ *
+ * @param job Job to run (workers and locks are set up here)
+ * @return MATH_SUCCESS, or MATH_ERROR_MEMORY if the workers cannot be allocated
+ */
+static MathStatus batch_job_run(BatchJob *job)
+{
+    // One scope for everything the job needs: no heap traffic once the thread's pool has grown
+    MathNatural thread_count = job->worker_count;
+    size_t worker_bytes = thread_count * sizeof(BatchWorker);
+    size_t partial_bytes = job->reduction ? job->chunk_count * sizeof(GcdInteger) : 0;
+    size_t scratch_bytes = job->interleaved ? thread_count * 2 * job->chunk_size * sizeof(GcdInteger) : 0;
+    MemoryArena *arena = memory_scratch_begin(&job->memory,
+                                              worker_bytes + partial_bytes + scratch_bytes + 3 * SYSTEM_CACHE_LINE_SIZE);
+    if (arena == NULL)
     {
-        printf("✗ System initialization failed\n");
-        return false;
+        return MATH_ERROR_MEMORY;
     }
-    printf("✓ System initialization successful\n");
 
-    // Test registry
-    MathNatural algorithm_count = gcd_registry_get_count();
-    if (algorithm_count == 0)
+    // Line-aligned: together with the trailing padding, workers never share a line
+    BatchWorker *workers = (BatchWorker *)memory_arena_alloc(arena, worker_bytes, SYSTEM_CACHE_LINE_SIZE);
+    memory_clear(workers, worker_bytes);
+    job->partials = NULL;
+    job->scratch = NULL;
+    if (partial_bytes > 0)
     {
-        printf("✗ No algorithms registered\n");
-        return false;
+        job->partials = (GcdInteger *)memory_arena_alloc(arena, partial_bytes, SYSTEM_CACHE_LINE_SIZE);
+        memory_clear(job->partials, partial_bytes);
+    }
+    if (scratch_bytes > 0)
+    {
+        job->scratch = (GcdInteger *)memory_arena_alloc(arena, scratch_bytes, SYSTEM_CACHE_LINE_SIZE);
+    }
+    job->workers = workers;
+    job->stop_requested = false;
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_init(&job->stop_lock, NULL);
+#endif
+
+    // Give every worker an initial contiguous share of the chunks
+    for (MathNatural w = 0; w < thread_count; w++)
+    {
+        workers[w].index = w;
+        workers[w].job = job;
+        workers[w].scratch = job->scratch != NULL ? job->scratch + w * 2 * job->chunk_size : NULL;
+        workers[w].metrics = (MathPerformanceMetrics)MATH_PERFORMANCE_METRICS_INIT;
+        workers[w].queue.next_chunk = job->chunk_count * w / thread_count;
+        workers[w].queue.end_chunk = job->chunk_count * (w + 1) / thread_count;
+#ifdef HAS_POSIX_THREADS
+        pthread_mutex_init(&workers[w].queue.lock, NULL);
+#endif
     }
-    printf("✓ Registry loaded %lu algorithms\n", (unsigned long)algorithm_count);
 
-    // Test basic computation
-    GcdInteger test_result = system_quick_gcd(48, 18);
-    if (test_result != 6)
+#ifdef HAS_POSIX_THREADS
+    if (thread_count > 1)
     {
-        printf("✗ Basic computation failed: expected 6, got %lld\n", (long long)test_result);
-        return false;
+        batch_pool_post(job);
+        batch_worker_main(&workers[0]);
+        batch_pool_withdraw(job);
     }
-    printf("✓ Basic computation successful: gcd(48, 18) = %lld\n", (long long)test_result);
+    else
+    {
+        batch_worker_main(&workers[0]);
+    }
+#else
+    batch_worker_main(&workers[0]);
+#endif
 
-    // Test consistency
-    MathNatural comparison_count = system_compare_all_algorithms(48, 18, false);
-    if (comparison_count == 0)
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Release the workers, buffers and locks of a finished job
+ *
+ * @param job Job previously run by batch_job_run()
+ */
+static void batch_job_release(BatchJob *job)
+{
+#ifdef HAS_POSIX_THREADS
+    for (MathNatural w = 0; w < job->worker_count; w++)
     {
-        printf("✗ Algorithm comparison failed\n");
-        return false;
+        pthread_mutex_destroy(&job->workers[w].queue.lock);
+    }
+    pthread_mutex_destroy(&job->stop_lock);
+#endif
+    memory_scratch_end(&job->memory);
+    job->workers = NULL;
+    job->partials = NULL;
+    job->scratch = NULL;
+}
+
+/**
+ * @brief Run a validated pair batch on worker threads and merge the workers' counters
+ *
+ * @param variant Algorithm variant to execute
+ * @param a First operands, or the interleaved pairs
+ * @param b Second operands (unused when interleaved)
+ * @param interleaved a holds pairs a0 b0 a1 b1 ...
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @param control Submitted job whose limits apply (NULL = none)
+ * @return Batch summary result over the pairs computed; execution_time_ms
+ *         is the wall-clock time
+ */
+MathResult system_run_pair_job(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    bool interleaved,
+    GcdInteger *out,
+    MathNatural n,
+    MathNatural thread_count,
+    SystemJob *control)
+{
+    if (thread_count == 0)
+    {
+        thread_count = system_get_default_thread_count();
+    }
+    thread_count = MATH_MIN(thread_count, SYSTEM_MAX_WORKER_THREADS);
+
+    MathNatural chunk_count = (n + SYSTEM_BATCH_CHUNK_SIZE - 1) / SYSTEM_BATCH_CHUNK_SIZE;
+    thread_count = MATH_MIN(thread_count, chunk_count);
+
+    // Not worth spawning threads: run on the calling thread (submitted jobs still need chunk checks)
+    if (thread_count <= 1 && !interleaved && control == NULL)
+    {
+        return system_execute_gcd_batch(variant, a, b, out, n);
+    }
+    if (thread_count == 0)
+    {
+        return math_create_batch_result(0, 0, 0.0);
+    }
+
+    BatchJob job = {
+        .variant = variant,
+        .operands_a = a,
+        .operands_b = b,
+        .results = out,
+        .kernel = system_production_kernel(variant, a, interleaved ? a + n : b, n),
+        .control = control,
+        .interleaved = interleaved,
+        .count = n,
+        .chunk_size = SYSTEM_BATCH_CHUNK_SIZE,
+        .chunk_count = chunk_count,
+        .worker_count = thread_count};
+
+    double start_time = math_get_time_ms();
+    if (batch_job_run(&job) != MATH_SUCCESS)
+    {
+        return math_create_error_result(MATH_ERROR_MEMORY, 0, 0.0);
+    }
+    double end_time = math_get_time_ms();
+
+    // Merge per-worker counters on the calling thread
+    MathPerformanceMetrics merged = MATH_PERFORMANCE_METRICS_INIT;
+    MathNatural successful = 0;
+    MathNatural failed = 0;
+    double busy_time = 0.0;
+    for (MathNatural w = 0; w < thread_count; w++)
+    {
+        math_merge_performance_metrics(&merged, &job.workers[w].metrics);
+        successful += job.workers[w].successful;
+        failed += job.workers[w].failed;
+        busy_time += job.workers[w].busy_time_ms;
+    }
+    batch_job_release(&job);
+
+    // Production chunks run untimed: count the wall-clock time instead
+    double elapsed_ms = math_elapsed_time_ms(start_time, end_time);
+    if (job.kernel != NULL)
+    {
+        system_account(successful, elapsed_ms);
+    }
+    else
+    {
+        system_account(successful, busy_time);
+        if (system_job_collects_performance(control))
+        {
+            gcd_registry_merge_performance(variant, &merged);
+        }
+    }
+
+    return math_create_batch_result(successful + failed, failed, elapsed_ms);
+}
+
+/**
+ * @brief Check that the system and a variant are ready for a batch
+ *
+ * @param variant Algorithm variant to execute
+ * @return MATH_SUCCESS, the system_init() error or MATH_ERROR_NOT_IMPLEMENTED
+ */
+MathStatus system_prepare_batch(GcdAlgorithmVariant variant)
+{
+    // Auto-initialize if needed (before any worker touches the registry)
+    if (!system_is_ready())
+    {
+        MathStatus init_status = system_init();
+        if (init_status != MATH_SUCCESS)
+        {
+            return init_status;
+        }
+    }
+
+    if (gcd_registry_get_implementation(variant) == NULL)
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Execute a GCD algorithm over a batch of operand pairs on worker threads
+ *
+ * @param variant Algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @return Batch summary result; execution_time_ms is the wall-clock time
+ */
+MathResult system_execute_gcd_batch_parallel(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    MathNatural n,
+    MathNatural thread_count)
+{
+    MathStatus status = system_prepare_batch(variant);
+    if (status != MATH_SUCCESS)
+    {
+        return math_create_error_result(status, 0, 0.0);
+    }
+
+    MathBatchInput input = MATH_BATCH_INPUT_INIT(a, b, out, n);
+    if (!memory_validate_batch_input(&input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    return system_run_pair_job(variant, a, b, false, out, n, thread_count, NULL);
+}
+
+/**
+ * @brief Execute a GCD algorithm over interleaved operand pairs on worker threads
+ *
+ * @param variant Algorithm variant to execute
+ * @param pairs Array of 2 * n operands: a0 b0 a1 b1 ...
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @return Batch summary result; execution_time_ms is the wall-clock time
+ */
+MathResult system_execute_gcd_batch_interleaved(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *pairs,
+    GcdInteger *out,
+    MathNatural n,
+    MathNatural thread_count)
+{
+    MathStatus status = system_prepare_batch(variant);
+    if (status != MATH_SUCCESS)
+    {
+        return math_create_error_result(status, 0, 0.0);
+    }
+
+    MathBatchInput input = MATH_BATCH_INPUT_INIT(pairs, pairs, out, n);
+    if (!memory_validate_batch_input(&input))
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    return system_run_pair_job(variant, pairs, NULL, true, out, n, thread_count, NULL);
+}
+
+/**
+ * @brief Compute the GCD of an array of values
+ *
+ * @param variant Algorithm variant to execute
+ * @param values Values to reduce
+ * @param n Number of values
+ * @return MathResult with value = GCD and iterations = values consumed
+ */
+MathResult system_execute_gcd_reduce(GcdAlgorithmVariant variant, const GcdInteger *values, MathNatural n)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        MathStatus init_status = system_init();
+        if (init_status != MATH_SUCCESS)
+        {
+            return math_create_error_result(init_status, 0, 0.0);
+        }
+    }
+
+    MathResult result = gcd_registry_execute_reduce(variant, values, n);
+
+    // Update statistics (count as one execution)
+    if (MATH_IS_VALID_RESULT(result))
+    {
+        system_account(1, result.execution_time_ms);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Compute the GCD of an array of values on worker threads
+ *
+ * Each chunk is reduced to a partial GCD by the work-stealing pool, and
+ * the partials are reduced once more on the calling thread. Chunks never
+ * taken because another one reached GCD_IDENTITY keep a partial of
+ * GCD_UNDEFINED, which leaves the final GCD unchanged.
+ *
+ * @param variant Algorithm variant to execute
+ * @param values Values to reduce
+ * @param n Number of values
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @return MathResult with value = GCD and iterations = values consumed;
+ *         execution_time_ms is the wall-clock time
+ */
+MathResult system_execute_gcd_reduce_parallel(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *values,
+    MathNatural n,
+    MathNatural thread_count)
+{
+    // Auto-initialize if needed (before any worker touches the registry)
+    if (!system_is_ready())
+    {
+        MathStatus init_status = system_init();
+        if (init_status != MATH_SUCCESS)
+        {
+            return math_create_error_result(init_status, 0, 0.0);
+        }
+    }
+
+    if (gcd_registry_get_implementation(variant) == NULL)
+    {
+        return math_create_error_result(MATH_ERROR_NOT_IMPLEMENTED, 0, 0.0);
+    }
+    if (values == NULL && n > 0)
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    if (thread_count == 0)
+    {
+        thread_count = system_get_default_thread_count();
+    }
+    thread_count = MATH_MIN(thread_count, SYSTEM_MAX_WORKER_THREADS);
+
+    MathNatural chunk_count = (n + SYSTEM_BATCH_CHUNK_SIZE - 1) / SYSTEM_BATCH_CHUNK_SIZE;
+    thread_count = MATH_MIN(thread_count, chunk_count);
+
+    // Not worth spawning threads: run on the calling thread
+    if (thread_count <= 1)
+    {
+        return system_execute_gcd_reduce(variant, values, n);
+    }
+
+    BatchJob job = {
+        .variant = variant,
+        .operands_a = values,
+        .operands_b = NULL,
+        .results = NULL,
+        .reduction = true,
+        .count = n,
+        .chunk_size = SYSTEM_BATCH_CHUNK_SIZE,
+        .chunk_count = chunk_count,
+        .worker_count = thread_count};
+
+    double start_time = math_get_time_ms();
+    if (batch_job_run(&job) != MATH_SUCCESS)
+    {
+        return math_create_error_result(MATH_ERROR_MEMORY, 0, 0.0);
+    }
+
+    MathNatural consumed = 0;
+    MathNatural failed = 0;
+    double busy_time = 0.0;
+    for (MathNatural w = 0; w < thread_count; w++)
+    {
+        consumed += job.workers[w].successful;
+        failed += job.workers[w].failed;
+        busy_time += job.workers[w].busy_time_ms;
+    }
+
+    // Second tree level: the partials themselves
+    MathResult combined = gcd_registry_execute_reduce(variant, job.partials, failed == 0 ? chunk_count : 0);
+    double end_time = math_get_time_ms();
+    batch_job_release(&job);
+
+    if (failed > 0)
+    {
+        return math_create_error_result(MATH_ERROR_OVERFLOW, consumed, math_elapsed_time_ms(start_time, end_time));
+    }
+    if (!MATH_IS_VALID_RESULT(combined))
+    {
+        return combined;
+    }
+
+    system_account(1, busy_time + combined.execution_time_ms);
+
+    return math_create_success_result(combined.value, consumed, math_elapsed_time_ms(start_time, end_time));
+}
+
+/**
+ * @brief Find moduli that share a factor with any other modulus
+ *
+ * @param moduli Positive moduli (count elements)
+ * @param count Number of moduli
+ * @param gcds Caller-initialized outputs, gcds[i] with capacity >= moduli[i].size
+ * @param config Execution options (NULL = defaults, one worker per online CPU)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus system_batch_gcd(const MathBigInteger *moduli, MathNatural count, MathBigInteger *gcds,
+                            const BatchGcdConfig *config, BatchGcdStats *stats)
+{
+    BatchGcdConfig effective = BATCH_GCD_CONFIG_INIT;
+    if (config != NULL)
+    {
+        effective = *config;
+    }
+    else
+    {
+        effective.thread_count = 0;
+    }
+
+    if (effective.thread_count == 0)
+    {
+        effective.thread_count = system_get_default_thread_count();
+    }
+
+    return batch_gcd_compute(moduli, count, gcds, &effective, stats);
+}
+
+/**
+ * @brief Execute Extended Euclidean algorithm (convenience wrapper)
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param x Pointer to store coefficient for a
+ * @param y Pointer to store coefficient for b
+ * @return ExtendedGcdResult with GCD and coefficients
+ */
+ExtendedGcdResult system_execute_extended_gcd(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    // Bezout coefficients of a repeated pair come from the result cache
+    ExtendedGcdResult result;
+    if (x != NULL && y != NULL && gcd_cache_lookup_extended(GCD_EXTENDED_EUCLIDEAN, a, b, &result))
+    {
+        *x = result.coefficient_x;
+        *y = result.coefficient_y;
+        system_account(1, 0.0);
+        return result;
+    }
+
+    result = mdc_analyzer_execute_extended(a, b, x, y);
+
+    // Update statistics (count as one execution)
+    if (result.is_valid)
+    {
+        system_account(1, 0.0);
+        gcd_cache_store_extended(GCD_EXTENDED_EUCLIDEAN, a, b, &result);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Inverse of a modulo m (convenience wrapper over modinv)
+ *
+ * @param a Value to invert
+ * @param modulus Modulus (positive)
+ * @param inverse Output in [0, modulus)
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus system_modinv(GcdInteger a, GcdInteger modulus, GcdInteger *inverse)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    MathStatus status = modinv(a, modulus, inverse);
+
+    // Update statistics (count as one execution)
+    if (status == MATH_SUCCESS)
+    {
+        system_account(1, 0.0);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Inverses of an array of values with one extended GCD (convenience wrapper over modinv_batch)
+ *
+ * @param values Values to invert
+ * @param inverses Output array
+ * @param count Number of values
+ * @param modulus Modulus (positive)
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus system_modinv_batch(const GcdInteger *values, GcdInteger *inverses, MathNatural count, GcdInteger modulus)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    MathStatus status = modinv_batch(values, inverses, count, modulus);
+
+    // Update statistics (the whole batch shares one extended GCD)
+    if (status == MATH_SUCCESS && count > 0)
+    {
+        system_account(1, 0.0);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Chinese Remainder recombination (convenience wrapper over crt_combine)
+ *
+ * @param residues Residues
+ * @param moduli Moduli (positive)
+ * @param count Number of congruences
+ * @param result Output residue
+ * @param modulus Output modulus
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus system_crt_combine(const GcdInteger *residues, const GcdInteger *moduli, MathNatural count,
+                              GcdInteger *result, GcdInteger *modulus)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    MathStatus status = crt_combine(residues, moduli, count, result, modulus);
+
+    // Update statistics (one extended GCD per congruence)
+    if (status == MATH_SUCCESS)
+    {
+        system_account(count, 0.0);
+    }
+
+    return status;
+}
+
+// ============================================================================
+// COMPARISON AND ANALYSIS INTERFACE
+// ============================================================================
+
+/**
+ * @brief Compare all available GCD algorithms (main comparison interface)
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param print_results Whether to print results to console
+ * @return Number of algorithms compared
+ */
+MathNatural system_compare_all_algorithms(GcdInteger a, GcdInteger b, bool print_results)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    MathResult results[GCD_VARIANT_CAPACITY]; // Space for all possible algorithms
+    GcdStepCounts steps[GCD_VARIANT_CAPACITY];
+    MathNatural count = mdc_analyzer_execute_all_counted(a, b, results, steps, GCD_VARIANT_CAPACITY);
+    const GcdStepCounts *counted = GCD_STEP_COUNTING_ENABLED ? steps : NULL;
+
+    // Update statistics
+    double elapsed_ms = 0.0;
+    for (MathNatural i = 0; i < count; i++)
+    {
+        if (MATH_IS_VALID_RESULT(results[i]) && results[i].execution_time_ms >= 0)
+        {
+            elapsed_ms += results[i].execution_time_ms;
+        }
+    }
+    system_account(count, elapsed_ms);
+
+    // Print results if requested
+    if (print_results && g_system.report_format != REPORT_FORMAT_TEXT)
+    {
+        GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+        MathNatural variant_count = mdc_analyzer_list_variants(variants, GCD_VARIANT_CAPACITY);
+        bool consistent = mdc_analyzer_validate_consistency(a, b, results, count);
+        report_write_comparison(system_report_stream(), g_system.report_format, a, b, variants, results,
+                                counted, MATH_MIN(count, variant_count), consistent);
+    }
+    else if (print_results)
+    {
+        mdc_analyzer_print_comparison(a, b, results, counted, count);
+
+        // Validate consistency
+        bool consistent = mdc_analyzer_validate_consistency(a, b, results, count);
+        if (consistent)
+        {
+            printf("✓ All algorithms produced consistent results\n");
+        }
+        else
+        {
+            printf("✗ WARNING: Inconsistent results detected!\n");
+        }
+        printf("\n");
+    }
+
+    return count;
+}
+
+/**
+ * @brief Compare all arbitrary-precision algorithms on big operands
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param print_results Whether to print results to console
+ * @return Number of algorithms compared (0 if the results disagree)
+ */
+MathNatural system_compare_big_algorithms(const MathBigInteger *a, const MathBigInteger *b, bool print_results)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    if (a == NULL || b == NULL)
+    {
+        return 0;
+    }
+
+    // One output per algorithm, each wide enough for the larger operand
+    MathNatural limbs = MATH_MAX(a->size, b->size) + 1;
+    MemoryArena arena;
+    if (memory_arena_init(&arena, GCD_VARIANT_CAPACITY * (limbs * sizeof(MathLimb) + MEMORY_ARENA_DEFAULT_ALIGNMENT)) != MATH_SUCCESS)
+    {
+        return 0;
+    }
+
+    MathResult results[GCD_VARIANT_CAPACITY];
+    MathBigInteger gcd_values[GCD_VARIANT_CAPACITY];
+    for (MathNatural i = 0; i < GCD_VARIANT_CAPACITY; i++)
+    {
+        bignum_alloc(&gcd_values[i], &arena, limbs);
+    }
+
+    MathNatural count = mdc_analyzer_execute_all_big(a, b, results, gcd_values, GCD_VARIANT_CAPACITY);
+    bool consistent = mdc_analyzer_validate_consistency_big(results, gcd_values, count);
+
+    // Update statistics
+    double elapsed_ms = 0.0;
+    for (MathNatural i = 0; i < count; i++)
+    {
+        if (MATH_IS_VALID_RESULT(results[i]) && results[i].execution_time_ms >= 0)
+        {
+            elapsed_ms += results[i].execution_time_ms;
+        }
+    }
+    system_account(count, elapsed_ms);
+
+    if (print_results)
+    {
+        mdc_analyzer_print_comparison_big(a, b, results, gcd_values, count);
+
+        if (consistent)
+        {
+            printf("✓ All algorithms produced consistent results\n");
+        }
+        else
+        {
+            printf("✗ WARNING: Inconsistent results detected!\n");
+        }
+        printf("\n");
+    }
+
+    memory_arena_destroy(&arena);
+    return consistent ? count : 0;
+}
+
+/**
+ * @brief Find the fastest algorithm for given input
+ *
+ * Answers from the GCD_AUTO decision table instead of running every
+ * algorithm; only the chosen one is executed, to report its time.
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param print_results Whether to print results to console
+ * @return The fastest algorithm variant
+ */
+GcdAlgorithmVariant system_find_fastest_algorithm(GcdInteger a, GcdInteger b, bool print_results)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    GcdDispatchBucket bucket = gcd_dispatch_classify(a, b);
+    const GcdDispatchTable *table = gcd_dispatch_get_table();
+    GcdAlgorithmVariant fastest = table->choice[bucket];
+
+    MathResult result = mdc_analyzer_execute_algorithm(fastest, a, b);
+    double fastest_time = MATH_IS_VALID_RESULT(result) ? result.execution_time_ms : -1.0;
+    if (fastest_time >= 0)
+    {
+        system_account(1, fastest_time);
+    }
+
+    if (print_results && g_system.report_format != REPORT_FORMAT_TEXT)
+    {
+        report_write_fastest(system_report_stream(), g_system.report_format, a, b, fastest, fastest_time);
+    }
+    else if (print_results)
+    {
+        if (fastest_time >= 0)
+        {
+            printf("=== Fastest Algorithm Analysis ===\n");
+            printf("Input: gcd(%lld, %lld)\n", (long long)a, (long long)b);
+            printf("Fastest: %s\n", mdc_analyzer_get_algorithm_name(fastest));
+            if (table->calibrated)
+            {
+                printf("Bucket: %s (calibrated median %.1f ns on %s)\n", gcd_dispatch_bucket_name(bucket),
+                       table->median_ns[bucket], table->cpu);
+            }
+            else
+            {
+                printf("Bucket: %s (built-in default; run 'calibrate' to measure this machine)\n",
+                       gcd_dispatch_bucket_name(bucket));
+            }
+            printf("Time: %.6f ms\n\n", fastest_time);
+        }
+        else
+        {
+            printf("Error: Could not determine fastest algorithm\n\n");
+        }
+    }
+
+    return fastest;
+}
+
+/**
+ * @brief Run simple benchmark comparing algorithms
+ *
+ * Uses the benchmark harness (warmup, calibrated batches, tick counter)
+ * and reports min / median / p99 / stddev per GCD. The measured metrics
+ * are merged into each implementation's performance record.
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param iterations Number of timed samples for each algorithm
+ * @param print_results Whether to print results to console
+ * @return Number of algorithms benchmarked
+ */
+MathNatural system_benchmark_algorithms(GcdInteger a, GcdInteger b, MathNatural iterations, bool print_results)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    BenchmarkConfig config = BENCHMARK_CONFIG_INIT;
+    config.sample_count = iterations;
+
+    BenchmarkStats benchmarks[GCD_VARIANT_CAPACITY];
+    MathNatural count = mdc_analyzer_benchmark_detailed(a, b, &config, benchmarks, GCD_VARIANT_CAPACITY);
+
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    MathNatural variant_count = mdc_analyzer_list_variants(variants, GCD_VARIANT_CAPACITY);
+
+    // Feed the measured distributions into each implementation's metrics
+    for (MathNatural i = 0; i < count && i < variant_count; i++)
+    {
+        if (benchmarks[i].sample_count > 0)
+        {
+            MathPerformanceMetrics metrics = MATH_PERFORMANCE_METRICS_INIT;
+            benchmark_stats_to_metrics(&benchmarks[i], &metrics);
+            gcd_registry_merge_performance(variants[i], &metrics);
+            system_account(benchmarks[i].total_operations, metrics.execution_time_ms);
+        }
+    }
+
+    if (print_results && g_system.report_format != REPORT_FORMAT_TEXT)
+    {
+        report_write_benchmark(system_report_stream(), g_system.report_format, a, b, &config, variants,
+                               benchmarks, MATH_MIN(count, variant_count));
+    }
+    else if (print_results)
+    {
+        printf("=== Algorithm Benchmark ===\n");
+        printf("Input: gcd(%lld, %lld)\n", (long long)a, (long long)b);
+        printf("Timer: %s at %.3f GHz, %lu samples + %lu warmup per algorithm\n\n",
+               benchmark_timer_name(), benchmark_timer_frequency() / 1e9,
+               (unsigned long)config.sample_count, (unsigned long)config.warmup_samples);
+
+        printf("%-20s %10s %10s %10s %10s %10s %8s\n",
+               "Algorithm", "min ns", "median ns", "p99 ns", "stddev", "ticks", "batch");
+        for (MathNatural i = 0; i < count && i < variant_count; i++)
+        {
+            const BenchmarkStats *entry = &benchmarks[i];
+            if (entry->sample_count == 0)
+            {
+                printf("%-20s %10s\n", mdc_analyzer_get_algorithm_name(variants[i]), "(rejected)");
+                continue;
+            }
+            printf("%-20s %10.2f %10.2f %10.2f %10.2f %10.1f %8lu\n",
+                   mdc_analyzer_get_algorithm_name(variants[i]),
+                   entry->min_ns, entry->median_ns, entry->p99_ns, entry->stddev_ns,
+                   entry->median_ticks, (unsigned long)entry->batch_size);
+        }
+        printf("\n");
+    }
+
+    return count;
+}
+
+/**
+ * @brief Benchmark every registered algorithm over every input class
+ *
+ * @param samples Number of timed samples per cell (0 = GCD_SUITE_DEFAULT_SAMPLES)
+ * @param seed Operand generator seed
+ * @param matrix Matrix receiving the results (NULL = internal, printed only)
+ * @param print_results Whether to print the comparison matrix
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus system_benchmark_suite(MathNatural samples, MathNatural seed, GcdSuiteMatrix *matrix, bool print_results)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    // The matrix is too large for the stack when the caller does not keep it
+    GcdSuiteMatrix *suite = matrix;
+    if (suite == NULL)
+    {
+        suite = (GcdSuiteMatrix *)malloc(sizeof(GcdSuiteMatrix));
+        if (suite == NULL)
+        {
+            return MATH_ERROR_MEMORY;
+        }
+    }
+
+    BenchmarkConfig config = BENCHMARK_CONFIG_INIT;
+    config.sample_count = samples > 0 ? samples : GCD_SUITE_DEFAULT_SAMPLES;
+
+    MathStatus status = gcd_suite_run(&config, seed, suite);
+    if (status == MATH_SUCCESS)
+    {
+        for (MathNatural r = 0; r < suite->variant_count; r++)
+        {
+            for (MathNatural c = 0; c < GCD_SUITE_COLUMN_COUNT; c++)
+            {
+                if (suite->cells[r][c].sample_count > 0)
+                {
+                    MathPerformanceMetrics metrics = MATH_PERFORMANCE_METRICS_INIT;
+                    benchmark_stats_to_metrics(&suite->cells[r][c], &metrics);
+                    gcd_registry_merge_performance(suite->variants[r], &metrics);
+                    system_account(suite->cells[r][c].total_operations, metrics.execution_time_ms);
+                }
+            }
+        }
+
+        if (print_results && g_system.report_format != REPORT_FORMAT_TEXT)
+        {
+            report_write_suite(system_report_stream(), g_system.report_format, suite);
+        }
+        else if (print_results)
+        {
+            printf("=== Benchmark Suite ===\n");
+            printf("Timer: %s at %.3f GHz, %lu samples + %lu warmup per cell, seed 0x%llx\n\n",
+                   benchmark_timer_name(), benchmark_timer_frequency() / 1e9,
+                   (unsigned long)config.sample_count, (unsigned long)config.warmup_samples,
+                   (unsigned long long)seed);
+            gcd_suite_print_matrix(suite);
+        }
+    }
+
+    if (suite != matrix)
+    {
+        free(suite);
+    }
+    return status;
+}
+
+/**
+ * @brief Calibrate the GCD_AUTO decision table on this machine
+ *
+ * @param samples Number of timed samples per cell (0 = GCD_SUITE_DEFAULT_SAMPLES)
+ * @param seed Operand generator seed
+ * @param path File the table is saved to (NULL = not saved)
+ * @param print_results Whether to print the timings and the chosen table
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT (unwritable path) or MATH_ERROR_MEMORY
+ */
+MathStatus system_calibrate_dispatcher(MathNatural samples, MathNatural seed, const char *path, bool print_results)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    BenchmarkConfig config = BENCHMARK_CONFIG_INIT;
+    config.sample_count = samples > 0 ? samples : GCD_SUITE_DEFAULT_SAMPLES;
+
+    GcdDispatchCalibration *calibration = (GcdDispatchCalibration *)malloc(sizeof(GcdDispatchCalibration));
+    if (calibration == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+
+    GcdDispatchTable table;
+    MathStatus status = gcd_suite_calibrate_dispatch(&config, seed, calibration, &table);
+    if (status == MATH_SUCCESS)
+    {
+        status = gcd_dispatch_set_table(&table);
+    }
+    if (status == MATH_SUCCESS && path != NULL)
+    {
+        status = gcd_dispatch_save(&table, path);
+    }
+
+    if (print_results && status == MATH_SUCCESS)
+    {
+        printf("=== Dispatcher Calibration ===\n");
+        printf("CPU: %s\n", table.cpu);
+        printf("Timer: %s at %.3f GHz, %lu samples + %lu warmup per cell, %d pairs per bucket\n\n",
+               benchmark_timer_name(), benchmark_timer_frequency() / 1e9,
+               (unsigned long)config.sample_count, (unsigned long)config.warmup_samples,
+               GCD_SUITE_CALIBRATION_PAIRS);
+        gcd_suite_print_calibration(calibration, &table);
+
+        printf("Decision table:\n");
+        for (MathNatural bucket = 0; bucket < GCD_DISPATCH_BUCKET_COUNT; bucket++)
+        {
+            printf("  %-12s -> %s\n", gcd_dispatch_bucket_name((GcdDispatchBucket)bucket),
+                   mdc_analyzer_get_algorithm_name(table.choice[bucket]));
+        }
+        if (path != NULL)
+        {
+            printf("Saved to %s\n", path);
+        }
+        printf("\n");
+    }
+
+    free(calibration);
+    return status;
+}
+
+/**
+ * @brief Install a decision table saved by system_calibrate_dispatcher
+ *
+ * @param path Table file
+ * @return MATH_SUCCESS, MATH_ERROR_NO_SOLUTION (missing file) or
+ *         MATH_ERROR_INVALID_INPUT (malformed file); the current table is
+ *         kept on error
+ */
+MathStatus system_load_dispatch_table(const char *path)
+{
+    GcdDispatchTable table;
+    MathStatus status = gcd_dispatch_load(path, &table);
+    if (status == MATH_SUCCESS)
+    {
+        status = gcd_dispatch_set_table(&table);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        memory_safe_strcpy(g_system.profile_path, path, sizeof(g_system.profile_path));
+        g_system.profile_status = SYSTEM_PROFILE_LOADED;
+    }
+    return status;
+}
+
+/**
+ * @brief Benchmark the arbitrary-precision algorithms on big operands
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param iterations Number of iterations per algorithm
+ * @param print_results Whether to print results to console
+ * @return Number of algorithms benchmarked
+ */
+MathNatural system_benchmark_big_algorithms(const MathBigInteger *a, const MathBigInteger *b,
+                                            MathNatural iterations, bool print_results)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    MathResult benchmarks[GCD_VARIANT_CAPACITY];
+    MathNatural count = mdc_analyzer_benchmark_big(a, b, iterations, benchmarks, GCD_VARIANT_CAPACITY);
+
+    system_account(count * iterations, 0.0);
+
+    if (print_results)
+    {
+        printf("=== Bignum Algorithm Benchmark ===\n");
+        printf("Input: gcd(<%lu bits>, <%lu bits>)\n",
+               (unsigned long)bignum_bit_length(a), (unsigned long)bignum_bit_length(b));
+        printf("Iterations per algorithm: %lu\n\n", (unsigned long)iterations);
+
+        GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+        MathNatural variant_count = mdc_analyzer_list_big_variants(variants, GCD_VARIANT_CAPACITY);
+
+        for (MathNatural i = 0; i < count && i < variant_count; i++)
+        {
+            printf("%-20s: Avg Time: %.6f ms | Runs: %lu\n",
+                   mdc_analyzer_get_algorithm_name(variants[i]),
+                   benchmarks[i].execution_time_ms,
+                   (unsigned long)benchmarks[i].iterations);
+        }
+        printf("\n");
+    }
+
+    return count;
+}
+
+// ============================================================================
+// INFORMATION AND LISTING INTERFACE
+// ============================================================================
+
+/**
+ * @brief List all available algorithms
+ *
+ * @param print_details Whether to print detailed information
+ */
+void system_list_algorithms(bool print_details)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    if (print_details)
+    {
+        gcd_registry_print_all();
+    }
+    else
+    {
+        printf("Available GCD Algorithms:\n");
+
+        GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+        MathNatural count = gcd_registry_list_variants(variants, GCD_VARIANT_CAPACITY);
+
+        for (MathNatural i = 0; i < count; i++)
+        {
+            printf("  %lu. %s\n", (unsigned long)(i + 1), gcd_registry_get_display_name(variants[i]));
+        }
+        printf("\nTotal: %lu algorithms\n\n", (unsigned long)count);
+    }
+}
+
+/**
+ * @brief Get information about a specific algorithm
+ *
+ * @param variant Algorithm variant to describe
+ * @param print_info Whether to print information to console
+ * @return Pointer to implementation spec, NULL if not found
+ */
+const ImplementationSpec *system_get_algorithm_info(GcdAlgorithmVariant variant, bool print_info)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        system_init();
+    }
+
+    const ImplementationSpec *spec = gcd_registry_get_implementation(variant);
+
+    if (print_info)
+    {
+        gcd_registry_print_implementation_info(variant);
+    }
+
+    return spec;
+}
+
+// ============================================================================
+// CONVENIENCE FUNCTIONS
+// ============================================================================
+
+/**
+ * @brief Quick GCD computation using default algorithm (Euclidean Modulo)
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @return GCD result, or MATH_INVALID_VALUE on error
+ */
+GcdInteger system_quick_gcd(GcdInteger a, GcdInteger b)
+{
+    MathResult result = system_execute_gcd(GCD_EUCLIDEAN_MODULO, a, b);
+    return MATH_IS_VALID_RESULT(result) ? result.value : MATH_INVALID_VALUE;
+}
+
+/**
+ * @brief Validate that two algorithms produce the same result
+ *
+ * @param variant1 First algorithm variant
+ * @param variant2 Second algorithm variant
+ * @param a First operand
+ * @param b Second operand
+ * @return true if both algorithms produce the same result
+ */
+bool system_validate_algorithms(GcdAlgorithmVariant variant1, GcdAlgorithmVariant variant2, GcdInteger a, GcdInteger b)
+{
+    MathResult result1 = system_execute_gcd(variant1, a, b);
+    MathResult result2 = system_execute_gcd(variant2, a, b);
+
+    if (!MATH_IS_VALID_RESULT(result1) || !MATH_IS_VALID_RESULT(result2))
+    {
+        return false;
+    }
+
+    return result1.value == result2.value;
+}
+
+// ============================================================================
+// SYSTEM DIAGNOSTICS
+// ============================================================================
+
+/**
+ * @brief Sum the per-thread counters of one algorithm
+ *
+ * @param variant Algorithm variant
+ * @param totals Output totals (zero when built with DISABLE_PERF_COUNTERS)
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus system_get_performance_counters(GcdAlgorithmVariant variant, PerfCounterTotals *totals)
+{
+    return perf_collect((unsigned int)variant, totals);
+}
+
+/**
+ * @brief Print the per-thread counters aggregated per algorithm
+ *
+ * Latencies come from the log2 histogram, so p50 and p99 are the upper
+ * edge of a power-of-two bucket of ticks.
+ */
+void system_print_performance_counters(void)
+{
+    if (!PERF_COUNTERS_ENABLED)
+    {
+        printf("Performance Counters: compiled out (DISABLE_PERF_COUNTERS)\n");
+        return;
+    }
+
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    MathNatural count = gcd_registry_list_variants(variants, GCD_VARIANT_CAPACITY);
+    double ns_per_tick = 1e9 / platform_counter_frequency();
+    bool header = false;
+
+    for (MathNatural i = 0; i < count; i++)
+    {
+        PerfCounterTotals totals;
+        if (system_get_performance_counters(variants[i], &totals) != MATH_SUCCESS || totals.calls == 0)
+        {
+            continue;
+        }
+
+        if (!header)
+        {
+            printf("\nPerformance Counters (%lu thread blocks, %s ticks):\n", (unsigned long)perf_thread_count(),
+                   benchmark_timer_name());
+            printf("%-26s %12s %10s %10s %10s %10s\n", "Algorithm", "Calls", "Mean ns", "p50 ns", "p99 ns",
+                   "Iter/call");
+            header = true;
+        }
+
+        printf("%-26s %12lu %10.1f %10.1f %10.1f %10.2f\n", gcd_registry_get_display_name(variants[i]),
+               (unsigned long)totals.calls, (double)totals.ticks / (double)totals.calls * ns_per_tick,
+               perf_histogram_quantile(&totals, 0.50) * ns_per_tick,
+               perf_histogram_quantile(&totals, 0.99) * ns_per_tick,
+               (double)totals.iterations / (double)totals.calls);
+
+        // Share of calls per histogram bucket, labelled by the bucket's upper edge
+        printf("  latency:");
+        for (unsigned int b = 0; b < PERF_HISTOGRAM_BUCKETS; b++)
+        {
+            if (totals.histogram[b] > 0)
+            {
+                printf(" <%.0fns:%.0f%%", (double)(1ull << (b + 1)) * ns_per_tick,
+                       100.0 * (double)totals.histogram[b] / (double)totals.calls);
+            }
+        }
+        printf("\n");
+    }
+
+    if (!header)
+    {
+        printf("Performance Counters: no calls recorded\n");
+    }
+}
+
+/**
+ * @brief Print system status and statistics
+ */
+void system_print_status(void)
+{
+    printf("=== System Status ===\n");
+    printf("Initialized: %s\n", g_system.is_initialized ? "Yes" : "No");
+    printf("Registry Ready: %s\n", g_system.registry_ready ? "Yes" : "No");
+    printf("Analyzer Ready: %s\n", g_system.analyzer_ready ? "Yes" : "No");
+
+    if (system_is_ready())
+    {
+        printf("Total Executions: %lu\n", (unsigned long)g_system.total_executions);
+        printf("Total Execution Time: %.6f ms\n", g_system.total_execution_time);
+
+        if (g_system.total_executions > 0)
+        {
+            double avg_time = g_system.total_execution_time / g_system.total_executions;
+            printf("Average Execution Time: %.6f ms\n", avg_time);
+        }
+
+        printf("Available Algorithms: %lu\n", (unsigned long)gcd_registry_get_count());
+
+        const GcdDispatchTable *table = gcd_dispatch_get_table();
+        switch (g_system.profile_status)
+        {
+        case SYSTEM_PROFILE_LOADED:
+            printf("Dispatch Profile: %s (%s%s)\n", g_system.profile_path,
+                   table->calibrated ? "calibrated on " : "uncalibrated", table->calibrated ? table->cpu : "");
+            break;
+        case SYSTEM_PROFILE_MISSING:
+            printf("Dispatch Profile: %s not found, built-in defaults\n", g_system.profile_path);
+            break;
+        case SYSTEM_PROFILE_INVALID:
+            printf("Dispatch Profile: %s is malformed, built-in defaults\n", g_system.profile_path);
+            break;
+        case SYSTEM_PROFILE_OTHER_CPU:
+            printf("Dispatch Profile: %s was measured on another CPU, built-in defaults\n", g_system.profile_path);
+            break;
+        case SYSTEM_PROFILE_DEFAULTS:
+        default:
+            printf("Dispatch Profile: none configured ($%s), built-in defaults\n", GCD_DISPATCH_PROFILE_ENV);
+            break;
+        }
+        printf("Dispatch Thresholds: tiny <= %u bits, two-adic >= %u zeros, skewed >= %u bits gap, "
+               "balanced32 <= %u bits\n",
+               table->thresholds.tiny_bits, table->thresholds.two_adic_zeros, table->thresholds.skew_bits,
+               table->thresholds.word32_bits);
+        printf("Big Operand Dispatch: half-GCD from %u bits, Lehmer below\n", table->thresholds.half_gcd_bits);
+        if (g_system.small_operand_bits != 0)
+        {
+            printf("Small-Operand Fast Path: auto pairs below 2^%u use the lookup table\n",
+                   g_system.small_operand_bits);
+        }
+        else
+        {
+            printf("Small-Operand Fast Path: disabled\n");
+        }
+
+        printf("Execution Mode: %s\n", g_system.execution_mode == SYSTEM_MODE_PRODUCTION
+                                              ? "production (bare kernels, batches validated once)"
+                                              : "instrumented");
+        printf("Build: %s\n", GCD_BUILD_CONFIG);
+        printf("Batch Kernels: %s (ISA copies built:", platform_isa_level_name(gcd_isa_active_level()));
+        for (int level = 0; level < PLATFORM_ISA_LEVEL_COUNT; level++)
+        {
+            if (gcd_isa_level_built((PlatformIsaLevel)level))
+            {
+                printf(" %s", platform_isa_level_name((PlatformIsaLevel)level));
+            }
+        }
+        printf(")\n");
+
+        GcdCacheStats cache;
+        gcd_cache_get_stats(&cache);
+        if (cache.capacity != 0)
+        {
+            MathNatural lookups = cache.hits + cache.misses;
+            printf("Result Cache: %lu entries per thread, %lu shards, %lu hits / %lu misses (%.1f%% hit rate), "
+                   "%lu evictions\n",
+                   (unsigned long)cache.capacity, (unsigned long)cache.shards, (unsigned long)cache.hits,
+                   (unsigned long)cache.misses, lookups > 0 ? 100.0 * (double)cache.hits / (double)lookups : 0.0,
+                   (unsigned long)cache.evictions);
+        }
+        else
+        {
+            printf("Result Cache: disabled\n");
+        }
+
+        system_print_performance_counters();
+    }
+
+    printf("\n");
+}
+
+/**
+ * @brief Completion callbacks seen by the self-test
+ */
+typedef struct
+{
+    SystemJobState state; /**< State passed to the last callback */
+    MathNatural calls;    /**< Callbacks so far */
+} SystemSelfTestJobLog;
+
+/**
+ * @brief Self-test completion callback: records the state and counts calls
+ */
+static void system_self_test_job_done(SystemJob *job, SystemJobState state, const MathResult *result, void *user_data)
+{
+    (void)job;
+    (void)result;
+    SystemSelfTestJobLog *log = (SystemSelfTestJobLog *)user_data;
+    log->state = state;
+    log->calls++;
+}
+
+#ifdef HAS_POSIX_THREADS
+/**
+ * @brief Server run by the self-test on a thread of its own
+ */
+typedef struct
+{
+    GcdServeOptions options;
+    GcdServeStats stats;
+    MathStatus status;
+    bool ready;    /**< Listening (or given up): the client may proceed */
+    bool listening;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+} SystemSelfTestServer;
+
+/**
+ * @brief Self-test server callback: let the client connect
+ */
+static void system_self_test_server_ready(const char *address, void *user_data)
+{
+    (void)address;
+    SystemSelfTestServer *server = (SystemSelfTestServer *)user_data;
+    pthread_mutex_lock(&server->lock);
+    server->ready = true;
+    server->listening = true;
+    pthread_cond_broadcast(&server->changed);
+    pthread_mutex_unlock(&server->lock);
+}
+
+/**
+ * @brief Self-test server thread
+ */
+static void *system_self_test_server_main(void *arg)
+{
+    SystemSelfTestServer *server = (SystemSelfTestServer *)arg;
+    server->status = system_serve(&server->options, &server->stats);
+    pthread_mutex_lock(&server->lock);
+    server->ready = true;
+    pthread_cond_broadcast(&server->changed);
+    pthread_mutex_unlock(&server->lock);
+    return NULL;
+}
+
+/**
+ * @brief Send one request and check its reply against mdc_modulo
+ *
+ * @param client Connected socket
+ * @param pairs Operands in the request's layout
+ * @param out Buffer of n GCDs
+ * @param header Request to send
+ * @return true if the reply matched
+ */
+static bool system_self_test_server_round(const PlatformSocket *client, const GcdInteger *pairs, GcdInteger *out,
+                                          const GcdRequestHeader *header)
+{
+    unsigned char frame[GCD_PROTOCOL_HEADER_SIZE];
+    MathNatural n = header->count;
+    gcd_protocol_encode_request(header, frame);
+    if (!platform_socket_send(client, frame, sizeof(frame)) ||
+        !platform_socket_send(client, pairs, (size_t)(2 * n * sizeof(GcdInteger))))
+    {
+        return false;
+    }
+
+    GcdReplyHeader reply;
+    if (platform_socket_receive(client, frame, sizeof(frame)) != sizeof(frame) ||
+        gcd_protocol_decode_reply(frame, &reply) != MATH_SUCCESS || reply.status != MATH_SUCCESS ||
+        reply.count != n || reply.tag != header->tag ||
+        platform_socket_receive(client, out, (size_t)(n * sizeof(GcdInteger))) != n * sizeof(GcdInteger))
+    {
+        return false;
+    }
+    for (MathNatural i = 0; i < n; i++)
+    {
+        bool aos = header->layout == GCD_DATASET_AOS;
+        GcdInteger a = aos ? pairs[2 * i] : pairs[i];
+        GcdInteger b = aos ? pairs[2 * i + 1] : pairs[n + i];
+        if (out[i] != mdc_modulo(a, b))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+/**
+ * @brief Self-test plugin compute: a constant, so a result cached for an
+ *        earlier implementation under the same variant number stands out
+ */
+static MathResult system_self_test_constant_compute(const MathBinaryInput *input)
+{
+    (void)input;
+    return math_create_success_result(7, 1, 0.0);
+}
+
+#ifdef HAS_POSIX_THREADS
+/**
+ * @brief Registry reader run while the self-test registers and removes plugins
+ */
+typedef struct
+{
+    bool stop;
+    bool ok;
+    MathNatural rounds;
+    pthread_mutex_t lock;
+} SystemSelfTestRegistryReader;
+
+/**
+ * @brief Self-test registry reader thread: built-in lookups must never be
+ *        disturbed, and the plugin is either fully present or absent
+ */
+static void *system_self_test_registry_reader(void *arg)
+{
+    SystemSelfTestRegistryReader *reader = (SystemSelfTestRegistryReader *)arg;
+    bool ok = true;
+    for (MathNatural round = 0; ok; round++)
+    {
+        pthread_mutex_lock(&reader->lock);
+        bool stop = reader->stop;
+        reader->rounds = round;
+        pthread_mutex_unlock(&reader->lock);
+        if (stop)
+        {
+            break;
+        }
+
+        GcdAlgorithmVariant variant;
+        ok = gcd_registry_execute(GCD_BINARY_STEIN, 1071, 462).value == 21 &&
+             gcd_registry_get_implementation(GCD_EUCLIDEAN_MODULO) == &euclidean_modulo_spec &&
+             gcd_registry_find_variant("Stein Binary GCD", &variant) && variant == GCD_BINARY_STEIN;
+        if (ok && gcd_registry_find_variant("self_test_churn", &variant))
+        {
+            MathResult result = gcd_registry_execute(variant, 1071, 462);
+            ok = result.status == MATH_ERROR_NOT_IMPLEMENTED || MATH_ABS(result.value) == 21;
+        }
+    }
+
+    pthread_mutex_lock(&reader->lock);
+    reader->ok = ok;
+    pthread_mutex_unlock(&reader->lock);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief Self-test benchmark body: the first call is slow, the others are cheap
+ *
+ * Models a variant measured cold: a harness that calibrates on the first
+ * call would settle on a batch of 1.
+ *
+ * @param context Number of calls so far (MathNatural)
+ * @param repetitions Operations to run
+ */
+static void system_self_test_cold_body(void *context, MathNatural repetitions)
+{
+    MathNatural *calls = (MathNatural *)context;
+    if ((*calls)++ == 0)
+    {
+        double start_time = math_get_time_ms();
+        while (math_elapsed_time_ms(start_time, math_get_time_ms()) < 0.2)
+        {
+            BENCHMARK_CLOBBER_MEMORY();
+        }
+    }
+    for (MathNatural i = 0; i < repetitions; i++)
+    {
+        BENCHMARK_DO_NOT_OPTIMIZE(i);
+    }
+}
+
+/**
+ * @brief Run system self-test
+ *
+ * @return true if all tests pass
+ */
+bool system_self_test(void)
+{
+    printf("=== System Self-Test ===\n");
+
+    // Initialize system
+    if (system_init() != MATH_SUCCESS)
+    {
+        printf("✗ System initialization failed\n");
+        return false;
+    }
+    printf("✓ System initialization successful\n");
+
+    // Test registry
+    MathNatural algorithm_count = gcd_registry_get_count();
+    if (algorithm_count == 0)
+    {
+        printf("✗ No algorithms registered\n");
+        return false;
+    }
+    printf("✓ Registry loaded %lu algorithms\n", (unsigned long)algorithm_count);
+
+    // Test basic computation
+    GcdInteger test_result = system_quick_gcd(48, 18);
+    if (test_result != 6)
+    {
+        printf("✗ Basic computation failed: expected 6, got %lld\n", (long long)test_result);
+        return false;
+    }
+    printf("✓ Basic computation successful: gcd(48, 18) = %lld\n", (long long)test_result);
+
+    // Test consistency
+    MathNatural comparison_count = system_compare_all_algorithms(48, 18, false);
+    if (comparison_count == 0)
+    {
+        printf("✗ Algorithm comparison failed\n");
+        return false;
     }
     printf("✓ Algorithm comparison successful: %lu algorithms tested\n", (unsigned long)comparison_count);
 
+    // Test batch execution against the reference implementation
+    GcdInteger batch_a[] = {48, 0, -270, 1071, 17, 1 << 20};
+    GcdInteger batch_b[] = {18, 35, 192, 462, 0, 3 << 12};
+    GcdInteger batch_out[6];
+    MathNatural batch_size = sizeof(batch_a) / sizeof(batch_a[0]);
+
+    GcdAlgorithmVariant variants[GCD_VARIANT_CAPACITY];
+    MathNatural variant_count = gcd_registry_list_variants(variants, GCD_VARIANT_CAPACITY);
+    for (MathNatural v = 0; v < variant_count; v++)
+    {
+        MathResult batch_result = system_execute_gcd_batch(variants[v], batch_a, batch_b, batch_out, batch_size);
+        if (!MATH_IS_VALID_RESULT(batch_result))
+        {
+            printf("✗ Batch execution failed for %s\n", gcd_registry_get_display_name(variants[v]));
+            return false;
+        }
+        for (MathNatural i = 0; i < batch_size; i++)
+        {
+            if (batch_out[i] != gcd_reference_implementation(batch_a[i], batch_b[i]))
+            {
+                printf("✗ Batch result mismatch for %s: gcd(%lld, %lld) = %lld\n",
+                       gcd_registry_get_display_name(variants[v]),
+                       (long long)batch_a[i], (long long)batch_b[i], (long long)batch_out[i]);
+                return false;
+            }
+        }
+    }
+    printf("✓ Batch execution successful: %lu algorithms x %lu pairs\n",
+           (unsigned long)variant_count, (unsigned long)batch_size);
+
+    // Test Bezout coefficients from the extended batch path: a*x + b*y = gcd
+    GcdInteger batch_x[6], batch_y[6];
+    MathNatural extended_count = 0;
+    for (MathNatural v = 0; v < variant_count; v++)
+    {
+        if (!GCD_VARIANT_HAS_COEFFICIENTS(variants[v]))
+        {
+            continue;
+        }
+        MathResult extended_result = system_execute_extended_gcd_batch(
+            variants[v], batch_a, batch_b, batch_out, batch_x, batch_y, batch_size);
+        if (!MATH_IS_VALID_RESULT(extended_result))
+        {
+            printf("✗ Extended batch execution failed for %s\n", gcd_registry_get_display_name(variants[v]));
+            return false;
+        }
+        for (MathNatural i = 0; i < batch_size; i++)
+        {
+            if (batch_out[i] != gcd_reference_implementation(batch_a[i], batch_b[i]) ||
+                batch_a[i] * batch_x[i] + batch_b[i] * batch_y[i] != batch_out[i])
+            {
+                printf("✗ Extended batch mismatch for %s: %lld*%lld + %lld*%lld != %lld\n",
+                       gcd_registry_get_display_name(variants[v]),
+                       (long long)batch_a[i], (long long)batch_x[i],
+                       (long long)batch_b[i], (long long)batch_y[i], (long long)batch_out[i]);
+                return false;
+            }
+        }
+        extended_count++;
+    }
+    printf("✓ Extended batch execution successful: %lu algorithms with Bezout coefficients\n",
+           (unsigned long)extended_count);
+
+    // Test parallel batch execution against the serial batch path
+    MathNatural parallel_size = 4 * SYSTEM_BATCH_CHUNK_SIZE + 17;
+    GcdInteger *parallel_buffer = (GcdInteger *)malloc(6 * parallel_size * sizeof(GcdInteger));
+    if (parallel_buffer == NULL)
+    {
+        printf("✗ Could not allocate parallel test buffers\n");
+        return false;
+    }
+    GcdInteger *parallel_a = parallel_buffer;
+    GcdInteger *parallel_b = parallel_buffer + parallel_size;
+    GcdInteger *serial_out = parallel_buffer + 2 * parallel_size;
+    GcdInteger *parallel_out = parallel_buffer + 3 * parallel_size;
+    GcdInteger *parallel_pairs = parallel_buffer + 4 * parallel_size;
+    for (MathNatural i = 0; i < parallel_size; i++)
+    {
+        parallel_a[i] = (GcdInteger)(i * 2654435761u % 1000003u);
+        parallel_b[i] = (GcdInteger)((i + 7) * 40503u % 65537u);
+        parallel_pairs[2 * i] = parallel_a[i];
+        parallel_pairs[2 * i + 1] = parallel_b[i];
+    }
+    system_execute_gcd_batch(GCD_BINARY_STEIN, parallel_a, parallel_b, serial_out, parallel_size);
+    MathResult parallel_result = system_execute_gcd_batch_parallel(
+        GCD_BINARY_STEIN, parallel_a, parallel_b, parallel_out, parallel_size, 4);
+    bool parallel_ok = MATH_IS_VALID_RESULT(parallel_result) &&
+                       memcmp(serial_out, parallel_out, parallel_size * sizeof(GcdInteger)) == 0;
+
+    // The same batch as interleaved (AoS) pairs, gathered chunk by chunk
+    memory_clear(parallel_out, parallel_size * sizeof(GcdInteger));
+    MathResult interleaved_result = system_execute_gcd_batch_interleaved(
+        GCD_BINARY_STEIN, parallel_pairs, parallel_out, parallel_size, 4);
+    bool interleaved_ok = MATH_IS_VALID_RESULT(interleaved_result) &&
+                          memcmp(serial_out, parallel_out, parallel_size * sizeof(GcdInteger)) == 0;
+    // Repeated batches reuse the resident workers instead of starting threads
+    MathNatural resident_threads = batch_pool_thread_count();
+    bool resident_ok = true;
+    for (int round = 0; round < 20 && resident_ok; round++)
+    {
+        parallel_result = system_execute_gcd_batch_parallel(
+            GCD_BINARY_STEIN, parallel_a, parallel_b, parallel_out, parallel_size, 4);
+        resident_ok = MATH_IS_VALID_RESULT(parallel_result) && batch_pool_thread_count() == resident_threads &&
+                  memcmp(serial_out, parallel_out, parallel_size * sizeof(GcdInteger)) == 0;
+    }
+    free(parallel_buffer);
+    if (!parallel_ok)
+    {
+        printf("✗ Parallel batch execution disagrees with serial batch\n");
+        return false;
+    }
+    if (!interleaved_ok)
+    {
+        printf("✗ Interleaved batch execution disagrees with serial batch\n");
+        return false;
+    }
+    if (!resident_ok)
+    {
+        printf("✗ Repeated parallel batches did not reuse the resident workers\n");
+        return false;
+    }
+    printf("✓ Parallel batch execution successful: %lu pairs on 4 workers (SoA and AoS), %lu resident threads\n",
+           (unsigned long)parallel_size, (unsigned long)resident_threads);
+
+    // Test n-ary reduction: every variant on a short array, then the pool on a long one
+    GcdInteger reduce_values[37];
+    for (MathNatural i = 0; i < 37; i++)
+    {
+        reduce_values[i] = (GcdInteger)(360 * ((i * 7919) % 1009 + 1)) * ((i % 3 == 0) ? -1 : 1);
+    }
+    reduce_values[5] = 0;
+    reduce_values[36] = 360 * 1013;
+    for (MathNatural v = 0; v < variant_count; v++)
+    {
+        MathResult reduce_result = system_execute_gcd_reduce(variants[v], reduce_values, 37);
+        if (!MATH_IS_VALID_RESULT(reduce_result) || reduce_result.value != 360)
+        {
+            printf("✗ Reduction failed for %s: got %lld, expected 360\n",
+                   gcd_registry_get_display_name(variants[v]), (long long)reduce_result.value);
+            return false;
+        }
+    }
+
+    MathNatural reduce_size = 6 * SYSTEM_BATCH_CHUNK_SIZE + 5;
+    GcdInteger *reduce_buffer = (GcdInteger *)malloc(reduce_size * sizeof(GcdInteger));
+    if (reduce_buffer == NULL)
+    {
+        printf("✗ Could not allocate reduction test buffer\n");
+        return false;
+    }
+    for (MathNatural i = 0; i < reduce_size; i++)
+    {
+        reduce_buffer[i] = (GcdInteger)(1001 * (i % 65521 + 1));
+    }
+    MathResult common_result = system_execute_gcd_reduce_parallel(GCD_BINARY_STEIN, reduce_buffer, reduce_size, 4);
+    reduce_buffer[3 * SYSTEM_BATCH_CHUNK_SIZE + 1] = 1003;
+    MathResult identity_result = system_execute_gcd_reduce_parallel(GCD_BINARY_STEIN, reduce_buffer, reduce_size, 4);
+    free(reduce_buffer);
+    if (!MATH_IS_VALID_RESULT(common_result) || common_result.value != 1001 ||
+        common_result.iterations != reduce_size ||
+        !MATH_IS_VALID_RESULT(identity_result) || identity_result.value != GCD_IDENTITY)
+    {
+        printf("✗ Parallel reduction failed\n");
+        return false;
+    }
+    printf("✓ Reduction successful: %lu algorithms, %lu values on 4 workers\n",
+           (unsigned long)variant_count, (unsigned long)reduce_size);
+
+    // Test arbitrary-precision algorithms: gcd(M127 * M89, M127 * M61) = M127
+    MathLimb big_storage[8 * 16];
+    MathBigInteger big_g, big_x, big_y, big_a, big_b, big_out, big_cx, big_cy;
+    MathBigInteger *big_values[] = {&big_g, &big_x, &big_y, &big_a, &big_b, &big_out, &big_cx, &big_cy};
+    for (MathNatural i = 0; i < 8; i++)
+    {
+        bignum_init_buffer(big_values[i], big_storage + 16 * i, 16);
+    }
+    bignum_from_string(&big_g, "170141183460469231731687303715884105727");
+    bignum_from_string(&big_x, "0x1ffffffffffffffffffffff");
+    bignum_from_string(&big_y, "2305843009213693951");
+    bignum_mul(&big_a, &big_g, &big_x);
+    bignum_mul(&big_b, &big_g, &big_y);
+
+    GcdAlgorithmVariant big_variants[GCD_VARIANT_CAPACITY];
+    MathNatural big_count = mdc_analyzer_list_big_variants(big_variants, GCD_VARIANT_CAPACITY);
+    for (MathNatural v = 0; v < big_count; v++)
+    {
+        MathBigBinaryInput big_input = MATH_BIG_BINARY_INPUT_INIT(&big_a, &big_b, &big_out);
+        big_input.coefficient_x = &big_cx;
+        big_input.coefficient_y = &big_cy;
+        MathResult big_result = system_execute_gcd_big(big_variants[v], &big_input);
+        if (!MATH_IS_VALID_RESULT(big_result) || bignum_compare(&big_out, &big_g) != 0)
+        {
+            printf("✗ Bignum GCD failed for %s\n", mdc_analyzer_get_algorithm_name(big_variants[v]));
+            return false;
+        }
+    }
+
+    // Bezout identity from the extended variant: a*x + b*y = g (reuse x, y as products)
+    bignum_mul(&big_x, &big_a, &big_cx);
+    bignum_mul(&big_y, &big_b, &big_cy);
+    bignum_add(&big_x, &big_x, &big_y);
+    if (bignum_compare(&big_x, &big_g) != 0)
+    {
+        printf("✗ Bignum Extended Euclidean coefficients do not satisfy a*x + b*y = gcd\n");
+        return false;
+    }
+    printf("✓ Bignum execution successful: %lu algorithms on %lu-bit operands\n",
+           (unsigned long)big_count, (unsigned long)bignum_bit_length(&big_a));
+
+    // Test the half-GCD past its recursion threshold: gcd(g * u, g * v) for
+    // random 2048-bit g and 20480-bit u, v, against Lehmer, with coefficients
+    MemoryArena hgcd_arena;
+    if (memory_arena_init(&hgcd_arena, 16 * 1024 * sizeof(MathLimb)) != MATH_SUCCESS)
+    {
+        printf("✗ Could not allocate half-GCD operands\n");
+        return false;
+    }
+    MathBigInteger hgcd_g, hgcd_u, hgcd_v, hgcd_a[2], hgcd_out[2], hgcd_cx, hgcd_cy, hgcd_check[2];
+    GcdRandom hgcd_rng;
+    gcd_random_seed(&hgcd_rng, 28);
+    bool hgcd_ok = gcd_generate_big_pairs(&hgcd_rng, 2048, &hgcd_arena, &hgcd_g, &hgcd_check[0], 1) == MATH_SUCCESS &&
+                   gcd_generate_big_pairs(&hgcd_rng, 20480, &hgcd_arena, &hgcd_u, &hgcd_v, 1) == MATH_SUCCESS;
+    MathNatural hgcd_limbs = hgcd_g.size + hgcd_u.size + 1;
+    for (MathNatural i = 0; i < 2 && hgcd_ok; i++)
+    {
+        hgcd_ok = bignum_alloc(&hgcd_a[i], &hgcd_arena, hgcd_limbs) == MATH_SUCCESS &&
+                  bignum_alloc(&hgcd_out[i], &hgcd_arena, hgcd_limbs) == MATH_SUCCESS &&
+                  bignum_alloc(&hgcd_check[i], &hgcd_arena, 2 * hgcd_limbs) == MATH_SUCCESS;
+    }
+    hgcd_ok = hgcd_ok && bignum_alloc(&hgcd_cx, &hgcd_arena, hgcd_limbs) == MATH_SUCCESS &&
+              bignum_alloc(&hgcd_cy, &hgcd_arena, hgcd_limbs) == MATH_SUCCESS &&
+              bignum_mul(&hgcd_a[0], &hgcd_g, &hgcd_u) == MATH_SUCCESS &&
+              bignum_mul(&hgcd_a[1], &hgcd_g, &hgcd_v) == MATH_SUCCESS;
+    if (hgcd_ok)
+    {
+        hgcd_a[1].negative = true;
+        MathBigBinaryInput lehmer_input = MATH_BIG_BINARY_INPUT_INIT(&hgcd_a[0], &hgcd_a[1], &hgcd_out[0]);
+        MathBigBinaryInput hgcd_input = MATH_BIG_BINARY_INPUT_INIT(&hgcd_a[0], &hgcd_a[1], &hgcd_out[1]);
+        hgcd_input.coefficient_x = &hgcd_cx;
+        hgcd_input.coefficient_y = &hgcd_cy;
+        hgcd_ok = MATH_IS_VALID_RESULT(system_execute_gcd_big(GCD_BIGNUM_LEHMER, &lehmer_input)) &&
+                  MATH_IS_VALID_RESULT(system_execute_gcd_big(GCD_BIGNUM_HALF_GCD, &hgcd_input)) &&
+                  bignum_compare(&hgcd_out[0], &hgcd_out[1]) == 0;
+    }
+    if (hgcd_ok)
+    {
+        // a*x + b*y = g with b negative
+        bignum_mul(&hgcd_check[0], &hgcd_a[0], &hgcd_cx);
+        bignum_mul(&hgcd_check[1], &hgcd_a[1], &hgcd_cy);
+        bignum_add(&hgcd_check[0], &hgcd_check[0], &hgcd_check[1]);
+        hgcd_ok = bignum_compare(&hgcd_check[0], &hgcd_out[1]) == 0;
+    }
+    memory_arena_destroy(&hgcd_arena);
+    if (!hgcd_ok)
+    {
+        printf("✗ Bignum half-GCD disagrees with Lehmer or its coefficients do not satisfy a*x + b*y = gcd\n");
+        return false;
+    }
+    printf("✓ Half-GCD successful: matches Lehmer with Bezout coefficients on %lu-limb operands\n",
+           (unsigned long)(hgcd_limbs - 1));
+
+    // Test batch GCD: moduli built from 31-bit primes, some shared between moduli
+    static const GcdInteger p[] = {2147483647, 2147483629, 2147483587, 2147483579,
+                                   2147483563, 2147483549, 2147483543, 2147483497};
+    const GcdInteger batch_moduli[9] = {p[0] * p[1], p[2] * p[3], p[4] * p[5], p[0] * p[6], p[7] * p[1],
+                                        p[2] * 5, 7 * 11, 13 * 17, p[5] * p[6]};
+    const GcdInteger batch_expected[9] = {p[0] * p[1], p[2], p[5], p[0] * p[6], p[1],
+                                          p[2], 1, 1, p[5] * p[6]};
+    GcdInteger batch_gcds[9];
+
+    BatchGcdConfig batch_config = BATCH_GCD_CONFIG_INIT;
+    batch_config.thread_count = 4;
+    BatchGcdStats batch_stats;
+    MathStatus batch_status = batch_gcd_compute_words(batch_moduli, 9, batch_gcds, &batch_config, &batch_stats);
+    if (batch_status != MATH_SUCCESS || memcmp(batch_gcds, batch_expected, sizeof(batch_expected)) != 0)
+    {
+        printf("✗ Batch GCD did not recover the shared factors\n");
+        return false;
+    }
+    printf("✓ Batch GCD successful: %lu of 9 moduli share a factor (%lu tree levels)\n",
+           (unsigned long)batch_stats.shared_count, (unsigned long)batch_stats.tree_levels);
+
+    // Test modular inversion: single, batched modulo M61 = 2^61 - 1, and a non-invertible value
+    const GcdInteger m61 = 2305843009213693951LL;
+    const GcdInteger inv_values[5] = {3, -5, 1234567891011LL, m61 - 1, 1LL << 60};
+    GcdInteger inv_out[5];
+    GcdInteger single_inverse = 0;
+    bool inverse_ok = system_modinv(3, 11, &single_inverse) == MATH_SUCCESS && single_inverse == 4 &&
+                      system_modinv(6, 9, &single_inverse) == MATH_ERROR_NO_SOLUTION &&
+                      system_modinv_batch(inv_values, inv_out, 5, m61) == MATH_SUCCESS;
+    for (MathNatural i = 0; inverse_ok && i < 5; i++)
+    {
+        GcdInteger reduced = ((inv_values[i] % m61) + m61) % m61;
+        inverse_ok = math_mul_mod((MathNatural)reduced, (MathNatural)inv_out[i], (MathNatural)m61) == 1;
+    }
+    if (!inverse_ok)
+    {
+        printf("✗ Modular inversion failed\n");
+        return false;
+    }
+
+    // Test CRT: coprime moduli, non-coprime moduli and an inconsistent system
+    const GcdInteger crt_residues[3] = {2, 3, 2};
+    const GcdInteger crt_moduli[3] = {3, 5, 7};
+    const GcdInteger shared_residues[2] = {1, 3};
+    const GcdInteger shared_moduli[2] = {4, 6};
+    const GcdInteger conflicting_residues[2] = {1, 2};
+    GcdInteger crt_value = 0, crt_modulus = 0, shared_value = 0, shared_modulus = 0;
+    bool crt_ok = system_crt_combine(crt_residues, crt_moduli, 3, &crt_value, &crt_modulus) == MATH_SUCCESS &&
+                  crt_value == 23 && crt_modulus == 105 &&
+                  system_crt_combine(conflicting_residues, shared_moduli, 2, &shared_value, &shared_modulus) ==
+                      MATH_ERROR_NO_SOLUTION &&
+                  system_crt_combine(shared_residues, shared_moduli, 2, &shared_value, &shared_modulus) ==
+                      MATH_SUCCESS &&
+                  shared_value == 9 && shared_modulus == 12;
+    if (!crt_ok)
+    {
+        printf("✗ CRT recombination failed\n");
+        return false;
+    }
+    printf("✓ Modular inverse and CRT successful: 5 inverses mod 2^61 - 1, x = %lld (mod %lld)\n",
+           (long long)crt_value, (long long)crt_modulus);
+
+    // Test the stream pipeline: separators, comments, a missing final newline, 64-bit extremes
+    static const char stream_input[] = "48 18\n# comment\n\n  -12,\t-8\r\n9223372036854775807 7\n"
+                                       "-9223372036854775807 -1\n0 5";
+    static const char stream_expected[] = "6\n4\n7\n1\n5\n";
+    FILE *stream_in = tmpfile();
+    FILE *stream_out = tmpfile();
+    GcdStreamOptions stream_options = GCD_STREAM_OPTIONS_INIT;
+    stream_options.variant = GCD_BINARY_STEIN_CTZ;
+    stream_options.batch_pairs = 2;
+    stream_options.thread_count = 1;
+    GcdStreamStats stream_stats;
+    char stream_text[64] = {0};
+    bool stream_ok = stream_in != NULL && stream_out != NULL &&
+                     fputs(stream_input, stream_in) >= 0 && fseek(stream_in, 0, SEEK_SET) == 0 &&
+                     system_stream_gcd(stream_in, stream_out, &stream_options, &stream_stats) == MATH_SUCCESS &&
+                     fseek(stream_out, 0, SEEK_SET) == 0 &&
+                     fread(stream_text, 1, sizeof(stream_text) - 1, stream_out) == strlen(stream_expected) &&
+                     strcmp(stream_text, stream_expected) == 0 && stream_stats.pairs == 5 && stream_stats.lines == 7;
+    if (stream_in != NULL)
+    {
+        fclose(stream_in);
+    }
+    if (stream_out != NULL)
+    {
+        fclose(stream_out);
+    }
+    if (!stream_ok)
+    {
+        printf("✗ Stream pipeline failed\n");
+        return false;
+    }
+    printf("✓ Stream pipeline successful: %lu pairs from %lu lines\n",
+           (unsigned long)stream_stats.pairs, (unsigned long)stream_stats.lines);
+
+    // Test the dataset header: round trip, and rejection of sizes that disagree with the count
+    GcdDatasetHeader dataset_header = {.count = 3, .width_bits = GCD_DATASET_WIDTH_BITS, .layout = GCD_DATASET_SOA};
+    GcdDatasetHeader decoded_header;
+    unsigned char header_bytes[GCD_DATASET_HEADER_SIZE];
+    size_t dataset_size = 0;
+    gcd_dataset_encode_header(&dataset_header, header_bytes);
+    bool dataset_ok = gcd_dataset_file_size(&dataset_header, &dataset_size) == MATH_SUCCESS &&
+                      dataset_size == GCD_DATASET_HEADER_SIZE + 6 * sizeof(GcdInteger) &&
+                      gcd_dataset_decode_header(header_bytes, dataset_size, &decoded_header) == MATH_SUCCESS &&
+                      decoded_header.count == 3 && decoded_header.layout == GCD_DATASET_SOA &&
+                      gcd_dataset_decode_header(header_bytes, dataset_size - 8, &decoded_header) ==
+                          MATH_ERROR_INVALID_INPUT;
+    if (!dataset_ok)
+    {
+        printf("✗ Dataset header round trip failed\n");
+        return false;
+    }
+    printf("✓ Dataset header round trip successful\n");
+
+    // Test the thread scratch pool: scopes reuse one block, a nested scope without room gets its own
+    MemoryScratch outer_scope;
+    MemoryScratch inner_scope;
+    MemoryArena *outer_arena = memory_scratch_begin(&outer_scope, 4096);
+    void *outer_block = outer_arena != NULL ? memory_arena_alloc(outer_arena, 4096, 1) : NULL;
+    MemoryArena *inner_arena = memory_scratch_begin(&inner_scope, 2 * memory_thread_arena_capacity());
+    bool pool_ok = outer_block != NULL && inner_arena != NULL && inner_arena != outer_arena;
+    memory_scratch_end(&inner_scope);
+    memory_scratch_end(&outer_scope);
+    outer_arena = memory_scratch_begin(&outer_scope, 4096);
+    pool_ok = pool_ok && outer_arena != NULL && memory_arena_alloc(outer_arena, 4096, 1) == outer_block;
+    memory_scratch_end(&outer_scope);
+    if (!pool_ok)
+    {
+        printf("✗ Thread scratch pool failed\n");
+        return false;
+    }
+    printf("✓ Thread scratch pool successful: %lu KiB block reused across scopes\n",
+           (unsigned long)(memory_thread_arena_capacity() >> 10));
+
+    // Test the harness calibration: a cold first call must not fix the batch
+    // size, and a variant's batch must not depend on what was measured before
+    BenchmarkConfig harness_config = BENCHMARK_CONFIG_INIT;
+    harness_config.sample_count = 50;
+    BenchmarkStats harness_stats;
+    MathNatural cold_calls = 0;
+    bool harness_ok = benchmark_run(system_self_test_cold_body, &cold_calls, &harness_config, &harness_stats) ==
+                      MATH_SUCCESS;
+    MathNatural cold_batch = harness_stats.batch_size;
+    harness_ok = harness_ok && cold_batch > 1;
+    const GcdAlgorithmVariant harness_order[4] = {GCD_EUCLIDEAN_MODULO, GCD_BINARY_STEIN, GCD_BINARY_STEIN,
+                                                  GCD_EUCLIDEAN_MODULO};
+    const GcdInteger harness_a = 1071;
+    const GcdInteger harness_b = 462;
+    MathNatural harness_batch[4] = {0};
+    for (int i = 0; i < 4 && harness_ok; i++)
+    {
+        harness_ok = mdc_analyzer_benchmark_pairs(harness_order[i], &harness_a, &harness_b, 1, &harness_config,
+                                                  &harness_stats) == MATH_SUCCESS;
+        harness_batch[i] = harness_stats.batch_size;
+    }
+    // Same variant in both orders (0 and 3, 1 and 2): within a factor of 4
+    harness_ok = harness_ok && harness_batch[0] <= 4 * harness_batch[3] && harness_batch[3] <= 4 * harness_batch[0] &&
+                 harness_batch[1] <= 4 * harness_batch[2] && harness_batch[2] <= 4 * harness_batch[1];
+    if (!harness_ok)
+    {
+        printf("✗ Benchmark harness calibration failed (cold batch %lu, batches %lu/%lu and %lu/%lu)\n",
+               (unsigned long)cold_batch, (unsigned long)harness_batch[0],
+               (unsigned long)harness_batch[3], (unsigned long)harness_batch[1], (unsigned long)harness_batch[2]);
+        return false;
+    }
+    printf("✓ Benchmark harness calibration successful: batches stable across variant order\n");
+
+    // Test the lookup table against plain modulo: every table entry, then reduced 16-bit pairs
+    bool table_ok = true;
+    for (GcdInteger x = 0; x < 256 && table_ok; x++)
+    {
+        for (GcdInteger y = 0; y < 256; y++)
+        {
+            if (mdc_table(x, y) != mdc_modulo(x, y) || (x > 0 && mdc_table(-x, y) != mdc_modulo(x, y)))
+            {
+                table_ok = false;
+                break;
+            }
+        }
+    }
+    for (GcdInteger x = 65535; x > 60000 && table_ok; x -= 7)
+    {
+        GcdInteger y = (x * 40503) & 0xFFFF;
+        table_ok = mdc_table(x, y) == mdc_modulo(x, y) &&
+                   system_execute_gcd(GCD_AUTO, x, y).value == mdc_modulo(x, y) &&
+                   mdc_table(x << 40, y << 20) == mdc_modulo(x << 40, y << 20);
+    }
+    if (!table_ok)
+    {
+        printf("✗ Small-operand lookup table failed\n");
+        return false;
+    }
+    printf("✓ Small-operand lookup table successful: all pairs below %u checked\n", 1u << GCD_TABLE_BITS);
+
+    // Test the inline kernels at every width against the registered modulo kernel
+    bool inline_ok = true;
+    for (GcdInteger i = 1; i <= 1000 && inline_ok; i++)
+    {
+        GcdInteger a = (GcdInteger)(((MathNatural)i * 2654435761u) & 0x7FFFFFFF);
+        GcdInteger b = (GcdInteger)(((MathNatural)i * 40503u + 977u) & 0xFFFFFF);
+        GcdInteger g = mdc_modulo(a, b);
+        GcdInteger x = 0;
+        GcdInteger y = 0;
+        int32_t x32 = 0;
+        int32_t y32 = 0;
+        uint32_t wide_a = UINT32_MAX - (uint32_t)i;
+        uint32_t wide_g = gcd_inline_extended_u32(wide_a, (uint32_t)b, &x32, &y32);
+
+        inline_ok = gcd_inline_modulo_u32((uint32_t)a, (uint32_t)b) == (uint32_t)g &&
+                    gcd_inline_stein_u32((uint32_t)a, (uint32_t)b) == (uint32_t)g &&
+                    gcd_inline_modulo_u64((uint64_t)a << 32, (uint64_t)b << 32) == (uint64_t)g << 32 &&
+                    gcd_inline_stein_u64((uint64_t)a << 32, (uint64_t)b << 32) == (uint64_t)g << 32 &&
+                    gcd_inline_stein_i64(-a, b) == g &&
+                    gcd_inline_extended_i64(-a, b, &x, &y) == g && -a * x + b * y == g &&
+                    wide_g == gcd_inline_stein_u32(wide_a, (uint32_t)b) &&
+                    (int64_t)wide_a * x32 + b * (int64_t)y32 == (int64_t)wide_g;
+#ifdef GCD_INLINE_HAS_UINT128
+        unsigned __int128 big_a = (unsigned __int128)a << 90;
+        unsigned __int128 big_b = (unsigned __int128)b << 90;
+        __int128 big_x = 0;
+        __int128 big_y = 0;
+        inline_ok = inline_ok && gcd_inline_stein_u128(big_a, big_b) == (unsigned __int128)g << 90 &&
+                    gcd_inline_modulo_u128(big_a, big_b) == (unsigned __int128)g << 90 &&
+                    gcd_inline_extended_u128(big_a, big_b, &big_x, &big_y) == (unsigned __int128)g << 90 &&
+                    (__int128)a * big_x + (__int128)b * big_y == (__int128)g;
+#endif
+    }
+#ifdef GCD_INLINE_HAS_GENERIC
+    int32_t generic_x;
+    int32_t generic_y;
+    inline_ok = inline_ok && sizeof(gcd_inline_modulo(48u, 18u)) == sizeof(uint32_t) &&
+                sizeof(gcd_inline_stein((uint64_t)48, (uint64_t)18)) == sizeof(uint64_t) &&
+                gcd_inline_stein(-48, 18) == 6 && gcd_inline_extended(240u, 46u, &generic_x, &generic_y) == 2u &&
+                240 * generic_x + 46 * generic_y == 2;
+#endif
+    if (!inline_ok)
+    {
+        printf("✗ Inline kernels failed\n");
+        return false;
+    }
+    printf("✓ Inline kernels successful: %s widths agree with %s\n",
+#ifdef GCD_INLINE_HAS_UINT128
+           "32-, 64- and 128-bit",
+#else
+           "32- and 64-bit",
+#endif
+           mdc_analyzer_get_algorithm_name(GCD_EUCLIDEAN_MODULO));
+
+    // Test the result cache: a repeated pair hits with the variant's own result, other variants miss
+    GcdInteger cache_x = 0;
+    GcdInteger cache_y = 0;
+    bool cache_ok = system_set_result_cache(64) == MATH_SUCCESS;
+    MathResult first = system_execute_gcd(GCD_EUCLIDEAN_MODULO, 48, -18);
+    MathResult other = system_execute_gcd(GCD_BINARY_STEIN, 48, -18);
+    MathResult repeat = system_execute_gcd(GCD_EUCLIDEAN_MODULO, 48, -18);
+    ExtendedGcdResult ext_first = system_execute_extended_gcd(-46, 240, &cache_x, &cache_y);
+    ExtendedGcdResult ext_repeat = system_execute_extended_gcd(-46, 240, &cache_x, &cache_y);
+    GcdCacheStats cache_stats;
+    gcd_cache_get_stats(&cache_stats);
+    cache_ok = cache_ok && first.value == mdc_modulo(48, -18) && other.value == 6 && repeat.value == first.value &&
+               ext_first.gcd == ext_repeat.gcd && MATH_ABS(ext_repeat.gcd) == 2 &&
+               -46 * cache_x + 240 * cache_y == ext_repeat.gcd && cache_stats.hits == 2 && cache_stats.misses == 3;
+    system_set_result_cache(0);
+    if (!cache_ok)
+    {
+        printf("✗ Result cache failed\n");
+        return false;
+    }
+    printf("✓ Result cache successful: repeated pairs answered with each variant's own result\n");
+
+    // Test production mode: bare kernels agree with the instrumented path on every sign and zero
+    GcdInteger production_a[] = {1071, -48, 0, -35, 0, 123456, 17, 1 << 20};
+    GcdInteger production_b[] = {-462, 18, 35, 0, 0, 7890, 31, 3 << 12};
+    const MathNatural production_count = sizeof(production_a) / sizeof(production_a[0]);
+    GcdInteger production_out[sizeof(production_a) / sizeof(production_a[0])];
+    bool production_ok = true;
+    MathNatural production_variants = 0;
+    for (unsigned int v = 0; v < GCD_VARIANT_COUNT && production_ok; v++)
+    {
+        GcdAlgorithmVariant variant = (GcdAlgorithmVariant)v;
+        if (gcd_registry_get_kernel(variant) == NULL)
+        {
+            production_ok = system_gcd(variant, 48, 18) == MATH_INVALID_VALUE;
+            continue;
+        }
+        production_variants++;
+        production_ok = system_gcd_batch(variant, production_a, production_b, production_out, production_count) ==
+                        MATH_SUCCESS;
+        for (MathNatural i = 0; i < production_count && production_ok; i++)
+        {
+            MathResult expected = system_execute_gcd(variant, production_a[i], production_b[i]);
+            production_ok = MATH_IS_VALID_RESULT(expected) &&
+                            system_gcd(variant, production_a[i], production_b[i]) == MATH_ABS(expected.value) &&
+                            production_out[i] == MATH_ABS(expected.value);
+        }
+    }
+
+    // Switching the whole system over; an LLONG_MIN operand still fails
+    system_set_execution_mode(SYSTEM_MODE_PRODUCTION);
+    MathResult production_single = system_execute_gcd(GCD_AUTO, -1071, 462);
+    MathResult production_batch = system_execute_gcd_batch(GCD_EUCLIDEAN_MODULO, production_a, production_b,
+                                                           production_out, production_count);
+    MathResult production_rejected = system_execute_gcd(GCD_EUCLIDEAN_MODULO, LLONG_MIN, 6);
+    system_set_execution_mode(SYSTEM_MODE_INSTRUMENTED);
+    production_a[0] = LLONG_MIN;
+    production_ok = production_ok && production_single.value == 21 &&
+                    production_batch.value == (GcdInteger)production_count && production_out[0] == 21 && !MATH_IS_VALID_RESULT(production_rejected) &&
+                    system_gcd(GCD_EUCLIDEAN_MODULO, LLONG_MIN, 6) == MATH_INVALID_VALUE &&
+                    system_gcd_batch(GCD_EUCLIDEAN_MODULO, production_a, production_b, production_out,
+                                     production_count) == MATH_ERROR_INVALID_INPUT;
+    if (!production_ok)
+    {
+        printf("✗ Production mode failed\n");
+        return false;
+    }
+    printf("✓ Production mode successful: %lu bare kernels agree with the instrumented path\n",
+           (unsigned long)production_variants);
+
+    // Test every ISA copy of the batch kernels this CPU can run against the reference kernels
+    bool isa_ok = true;
+    MathNatural isa_levels = 0;
+    PlatformIsaLevel isa_active = gcd_isa_active_level();
+    for (int level = 0; level < PLATFORM_ISA_LEVEL_COUNT && isa_ok; level++)
+    {
+        if (gcd_isa_select_level((PlatformIsaLevel)level) != MATH_SUCCESS)
+        {
+            continue;
+        }
+        isa_levels++;
+        isa_ok = gcd_isa_batch_modulo(production_a, production_b, production_out, production_count) == 1 &&
+                 production_out[0] == MATH_INVALID_VALUE;
+        for (MathNatural i = 1; i < production_count && isa_ok; i++)
+        {
+            isa_ok = production_out[i] == MATH_ABS(mdc_modulo(production_a[i], production_b[i]));
+        }
+        isa_ok = isa_ok && gcd_isa_batch_stein(production_a, production_b, production_out, production_count) == 1;
+        for (MathNatural i = 1; i < production_count && isa_ok; i++)
+        {
+            isa_ok = production_out[i] == MATH_ABS(mdc_modulo(production_a[i], production_b[i]));
+        }
+    }
+    gcd_isa_select_level(isa_active);
+    if (!isa_ok)
+    {
+        printf("✗ ISA batch kernels failed\n");
+        return false;
+    }
+    printf("✓ ISA batch kernels successful: %lu level(s) agree, %s active\n", (unsigned long)isa_levels,
+           platform_isa_level_name(isa_active));
+
+    // Test runtime registration: a plugin joins the analyzer, name lookup and both execution modes
+    ImplementationSpec plugin = euclidean_modulo_spec;
+    snprintf(plugin.metadata.name, sizeof(plugin.metadata.name), "%s", "self_test_plugin");
+    GcdAlgorithmVariant builtin_variants[GCD_VARIANT_CAPACITY];
+    MathNatural builtin_count = mdc_analyzer_list_variants(builtin_variants, GCD_VARIANT_CAPACITY);
+    GcdAlgorithmVariant plugin_variant = GCD_AUTO;
+    GcdAlgorithmVariant duplicate_variant = GCD_AUTO;
+    GcdAlgorithmVariant found_variant = GCD_AUTO;
+    PerfCounterTotals plugin_counters;
+    bool plugin_ok = system_set_result_cache(64) == MATH_SUCCESS;
+    plugin_ok = plugin_ok && gcd_registry_register(&plugin, mdc_modulo, "Self-Test Plugin", GCD_REGISTRY_ROLE_WORD,
+                                           &plugin_variant) == MATH_SUCCESS &&
+                     (unsigned int)plugin_variant >= GCD_VARIANT_COUNT;
+    if (plugin_ok)
+    {
+        GcdAlgorithmVariant listed[GCD_VARIANT_CAPACITY];
+        MathNatural listed_count = mdc_analyzer_list_variants(listed, GCD_VARIANT_CAPACITY);
+        plugin_ok = gcd_registry_register(&plugin, NULL, NULL, 0, &duplicate_variant) == MATH_ERROR_INVALID_INPUT &&
+                    mdc_analyzer_get_implementation(plugin_variant) == &plugin &&
+                    gcd_registry_find_variant("self_test_plugin", &found_variant) && found_variant == plugin_variant &&
+                    listed_count == builtin_count + 1 && listed[builtin_count] == plugin_variant &&
+                    strcmp(mdc_analyzer_get_algorithm_name(plugin_variant), "Self-Test Plugin") == 0 &&
+                    MATH_ABS(system_execute_gcd(plugin_variant, 1071, -462).value) == 21 &&
+                    system_gcd(plugin_variant, -1071, 462) == 21;
+        plugin_ok = system_get_performance_counters(plugin_variant, &plugin_counters) == MATH_SUCCESS &&
+                    (plugin_counters.calls > 0 || !PERF_COUNTERS_ENABLED) && plugin_ok;
+        plugin_ok = gcd_registry_unregister(plugin_variant) == MATH_SUCCESS && plugin_ok;
+    }
+    // A later registration reuses the number: its counters must start from zero
+    plugin_ok = plugin_ok && system_get_performance_counters(plugin_variant, &plugin_counters) == MATH_SUCCESS &&
+                plugin_counters.calls == 0;
+    plugin_ok = plugin_ok && gcd_registry_get_implementation(plugin_variant) == NULL &&
+                !gcd_registry_find_variant("self_test_plugin", &found_variant) &&
+                mdc_analyzer_list_variants(builtin_variants, GCD_VARIANT_CAPACITY) == builtin_count &&
+                gcd_registry_unregister(GCD_AUTO) == MATH_ERROR_INVALID_INPUT;
+    // ...and it must not be answered from the removed plugin's cached results
+    ImplementationSpec reused_plugin = euclidean_modulo_spec;
+    snprintf(reused_plugin.metadata.name, sizeof(reused_plugin.metadata.name), "%s", "self_test_reused");
+    reused_plugin.compute = system_self_test_constant_compute;
+    reused_plugin.compute_batch = NULL;
+    reused_plugin.validate = NULL;
+    GcdAlgorithmVariant reused_variant = GCD_AUTO;
+    plugin_ok = plugin_ok && gcd_registry_register(&reused_plugin, NULL, NULL, 0, &reused_variant) == MATH_SUCCESS;
+    plugin_ok = plugin_ok && reused_variant == plugin_variant &&
+                system_execute_gcd(reused_variant, 1071, -462).value == 7;
+    plugin_ok = plugin_ok && gcd_registry_unregister(reused_variant) == MATH_SUCCESS;
+    system_set_result_cache(0);
+    if (!plugin_ok)
+    {
+        printf("✗ Runtime registration failed\n");
+        return false;
+    }
+    printf("✓ Runtime registration successful: a plugin was listed, found by name, run, removed and its counters "
+           "and cached results reset\n");
+
+    // Test concurrent registration: lookups on other threads stay consistent while plugins come and go
+    ImplementationSpec churn_plugin = euclidean_modulo_spec;
+    snprintf(churn_plugin.metadata.name, sizeof(churn_plugin.metadata.name), "%s", "self_test_churn");
+    bool churn_ok = true;
+    MathNatural churn_rounds = 0;
+#ifdef HAS_POSIX_THREADS
+    SystemSelfTestRegistryReader readers[2];
+    pthread_t reader_threads[2];
+    MathNatural reader_count = 0;
+    for (; reader_count < 2; reader_count++)
+    {
+        SystemSelfTestRegistryReader *reader = &readers[reader_count];
+        reader->stop = false;
+        reader->ok = false;
+        reader->rounds = 0;
+        pthread_mutex_init(&reader->lock, NULL);
+        if (pthread_create(&reader_threads[reader_count], NULL, system_self_test_registry_reader, reader) != 0)
+        {
+            pthread_mutex_destroy(&reader->lock);
+            break;
+        }
+    }
+#endif
+    for (MathNatural round = 0; round < 500 && churn_ok; round++)
+    {
+        GcdAlgorithmVariant churn_variant = GCD_AUTO;
+        churn_ok = gcd_registry_register(&churn_plugin, mdc_modulo, NULL, GCD_REGISTRY_ROLE_WORD, &churn_variant) ==
+                       MATH_SUCCESS &&
+                   MATH_ABS(gcd_registry_execute(churn_variant, 1071, 462).value) == 21 &&
+                   gcd_registry_unregister(churn_variant) == MATH_SUCCESS;
+        churn_rounds++;
+    }
+#ifdef HAS_POSIX_THREADS
+    for (MathNatural r = 0; r < reader_count; r++)
+    {
+        pthread_mutex_lock(&readers[r].lock);
+        readers[r].stop = true;
+        pthread_mutex_unlock(&readers[r].lock);
+        pthread_join(reader_threads[r], NULL);
+        churn_ok = churn_ok && readers[r].ok && readers[r].rounds > 0;
+        pthread_mutex_destroy(&readers[r].lock);
+    }
+#endif
+    churn_ok = churn_ok && !gcd_registry_find_variant("self_test_churn", &found_variant) &&
+               mdc_analyzer_list_variants(builtin_variants, GCD_VARIANT_CAPACITY) == builtin_count;
+    if (!churn_ok)
+    {
+        printf("✗ Concurrent registration failed\n");
+        return false;
+    }
+    printf("✓ Concurrent registration successful: %lu register/remove rounds while lookups ran\n",
+           (unsigned long)churn_rounds);
+
+    // Test the unsigned paths: full 64-bit range, then 128-bit operands where the compiler has them
+    static const GcdAlgorithmVariant unsigned_variants[] = {GCD_EUCLIDEAN_MODULO, GCD_BINARY_STEIN_CTZ, GCD_AUTO};
+    const MathNatural unsigned_variant_count = sizeof(unsigned_variants) / sizeof(unsigned_variants[0]);
+    bool unsigned_ok = true;
+    uint64_t unsigned_seed = 0x9E3779B97F4A7C15ull;
+    for (MathNatural i = 0; i < 1000 && unsigned_ok; i++)
+    {
+        unsigned_seed ^= unsigned_seed << 13;
+        unsigned_seed ^= unsigned_seed >> 7;
+        unsigned_seed ^= unsigned_seed << 17;
+        uint64_t x = unsigned_seed;
+        uint64_t y = (unsigned_seed * 0x2545F4914F6CDD1Dull) >> (i % 64);
+        uint64_t factor = (uint64_t)1 << (i % 24);
+        x = (x / factor) * factor;
+        y = (y / factor) * factor;
+        MathWideNatural expected = gcd_inline_modulo_u64(x, y);
+        for (MathNatural v = 0; v < unsigned_variant_count && unsigned_ok; v++)
+        {
+            MathUnsignedResult result = system_execute_gcd_unsigned(unsigned_variants[v], x, y);
+            unsigned_ok = result.is_valid && result.value == expected;
+            if (unsigned_ok && (x >> 63) == 0 && (y >> 63) == 0)
+            {
+                unsigned_ok = result.value == (MathWideNatural)mdc_modulo((GcdInteger)x, (GcdInteger)y);
+            }
+        }
+    }
+
+    // 2^63 has no signed magnitude: the signed path rejects what the unsigned one answers
+    MathWideNatural two_63 = (MathWideNatural)1 << 63;
+    unsigned_ok = unsigned_ok &&
+                  system_execute_gcd_unsigned(GCD_EUCLIDEAN_MODULO, two_63, 3u << 20).value == (1u << 20) &&
+                  system_execute_gcd_unsigned(GCD_BINARY_STEIN_CTZ, two_63, 0).value == two_63 &&
+                  system_execute_gcd_unsigned(GCD_AUTO, 0, 0).value == 0 &&
+                  !system_execute_gcd_unsigned(GCD_EXTENDED_EUCLIDEAN, 48, 18).is_valid;
+#if MATH_WIDE_BITS > 64
+    // gcd(3 * 2^90 * p, 2^100 * q) for coprime odd p, q spanning both words
+    MathWideNatural wide_a = ((MathWideNatural)3 << 90) * 0x1FFFFFFFull;
+    MathWideNatural wide_b = ((MathWideNatural)1 << 100) * 7u;
+    MathWideNatural wide_gcd = (MathWideNatural)1 << 90;
+    for (MathNatural v = 0; v < unsigned_variant_count && unsigned_ok; v++)
+    {
+        unsigned_ok = system_execute_gcd_unsigned(unsigned_variants[v], wide_a, wide_b).value == wide_gcd &&
+                      system_execute_gcd_unsigned(unsigned_variants[v], ~(MathWideNatural)0, ~(MathWideNatural)0 / 3)
+                              .value == ~(MathWideNatural)0 / 3;
+    }
+#endif
+    if (!unsigned_ok)
+    {
+        printf("✗ Unsigned paths failed\n");
+        return false;
+    }
+    printf("✓ Unsigned paths successful: 64-bit%s operands agree across Modulo, CTZ and Auto\n",
+           MATH_WIDE_BITS > 64 ? " and 128-bit" : "");
+
+    // Test submitted jobs: a full run with its callback, an exact pair budget, then cancel and timeout
+    MathNatural job_size = 3 * SYSTEM_BATCH_CHUNK_SIZE + 5;
+    GcdInteger *job_buffer = (GcdInteger *)malloc(3 * job_size * sizeof(GcdInteger));
+    if (job_buffer == NULL)
+    {
+        printf("✗ Could not allocate job test buffers\n");
+        return false;
+    }
+    GcdInteger *job_a = job_buffer;
+    GcdInteger *job_b = job_buffer + job_size;
+    GcdInteger *job_out = job_buffer + 2 * job_size;
+    for (MathNatural i = 0; i < job_size; i++)
+    {
+        job_a[i] = (GcdInteger)(i * 2654435761u % 1000003u);
+        job_b[i] = (GcdInteger)((i + 3) * 40503u % 65537u);
+    }
+
+    SystemSelfTestJobLog seen = {SYSTEM_JOB_RUNNING, 0};
+    SystemJobOptions job_options = SYSTEM_JOB_OPTIONS_INIT;
+    job_options.thread_count = 2;
+    job_options.on_complete = system_self_test_job_done;
+    job_options.user_data = &seen;
+    SystemJob *job = NULL;
+    MathResult job_result = MATH_RESULT_INIT(0);
+    bool job_ok = system_submit_batch(GCD_EUCLIDEAN_MODULO, job_a, job_b, job_out, job_size, &job_options, &job) ==
+                      MATH_SUCCESS &&
+                  system_job_wait(job, &job_result) == SYSTEM_JOB_COMPLETED;
+    system_job_release(job);
+    job_ok = job_ok && MATH_IS_VALID_RESULT(job_result) && job_result.value == (GcdInteger)job_size &&
+             seen.state == SYSTEM_JOB_COMPLETED && seen.calls == 1;
+    for (MathNatural i = 0; i < job_size && job_ok; i++)
+    {
+        job_ok = job_out[i] == mdc_modulo(job_a[i], job_b[i]);
+    }
+
+    // max_iterations truncates the chunk that crosses it; later pairs stay marked
+    MathNatural job_budget = SYSTEM_BATCH_CHUNK_SIZE + 100;
+    job_options.thread_count = 1;
+    job_options.config.max_iterations = job_budget;
+    job_ok = job_ok &&
+             system_submit_batch(GCD_EUCLIDEAN_MODULO, job_a, job_b, job_out, job_size, &job_options, &job) ==
+                 MATH_SUCCESS &&
+             system_job_wait(job, &job_result) == SYSTEM_JOB_LIMIT_REACHED;
+    system_job_release(job);
+    job_ok = job_ok && job_result.status == MATH_ERROR_LIMIT_REACHED && job_result.iterations == job_budget &&
+             seen.state == SYSTEM_JOB_LIMIT_REACHED && seen.calls == 2 &&
+             job_out[job_budget - 1] == mdc_modulo(job_a[job_budget - 1], job_b[job_budget - 1]) &&
+             job_out[job_budget] == MATH_INVALID_VALUE;
+
+    // Cancellation and timeouts race the workers: either the job stopped early or it had finished
+    job_options.config.max_iterations = 0;
+    for (int stop = 0; stop < 2 && job_ok; stop++)
+    {
+        job_options.config.timeout_ms = (stop == 0) ? 0.0 : 1e-6;
+        SystemJobState expected = (stop == 0) ? SYSTEM_JOB_CANCELLED : SYSTEM_JOB_TIMED_OUT;
+        job_ok = system_submit_batch(GCD_EUCLIDEAN_MODULO, job_a, job_b, job_out, job_size, &job_options, &job) ==
+                 MATH_SUCCESS;
+        if (!job_ok)
+        {
+            break;
+        }
+        if (stop == 0)
+        {
+            system_job_cancel(job);
+        }
+        SystemJobState state = system_job_wait(job, &job_result);
+        job_ok = system_job_poll(job, NULL) == state &&
+                 (state == expected ? job_result.status == (stop == 0 ? MATH_ERROR_CANCELLED : MATH_ERROR_TIMEOUT) &&
+                                          job_result.iterations < job_size
+                                    : state == SYSTEM_JOB_COMPLETED && MATH_IS_VALID_RESULT(job_result));
+        system_job_release(job);
+    }
+    job_ok = job_ok && seen.calls == 4 &&
+             system_submit_batch(GCD_EUCLIDEAN_MODULO, job_a, NULL, job_out, job_size, NULL, &job) ==
+                 MATH_ERROR_INVALID_INPUT &&
+             job == NULL;
+
+    // A burst of jobs shares the resident workers instead of starting threads of its own
+    SystemJob *burst[8] = {NULL};
+    MathNatural burst_count = sizeof(burst) / sizeof(burst[0]);
+    GcdInteger *burst_out = (GcdInteger *)malloc(burst_count * job_size * sizeof(GcdInteger));
+    MathNatural burst_threads = MATH_MAX(batch_pool_thread_count(), system_get_default_thread_count());
+    job_options = (SystemJobOptions)SYSTEM_JOB_OPTIONS_INIT;
+    job_options.thread_count = 2;
+    job_ok = job_ok && burst_out != NULL;
+    for (MathNatural j = 0; j < burst_count && job_ok; j++)
+    {
+        job_ok = system_submit_batch(GCD_EUCLIDEAN_MODULO, job_a, job_b, burst_out + j * job_size, job_size,
+                                     &job_options, &burst[j]) == MATH_SUCCESS;
+    }
+    for (MathNatural j = 0; j < burst_count; j++)
+    {
+        if (burst[j] != NULL)
+        {
+            job_ok = job_ok && system_job_wait(burst[j], &job_result) == SYSTEM_JOB_COMPLETED &&
+                     job_result.value == (GcdInteger)job_size &&
+                     burst_out[j * job_size + job_size - 1] == mdc_modulo(job_a[job_size - 1], job_b[job_size - 1]);
+            system_job_release(burst[j]);
+        }
+    }
+    job_ok = job_ok && batch_pool_thread_count() <= burst_threads;
+    free(burst_out);
+    free(job_buffer);
+    if (!job_ok)
+    {
+        printf("✗ Submitted jobs failed\n");
+        return false;
+    }
+    printf("✓ Submitted jobs successful: wait, callback, pair budget, cancel, timeout and a burst of %lu\n",
+           (unsigned long)burst_count);
+
+    // Test the resident server: a job-sized SoA request, then a small AoS one on the same connection
+#ifdef HAS_POSIX_THREADS
+    SystemSelfTestServer server;
+    memory_clear(&server, sizeof(server));
+    server.options = (GcdServeOptions)GCD_SERVE_OPTIONS_INIT;
+    server.options.address = "unix:gcd_analyzer_selftest.sock";
+    server.options.variant = GCD_EUCLIDEAN_MODULO;
+    server.options.connection_limit = 1;
+    server.options.on_ready = system_self_test_server_ready;
+    server.options.user_data = &server;
+    pthread_mutex_init(&server.lock, NULL);
+    pthread_cond_init(&server.changed, NULL);
+
+    pthread_t server_thread;
+    bool server_started = platform_sockets_supported() && gcd_protocol_host_supported() &&
+                          pthread_create(&server_thread, NULL, system_self_test_server_main, &server) == 0;
+    bool server_ok = true;
+    if (server_started)
+    {
+        pthread_mutex_lock(&server.lock);
+        while (!server.ready)
+        {
+            pthread_cond_wait(&server.changed, &server.lock);
+        }
+        pthread_mutex_unlock(&server.lock);
+
+        MathNatural server_pairs = 2 * SYSTEM_BATCH_CHUNK_SIZE + 3;
+        GcdInteger *server_buffer = (GcdInteger *)malloc(3 * server_pairs * sizeof(GcdInteger));
+        PlatformSocket client;
+        if (server.listening && server_buffer != NULL && platform_socket_connect(server.options.address, &client))
+        {
+            for (MathNatural i = 0; i < 2 * server_pairs; i++)
+            {
+                server_buffer[i] = (GcdInteger)((i + 1) * 2654435761u % 1000003u);
+            }
+            GcdRequestHeader soa = {.algorithm = GCD_PROTOCOL_DEFAULT_ALGORITHM, .layout = GCD_DATASET_SOA,
+                                    .count = server_pairs, .tag = 1};
+            GcdRequestHeader aos = {.algorithm = GCD_BINARY_STEIN, .layout = GCD_DATASET_AOS, .count = 5, .tag = 2};
+            server_ok = system_self_test_server_round(&client, server_buffer, server_buffer + 2 * server_pairs, &soa) &&
+                        system_self_test_server_round(&client, server_buffer, server_buffer + 2 * server_pairs, &aos);
+            platform_socket_close(&client);
+        }
+        else if (server.listening)
+        {
+            server_ok = false; // Listening yet unreachable: retry once so the accept loop can return
+            if (platform_socket_connect(server.options.address, &client))
+            {
+                platform_socket_close(&client);
+            }
+        }
+        free(server_buffer);
+        pthread_join(server_thread, NULL);
+        server_ok = server_ok && (!server.listening || (server.status == MATH_SUCCESS && server.stats.requests == 2 &&
+                                                        server.stats.pairs == server_pairs + 5));
+    }
+    pthread_cond_destroy(&server.changed);
+    pthread_mutex_destroy(&server.lock);
+    if (!server_ok)
+    {
+        printf("✗ Resident server failed\n");
+        return false;
+    }
+    if (server_started && server.listening)
+    {
+        printf("✓ Resident server successful: job-sized SoA and small AoS requests over a Unix domain socket\n");
+    }
+    else
+    {
+        printf("- Resident server skipped: cannot listen on %s here\n", server.options.address);
+    }
+#endif
+
     printf("✓ All tests passed!\n\n");
     return true;
 }
\ No newline at end of file
@@ -15,8 +15,52 @@
 #include "../../core/domain/mathematical_types.h"
 #include "../../challenges/greatest_common_divisor/domain_types.h"
 #include "../../core/interfaces/implementation_interface.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/batch_gcd.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/modular_arithmetic.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/benchmark_suite.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/benchmark_report.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/gcd_stream.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/gcd_dataset.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/gcd_protocol.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/gcd_cache.h"
+#include "../../infrastructure/utilities/perf_counters.h"
 #include <stdbool.h>
 
+// ============================================================================
+// PARALLEL EXECUTION LIMITS
+// ============================================================================
+
+/**
+ * @brief Maximum number of worker threads for parallel batch execution
+ */
+#define SYSTEM_MAX_WORKER_THREADS 256
+
+/**
+ * @brief Number of operand pairs per work-stealing chunk
+ */
+#define SYSTEM_BATCH_CHUNK_SIZE 4096
+
+/**
+ * @brief Assumed cache line size used to pad per-thread state
+ */
+#define SYSTEM_CACHE_LINE_SIZE 64
+
+// ============================================================================
+// HOST PROFILE
+// ============================================================================
+
+/**
+ * @brief Outcome of loading the per-host dispatch profile
+ */
+typedef enum
+{
+    SYSTEM_PROFILE_DEFAULTS,  /**< No profile configured (GCD_ANALYZER_PROFILE unset or empty) */
+    SYSTEM_PROFILE_MISSING,   /**< Profile file not found: built-in defaults */
+    SYSTEM_PROFILE_LOADED,    /**< Profile installed */
+    SYSTEM_PROFILE_INVALID,   /**< Malformed profile ignored: built-in defaults */
+    SYSTEM_PROFILE_OTHER_CPU  /**< Profile measured on another CPU model ignored: built-in defaults */
+} SystemProfileStatus;
+
 // ============================================================================
 // SYSTEM INITIALIZATION
 // ============================================================================
@@ -24,6 +68,11 @@
 /**
  * @brief Initialize the entire GCD algorithm analysis system
  *
+ * Also installs the per-host dispatch profile (see system_profile_path)
+ * when it exists and was calibrated on this CPU model, so short-lived
+ * processes neither re-calibrate nor fall back to guesses. A missing or
+ * unusable profile leaves the built-in defaults and does not fail.
+ *
  * @return MATH_SUCCESS if initialization successful
  */
 MathStatus system_init(void);
@@ -44,6 +93,160 @@ bool system_is_ready(void);
  */
 bool system_get_status(MathNatural *total_executions, double *total_time);
 
+/**
+ * @brief File of the per-host dispatch profile
+ *
+ * The profile is only loaded when configured explicitly; a table in the
+ * working directory is never picked up on its own.
+ *
+ * @return $GCD_ANALYZER_PROFILE, or NULL if it is unset or empty (no profile)
+ */
+const char *system_profile_path(void);
+
+/**
+ * @brief Outcome of the last profile load
+ *
+ * @return Profile status (SYSTEM_PROFILE_DEFAULTS before system_init)
+ */
+SystemProfileStatus system_get_profile_status(void);
+
+/**
+ * @brief Select the output format of compare, fastest, benchmark and bench-suite
+ *
+ * With a JSON or CSV format those commands write one report (see
+ * benchmark_report.h) to stream instead of printing console tables.
+ *
+ * @param format REPORT_FORMAT_TEXT (console tables) or a machine-readable format
+ * @param stream Destination of JSON/CSV reports (NULL = stdout)
+ */
+void system_set_report_output(ReportFormat format, FILE *stream);
+
+// ============================================================================
+// SMALL-OPERAND FAST PATH
+// ============================================================================
+
+/**
+ * @brief Default operand width answered by the fast path
+ */
+#define SYSTEM_SMALL_OPERAND_BITS 16
+
+/**
+ * @brief Widest operands the fast path may be configured for
+ */
+#define SYSTEM_SMALL_OPERAND_MAX_BITS 32
+
+/**
+ * @brief Configure the small-operand fast path of system_execute_gcd
+ *
+ * GCD_AUTO calls whose operands both have magnitudes below 2^bits skip
+ * the registry and the per-call timer and go straight to the table-driven
+ * kernel (GCD_EUCLIDEAN_TABLE). They still count towards the session
+ * totals, with no execution time, but not towards the per-variant
+ * performance counters. Explicitly requested variants always run their
+ * own kernel, so compare and benchmark measure what they name.
+ *
+ * @param bits Operand width, 0 to disable the fast path
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT above
+ *         SYSTEM_SMALL_OPERAND_MAX_BITS
+ */
+MathStatus system_set_small_operand_bits(unsigned int bits);
+
+/**
+ * @brief Operand width of the small-operand fast path
+ *
+ * @return Configured width (0 = disabled)
+ */
+unsigned int system_get_small_operand_bits(void);
+
+// ============================================================================
+// RESULT CACHE
+// ============================================================================
+
+/**
+ * @brief Enable, resize or disable the result cache (gcd_cache.h)
+ *
+ * The cache sits in front of gcd_registry_execute, and so of
+ * system_execute_gcd, and of system_execute_extended_gcd. A hit returns
+ * the cached GCD with no iterations and no execution time. Batch, compare
+ * and benchmark paths never consult it. Off by default.
+ *
+ * @param entries Entries per thread (0 disables)
+ * @return MATH_SUCCESS, or MATH_ERROR_INVALID_INPUT above GCD_CACHE_MAX_ENTRIES
+ */
+MathStatus system_set_result_cache(MathNatural entries);
+
+// ============================================================================
+// EXECUTION MODE
+// ============================================================================
+
+/**
+ * @brief How the execution interface runs a variant's kernel
+ */
+typedef enum
+{
+    SYSTEM_MODE_INSTRUMENTED, /**< Validate, special-case, time and record every call (default) */
+    SYSTEM_MODE_PRODUCTION    /**< Validate once per batch and call the bare kernel */
+} SystemExecutionMode;
+
+/**
+ * @brief Select the execution mode of the whole system
+ *
+ * In production mode, system_execute_gcd and the batch functions call the
+ * variant's bare kernel (gcd_registry_get_kernel) for variants that have
+ * one. Batches are checked for LLONG_MIN operands in one pass before any
+ * kernel runs; a batch containing one takes the instrumented path so the
+ * pair is rejected as usual. Single calls skip the per-call timer, the
+ * result cache, the session totals and the performance counters. Batches
+ * are still timed once and counted in the session totals, but do not
+ * update the per-variant performance record. GCDs are always
+ * non-negative. Variants without a bare kernel run instrumented.
+ *
+ * Analysis commands (compare, benchmark, calibrate) measure the
+ * instrumented path whatever the mode.
+ *
+ * @param mode SYSTEM_MODE_INSTRUMENTED or SYSTEM_MODE_PRODUCTION
+ */
+void system_set_execution_mode(SystemExecutionMode mode);
+
+/**
+ * @brief Execution mode selected by system_set_execution_mode
+ *
+ * @return Current mode (SYSTEM_MODE_INSTRUMENTED by default)
+ */
+SystemExecutionMode system_get_execution_mode(void);
+
+/**
+ * @brief Compute one GCD on the production path, whatever the system mode
+ *
+ * Calls the variant's bare kernel on the operands' magnitudes: no
+ * MathResult, no timing, no counters.
+ *
+ * @param variant Algorithm variant with a bare kernel
+ * @param a First operand
+ * @param b Second operand
+ * @return gcd(|a|, |b|), or MATH_INVALID_VALUE for LLONG_MIN operands and
+ *         variants without a bare kernel
+ */
+GcdInteger system_gcd(GcdAlgorithmVariant variant, GcdInteger a, GcdInteger b);
+
+/**
+ * @brief Compute a batch of GCDs on the production path, whatever the system mode
+ *
+ * The arguments and every operand are validated once, before the first
+ * kernel call; nothing is timed or counted.
+ *
+ * @param variant Algorithm variant with a bare kernel
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT (NULL arrays or an
+ *         LLONG_MIN operand, nothing written) or MATH_ERROR_NOT_IMPLEMENTED
+ *         (variant without a bare kernel)
+ */
+MathStatus system_gcd_batch(GcdAlgorithmVariant variant, const GcdInteger *a, const GcdInteger *b, GcdInteger *out,
+                            MathNatural n);
+
 // ============================================================================
 // HIGH-LEVEL EXECUTION INTERFACE
 // ============================================================================
@@ -68,9 +271,221 @@ MathResult system_execute_gcd(GcdAlgorithmVariant variant, GcdInteger a, GcdInte
  */
 MathResult system_execute_gcd_by_name(const char *algorithm_name, GcdInteger a, GcdInteger b);
 
+/**
+ * @brief Execute a GCD algorithm on arbitrary-precision operands
+ *
+ * @param variant Algorithm variant to execute (must provide compute_big)
+ * @param input Arbitrary-precision input
+ * @return MathResult whose value is the bit length of the GCD
+ */
+MathResult system_execute_gcd_big(GcdAlgorithmVariant variant, const MathBigBinaryInput *input);
+
+/**
+ * @brief Execute a GCD algorithm on unsigned operands
+ *
+ * Native uint64_t and, where the compiler has it, unsigned __int128
+ * arithmetic: the full unsigned range, 2^63 itself included, without
+ * taking magnitudes and without going to arbitrary precision.
+ *
+ * @param variant Algorithm variant to execute (must provide compute_unsigned)
+ * @param a First operand
+ * @param b Second operand
+ * @return MathUnsignedResult with computation result and timing
+ */
+MathUnsignedResult system_execute_gcd_unsigned(GcdAlgorithmVariant variant, MathWideNatural a, MathWideNatural b);
+
+/**
+ * @brief Execute a GCD algorithm over a batch of operand pairs
+ *
+ * Processes whole operand arrays in one call through the registry batch
+ * path, timing the batch once instead of once per pair.
+ *
+ * @param variant Algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @return Batch summary result (value = pairs computed successfully)
+ */
+MathResult system_execute_gcd_batch(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    MathNatural n);
+
+/**
+ * @brief Execute an extended GCD algorithm over a batch, returning Bezout coefficients
+ *
+ * For every pair a[i] * x[i] + b[i] * y[i] = out[i]. Only extended
+ * variants (GCD_VARIANT_HAS_COEFFICIENTS) are accepted.
+ *
+ * @param variant Extended algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param x Output array receiving the coefficient of each a[i]
+ * @param y Output array receiving the coefficient of each b[i]
+ * @param n Number of operand pairs
+ * @return Batch summary result (value = pairs computed successfully)
+ */
+MathResult system_execute_extended_gcd_batch(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    GcdInteger *x,
+    GcdInteger *y,
+    MathNatural n);
+
+/**
+ * @brief Execute a GCD algorithm over a batch of operand pairs on worker threads
+ *
+ * Splits the operand arrays into chunks scheduled by a work-stealing pool.
+ * Each worker keeps its own counters and performance metrics, which are
+ * merged into the system statistics and the implementation's performance
+ * record once all workers have finished. Small batches run on the caller.
+ *
+ * @param variant Algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @return Batch summary result; execution_time_ms is the wall-clock time
+ */
+MathResult system_execute_gcd_batch_parallel(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *a,
+    const GcdInteger *b,
+    GcdInteger *out,
+    MathNatural n,
+    MathNatural thread_count);
+
+/**
+ * @brief Execute a GCD algorithm over interleaved operand pairs on worker threads
+ *
+ * Same scheduling as system_execute_gcd_batch_parallel() for pairs stored
+ * as a0 b0 a1 b1 ... (the AoS dataset layout). Each worker gathers its
+ * current chunk into two small column buffers before running the batch
+ * kernel, so the input is never copied as a whole.
+ *
+ * @param variant Algorithm variant to execute
+ * @param pairs Array of 2 * n operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @return Batch summary result; execution_time_ms is the wall-clock time
+ */
+MathResult system_execute_gcd_batch_interleaved(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *pairs,
+    GcdInteger *out,
+    MathNatural n,
+    MathNatural thread_count);
+
+/**
+ * @brief Compute the GCD of every operand pair of a stream
+ *
+ * Reads pairs from input in batches of options->batch_pairs, runs each
+ * batch through the parallel batch API and writes one GCD per pair to
+ * output, in input order. The first malformed record stops the stream;
+ * stats->lines then names the offending text line.
+ *
+ * @param input Source of operand pairs
+ * @param output Destination of the GCDs
+ * @param options Algorithm, record format and batching (NULL = GCD_STREAM_OPTIONS_INIT)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT (malformed input or an I/O
+ *         error), MATH_ERROR_MEMORY or the batch API's error
+ */
+MathStatus system_stream_gcd(FILE *input, FILE *output, const GcdStreamOptions *options, GcdStreamStats *stats);
+
+/**
+ * @brief Compute the GCD of every operand pair of a mapped dataset file
+ *
+ * Maps the input dataset (see gcd_dataset.h) and a result file of the
+ * same count, then runs the parallel batch scheduler directly over the
+ * mappings: SoA columns go to the batch kernels as they are, AoS pairs
+ * are gathered chunk by chunk. Rejected pairs produce MATH_INVALID_VALUE.
+ *
+ * @param input_path Dataset of operand pairs (AoS or SoA layout)
+ * @param output_path Result file to create (values layout)
+ * @param variant Algorithm variant to execute
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT (unreadable, malformed or
+ *         values-layout input, or an output that cannot be written),
+ *         MATH_ERROR_NOT_IMPLEMENTED (unsupported version, width or host),
+ *         MATH_ERROR_MEMORY or the batch API's error
+ */
+MathStatus system_run_dataset(const char *input_path, const char *output_path, GcdAlgorithmVariant variant,
+                              MathNatural thread_count, GcdDatasetStats *stats);
+
+/**
+ * @brief Get the default number of worker threads (online CPUs)
+ *
+ * @return Number of worker threads used when thread_count is 0
+ */
+MathNatural system_get_default_thread_count(void);
+
+/**
+ * @brief Compute the GCD of an array of values
+ *
+ * Reduces the array with a pairwise tree of batch calls and stops as soon
+ * as the running GCD reaches GCD_IDENTITY, instead of folding through
+ * system_execute_gcd once per value.
+ *
+ * @param variant Algorithm variant to execute
+ * @param values Values to reduce (any sign)
+ * @param n Number of values (0 gives GCD_UNDEFINED)
+ * @return MathResult with value = GCD and iterations = values consumed
+ */
+MathResult system_execute_gcd_reduce(GcdAlgorithmVariant variant, const GcdInteger *values, MathNatural n);
+
+/**
+ * @brief Compute the GCD of an array of values on worker threads
+ *
+ * Chunks of SYSTEM_BATCH_CHUNK_SIZE values are reduced in parallel by the
+ * work-stealing pool and their partial GCDs reduced on the calling thread.
+ * A chunk reaching GCD_IDENTITY stops all workers. Arrays of a single
+ * chunk run on the caller.
+ *
+ * @param variant Algorithm variant to execute
+ * @param values Values to reduce (any sign)
+ * @param n Number of values
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @return MathResult with value = GCD and iterations = values consumed;
+ *         execution_time_ms is the wall-clock time
+ */
+MathResult system_execute_gcd_reduce_parallel(
+    GcdAlgorithmVariant variant,
+    const GcdInteger *values,
+    MathNatural n,
+    MathNatural thread_count);
+
+/**
+ * @brief Find moduli that share a factor with any other modulus
+ *
+ * Runs the product-tree / remainder-tree batch GCD, filling in the
+ * default worker count when config->thread_count is 0.
+ *
+ * @param moduli Positive moduli (count elements)
+ * @param count Number of moduli
+ * @param gcds Caller-initialized outputs, gcds[i] with capacity >= moduli[i].size
+ * @param config Execution options (NULL = defaults, one worker per online CPU)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus system_batch_gcd(const MathBigInteger *moduli, MathNatural count, MathBigInteger *gcds,
+                            const BatchGcdConfig *config, BatchGcdStats *stats);
+
 /**
  * @brief Execute Extended Euclidean algorithm (convenience wrapper)
  *
+ * With the result cache enabled, a repeated pair is answered from it
+ * with the GCD and coefficients first computed for it.
+ *
  * @param a First operand
  * @param b Second operand
  * @param x Pointer to store coefficient for a
@@ -79,6 +494,203 @@ MathResult system_execute_gcd_by_name(const char *algorithm_name, GcdInteger a,
  */
 ExtendedGcdResult system_execute_extended_gcd(GcdInteger a, GcdInteger b, GcdInteger *x, GcdInteger *y);
 
+/**
+ * @brief Inverse of a modulo m (convenience wrapper over modinv)
+ *
+ * @param a Value to invert
+ * @param modulus Modulus (positive)
+ * @param inverse Output in [0, modulus)
+ * @return MATH_SUCCESS, MATH_ERROR_NO_SOLUTION if gcd(a, modulus) != 1, or an error code
+ */
+MathStatus system_modinv(GcdInteger a, GcdInteger modulus, GcdInteger *inverse);
+
+/**
+ * @brief Inverses of an array of values with one extended GCD (convenience wrapper over modinv_batch)
+ *
+ * @param values Values to invert (count elements, must not overlap inverses)
+ * @param inverses Output array (count elements)
+ * @param count Number of values
+ * @param modulus Modulus (positive)
+ * @return MATH_SUCCESS, MATH_ERROR_NO_SOLUTION if some value is not invertible, or an error code
+ */
+MathStatus system_modinv_batch(const GcdInteger *values, GcdInteger *inverses, MathNatural count, GcdInteger modulus);
+
+/**
+ * @brief Chinese Remainder recombination (convenience wrapper over crt_combine)
+ *
+ * @param residues Residues (count elements)
+ * @param moduli Moduli (count elements, positive)
+ * @param count Number of congruences
+ * @param result Output residue
+ * @param modulus Output modulus (lcm of the moduli)
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus system_crt_combine(const GcdInteger *residues, const GcdInteger *moduli, MathNatural count,
+                              GcdInteger *result, GcdInteger *modulus);
+
+// ============================================================================
+// ASYNCHRONOUS JOBS
+// ============================================================================
+
+/**
+ * @brief Handle of a submitted job
+ */
+typedef struct SystemJob SystemJob;
+
+/**
+ * @brief Progress of a submitted job
+ */
+typedef enum
+{
+    SYSTEM_JOB_RUNNING,     /**< Still computing */
+    SYSTEM_JOB_COMPLETED,   /**< Every pair computed */
+    SYSTEM_JOB_CANCELLED,   /**< Stopped by system_job_cancel (MATH_ERROR_CANCELLED) */
+    SYSTEM_JOB_TIMED_OUT,   /**< Stopped at config.timeout_ms (MATH_ERROR_TIMEOUT) */
+    SYSTEM_JOB_LIMIT_REACHED, /**< Stopped at config.max_iterations pairs (MATH_ERROR_LIMIT_REACHED) */
+    SYSTEM_JOB_FAILED       /**< Could not run (e.g. out of memory) */
+} SystemJobState;
+
+/**
+ * @brief Completion callback of a submitted job
+ *
+ * Runs once on the pool thread that ran the job, after the final result
+ * is known and before waiters are woken. It must not wait for or release
+ * its own job, nor wait for a job submitted after it.
+ *
+ * @param job Finished job
+ * @param state Final state
+ * @param result Final result
+ * @param user_data SystemJobOptions.user_data
+ */
+typedef void (*SystemJobCallback)(SystemJob *job, SystemJobState state, const MathResult *result, void *user_data);
+
+/**
+ * @brief Options of a submitted job
+ *
+ * config.timeout_ms bounds the job's wall-clock time and
+ * config.max_iterations the number of pairs it computes (0 = no limit
+ * for either). Both, like cancellation, are checked before each chunk of
+ * SYSTEM_BATCH_CHUNK_SIZE pairs, so a job stops within one chunk per
+ * worker of the limit. With config.collect_performance_data false the
+ * implementation's performance record is left untouched.
+ */
+typedef struct
+{
+    MathNatural thread_count;     /**< Workers (0 = one per online CPU) */
+    ImplementationConfig config;  /**< Limits and performance collection */
+    SystemJobCallback on_complete; /**< Optional completion callback */
+    void *user_data;              /**< Passed to on_complete */
+} SystemJobOptions;
+
+/**
+ * @brief Default job options: no limits, performance collected, no callback
+ */
+#define SYSTEM_JOB_OPTIONS_INIT {                                                         \
+    .thread_count = 0,                                                                    \
+    .config = {.collect_performance_data = true, .max_iterations = 0, .timeout_ms = 0.0}, \
+    .on_complete = NULL,                                                                  \
+    .user_data = NULL}
+
+/**
+ * @brief Start a parallel batch without waiting for it
+ *
+ * Runs system_execute_gcd_batch_parallel() on a resident worker thread,
+ * which acts as the first worker. Jobs share those threads (at least one
+ * per online CPU) with the batch workers; a job finding none free queues
+ * until one is. The arrays must stay valid until the job has finished.
+ * Every out[i] reads MATH_INVALID_VALUE until its pair is computed, so a
+ * stopped job leaves the pairs it never reached marked.
+ * Single-threaded builds run the job before returning.
+ *
+ * @param variant Algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param options Threads, limits and callback (NULL = SYSTEM_JOB_OPTIONS_INIT)
+ * @param job Output handle, to be released with system_job_release()
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT, MATH_ERROR_NOT_IMPLEMENTED
+ *         or MATH_ERROR_MEMORY (no job was started)
+ */
+MathStatus system_submit_batch(GcdAlgorithmVariant variant, const GcdInteger *a, const GcdInteger *b, GcdInteger *out,
+                               MathNatural n, const SystemJobOptions *options, SystemJob **job);
+
+/**
+ * @brief Start a parallel batch of interleaved pairs without waiting for it
+ *
+ * Like system_submit_batch(), with the pairs laid out as
+ * system_execute_gcd_batch_interleaved() expects them.
+ *
+ * @param variant Algorithm variant to execute
+ * @param pairs Array of 2 * n operands: a0 b0 a1 b1 ...
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param options Threads, limits and callback (NULL = SYSTEM_JOB_OPTIONS_INIT)
+ * @param job Output handle, to be released with system_job_release()
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT, MATH_ERROR_NOT_IMPLEMENTED
+ *         or MATH_ERROR_MEMORY (no job was started)
+ */
+MathStatus system_submit_batch_interleaved(GcdAlgorithmVariant variant, const GcdInteger *pairs, GcdInteger *out,
+                                           MathNatural n, const SystemJobOptions *options, SystemJob **job);
+
+/**
+ * @brief Check a job without blocking
+ *
+ * @param job Submitted job
+ * @param result Optional output: the final result once the job has finished
+ * @return Current state
+ */
+SystemJobState system_job_poll(SystemJob *job, MathResult *result);
+
+/**
+ * @brief Block until a job has finished
+ *
+ * @param job Submitted job
+ * @param result Optional output: the final result
+ * @return Final state
+ */
+SystemJobState system_job_wait(SystemJob *job, MathResult *result);
+
+/**
+ * @brief Ask a job to stop after the chunks its workers are computing
+ *
+ * The job finishes as SYSTEM_JOB_CANCELLED with status
+ * MATH_ERROR_CANCELLED, unless it had already finished.
+ *
+ * @param job Submitted job
+ */
+void system_job_cancel(SystemJob *job);
+
+/**
+ * @brief Wait for a job if it is still running, then free it
+ *
+ * @param job Submitted job (NULL is ignored)
+ */
+void system_job_release(SystemJob *job);
+
+// ============================================================================
+// RESIDENT SERVER
+// ============================================================================
+
+/**
+ * @brief Serve framed GCD batch requests on a socket
+ *
+ * Listens on options->address and answers the requests of every client
+ * as described in gcd_protocol.h, each connection on a thread of its own.
+ * Requests of more than one chunk run as submitted jobs, so a client that
+ * pipelines has its next request read while the previous one computes.
+ * The execution mode, dispatch table and result cache of the process
+ * apply to every request.
+ *
+ * @param options Address, default algorithm and limits
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS once options->connection_limit connections have
+ *         been served and closed; MATH_ERROR_INVALID_INPUT if the address
+ *         cannot be listened on or accepting fails; MATH_ERROR_NOT_IMPLEMENTED
+ *         without sockets or on a big-endian host; MATH_ERROR_MEMORY
+ */
+MathStatus system_serve(const GcdServeOptions *options, GcdServeStats *stats);
+
 // ============================================================================
 // COMPARISON AND ANALYSIS INTERFACE
 // ============================================================================
@@ -93,9 +705,22 @@ ExtendedGcdResult system_execute_extended_gcd(GcdInteger a, GcdInteger b, GcdInt
  */
 MathNatural system_compare_all_algorithms(GcdInteger a, GcdInteger b, bool print_results);
 
+/**
+ * @brief Compare all arbitrary-precision algorithms on big operands
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param print_results Whether to print results to console
+ * @return Number of algorithms compared (0 if the results disagree)
+ */
+MathNatural system_compare_big_algorithms(const MathBigInteger *a, const MathBigInteger *b, bool print_results);
+
 /**
  * @brief Find the fastest algorithm for given input
  *
+ * Answers from the GCD_AUTO decision table instead of running every
+ * algorithm; only the chosen one is executed, to report its time.
+ *
  * @param a First operand
  * @param b Second operand
  * @param print_results Whether to print results to console
@@ -106,14 +731,74 @@ GcdAlgorithmVariant system_find_fastest_algorithm(GcdInteger a, GcdInteger b, bo
 /**
  * @brief Run simple benchmark comparing algorithms
  *
+ * Uses the benchmark harness (warmup, calibrated batches, tick counter)
+ * and reports min / median / p99 / stddev per GCD. The measured metrics
+ * are merged into each implementation's performance record.
+ *
  * @param a First operand
  * @param b Second operand
- * @param iterations Number of iterations for each algorithm
+ * @param iterations Number of timed samples for each algorithm
  * @param print_results Whether to print results to console
  * @return Number of algorithms benchmarked
  */
 MathNatural system_benchmark_algorithms(GcdInteger a, GcdInteger b, MathNatural iterations, bool print_results);
 
+/**
+ * @brief Benchmark the arbitrary-precision algorithms on big operands
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @param iterations Number of iterations per algorithm
+ * @param print_results Whether to print results to console
+ * @return Number of algorithms benchmarked
+ */
+MathNatural system_benchmark_big_algorithms(const MathBigInteger *a, const MathBigInteger *b,
+                                            MathNatural iterations, bool print_results);
+
+/**
+ * @brief Benchmark every registered algorithm over every input class
+ *
+ * Runs gcd_suite_run on generated operands (uniform, Fibonacci, 2-adic,
+ * coprime, near-equal and bignum columns) and merges each measured cell
+ * into the implementation's performance record.
+ *
+ * @param samples Number of timed samples per cell (0 = GCD_SUITE_DEFAULT_SAMPLES)
+ * @param seed Operand generator seed
+ * @param matrix Matrix receiving the results (NULL = internal, printed only)
+ * @param print_results Whether to print the comparison matrix
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus system_benchmark_suite(MathNatural samples, MathNatural seed, GcdSuiteMatrix *matrix, bool print_results);
+
+/**
+ * @brief Calibrate the GCD_AUTO decision table on this machine
+ *
+ * Measures every dispatcher candidate on every input bucket, installs
+ * the fastest per bucket and optionally saves the table, so later
+ * processes can load it with system_load_dispatch_table and never pay
+ * for trial runs.
+ *
+ * @param samples Number of timed samples per cell (0 = GCD_SUITE_DEFAULT_SAMPLES)
+ * @param seed Operand generator seed
+ * @param path File the table is saved to (NULL = not saved)
+ * @param print_results Whether to print the timings and the chosen table
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT (unwritable path) or MATH_ERROR_MEMORY
+ */
+MathStatus system_calibrate_dispatcher(MathNatural samples, MathNatural seed, const char *path, bool print_results);
+
+/**
+ * @brief Install a decision table saved by system_calibrate_dispatcher
+ *
+ * Unlike the startup profile, an explicitly named table is installed
+ * whatever CPU it was measured on.
+ *
+ * @param path Table file
+ * @return MATH_SUCCESS, MATH_ERROR_NO_SOLUTION (missing file) or
+ *         MATH_ERROR_INVALID_INPUT (malformed file); the current table is
+ *         kept on error
+ */
+MathStatus system_load_dispatch_table(const char *path);
+
 // ============================================================================
 // INFORMATION AND LISTING INTERFACE
 // ============================================================================
@@ -162,8 +847,31 @@ bool system_validate_algorithms(GcdAlgorithmVariant variant1, GcdAlgorithmVarian
 // SYSTEM DIAGNOSTICS
 // ============================================================================
 
+/**
+ * @brief Sum the per-thread counters of one algorithm
+ *
+ * Counts calls that went through the registry (single, batch, parallel
+ * and bignum execution); each pair of a batch counts as one call.
+ *
+ * @param variant Algorithm variant
+ * @param totals Output totals (zero when built with DISABLE_PERF_COUNTERS)
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus system_get_performance_counters(GcdAlgorithmVariant variant, PerfCounterTotals *totals);
+
+/**
+ * @brief Print the per-thread counters aggregated per algorithm
+ *
+ * Latencies come from the log2 histogram, so p50 and p99 are the upper
+ * edge of a power-of-two bucket of ticks.
+ */
+void system_print_performance_counters(void);
+
 /**
  * @brief Print system status and statistics
+ *
+ * Includes the per-algorithm counters and latency histograms aggregated
+ * over all threads.
  */
 void system_print_status(void);
 
@@ -0,0 +1,111 @@
+/**
+ * @file system_dataset.c
+ * @brief GCDs of the operand pairs of a memory-mapped dataset file
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The input and result files are mapped by gcd_dataset.h, and the
+ * workers of the batch scheduler read operands from one mapping and
+ * store GCDs into the other, so no record is copied.
+ */
+
+#include "system_internal.h"
+#include "../../infrastructure/utilities/math_utils.h"
+#include "../../infrastructure/utilities/memory_utils.h"
+#include <string.h>
+
+// ============================================================================
+// DATASET FILES
+// ============================================================================
+
+/**
+ * @brief Compute the GCD of every operand pair of a mapped dataset file
+ *
+ * @param input_path Dataset of operand pairs (AoS or SoA layout)
+ * @param output_path Result file to create (values layout)
+ * @param variant Algorithm variant to execute
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus system_run_dataset(const char *input_path, const char *output_path, GcdAlgorithmVariant variant,
+                              MathNatural thread_count, GcdDatasetStats *stats)
+{
+    MathStatus status = system_prepare_batch(variant);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+    // Creating the output truncates it, which must not happen to the mapped input
+    if (input_path == NULL || output_path == NULL || strcmp(input_path, output_path) == 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    GcdDatasetStats summary;
+    memory_clear(&summary, sizeof(summary));
+    double start_time = math_get_time_ms();
+
+    GcdDataset input;
+    status = gcd_dataset_open(input_path, &input);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+    if (input.header.layout == GCD_DATASET_VALUES)
+    {
+        gcd_dataset_close(&input);
+        return MATH_ERROR_INVALID_INPUT; // A result file, not operand pairs
+    }
+
+    MathNatural n = input.header.count;
+    GcdDatasetHeader output_header = {.count = n, .width_bits = GCD_DATASET_WIDTH_BITS, .layout = GCD_DATASET_VALUES};
+    GcdDataset output;
+    status = gcd_dataset_create(output_path, &output_header, &output);
+    if (status != MATH_SUCCESS)
+    {
+        gcd_dataset_close(&input);
+        return status;
+    }
+
+    // Workers read operands from the input mapping and store GCDs into the output mapping
+    MathResult result;
+    if (input.header.layout == GCD_DATASET_SOA)
+    {
+        result = system_run_pair_job(variant, input.records, input.records + n, false, output.records, n,
+                                     thread_count, NULL);
+    }
+    else
+    {
+        result = system_run_pair_job(variant, input.records, NULL, true, output.records, n, thread_count, NULL);
+    }
+
+    // A rejected pair leaves MATH_INVALID_VALUE in its slot; the others are still valid
+    if (result.status != MATH_SUCCESS && !(result.status == MATH_ERROR_OVERFLOW && result.iterations == n))
+    {
+        status = result.status;
+    }
+    else
+    {
+        summary.pairs = n;
+        summary.failed = n - (MathNatural)result.value;
+        summary.compute_time_ms = result.execution_time_ms;
+    }
+
+    summary.layout = input.header.layout;
+    summary.bytes_read = input.mapping.size;
+    summary.bytes_written = output.mapping.size;
+    MathStatus close_status = gcd_dataset_close(&output);
+    if (status == MATH_SUCCESS)
+    {
+        status = close_status;
+    }
+    gcd_dataset_close(&input);
+    summary.execution_time_ms = math_elapsed_time_ms(start_time, math_get_time_ms());
+
+    if (stats != NULL)
+    {
+        *stats = summary;
+    }
+    return status;
+}
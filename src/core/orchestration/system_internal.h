@@ -0,0 +1,105 @@
+/**
+ * @file system_internal.h
+ * @brief Coordinator internals shared by its translation units
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * system_coordinator.c owns the system state and the work-stealing batch
+ * scheduler. The submitted jobs (system_jobs.c), the stream and dataset
+ * paths (system_stream.c, system_dataset.c) and the resident server
+ * (system_server.c) build on the scheduler through the functions declared
+ * here. None of this is part of the public interface.
+ */
+
+#ifndef SYSTEM_INTERNAL_H
+#define SYSTEM_INTERNAL_H
+
+#include "system_coordinator.h"
+
+// Platform detection for worker threads
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || defined(__MINGW32__)
+#ifndef SINGLE_THREADED
+#define HAS_POSIX_THREADS 1
+#endif
+#endif
+
+#ifdef HAS_POSIX_THREADS
+#include <pthread.h>
+#endif
+
+// ============================================================================
+// BATCH SCHEDULER (system_coordinator.c)
+// ============================================================================
+
+/**
+ * @brief Check that the system and a variant are ready for a batch
+ *
+ * @param variant Algorithm variant to execute
+ * @return MATH_SUCCESS, the system_init() error or MATH_ERROR_NOT_IMPLEMENTED
+ */
+MathStatus system_prepare_batch(GcdAlgorithmVariant variant);
+
+/**
+ * @brief Compute a batch of operand pairs on the work-stealing pool
+ *
+ * @param variant Algorithm variant to execute
+ * @param a First operands, or the interleaved pairs
+ * @param b Second operands (unused when interleaved)
+ * @param interleaved a holds pairs a0 b0 a1 b1 ...
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param thread_count Number of workers (0 = one per online CPU)
+ * @param control Submitted job whose limits apply (NULL = none)
+ * @return Batch summary result over the pairs computed; execution_time_ms
+ *         is the wall-clock time
+ */
+MathResult system_run_pair_job(GcdAlgorithmVariant variant, const GcdInteger *a, const GcdInteger *b,
+                               bool interleaved, GcdInteger *out, MathNatural n, MathNatural thread_count,
+                               SystemJob *control);
+
+#ifdef HAS_POSIX_THREADS
+/**
+ * @brief Work item run on a resident pool thread
+ */
+typedef struct SystemPoolTask
+{
+    void (*run)(void *context);
+    void *context;
+    struct SystemPoolTask *next; /**< Queue link, owned by the pool */
+} SystemPoolTask;
+
+/**
+ * @brief Queue a task for the resident pool threads that run the batch workers
+ *
+ * At most one task per pool thread (at least one per online CPU) runs at
+ * once; the rest wait their turn.
+ * A task must not wait for a task queued after it.
+ *
+ * @param task Task to run; must stay valid until its function has started
+ * @return MATH_SUCCESS, or MATH_ERROR_MEMORY if no pool thread could be started
+ */
+MathStatus system_pool_submit(SystemPoolTask *task);
+#endif
+
+// ============================================================================
+// SUBMITTED JOBS (system_jobs.c)
+// ============================================================================
+
+/**
+ * @brief Admit (part of) a chunk under a submitted job's cancellation and limits
+ *
+ * @param control Submitted job (NULL admits everything)
+ * @param length Pairs in the chunk
+ * @return Pairs to compute from the start of the chunk (0 = stop)
+ */
+MathNatural system_job_admit(SystemJob *control, MathNatural length);
+
+/**
+ * @brief Check whether a batch should update the implementation's performance record
+ *
+ * @param control Submitted job (NULL = a plain batch, which always does)
+ * @return true unless the job was submitted with collect_performance_data off
+ */
+bool system_job_collects_performance(const SystemJob *control);
+
+#endif // SYSTEM_INTERNAL_H
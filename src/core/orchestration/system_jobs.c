@@ -0,0 +1,368 @@
+/**
+ * @file system_jobs.c
+ * @brief Submitted batches: asynchronous jobs with cancellation and limits
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * A job is a parallel batch run as a task of the resident worker pool;
+ * jobs that find no free pool thread queue until one is. The batch
+ * scheduler in system_coordinator.c calls system_job_admit before every
+ * chunk, which is where cancellation, the deadline and the pair budget
+ * take effect.
+ */
+
+#include "system_internal.h"
+#include "../../infrastructure/utilities/math_utils.h"
+#include <stdlib.h>
+
+// ============================================================================
+// ASYNCHRONOUS JOBS
+// ============================================================================
+// A submitted batch runs system_run_pair_job() as a task on a resident
+// pool thread, which acts as worker 0 of the batch. Workers check the
+// job's cancel flag, deadline and pair budget each time they take a chunk;
+// the first check that fails stops the batch and becomes the job's final
+// state.
+
+/**
+ * @brief Submitted batch: inputs, limits and the outcome waiters read
+ */
+struct SystemJob
+{
+    GcdAlgorithmVariant variant;
+    const GcdInteger *operands_a;
+    const GcdInteger *operands_b;
+    bool interleaved; /**< operands_a holds pairs a0 b0 a1 b1 ... */
+    GcdInteger *results;
+    MathNatural count;
+    SystemJobOptions options;
+    double deadline_ms;         /**< math_get_time_ms() at which the job times out (0 = none) */
+    MathNatural pairs_admitted; /**< Pairs handed to workers so far */
+    bool cancel_requested;      /**< Set by system_job_cancel */
+    SystemJobState stop_reason; /**< Limit that stopped the workers (SYSTEM_JOB_RUNNING = none) */
+    SystemJobState state;       /**< Published once the callback has run */
+    MathResult result;          /**< Final result, valid once state is not SYSTEM_JOB_RUNNING */
+#ifdef HAS_POSIX_THREADS
+    SystemPoolTask task;
+    pthread_mutex_t lock; /**< Guards the progress fields and the outcome */
+    pthread_cond_t finished;
+#endif
+};
+
+/**
+ * @brief Admit (part of) a chunk under a submitted job's cancellation and limits
+ *
+ * The first failed check is remembered, so every later call returns 0.
+ * The iteration budget truncates the chunk that crosses it.
+ *
+ * @param control Submitted job (NULL admits everything)
+ * @param length Pairs in the chunk
+ * @return Pairs to compute from the start of the chunk (0 = stop)
+ */
+MathNatural system_job_admit(SystemJob *control, MathNatural length)
+{
+    if (control == NULL)
+    {
+        return length;
+    }
+
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&control->lock);
+#endif
+    MathNatural budget = control->options.config.max_iterations;
+    if (control->stop_reason != SYSTEM_JOB_RUNNING)
+    {
+        length = 0;
+    }
+    else if (control->cancel_requested)
+    {
+        control->stop_reason = SYSTEM_JOB_CANCELLED;
+        length = 0;
+    }
+    else if (control->deadline_ms > 0.0 && math_get_time_ms() >= control->deadline_ms)
+    {
+        control->stop_reason = SYSTEM_JOB_TIMED_OUT;
+        length = 0;
+    }
+    else if (budget > 0 && control->pairs_admitted + length > budget)
+    {
+        control->stop_reason = SYSTEM_JOB_LIMIT_REACHED;
+        length = budget - control->pairs_admitted;
+    }
+    control->pairs_admitted += length;
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&control->lock);
+#endif
+    return length;
+}
+
+/**
+ * @brief Check whether a batch should update the implementation's performance record
+ *
+ * @param control Submitted job (NULL = a plain batch, which always does)
+ * @return true unless the job was submitted with collect_performance_data off
+ */
+bool system_job_collects_performance(const SystemJob *control)
+{
+    return control == NULL || control->options.config.collect_performance_data;
+}
+
+/**
+ * @brief Record a job's outcome, run its callback and wake its waiters
+ *
+ * @param job Job whose workers have all returned
+ * @param result Result of system_run_pair_job()
+ */
+static void system_job_finish(SystemJob *job, MathResult result)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&job->lock);
+#endif
+    SystemJobState state = job->stop_reason;
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&job->lock);
+#endif
+
+    if (result.status == MATH_ERROR_MEMORY)
+    {
+        state = SYSTEM_JOB_FAILED;
+    }
+    else if (state == SYSTEM_JOB_RUNNING)
+    {
+        state = SYSTEM_JOB_COMPLETED;
+    }
+    else
+    {
+        // Stopped early: the batch summary still counts the pairs computed
+        result.status = (state == SYSTEM_JOB_CANCELLED)       ? MATH_ERROR_CANCELLED
+                        : (state == SYSTEM_JOB_LIMIT_REACHED) ? MATH_ERROR_LIMIT_REACHED
+                                                              : MATH_ERROR_TIMEOUT;
+        result.is_valid = false;
+    }
+
+    if (job->options.on_complete != NULL)
+    {
+        job->options.on_complete(job, state, &result, job->options.user_data);
+    }
+
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&job->lock);
+#endif
+    job->result = result;
+    job->state = state;
+#ifdef HAS_POSIX_THREADS
+    pthread_cond_broadcast(&job->finished);
+    pthread_mutex_unlock(&job->lock);
+#endif
+}
+
+/**
+ * @brief Job task: run the batch, then publish its outcome
+ *
+ * @param context Pointer to the SystemJob
+ */
+static void system_job_main(void *context)
+{
+    SystemJob *job = (SystemJob *)context;
+    MathResult result = system_run_pair_job(job->variant, job->operands_a, job->operands_b, job->interleaved,
+                                            job->results, job->count, job->options.thread_count, job);
+    system_job_finish(job, result);
+}
+
+/**
+ * @brief Validate a batch and queue its job on the worker pool
+ *
+ * @param variant Algorithm variant to execute
+ * @param a First operands, or the interleaved pairs
+ * @param b Second operands (unused when interleaved)
+ * @param interleaved a holds pairs a0 b0 a1 b1 ...
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param options Threads, limits and callback (NULL = SYSTEM_JOB_OPTIONS_INIT)
+ * @param job Output handle
+ * @return MATH_SUCCESS or an error code (no job was started)
+ */
+static MathStatus system_job_start(GcdAlgorithmVariant variant, const GcdInteger *a, const GcdInteger *b,
+                                   bool interleaved, GcdInteger *out, MathNatural n,
+                                   const SystemJobOptions *options, SystemJob **job)
+{
+    if (job == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    *job = NULL;
+
+    MathStatus status = system_prepare_batch(variant);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    MathBatchInput input = MATH_BATCH_INPUT_INIT(a, interleaved ? a : b, out, n);
+    if (!memory_validate_batch_input(&input))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    SystemJob *submitted = (SystemJob *)calloc(1, sizeof(SystemJob));
+    if (submitted == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+
+    const SystemJobOptions defaults = SYSTEM_JOB_OPTIONS_INIT;
+    submitted->variant = variant;
+    submitted->operands_a = a;
+    submitted->operands_b = interleaved ? NULL : b;
+    submitted->interleaved = interleaved;
+    submitted->results = out;
+    submitted->count = n;
+    submitted->options = (options != NULL) ? *options : defaults;
+    submitted->stop_reason = SYSTEM_JOB_RUNNING;
+    submitted->state = SYSTEM_JOB_RUNNING;
+
+    // Pairs the job never reaches keep the marker of a rejected pair
+    for (MathNatural i = 0; i < n; i++)
+    {
+        out[i] = MATH_INVALID_VALUE;
+    }
+
+    double timeout_ms = submitted->options.config.timeout_ms;
+    if (timeout_ms > 0.0)
+    {
+        submitted->deadline_ms = math_get_time_ms() + timeout_ms;
+    }
+
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_init(&submitted->lock, NULL);
+    pthread_cond_init(&submitted->finished, NULL);
+    submitted->task.run = system_job_main;
+    submitted->task.context = submitted;
+    if (system_pool_submit(&submitted->task) != MATH_SUCCESS)
+    {
+        pthread_cond_destroy(&submitted->finished);
+        pthread_mutex_destroy(&submitted->lock);
+        free(submitted);
+        return MATH_ERROR_MEMORY;
+    }
+#else
+    system_job_main(submitted); // No threads: the job has finished on return
+#endif
+
+    *job = submitted;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Start a parallel batch without waiting for it
+ *
+ * @param variant Algorithm variant to execute
+ * @param a Array of first operands
+ * @param b Array of second operands
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param options Threads, limits and callback (NULL = SYSTEM_JOB_OPTIONS_INIT)
+ * @param job Output handle, to be released with system_job_release()
+ * @return MATH_SUCCESS or an error code (no job was started)
+ */
+MathStatus system_submit_batch(GcdAlgorithmVariant variant, const GcdInteger *a, const GcdInteger *b, GcdInteger *out,
+                               MathNatural n, const SystemJobOptions *options, SystemJob **job)
+{
+    return system_job_start(variant, a, b, false, out, n, options, job);
+}
+
+/**
+ * @brief Start a parallel batch of interleaved pairs without waiting for it
+ *
+ * @param variant Algorithm variant to execute
+ * @param pairs Array of 2 * n operands: a0 b0 a1 b1 ...
+ * @param out Output array receiving one GCD per pair
+ * @param n Number of operand pairs
+ * @param options Threads, limits and callback (NULL = SYSTEM_JOB_OPTIONS_INIT)
+ * @param job Output handle, to be released with system_job_release()
+ * @return MATH_SUCCESS or an error code (no job was started)
+ */
+MathStatus system_submit_batch_interleaved(GcdAlgorithmVariant variant, const GcdInteger *pairs, GcdInteger *out,
+                                           MathNatural n, const SystemJobOptions *options, SystemJob **job)
+{
+    return system_job_start(variant, pairs, NULL, true, out, n, options, job);
+}
+
+/**
+ * @brief Check a job without blocking
+ *
+ * @param job Submitted job
+ * @param result Optional output: the final result once the job has finished
+ * @return Current state
+ */
+SystemJobState system_job_poll(SystemJob *job, MathResult *result)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&job->lock);
+#endif
+    SystemJobState state = job->state;
+    if (state != SYSTEM_JOB_RUNNING && result != NULL)
+    {
+        *result = job->result;
+    }
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&job->lock);
+#endif
+    return state;
+}
+
+/**
+ * @brief Block until a job has finished
+ *
+ * @param job Submitted job
+ * @param result Optional output: the final result
+ * @return Final state
+ */
+SystemJobState system_job_wait(SystemJob *job, MathResult *result)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&job->lock);
+    while (job->state == SYSTEM_JOB_RUNNING)
+    {
+        pthread_cond_wait(&job->finished, &job->lock);
+    }
+    pthread_mutex_unlock(&job->lock);
+#endif
+    return system_job_poll(job, result);
+}
+
+/**
+ * @brief Ask a job to stop after the chunks its workers are computing
+ *
+ * @param job Submitted job
+ */
+void system_job_cancel(SystemJob *job)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&job->lock);
+#endif
+    job->cancel_requested = true;
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&job->lock);
+#endif
+}
+
+/**
+ * @brief Wait for a job if it is still running, then free it
+ *
+ * @param job Submitted job (NULL is ignored)
+ */
+void system_job_release(SystemJob *job)
+{
+    if (job == NULL)
+    {
+        return;
+    }
+
+#ifdef HAS_POSIX_THREADS
+    system_job_wait(job, NULL); // The task does not touch the job once it is published
+    pthread_cond_destroy(&job->finished);
+    pthread_mutex_destroy(&job->lock);
+#endif
+    free(job);
+}
@@ -0,0 +1,480 @@
+/**
+ * @file system_server.c
+ * @brief Resident server answering framed GCD batch requests on a socket
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * The frames are described in gcd_protocol.h and the sockets come from
+ * socket_io.h; this file reads requests, runs them inline or as
+ * submitted jobs, and writes the replies in request order.
+ */
+
+#include "system_internal.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/solution_registry.h"
+#include "../../infrastructure/utilities/math_utils.h"
+#include "../../infrastructure/utilities/memory_utils.h"
+#include "../../infrastructure/platform/socket_io.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// RESIDENT SERVER
+// ============================================================================
+// One thread per connection. Each connection owns two request slots: while
+// the batch of one slot runs as a submitted job, the connection reads the
+// next request into the other, provided the client has already sent it.
+// Operands are received straight into a slot's buffer, workers write the
+// GCDs right behind the reply header in the same buffer, and the reply
+// leaves in one send from there.
+
+/**
+ * @brief State shared by the accept loop and the connection threads
+ */
+typedef struct
+{
+    const GcdServeOptions *options;
+    MathNatural max_pairs;   /**< Largest request accepted */
+    MathNatural active;      /**< Connections being served */
+    GcdServeStats stats;     /**< Run summary, guarded by lock */
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_t lock;
+    pthread_cond_t changed; /**< Signalled whenever active drops */
+#endif
+} ServeState;
+
+/**
+ * @brief One request of a connection, from its header to its reply
+ */
+typedef struct
+{
+    GcdRequestHeader request;
+    GcdAlgorithmVariant variant; /**< Algorithm resolved from the request */
+    MathStatus status;           /**< Error found before computing (MATH_SUCCESS = none) */
+    bool fatal;                  /**< Close the connection after the reply */
+    unsigned char *buffer;       /**< Operands, then the reply header, then the GCDs */
+    size_t capacity;             /**< Size of buffer */
+    SystemJob *job;              /**< Batch still computing (NULL = ran inline) */
+    MathResult result;           /**< Batch summary of an inline run */
+} ServeSlot;
+
+/**
+ * @brief A connection handed to its thread
+ */
+typedef struct
+{
+    ServeState *server;
+    PlatformSocket socket;
+} ServeConnection;
+
+/**
+ * @brief Requests below this many pairs run on the connection thread
+ *
+ * A submitted job is handed to a pool thread; a single chunk is cheaper
+ * to compute than to hand over.
+ */
+#define SERVE_INLINE_PAIRS SYSTEM_BATCH_CHUNK_SIZE
+
+/**
+ * @brief First payload chunk read into a slot's buffer
+ *
+ * The buffer then doubles with every chunk received, so memory follows
+ * the bytes a client actually sends rather than the count in its header.
+ */
+#define SERVE_PAYLOAD_CHUNK_BYTES ((size_t)64 << 10)
+
+/**
+ * @brief Grow a slot's buffer to at least bytes
+ *
+ * @param slot Slot to grow
+ * @param bytes Size needed
+ * @return false if the allocation failed (the buffer is kept)
+ */
+static bool system_serve_reserve(ServeSlot *slot, size_t bytes)
+{
+    if (bytes <= slot->capacity)
+    {
+        return true;
+    }
+    unsigned char *grown = (unsigned char *)realloc(slot->buffer, bytes);
+    if (grown == NULL)
+    {
+        return false;
+    }
+    slot->buffer = grown;
+    slot->capacity = bytes;
+    return true;
+}
+
+/**
+ * @brief Read the next request of a connection into a slot
+ *
+ * Header errors and oversized counts mark the slot fatal: the payload
+ * cannot be trusted or skipped, so the reply is the last frame sent. The
+ * buffer grows as the payload arrives (see SERVE_PAYLOAD_CHUNK_BYTES).
+ *
+ * @param connection Connection to read from
+ * @param slot Slot receiving the request
+ * @return false when the connection ended (cleanly or mid-frame)
+ */
+static bool system_serve_read(ServeConnection *connection, ServeSlot *slot)
+{
+    const ServeState *server = connection->server;
+    unsigned char header[GCD_PROTOCOL_HEADER_SIZE];
+    slot->status = MATH_SUCCESS;
+    slot->fatal = false;
+    slot->job = NULL;
+    memory_clear(&slot->request, sizeof(slot->request));
+
+    if (platform_socket_receive(&connection->socket, header, sizeof(header)) != sizeof(header))
+    {
+        return false;
+    }
+    slot->status = gcd_protocol_decode_request(header, &slot->request);
+    if (slot->status == MATH_SUCCESS && slot->request.count > server->max_pairs)
+    {
+        slot->status = MATH_ERROR_INVALID_INPUT;
+    }
+
+    // Receive the 2n operands in growing chunks
+    MathNatural n = slot->request.count;
+    size_t payload = slot->status == MATH_SUCCESS ? (size_t)(2 * n * sizeof(GcdInteger)) : 0;
+    size_t received = 0;
+    while (received < payload)
+    {
+        size_t target = MATH_MIN(payload, MATH_MAX(SERVE_PAYLOAD_CHUNK_BYTES, 2 * received));
+        if (!system_serve_reserve(slot, target))
+        {
+            slot->status = MATH_ERROR_MEMORY;
+            break;
+        }
+        size_t wanted = target - received;
+        if (platform_socket_receive(&connection->socket, slot->buffer + received, wanted) != wanted)
+        {
+            return false;
+        }
+        received = target;
+    }
+
+    // Then room for the reply header and the n GCDs behind them
+    if (slot->status == MATH_SUCCESS && !system_serve_reserve(slot, 3 * payload / 2 + GCD_PROTOCOL_HEADER_SIZE))
+    {
+        slot->status = MATH_ERROR_MEMORY;
+    }
+    if (slot->status != MATH_SUCCESS)
+    {
+        slot->fatal = true;
+        slot->request.count = 0;
+        return true;
+    }
+
+    unsigned int algorithm = slot->request.algorithm;
+    if (algorithm == GCD_PROTOCOL_DEFAULT_ALGORITHM)
+    {
+        slot->variant = server->options->variant;
+    }
+    else if (algorithm < GCD_VARIANT_CAPACITY && gcd_registry_get_implementation((GcdAlgorithmVariant)algorithm) != NULL)
+    {
+        slot->variant = (GcdAlgorithmVariant)algorithm;
+    }
+    else
+    {
+        slot->status = MATH_ERROR_NOT_IMPLEMENTED; // The payload was read: the next frame is intact
+    }
+    return true;
+}
+
+/**
+ * @brief Start computing a slot's request
+ *
+ * @param server Server state
+ * @param slot Slot holding a request
+ */
+static void system_serve_start(const ServeState *server, ServeSlot *slot)
+{
+    MathNatural n = slot->request.count;
+    if (slot->status != MATH_SUCCESS || n == 0)
+    {
+        slot->result = math_create_batch_result(0, 0, 0.0);
+        return;
+    }
+
+    const GcdInteger *operands = (const GcdInteger *)slot->buffer;
+    GcdInteger *results = (GcdInteger *)(slot->buffer + 2 * n * sizeof(GcdInteger) + GCD_PROTOCOL_HEADER_SIZE);
+    bool interleaved = slot->request.layout == GCD_DATASET_AOS;
+    MathNatural thread_count = server->options->thread_count;
+
+    if (n > SERVE_INLINE_PAIRS)
+    {
+        SystemJobOptions options = SYSTEM_JOB_OPTIONS_INIT;
+        options.thread_count = thread_count;
+        MathStatus status = interleaved
+                                ? system_submit_batch_interleaved(slot->variant, operands, results, n, &options,
+                                                                  &slot->job)
+                                : system_submit_batch(slot->variant, operands, operands + n, results, n, &options,
+                                                      &slot->job);
+        if (status != MATH_SUCCESS)
+        {
+            slot->status = status;
+        }
+        return;
+    }
+
+    slot->result = interleaved
+                       ? system_execute_gcd_batch_interleaved(slot->variant, operands, results, n, 1)
+                       : system_execute_gcd_batch_parallel(slot->variant, operands, operands + n, results, n, 1);
+}
+
+/**
+ * @brief Wait for a slot's batch and send its reply
+ *
+ * @param connection Connection to reply on
+ * @param slot Slot whose request was started
+ * @return true if the reply was sent
+ */
+static bool system_serve_reply(ServeConnection *connection, ServeSlot *slot)
+{
+    MathResult result = slot->result;
+    if (slot->job != NULL)
+    {
+        system_job_wait(slot->job, &result);
+        system_job_release(slot->job);
+        slot->job = NULL;
+    }
+
+    // Rejected pairs carry MATH_INVALID_VALUE; the request itself succeeded
+    MathNatural n = slot->request.count;
+    GcdReplyHeader reply = {.status = slot->status, .count = 0, .tag = slot->request.tag, .failed = 0};
+    if (reply.status == MATH_SUCCESS && result.status != MATH_SUCCESS &&
+        !(result.status == MATH_ERROR_OVERFLOW && result.iterations == n))
+    {
+        reply.status = result.status;
+    }
+    if (reply.status == MATH_SUCCESS)
+    {
+        reply.count = n;
+        reply.failed = n - (MathNatural)result.value;
+    }
+
+    unsigned char header[GCD_PROTOCOL_HEADER_SIZE];
+    unsigned char *frame = header;
+    if (reply.count > 0)
+    {
+        frame = slot->buffer + 2 * n * sizeof(GcdInteger); // Right in front of the GCDs
+    }
+    gcd_protocol_encode_reply(&reply, frame);
+    bool sent = platform_socket_send(&connection->socket, frame,
+                                     GCD_PROTOCOL_HEADER_SIZE + (size_t)(reply.count * sizeof(GcdInteger)));
+
+    ServeState *server = connection->server;
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&server->lock);
+#endif
+    server->stats.requests++;
+    server->stats.pairs += reply.count;
+    server->stats.failed += reply.failed;
+    server->stats.errors += reply.status != MATH_SUCCESS;
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&server->lock);
+#endif
+    return sent;
+}
+
+/**
+ * @brief Serve one connection until the client closes it
+ *
+ * @param connection Connection to serve (freed here)
+ */
+static void system_serve_connection(ServeConnection *connection)
+{
+    ServeSlot slots[2];
+    memory_clear(slots, sizeof(slots));
+    int in_flight = -1; // Slot whose reply is still owed
+
+    for (;;)
+    {
+        // A lockstep client waits for the reply before sending more: answer it first
+        if (in_flight >= 0 && !platform_socket_readable(&connection->socket, 0))
+        {
+            bool sent = system_serve_reply(connection, &slots[in_flight]);
+            in_flight = -1;
+            if (!sent)
+            {
+                break;
+            }
+            continue;
+        }
+
+        int next = (in_flight == 0) ? 1 : 0;
+        if (!system_serve_read(connection, &slots[next]))
+        {
+            break;
+        }
+        system_serve_start(connection->server, &slots[next]);
+
+        // Replies leave in request order
+        if (in_flight >= 0 && !system_serve_reply(connection, &slots[in_flight]))
+        {
+            in_flight = next;
+            break;
+        }
+        in_flight = next;
+        if (slots[next].fatal)
+        {
+            break;
+        }
+    }
+
+    // A request still computing must finish before its buffer goes away
+    if (in_flight >= 0)
+    {
+        system_serve_reply(connection, &slots[in_flight]);
+    }
+    platform_socket_close(&connection->socket);
+    free(slots[0].buffer);
+    free(slots[1].buffer);
+
+    ServeState *server = connection->server;
+    free(connection);
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&server->lock);
+    server->active--;
+    pthread_cond_broadcast(&server->changed);
+    pthread_mutex_unlock(&server->lock);
+#else
+    server->active--;
+#endif
+}
+
+#ifdef HAS_POSIX_THREADS
+/**
+ * @brief Connection thread entry point
+ *
+ * @param arg Pointer to the ServeConnection
+ * @return NULL
+ */
+static void *system_serve_connection_main(void *arg)
+{
+    system_serve_connection((ServeConnection *)arg);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief Serve framed GCD batch requests on a socket
+ *
+ * @param options Address, default algorithm and limits
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS once connection_limit connections have been served,
+ *         or an error code
+ */
+MathStatus system_serve(const GcdServeOptions *options, GcdServeStats *stats)
+{
+    if (options == NULL || options->address == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+    if (!platform_sockets_supported() || !gcd_protocol_host_supported())
+    {
+        return MATH_ERROR_NOT_IMPLEMENTED;
+    }
+
+    MathStatus status = system_prepare_batch(options->variant);
+    if (status != MATH_SUCCESS)
+    {
+        return status;
+    }
+
+    ServeState server;
+    memory_clear(&server, sizeof(server));
+    server.options = options;
+    server.max_pairs = options->max_pairs > 0 ? options->max_pairs : GCD_PROTOCOL_MAX_PAIRS;
+    PlatformSocket listener;
+    if (!platform_socket_listen(options->address, &listener))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+#ifdef HAS_POSIX_THREADS
+    MathNatural max_connections = options->max_connections > 0 ? options->max_connections
+                                                               : GCD_SERVE_MAX_CONNECTIONS;
+    pthread_mutex_init(&server.lock, NULL);
+    pthread_cond_init(&server.changed, NULL);
+    pthread_attr_t detached;
+    pthread_attr_init(&detached);
+    pthread_attr_setdetachstate(&detached, PTHREAD_CREATE_DETACHED);
+#endif
+
+    if (options->on_ready != NULL)
+    {
+        options->on_ready(options->address, options->user_data);
+    }
+
+    while (options->connection_limit == 0 || server.stats.connections < options->connection_limit)
+    {
+        // Hold further clients in the listen queue while every slot is busy
+#ifdef HAS_POSIX_THREADS
+        pthread_mutex_lock(&server.lock);
+        while (server.active >= max_connections)
+        {
+            pthread_cond_wait(&server.changed, &server.lock);
+        }
+        pthread_mutex_unlock(&server.lock);
+#endif
+
+        ServeConnection *connection = (ServeConnection *)malloc(sizeof(ServeConnection));
+        if (connection == NULL)
+        {
+            status = MATH_ERROR_MEMORY;
+            break;
+        }
+        // A failed connection or a shortage of descriptors is no reason to stop serving
+        PlatformAcceptStatus accepted = platform_socket_accept(&listener, &connection->socket);
+        if (accepted != PLATFORM_ACCEPT_OK)
+        {
+            free(connection);
+            if (accepted == PLATFORM_ACCEPT_FAILED)
+            {
+                status = MATH_ERROR_INVALID_INPUT;
+                break;
+            }
+            continue;
+        }
+        connection->server = &server;
+
+#ifdef HAS_POSIX_THREADS
+        pthread_mutex_lock(&server.lock);
+        server.active++;
+        server.stats.connections++;
+        pthread_mutex_unlock(&server.lock);
+
+        pthread_t thread;
+        if (pthread_create(&thread, &detached, system_serve_connection_main, connection) != 0)
+        {
+            system_serve_connection(connection); // Serve it here rather than drop it
+        }
+#else
+        server.active++;
+        server.stats.connections++;
+        system_serve_connection(connection);
+#endif
+    }
+
+    // Let the connections still open finish before the state goes away
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_lock(&server.lock);
+    while (server.active > 0)
+    {
+        pthread_cond_wait(&server.changed, &server.lock);
+    }
+    pthread_mutex_unlock(&server.lock);
+    pthread_attr_destroy(&detached);
+    pthread_cond_destroy(&server.changed);
+    pthread_mutex_destroy(&server.lock);
+#endif
+    platform_socket_close(&listener);
+
+    if (stats != NULL)
+    {
+        *stats = server.stats;
+    }
+    return status;
+}
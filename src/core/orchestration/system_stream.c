@@ -0,0 +1,130 @@
+/**
+ * @file system_stream.c
+ * @brief GCDs of the operand pairs of a text or binary stream
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Records are parsed and written by gcd_stream.h; each batch of pairs in
+ * between runs on the parallel batch path.
+ */
+
+#include "system_internal.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/solution_registry.h"
+#include "../../infrastructure/utilities/math_utils.h"
+#include "../../infrastructure/utilities/memory_utils.h"
+#include <stdlib.h>
+
+// ============================================================================
+// STREAM PIPELINE
+// ============================================================================
+
+/**
+ * @brief Compute the GCD of every operand pair of a stream
+ *
+ * @param input Source of operand pairs
+ * @param output Destination of the GCDs
+ * @param options Algorithm, record format and batching (NULL = GCD_STREAM_OPTIONS_INIT)
+ * @param stats Optional run summary
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus system_stream_gcd(FILE *input, FILE *output, const GcdStreamOptions *options, GcdStreamStats *stats)
+{
+    // Auto-initialize if needed
+    if (!system_is_ready())
+    {
+        MathStatus init_status = system_init();
+        if (init_status != MATH_SUCCESS)
+        {
+            return init_status;
+        }
+    }
+
+    GcdStreamOptions defaults = GCD_STREAM_OPTIONS_INIT;
+    if (options == NULL)
+    {
+        options = &defaults;
+    }
+    if (input == NULL || output == NULL || gcd_registry_get_implementation(options->variant) == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    GcdStreamStats summary;
+    memory_clear(&summary, sizeof(summary));
+    MathNatural batch_pairs = options->batch_pairs > 0 ? options->batch_pairs : GCD_STREAM_BATCH_PAIRS;
+
+    GcdStreamReader reader;
+    GcdStreamWriter writer;
+    GcdInteger *a = (GcdInteger *)malloc(3 * batch_pairs * sizeof(GcdInteger));
+    MathStatus status = a != NULL ? MATH_SUCCESS : MATH_ERROR_MEMORY;
+    if (status == MATH_SUCCESS)
+    {
+        status = gcd_stream_reader_init(&reader, input, options->format, 0);
+        if (status == MATH_SUCCESS)
+        {
+            status = gcd_stream_writer_init(&writer, output, options->format, 0);
+            if (status != MATH_SUCCESS)
+            {
+                gcd_stream_reader_destroy(&reader);
+            }
+        }
+    }
+    if (status != MATH_SUCCESS)
+    {
+        free(a);
+        return status;
+    }
+
+    GcdInteger *b = a + batch_pairs;
+    GcdInteger *out = b + batch_pairs;
+    double start_time = math_get_time_ms();
+
+    for (;;)
+    {
+        MathNatural n = gcd_stream_read_pairs(&reader, a, b, batch_pairs);
+        if (n == 0)
+        {
+            status = reader.status;
+            break;
+        }
+
+        // A batch with rejected pairs still computes all the others
+        MathResult result = system_execute_gcd_batch_parallel(options->variant, a, b, out, n,
+                                                              options->thread_count);
+        if (result.status != MATH_SUCCESS && !(result.status == MATH_ERROR_OVERFLOW && result.iterations == n))
+        {
+            status = result.status;
+            break;
+        }
+        summary.pairs += n;
+        summary.failed += n - (MathNatural)result.value;
+        summary.compute_time_ms += result.execution_time_ms;
+
+        status = gcd_stream_write_values(&writer, out, n);
+        if (status != MATH_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    // GCDs of the pairs before a malformed record are still delivered
+    MathStatus flush_status = gcd_stream_flush(&writer);
+    if (status == MATH_SUCCESS)
+    {
+        status = flush_status;
+    }
+    summary.execution_time_ms = math_elapsed_time_ms(start_time, math_get_time_ms());
+    summary.lines = reader.lines;
+    summary.bytes_read = reader.bytes;
+    summary.bytes_written = writer.bytes;
+
+    gcd_stream_writer_destroy(&writer);
+    gcd_stream_reader_destroy(&reader);
+    free(a);
+
+    if (stats != NULL)
+    {
+        *stats = summary;
+    }
+    return status;
+}
@@ -0,0 +1,390 @@
+/**
+ * @file cpu_detection.c
+ * @brief CPU capability detection for runtime kernel dispatch
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This file implements instruction set detection. On x86 it relies on the
+ * GCC/Clang CPU builtins; on AArch64 NEON is part of the base architecture.
+ * Other compilers and architectures report no SIMD support, which makes all
+ * callers fall back to their portable scalar code.
+ */
+
+#include "cpu_detection.h"
+#include <stdio.h>
+#include <string.h>
+
+// Platform detection for CPU feature builtins
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HAS_X86_CPU_BUILTINS 1
+#include <cpuid.h>
+#endif
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+#define HAS_POSIX_SYSCONF 1
+#include <unistd.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define HAS_AARCH64_NEON 1
+#endif
+
+#if defined(__aarch64__) && defined(__linux__)
+#define HAS_AARCH64_HWCAP 1
+#include <sys/auxv.h>
+#endif
+
+// ============================================================================
+// CAPABILITY QUERIES
+// ============================================================================
+
+/**
+ * @brief Check whether the CPU and build support AVX2
+ *
+ * @return true if AVX2 kernels can be executed
+ */
+bool platform_has_avx2(void)
+{
+#ifdef HAS_X86_CPU_BUILTINS
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Check whether the CPU and build support AVX-512 F and CD
+ *
+ * @return true if AVX-512 kernels can be executed
+ */
+bool platform_has_avx512(void)
+{
+#ifdef HAS_X86_CPU_BUILTINS
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f") != 0 && __builtin_cpu_supports("avx512cd") != 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Check whether the CPU and build support AArch64 NEON
+ *
+ * @return true if NEON kernels can be executed
+ */
+bool platform_has_neon(void)
+{
+#ifdef HAS_AARCH64_NEON
+    return true; // Mandatory on every AArch64 CPU
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Detect the best SIMD level available on this CPU
+ *
+ * @return Highest supported SIMD level
+ */
+PlatformSimdLevel platform_detect_simd_level(void)
+{
+    if (platform_has_avx512())
+    {
+        return PLATFORM_SIMD_AVX512;
+    }
+    if (platform_has_avx2())
+    {
+        return PLATFORM_SIMD_AVX2;
+    }
+    if (platform_has_neon())
+    {
+        return PLATFORM_SIMD_NEON;
+    }
+    return PLATFORM_SIMD_NONE;
+}
+
+/**
+ * @brief Check whether a given SIMD level can be executed here
+ *
+ * @param level SIMD level to check
+ * @return true if kernels for this level can run
+ */
+bool platform_supports_simd_level(PlatformSimdLevel level)
+{
+    switch (level)
+    {
+    case PLATFORM_SIMD_NONE:
+        return true;
+    case PLATFORM_SIMD_NEON:
+        return platform_has_neon();
+    case PLATFORM_SIMD_AVX2:
+        return platform_has_avx2();
+    case PLATFORM_SIMD_AVX512:
+        return platform_has_avx512();
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Get a human-readable name for a SIMD level
+ *
+ * @param level SIMD level
+ * @return Level name (e.g. "AVX2")
+ */
+const char *platform_simd_level_name(PlatformSimdLevel level)
+{
+    switch (level)
+    {
+    case PLATFORM_SIMD_NONE:
+        return "Scalar";
+    case PLATFORM_SIMD_NEON:
+        return "NEON";
+    case PLATFORM_SIMD_AVX2:
+        return "AVX2";
+    case PLATFORM_SIMD_AVX512:
+        return "AVX-512";
+    default:
+        return "Unknown";
+    }
+}
+
+// ============================================================================
+// INSTRUCTION SET LEVELS
+// ============================================================================
+
+#ifdef HAS_X86_CPU_BUILTINS
+
+/**
+ * @brief Check a CPUID feature bit
+ *
+ * @param leaf CPUID leaf
+ * @param use_ecx true for ECX, false for EBX
+ * @param bit Bit number
+ * @return true if the leaf exists and the bit is set
+ */
+static bool platform_cpuid_bit(unsigned int leaf, bool use_ecx, unsigned int bit)
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(leaf & 0x80000000u, NULL) < leaf || !__get_cpuid(leaf, &eax, &ebx, &ecx, &edx))
+    {
+        return false;
+    }
+    return (((use_ecx ? ecx : ebx) >> bit) & 1u) != 0;
+}
+
+#endif
+
+#ifdef HAS_AARCH64_HWCAP
+// Older kernel headers lack the ARMv8.1/8.2 bits
+#ifndef HWCAP_ATOMICS
+#define HWCAP_ATOMICS (1UL << 8)
+#endif
+#ifndef HWCAP_ASIMDRDM
+#define HWCAP_ASIMDRDM (1UL << 12)
+#endif
+#ifndef HWCAP_DCPOP
+#define HWCAP_DCPOP (1UL << 16)
+#endif
+#endif
+
+/**
+ * @brief Check whether code compiled for an instruction set level can run here
+ *
+ * The CPU builtins also check that the OS saves the vector registers a
+ * level needs; the few features they cannot name are read from CPUID.
+ *
+ * @param level ISA level to check
+ * @return true if the CPU provides every feature of the level
+ */
+bool platform_supports_isa_level(PlatformIsaLevel level)
+{
+    switch (level)
+    {
+    case PLATFORM_ISA_BASELINE:
+        return true;
+#ifdef HAS_X86_CPU_BUILTINS
+    case PLATFORM_ISA_X86_64_V2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("popcnt") && __builtin_cpu_supports("ssse3") &&
+               __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("sse4.2") &&
+               platform_cpuid_bit(1, true, 13); // CMPXCHG16B
+    case PLATFORM_ISA_X86_64_V3:
+        return platform_supports_isa_level(PLATFORM_ISA_X86_64_V2) && __builtin_cpu_supports("avx2") &&
+               __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("fma") &&
+               platform_cpuid_bit(1, true, 22) &&          // MOVBE
+               platform_cpuid_bit(1, true, 29) &&          // F16C
+               platform_cpuid_bit(0x80000001u, true, 5);   // LZCNT
+    case PLATFORM_ISA_X86_64_V4:
+        return platform_supports_isa_level(PLATFORM_ISA_X86_64_V3) && __builtin_cpu_supports("avx512f") &&
+               __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512cd") &&
+               __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl");
+#endif
+#if defined(HAS_AARCH64_HWCAP)
+    case PLATFORM_ISA_ARMV8_2:
+    {
+        unsigned long hwcap = getauxval(AT_HWCAP);
+        unsigned long wanted = HWCAP_ATOMICS | HWCAP_ASIMDRDM | HWCAP_DCPOP;
+        return (hwcap & wanted) == wanted;
+    }
+#elif defined(__aarch64__) && defined(__APPLE__)
+    case PLATFORM_ISA_ARMV8_2:
+        return true; // Every Apple AArch64 core implements ARMv8.4-A or later
+#endif
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Detect the highest instruction set level of this CPU
+ *
+ * @return PLATFORM_ISA_BASELINE if no level above the baseline is supported
+ */
+PlatformIsaLevel platform_detect_isa_level(void)
+{
+    static const PlatformIsaLevel descending[] = {
+        PLATFORM_ISA_X86_64_V4, PLATFORM_ISA_X86_64_V3, PLATFORM_ISA_X86_64_V2, PLATFORM_ISA_ARMV8_2};
+
+    for (size_t i = 0; i < sizeof(descending) / sizeof(descending[0]); i++)
+    {
+        if (platform_supports_isa_level(descending[i]))
+        {
+            return descending[i];
+        }
+    }
+    return PLATFORM_ISA_BASELINE;
+}
+
+/**
+ * @brief Get a human-readable name for an instruction set level
+ *
+ * @param level ISA level
+ * @return Level name as accepted by -march (e.g. "x86-64-v3")
+ */
+const char *platform_isa_level_name(PlatformIsaLevel level)
+{
+    switch (level)
+    {
+    case PLATFORM_ISA_BASELINE:
+        return "baseline";
+    case PLATFORM_ISA_X86_64_V2:
+        return "x86-64-v2";
+    case PLATFORM_ISA_X86_64_V3:
+        return "x86-64-v3";
+    case PLATFORM_ISA_X86_64_V4:
+        return "x86-64-v4";
+    case PLATFORM_ISA_ARMV8_2:
+        return "armv8.2-a";
+    default:
+        return "unknown";
+    }
+}
+
+// ============================================================================
+// HOST IDENTIFICATION
+// ============================================================================
+
+/**
+ * @brief Copy a string, trimming surrounding whitespace
+ */
+static void platform_copy_trimmed(char *buffer, size_t size, const char *text)
+{
+    while (*text == ' ' || *text == '\t')
+    {
+        text++;
+    }
+    size_t length = strlen(text);
+    while (length > 0 && (text[length - 1] == ' ' || text[length - 1] == '\n' || text[length - 1] == '\r'))
+    {
+        length--;
+    }
+    if (length >= size)
+    {
+        length = size - 1;
+    }
+    memcpy(buffer, text, length);
+    buffer[length] = '\0';
+}
+
+/**
+ * @brief Get the CPU model string (e.g. the x86 brand string)
+ *
+ * @param buffer Output buffer
+ * @param size Buffer size in bytes
+ * @return true if a model was found; otherwise buffer holds "unknown"
+ */
+bool platform_cpu_model(char *buffer, size_t size)
+{
+    if (buffer == NULL || size == 0)
+    {
+        return false;
+    }
+
+#ifdef HAS_X86_CPU_BUILTINS
+    // Brand string: 48 bytes from extended leaves 0x80000002..0x80000004
+    unsigned int brand[12];
+    if (__get_cpuid_max(0x80000000u, NULL) >= 0x80000004u)
+    {
+        for (unsigned int leaf = 0; leaf < 3; leaf++)
+        {
+            __get_cpuid(0x80000002u + leaf, &brand[4 * leaf], &brand[4 * leaf + 1],
+                        &brand[4 * leaf + 2], &brand[4 * leaf + 3]);
+        }
+        char text[sizeof(brand) + 1];
+        memcpy(text, brand, sizeof(brand));
+        text[sizeof(brand)] = '\0';
+        platform_copy_trimmed(buffer, size, text);
+        if (buffer[0] != '\0')
+        {
+            return true;
+        }
+    }
+#elif defined(__linux__)
+    // Other Linux targets describe the CPU in /proc/cpuinfo
+    FILE *cpuinfo = fopen("/proc/cpuinfo", "r");
+    if (cpuinfo != NULL)
+    {
+        char line[256];
+        bool found = false;
+        while (!found && fgets(line, sizeof(line), cpuinfo) != NULL)
+        {
+            char *separator = strchr(line, ':');
+            if (separator != NULL && (strncmp(line, "model name", 10) == 0 || strncmp(line, "Hardware", 8) == 0))
+            {
+                platform_copy_trimmed(buffer, size, separator + 1);
+                found = buffer[0] != '\0';
+            }
+        }
+        fclose(cpuinfo);
+        if (found)
+        {
+            return true;
+        }
+    }
+#endif
+
+    platform_copy_trimmed(buffer, size, "unknown");
+    return false;
+}
+
+/**
+ * @brief Get the number of online logical CPUs
+ *
+ * @return CPU count (at least 1)
+ */
+unsigned int platform_cpu_count(void)
+{
+    long cpus = 1;
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    cpus = (long)info.dwNumberOfProcessors;
+#elif defined(HAS_POSIX_SYSCONF) && defined(_SC_NPROCESSORS_ONLN)
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return cpus > 0 ? (unsigned int)cpus : 1u;
+}
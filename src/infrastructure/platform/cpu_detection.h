@@ -0,0 +1,141 @@
+/**
+ * @file cpu_detection.h
+ * @brief CPU capability detection for runtime kernel dispatch
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares functions to query the instruction set extensions
+ * available on the running CPU, so vectorized kernels can be selected at
+ * runtime instead of at compile time.
+ */
+
+#ifndef CPU_DETECTION_H
+#define CPU_DETECTION_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// ============================================================================
+// SIMD CAPABILITY LEVELS
+// ============================================================================
+
+/**
+ * @brief SIMD instruction set levels relevant to the GCD kernels
+ */
+typedef enum
+{
+    PLATFORM_SIMD_NONE,   /**< No usable SIMD extension (portable scalar code) */
+    PLATFORM_SIMD_NEON,   /**< ARM Advanced SIMD (AArch64), 2 x 64-bit lanes */
+    PLATFORM_SIMD_AVX2,   /**< x86 AVX2, 4 x 64-bit lanes */
+    PLATFORM_SIMD_AVX512  /**< x86 AVX-512 F + CD, 8 x 64-bit lanes */
+} PlatformSimdLevel;
+
+/**
+ * @brief Instruction set levels that whole object files are compiled for
+ *
+ * These are the psABI micro-architecture levels on x86-64 and the
+ * architecture revision on AArch64; a build may carry one copy of its
+ * multiversioned kernels per level (see gcd_isa.h).
+ */
+typedef enum
+{
+    PLATFORM_ISA_BASELINE,  /**< Whatever the build targets by default */
+    PLATFORM_ISA_X86_64_V2, /**< SSE4.2, SSSE3, POPCNT, CMPXCHG16B */
+    PLATFORM_ISA_X86_64_V3, /**< v2 + AVX2, BMI1/2, FMA, LZCNT, MOVBE */
+    PLATFORM_ISA_X86_64_V4, /**< v3 + AVX-512 F, BW, CD, DQ, VL */
+    PLATFORM_ISA_ARMV8_2,   /**< ARMv8.2-A: LSE atomics, RDM, DC CVAP */
+    PLATFORM_ISA_LEVEL_COUNT
+} PlatformIsaLevel;
+
+// ============================================================================
+// CAPABILITY QUERIES
+// ============================================================================
+
+/**
+ * @brief Check whether the CPU and build support AVX2
+ *
+ * @return true if AVX2 kernels can be executed
+ */
+bool platform_has_avx2(void);
+
+/**
+ * @brief Check whether the CPU and build support AVX-512 F and CD
+ *
+ * @return true if AVX-512 kernels can be executed
+ */
+bool platform_has_avx512(void);
+
+/**
+ * @brief Check whether the CPU and build support AArch64 NEON
+ *
+ * @return true if NEON kernels can be executed
+ */
+bool platform_has_neon(void);
+
+/**
+ * @brief Detect the best SIMD level available on this CPU
+ *
+ * @return Highest supported SIMD level
+ */
+PlatformSimdLevel platform_detect_simd_level(void);
+
+/**
+ * @brief Check whether a given SIMD level can be executed here
+ *
+ * @param level SIMD level to check
+ * @return true if kernels for this level can run
+ */
+bool platform_supports_simd_level(PlatformSimdLevel level);
+
+/**
+ * @brief Get a human-readable name for a SIMD level
+ *
+ * @param level SIMD level
+ * @return Level name (e.g. "AVX2")
+ */
+const char *platform_simd_level_name(PlatformSimdLevel level);
+
+/**
+ * @brief Check whether code compiled for an instruction set level can run here
+ *
+ * @param level ISA level to check
+ * @return true if the CPU (and OS register state) provides every feature of the level
+ */
+bool platform_supports_isa_level(PlatformIsaLevel level);
+
+/**
+ * @brief Detect the highest instruction set level of this CPU
+ *
+ * @return PLATFORM_ISA_BASELINE if no level above the baseline is supported
+ */
+PlatformIsaLevel platform_detect_isa_level(void);
+
+/**
+ * @brief Get a human-readable name for an instruction set level
+ *
+ * @param level ISA level
+ * @return Level name as accepted by -march (e.g. "x86-64-v3")
+ */
+const char *platform_isa_level_name(PlatformIsaLevel level);
+
+// ============================================================================
+// HOST IDENTIFICATION
+// ============================================================================
+
+/**
+ * @brief Get the CPU model string (e.g. the x86 brand string)
+ *
+ * @param buffer Output buffer
+ * @param size Buffer size in bytes
+ * @return true if a model was found; otherwise buffer holds "unknown"
+ */
+bool platform_cpu_model(char *buffer, size_t size);
+
+/**
+ * @brief Get the number of online logical CPUs
+ *
+ * @return CPU count (at least 1)
+ */
+unsigned int platform_cpu_count(void);
+
+#endif // CPU_DETECTION_H
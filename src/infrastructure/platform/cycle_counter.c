@@ -0,0 +1,230 @@
+/**
+ * @file cycle_counter.c
+ * @brief Low-overhead hardware tick counter for benchmarking
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This file implements the tick counter reads. On x86 the TSC is fenced
+ * with lfence on both sides of rdtsc at the start and read with rdtscp
+ * (which waits for earlier instructions) at the end, following Intel's
+ * benchmarking guidance. On AArch64 an isb orders the CNTVCT_EL0 read.
+ * The TSC on every CPU this project targets runs at a constant rate
+ * independent of frequency scaling, so it measures wall time, not core
+ * cycles.
+ */
+
+// clock_gettime() is hidden by glibc in strict C99 builds
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+#endif
+
+#include "cycle_counter.h"
+#include <time.h>
+
+// Platform detection for counter instructions
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HAS_X86_TSC 1
+#include <x86intrin.h>
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define HAS_AARCH64_CNTVCT 1
+#endif
+
+// Platform detection for the OS fallback and TSC calibration
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || defined(_POSIX_VERSION)
+#ifndef SIMPLE_TIMING
+#define HAS_POSIX_TIMING 1
+#endif
+#endif
+
+// Platform detection for the one-time calibration
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || defined(__MINGW32__)
+#ifndef SINGLE_THREADED
+#define HAS_POSIX_THREADS 1
+#endif
+#endif
+
+#if defined(HAS_X86_TSC) && defined(HAS_POSIX_THREADS)
+#include <pthread.h>
+#endif
+
+// ============================================================================
+// OS CLOCK
+// ============================================================================
+// Backs the counter where no instruction is available and calibrates the
+// TSC; not needed on AArch64, whose counter reports its own rate.
+
+#ifndef HAS_AARCH64_CNTVCT
+
+/**
+ * @brief Read the OS clock in its native ticks
+ *
+ * @return Nanoseconds (POSIX) or clock() ticks
+ */
+static uint64_t counter_read_os_clock(void)
+{
+#ifdef HAS_POSIX_TIMING
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+    {
+        return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+    }
+#endif
+    return (uint64_t)clock();
+}
+
+/**
+ * @brief Rate of counter_read_os_clock in ticks per second
+ */
+static double counter_os_clock_frequency(void)
+{
+#ifdef HAS_POSIX_TIMING
+    return 1e9;
+#else
+    return (double)CLOCKS_PER_SEC;
+#endif
+}
+#endif
+
+// ============================================================================
+// COUNTER READS
+// ============================================================================
+
+/**
+ * @brief Read the counter at the start of a timed region
+ *
+ * @return Current tick count
+ */
+uint64_t platform_counter_start(void)
+{
+#if defined(HAS_X86_TSC)
+    _mm_lfence();
+    uint64_t ticks = __rdtsc();
+    _mm_lfence();
+    return ticks;
+#elif defined(HAS_AARCH64_CNTVCT)
+    uint64_t ticks;
+    __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0" : "=r"(ticks) : : "memory");
+    return ticks;
+#else
+    return counter_read_os_clock();
+#endif
+}
+
+/**
+ * @brief Read the counter at the end of a timed region
+ *
+ * @return Current tick count
+ */
+uint64_t platform_counter_stop(void)
+{
+#if defined(HAS_X86_TSC)
+    unsigned int aux;
+    uint64_t ticks = __rdtscp(&aux);
+    _mm_lfence();
+    return ticks;
+#elif defined(HAS_AARCH64_CNTVCT)
+    uint64_t ticks;
+    __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0\n\tisb" : "=r"(ticks) : : "memory");
+    return ticks;
+#else
+    return counter_read_os_clock();
+#endif
+}
+
+// ============================================================================
+// COUNTER PROPERTIES
+// ============================================================================
+
+#ifdef HAS_X86_TSC
+static double g_tsc_frequency; /**< Ticks per second, set once by counter_calibrate_tsc */
+#ifdef HAS_POSIX_THREADS
+static pthread_once_t g_tsc_calibration_once = PTHREAD_ONCE_INIT;
+#endif
+
+/**
+ * @brief Measure the TSC rate against the OS clock
+ */
+static void counter_calibrate_tsc(void)
+{
+    // Count TSC ticks across a fixed stretch of OS time
+    const double os_frequency = counter_os_clock_frequency();
+    const uint64_t os_window = (uint64_t)(os_frequency / 100.0); // 10 ms
+    uint64_t os_start = counter_read_os_clock();
+    uint64_t tsc_start = platform_counter_start();
+    uint64_t os_now;
+    do
+    {
+        os_now = counter_read_os_clock();
+    } while (os_now - os_start < os_window);
+    uint64_t tsc_end = platform_counter_stop();
+
+    g_tsc_frequency = (double)(tsc_end - tsc_start) * os_frequency / (double)(os_now - os_start);
+}
+#endif
+
+/**
+ * @brief Get the counter rate in ticks per second
+ *
+ * @return Ticks per second
+ */
+double platform_counter_frequency(void)
+{
+#if defined(HAS_X86_TSC)
+#ifdef HAS_POSIX_THREADS
+    pthread_once(&g_tsc_calibration_once, counter_calibrate_tsc);
+#else
+    if (g_tsc_frequency == 0.0)
+    {
+        counter_calibrate_tsc();
+    }
+#endif
+    return g_tsc_frequency;
+#elif defined(HAS_AARCH64_CNTVCT)
+    uint64_t frequency;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(frequency));
+    return (double)frequency;
+#else
+    return counter_os_clock_frequency();
+#endif
+}
+
+/**
+ * @brief Get the source backing the counter in this build
+ *
+ * @return Counter source
+ */
+PlatformCounterSource platform_counter_source(void)
+{
+#if defined(HAS_X86_TSC)
+    return PLATFORM_COUNTER_TSC;
+#elif defined(HAS_AARCH64_CNTVCT)
+    return PLATFORM_COUNTER_CNTVCT;
+#elif defined(HAS_POSIX_TIMING)
+    return PLATFORM_COUNTER_MONOTONIC;
+#else
+    return PLATFORM_COUNTER_CLOCK;
+#endif
+}
+
+/**
+ * @brief Get a human-readable name for a counter source
+ *
+ * @param source Counter source
+ * @return Source name (e.g. "rdtsc")
+ */
+const char *platform_counter_name(PlatformCounterSource source)
+{
+    switch (source)
+    {
+    case PLATFORM_COUNTER_TSC:
+        return "rdtsc";
+    case PLATFORM_COUNTER_CNTVCT:
+        return "cntvct_el0";
+    case PLATFORM_COUNTER_MONOTONIC:
+        return "clock_gettime";
+    case PLATFORM_COUNTER_CLOCK:
+        return "clock";
+    default:
+        return "unknown";
+    }
+}
@@ -0,0 +1,347 @@
+/**
+ * @file file_mapping.c
+ * @brief Memory-mapped files for large binary datasets
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This file implements file mappings with mmap() on POSIX systems and
+ * file mapping objects on Windows. Without either, files are read into a
+ * heap buffer, and writable "mappings" are buffers written to the file
+ * when unmapped.
+ */
+
+// ftruncate() is hidden by glibc in strict C99 builds
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+#endif
+
+#include "file_mapping.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Platform detection for file mappings
+#if defined(_WIN32)
+#define HAS_WINDOWS_MAPPING 1
+#include <windows.h>
+#elif defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+#define HAS_POSIX_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// PLATFORM BACKENDS
+// ============================================================================
+
+/**
+ * @brief Reset a mapping to the unmapped state
+ *
+ * @param mapping Mapping to reset
+ */
+static void mapping_reset(PlatformFileMapping *mapping)
+{
+    memset(mapping, 0, sizeof(*mapping));
+    mapping->handle = -1;
+}
+
+#if defined(HAS_POSIX_MMAP)
+
+/**
+ * @brief Map an open file descriptor
+ *
+ * @param fd Open descriptor (owned by the mapping on success)
+ * @param size Bytes to map
+ * @param writable Map shared and writable instead of private and read-only
+ * @param mapping Output mapping
+ * @return true on success
+ */
+static bool mapping_map_descriptor(int fd, size_t size, bool writable, PlatformFileMapping *mapping)
+{
+    void *data = NULL;
+    if (size > 0) // mmap() rejects empty ranges
+    {
+        data = mmap(NULL, size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                    writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+#ifdef MADV_SEQUENTIAL
+        if (!writable)
+        {
+            madvise(data, size, MADV_SEQUENTIAL);
+        }
+#endif
+    }
+
+    mapping->data = data;
+    mapping->size = size;
+    mapping->writable = writable;
+    mapping->mapped = true;
+    mapping->handle = fd;
+    return true;
+}
+
+#elif defined(HAS_WINDOWS_MAPPING)
+
+/**
+ * @brief Map a view of an open file
+ *
+ * @param file Open file handle (owned by the mapping on success)
+ * @param size Bytes to map
+ * @param writable Map for writing (the mapping object extends the file to size)
+ * @param mapping Output mapping
+ * @return true on success
+ */
+static bool mapping_map_handle(HANDLE file, size_t size, bool writable, PlatformFileMapping *mapping)
+{
+    HANDLE view_object = NULL;
+    void *data = NULL;
+    if (size > 0) // Mapping objects cannot be empty
+    {
+        unsigned long long size64 = (unsigned long long)size;
+        view_object = CreateFileMappingA(file, NULL, writable ? PAGE_READWRITE : PAGE_READONLY,
+                                         (DWORD)(size64 >> 32), (DWORD)(size64 & 0xFFFFFFFFu), NULL);
+        if (view_object == NULL)
+        {
+            return false;
+        }
+        data = MapViewOfFile(view_object, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+        if (data == NULL)
+        {
+            CloseHandle(view_object);
+            return false;
+        }
+    }
+
+    mapping->data = data;
+    mapping->size = size;
+    mapping->writable = writable;
+    mapping->mapped = true;
+    mapping->handle = (intptr_t)file;
+    mapping->view = (intptr_t)view_object;
+    return true;
+}
+
+#endif
+
+// ============================================================================
+// MAPPINGS
+// ============================================================================
+
+/**
+ * @brief Map an existing file for reading
+ *
+ * @param path File to map
+ * @param mapping Output mapping
+ * @return true on success
+ */
+bool platform_map_file_read(const char *path, PlatformFileMapping *mapping)
+{
+    if (path == NULL || mapping == NULL)
+    {
+        return false;
+    }
+    mapping_reset(mapping);
+
+#if defined(HAS_POSIX_MMAP)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) ||
+        !mapping_map_descriptor(fd, (size_t)info.st_size, false, mapping))
+    {
+        close(fd);
+        return false;
+    }
+    return true;
+#elif defined(HAS_WINDOWS_MAPPING)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || (unsigned long long)file_size.QuadPart > (size_t)-1 ||
+        !mapping_map_handle(file, (size_t)file_size.QuadPart, false, mapping))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    return true;
+#else
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        size = ftell(file);
+        rewind(file);
+    }
+
+    void *data = NULL;
+    bool ok = size >= 0;
+    if (ok && size > 0)
+    {
+        data = malloc((size_t)size);
+        ok = data != NULL && fread(data, 1, (size_t)size, file) == (size_t)size;
+    }
+    fclose(file);
+    if (!ok)
+    {
+        free(data);
+        return false;
+    }
+    mapping->data = data;
+    mapping->size = (size_t)size;
+    return true;
+#endif
+}
+
+/**
+ * @brief Create (or truncate) a file of a given size and map it for writing
+ *
+ * @param path File to create
+ * @param size File size in bytes
+ * @param mapping Output mapping
+ * @return true on success
+ */
+bool platform_map_file_create(const char *path, size_t size, PlatformFileMapping *mapping)
+{
+    if (path == NULL || mapping == NULL)
+    {
+        return false;
+    }
+    mapping_reset(mapping);
+
+#if defined(HAS_POSIX_MMAP)
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+    if (ftruncate(fd, (off_t)size) != 0 || !mapping_map_descriptor(fd, size, true, mapping))
+    {
+        close(fd);
+        return false;
+    }
+    return true;
+#elif defined(HAS_WINDOWS_MAPPING)
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    if (!mapping_map_handle(file, size, true, mapping))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    return true;
+#else
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+    void *data = NULL;
+    if (size > 0)
+    {
+        data = calloc(1, size);
+        if (data == NULL)
+        {
+            fclose(file);
+            return false;
+        }
+    }
+    mapping->data = data;
+    mapping->size = size;
+    mapping->writable = true;
+    mapping->stream = file;
+    return true;
+#endif
+}
+
+/**
+ * @brief Unmap a file, committing the contents of a writable mapping
+ *
+ * @param mapping Mapping to release
+ * @return true unless writing the contents back failed
+ */
+bool platform_unmap_file(PlatformFileMapping *mapping)
+{
+    if (mapping == NULL)
+    {
+        return true;
+    }
+
+    bool ok = true;
+#if defined(HAS_POSIX_MMAP)
+    if (mapping->data != NULL && munmap(mapping->data, mapping->size) != 0)
+    {
+        ok = false;
+    }
+    if (mapping->handle >= 0 && close((int)mapping->handle) != 0 && mapping->writable)
+    {
+        ok = false;
+    }
+#elif defined(HAS_WINDOWS_MAPPING)
+    if (mapping->data != NULL)
+    {
+        if (mapping->writable && !FlushViewOfFile(mapping->data, 0))
+        {
+            ok = false;
+        }
+        UnmapViewOfFile(mapping->data);
+    }
+    if (mapping->view != 0)
+    {
+        CloseHandle((HANDLE)mapping->view);
+    }
+    if (mapping->handle != -1)
+    {
+        CloseHandle((HANDLE)mapping->handle);
+    }
+#else
+    if (mapping->stream != NULL)
+    {
+        FILE *file = (FILE *)mapping->stream;
+        if (mapping->size > 0 && fwrite(mapping->data, 1, mapping->size, file) != mapping->size)
+        {
+            ok = false;
+        }
+        if (fclose(file) != 0)
+        {
+            ok = false;
+        }
+    }
+    free(mapping->data);
+#endif
+    mapping_reset(mapping);
+    return ok;
+}
+
+/**
+ * @brief Check whether file mappings are backed by the OS
+ *
+ * @return true when mappings avoid copying the file into memory
+ */
+bool platform_file_mapping_is_native(void)
+{
+#if defined(HAS_POSIX_MMAP) || defined(HAS_WINDOWS_MAPPING)
+    return true;
+#else
+    return false;
+#endif
+}
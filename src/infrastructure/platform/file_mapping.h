@@ -0,0 +1,78 @@
+/**
+ * @file file_mapping.h
+ * @brief Memory-mapped files for large binary datasets
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares read-only and read-write file mappings. POSIX
+ * systems use mmap(); Windows uses CreateFileMapping/MapViewOfFile. On
+ * other platforms the file is read into (or written back from) a heap
+ * buffer, so callers work against the same pointer either way and only
+ * lose the zero-copy property.
+ */
+
+#ifndef FILE_MAPPING_H
+#define FILE_MAPPING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// MAPPINGS
+// ============================================================================
+
+/**
+ * @brief A mapped file
+ */
+typedef struct
+{
+    void *data;      /**< First byte of the file (NULL for an empty file) */
+    size_t size;     /**< File size in bytes */
+    bool writable;   /**< Created by platform_map_file_create() */
+    bool mapped;     /**< true = OS mapping, false = heap buffer fallback */
+    intptr_t handle; /**< File descriptor or HANDLE (-1 = none) */
+    intptr_t view;   /**< Windows mapping object (0 = none) */
+    void *stream;    /**< Fallback writer: FILE receiving the buffer on unmap */
+} PlatformFileMapping;
+
+/**
+ * @brief Map an existing file for reading
+ *
+ * The mapping is advised for sequential access where the OS supports it.
+ *
+ * @param path File to map
+ * @param mapping Output mapping
+ * @return true on success (mapping->data covers mapping->size bytes)
+ */
+bool platform_map_file_read(const char *path, PlatformFileMapping *mapping);
+
+/**
+ * @brief Create (or truncate) a file of a given size and map it for writing
+ *
+ * Bytes stored through mapping->data reach the file by the time
+ * platform_unmap_file() returns.
+ *
+ * @param path File to create
+ * @param size File size in bytes
+ * @param mapping Output mapping
+ * @return true on success
+ */
+bool platform_map_file_create(const char *path, size_t size, PlatformFileMapping *mapping);
+
+/**
+ * @brief Unmap a file, committing the contents of a writable mapping
+ *
+ * @param mapping Mapping to release (reset afterwards; NULL is ignored)
+ * @return true unless writing the contents back failed
+ */
+bool platform_unmap_file(PlatformFileMapping *mapping);
+
+/**
+ * @brief Check whether file mappings are backed by the OS
+ *
+ * @return true when mappings avoid copying the file into memory
+ */
+bool platform_file_mapping_is_native(void);
+
+#endif // FILE_MAPPING_H
@@ -0,0 +1,493 @@
+/**
+ * @file socket_io.c
+ * @brief Stream sockets for the resident GCD server
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This file implements Unix domain and TCP stream sockets on top of the
+ * BSD socket API. Platforms without it get stubs that always fail.
+ */
+
+// lstat() and S_ISSOCK are hidden by glibc in strict C99 builds
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+#endif
+
+#include "socket_io.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Platform detection for BSD sockets
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+#define HAS_POSIX_SOCKETS 1
+#include <errno.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+// Keep a vanished peer from killing the process with SIGPIPE
+#if defined(HAS_POSIX_SOCKETS) && defined(MSG_NOSIGNAL)
+#define SOCKET_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SOCKET_SEND_FLAGS 0
+#endif
+
+/**
+ * @brief Pending connections queued by the kernel before accept()
+ */
+#define SOCKET_LISTEN_BACKLOG 64
+
+// ============================================================================
+// ADDRESSES
+// ============================================================================
+
+/**
+ * @brief Reset a socket to the closed state
+ *
+ * @param socket Socket to reset
+ */
+static void socket_reset(PlatformSocket *socket)
+{
+    memset(socket, 0, sizeof(*socket));
+    socket->handle = -1;
+}
+
+#ifdef HAS_POSIX_SOCKETS
+
+/**
+ * @brief Decoded socket address
+ */
+typedef struct
+{
+    bool is_unix;
+    struct sockaddr_un unix_address;
+    struct sockaddr_in inet_address;
+} SocketAddress;
+
+/**
+ * @brief Parse "unix:<path>", "tcp:<host>:<port>" or "<host>:<port>"
+ *
+ * @param text Address text
+ * @param address Output address
+ * @return true if the address is well formed
+ */
+static bool socket_parse_address(const char *text, SocketAddress *address)
+{
+    memset(address, 0, sizeof(*address));
+    if (text == NULL)
+    {
+        return false;
+    }
+
+    if (strncmp(text, "unix:", 5) == 0)
+    {
+        const char *path = text + 5;
+        size_t length = strlen(path);
+        if (length == 0 || length >= sizeof(address->unix_address.sun_path) || length >= PLATFORM_SOCKET_PATH_MAX)
+        {
+            return false;
+        }
+        address->is_unix = true;
+        address->unix_address.sun_family = AF_UNIX;
+        memcpy(address->unix_address.sun_path, path, length + 1);
+        return true;
+    }
+
+    if (strncmp(text, "tcp:", 4) == 0)
+    {
+        text += 4;
+    }
+    const char *colon = strrchr(text, ':');
+    if (colon == NULL || colon == text || (size_t)(colon - text) >= 64)
+    {
+        return false;
+    }
+
+    char *end = NULL;
+    unsigned long port = strtoul(colon + 1, &end, 10);
+    if (end == colon + 1 || *end != '\0' || port > 65535)
+    {
+        return false;
+    }
+
+    char host[64];
+    memcpy(host, text, (size_t)(colon - text));
+    host[colon - text] = '\0';
+
+    address->inet_address.sin_family = AF_INET;
+    address->inet_address.sin_port = htons((uint16_t)port);
+    if (strcmp(host, "*") == 0)
+    {
+        address->inet_address.sin_addr.s_addr = htonl(INADDR_ANY);
+        return true;
+    }
+    if (strcmp(host, "localhost") == 0)
+    {
+        address->inet_address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        return true;
+    }
+    return inet_pton(AF_INET, host, &address->inet_address.sin_addr) == 1;
+}
+
+/**
+ * @brief Generic view of a parsed address
+ *
+ * @param address Parsed address
+ * @param length Output size of the returned structure
+ * @return Address to hand to bind() or connect()
+ */
+static const struct sockaddr *socket_address_view(const SocketAddress *address, socklen_t *length)
+{
+    if (address->is_unix)
+    {
+        *length = (socklen_t)sizeof(address->unix_address);
+        return (const struct sockaddr *)&address->unix_address;
+    }
+    *length = (socklen_t)sizeof(address->inet_address);
+    return (const struct sockaddr *)&address->inet_address;
+}
+
+/**
+ * @brief Open a stream socket for an address family
+ *
+ * @param address Parsed address
+ * @return Descriptor, or -1 on failure
+ */
+static int socket_open(const SocketAddress *address)
+{
+    int fd = socket(address->is_unix ? AF_UNIX : AF_INET, SOCK_STREAM, 0);
+#ifdef SO_NOSIGPIPE
+    if (fd >= 0)
+    {
+        int on = 1;
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+    }
+#endif
+    return fd;
+}
+
+#endif
+
+// ============================================================================
+// SOCKETS
+// ============================================================================
+
+/**
+ * @brief Check whether this build can open sockets
+ *
+ * @return true on platforms with BSD sockets
+ */
+bool platform_sockets_supported(void)
+{
+#ifdef HAS_POSIX_SOCKETS
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Bind and listen on an address
+ *
+ * @param address Address to listen on
+ * @param listener Output socket
+ * @return true on success
+ */
+bool platform_socket_listen(const char *address, PlatformSocket *listener)
+{
+    if (listener == NULL)
+    {
+        return false;
+    }
+    socket_reset(listener);
+
+#ifdef HAS_POSIX_SOCKETS
+    SocketAddress parsed;
+    if (!socket_parse_address(address, &parsed))
+    {
+        return false;
+    }
+
+    if (parsed.is_unix)
+    {
+        // Only a socket left behind by an earlier server may be replaced
+        struct stat info;
+        if (lstat(parsed.unix_address.sun_path, &info) == 0)
+        {
+            if (!S_ISSOCK(info.st_mode) || unlink(parsed.unix_address.sun_path) != 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    int fd = socket_open(&parsed);
+    if (fd < 0)
+    {
+        return false;
+    }
+    if (!parsed.is_unix)
+    {
+        int on = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    }
+
+    socklen_t length;
+    const struct sockaddr *view = socket_address_view(&parsed, &length);
+    if (bind(fd, view, length) != 0 || listen(fd, SOCKET_LISTEN_BACKLOG) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    listener->handle = fd;
+    if (parsed.is_unix)
+    {
+        memcpy(listener->unix_path, parsed.unix_address.sun_path, strlen(parsed.unix_address.sun_path) + 1);
+    }
+    return true;
+#else
+    (void)address;
+    return false;
+#endif
+}
+
+/**
+ * @brief Connect to a listening address
+ *
+ * @param address Address to connect to
+ * @param connection Output socket
+ * @return true on success
+ */
+bool platform_socket_connect(const char *address, PlatformSocket *connection)
+{
+    if (connection == NULL)
+    {
+        return false;
+    }
+    socket_reset(connection);
+
+#ifdef HAS_POSIX_SOCKETS
+    SocketAddress parsed;
+    if (!socket_parse_address(address, &parsed))
+    {
+        return false;
+    }
+
+    int fd = socket_open(&parsed);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    socklen_t length;
+    const struct sockaddr *view = socket_address_view(&parsed, &length);
+    if (connect(fd, view, length) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    if (!parsed.is_unix)
+    {
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+
+    connection->handle = fd;
+    return true;
+#else
+    (void)address;
+    return false;
+#endif
+}
+
+/**
+ * @brief Wait for the next connection on a listener
+ *
+ * @param listener Listening socket
+ * @param connection Output socket
+ * @return PLATFORM_ACCEPT_OK, PLATFORM_ACCEPT_RETRY, PLATFORM_ACCEPT_BUSY
+ *         or PLATFORM_ACCEPT_FAILED
+ */
+PlatformAcceptStatus platform_socket_accept(const PlatformSocket *listener, PlatformSocket *connection)
+{
+    if (listener == NULL || connection == NULL)
+    {
+        return PLATFORM_ACCEPT_FAILED;
+    }
+    socket_reset(connection);
+
+#ifdef HAS_POSIX_SOCKETS
+    int fd;
+    do
+    {
+        fd = accept((int)listener->handle, NULL, NULL);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0)
+    {
+        switch (errno)
+        {
+        case EBADF:
+        case EFAULT:
+        case EINVAL:
+        case ENOTSOCK:
+            return PLATFORM_ACCEPT_FAILED;
+        case EMFILE:
+        case ENFILE:
+        case ENOBUFS:
+        case ENOMEM:
+        {
+            struct timespec pause = {0, PLATFORM_ACCEPT_BACKOFF_MS * 1000000L};
+            nanosleep(&pause, NULL);
+            return PLATFORM_ACCEPT_BUSY;
+        }
+        default:
+            // ECONNABORTED, EPROTO, EPERM and the network errors Linux
+            // passes on from the pending connection
+            return PLATFORM_ACCEPT_RETRY;
+        }
+    }
+
+#ifdef SO_NOSIGPIPE
+    int no_sigpipe = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+    if (listener->unix_path[0] == '\0')
+    {
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+
+    connection->handle = fd;
+    return PLATFORM_ACCEPT_OK;
+#else
+    return PLATFORM_ACCEPT_FAILED;
+#endif
+}
+
+/**
+ * @brief Receive exactly size bytes unless the peer closes first
+ *
+ * @param socket Connected socket
+ * @param data Destination
+ * @param size Bytes wanted
+ * @return Bytes received
+ */
+size_t platform_socket_receive(const PlatformSocket *socket, void *data, size_t size)
+{
+    size_t received = 0;
+#ifdef HAS_POSIX_SOCKETS
+    unsigned char *bytes = (unsigned char *)data;
+    while (received < size)
+    {
+        ssize_t count = recv((int)socket->handle, bytes + received, size - received, 0);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            break;
+        }
+        received += (size_t)count;
+    }
+#else
+    (void)socket;
+    (void)data;
+    (void)size;
+#endif
+    return received;
+}
+
+/**
+ * @brief Send a whole buffer
+ *
+ * @param socket Connected socket
+ * @param data Bytes to send
+ * @param size Number of bytes
+ * @return true if every byte was handed to the kernel
+ */
+bool platform_socket_send(const PlatformSocket *socket, const void *data, size_t size)
+{
+#ifdef HAS_POSIX_SOCKETS
+    const unsigned char *bytes = (const unsigned char *)data;
+    size_t sent = 0;
+    while (sent < size)
+    {
+        ssize_t count = send((int)socket->handle, bytes + sent, size - sent, SOCKET_SEND_FLAGS);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            return false;
+        }
+        sent += (size_t)count;
+    }
+    return true;
+#else
+    (void)socket;
+    (void)data;
+    return size == 0;
+#endif
+}
+
+/**
+ * @brief Check whether a socket has bytes (or an end of stream) to read
+ *
+ * @param socket Connected socket
+ * @param timeout_ms Longest wait (0 = just check)
+ * @return true if a receive would not block
+ */
+bool platform_socket_readable(const PlatformSocket *socket, int timeout_ms)
+{
+#ifdef HAS_POSIX_SOCKETS
+    struct pollfd entry;
+    entry.fd = (int)socket->handle;
+    entry.events = POLLIN;
+    entry.revents = 0;
+    int ready;
+    do
+    {
+        ready = poll(&entry, 1, timeout_ms);
+    } while (ready < 0 && errno == EINTR);
+    return ready > 0;
+#else
+    (void)socket;
+    (void)timeout_ms;
+    return false;
+#endif
+}
+
+/**
+ * @brief Close a socket, removing a listener's socket file
+ *
+ * @param socket Socket to close
+ */
+void platform_socket_close(PlatformSocket *socket)
+{
+    if (socket == NULL)
+    {
+        return;
+    }
+
+#ifdef HAS_POSIX_SOCKETS
+    if (socket->handle >= 0)
+    {
+        close((int)socket->handle);
+    }
+    if (socket->unix_path[0] != '\0')
+    {
+        unlink(socket->unix_path);
+    }
+#endif
+    socket_reset(socket);
+}
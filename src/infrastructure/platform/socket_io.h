@@ -0,0 +1,141 @@
+/**
+ * @file socket_io.h
+ * @brief Stream sockets for the resident GCD server
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares listening, connecting and whole-buffer transfers
+ * on stream sockets. Addresses are written as:
+ * - "unix:<path>": a Unix domain socket at path
+ * - "tcp:<host>:<port>" or "<host>:<port>": TCP on an IPv4 address
+ *   (host is a dotted quad, "localhost" or "*" for every interface)
+ *
+ * POSIX systems use BSD sockets. Elsewhere every call fails and
+ * platform_sockets_supported() returns false.
+ */
+
+#ifndef SOCKET_IO_H
+#define SOCKET_IO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// SOCKETS
+// ============================================================================
+
+/**
+ * @brief Longest Unix domain socket path accepted
+ */
+#define PLATFORM_SOCKET_PATH_MAX 104
+
+/**
+ * @brief An open socket
+ */
+typedef struct
+{
+    intptr_t handle;                          /**< File descriptor (-1 = closed) */
+    char unix_path[PLATFORM_SOCKET_PATH_MAX]; /**< Listener's socket file, removed on close ("" = none) */
+} PlatformSocket;
+
+/**
+ * @brief Outcome of waiting for a connection
+ */
+typedef enum
+{
+    PLATFORM_ACCEPT_OK,    /**< A connection was accepted */
+    PLATFORM_ACCEPT_RETRY, /**< The pending connection failed (aborted, network error): accept again */
+    PLATFORM_ACCEPT_BUSY,  /**< Out of descriptors or memory: the call paused briefly, accept again */
+    PLATFORM_ACCEPT_FAILED /**< The listener is unusable */
+} PlatformAcceptStatus;
+
+/**
+ * @brief Pause after an accept that ran out of descriptors or memory
+ *
+ * The connection stays in the listen queue; the pause gives other
+ * connections time to close rather than spinning on the same error.
+ */
+#define PLATFORM_ACCEPT_BACKOFF_MS 50
+
+/**
+ * @brief Check whether this build can open sockets
+ *
+ * @return true on platforms with BSD sockets
+ */
+bool platform_sockets_supported(void);
+
+/**
+ * @brief Bind and listen on an address
+ *
+ * A stale Unix domain socket file at the path is replaced; any other file
+ * there makes the call fail.
+ *
+ * @param address Address to listen on (see the file comment)
+ * @param listener Output socket
+ * @return true on success
+ */
+bool platform_socket_listen(const char *address, PlatformSocket *listener);
+
+/**
+ * @brief Connect to a listening address
+ *
+ * @param address Address to connect to (see the file comment)
+ * @param connection Output socket
+ * @return true on success
+ */
+bool platform_socket_connect(const char *address, PlatformSocket *connection);
+
+/**
+ * @brief Wait for the next connection on a listener
+ *
+ * TCP connections have Nagle's algorithm turned off: replies are written
+ * whole and should leave at once. Only PLATFORM_ACCEPT_FAILED means the
+ * listener should be given up; the other failures are transient.
+ *
+ * @param listener Listening socket
+ * @param connection Output socket
+ * @return PLATFORM_ACCEPT_OK, PLATFORM_ACCEPT_RETRY, PLATFORM_ACCEPT_BUSY
+ *         or PLATFORM_ACCEPT_FAILED
+ */
+PlatformAcceptStatus platform_socket_accept(const PlatformSocket *listener, PlatformSocket *connection);
+
+/**
+ * @brief Receive exactly size bytes unless the peer closes first
+ *
+ * @param socket Connected socket
+ * @param data Destination
+ * @param size Bytes wanted
+ * @return Bytes received (less than size on end of stream or error)
+ */
+size_t platform_socket_receive(const PlatformSocket *socket, void *data, size_t size);
+
+/**
+ * @brief Send a whole buffer
+ *
+ * A peer that has gone away makes the call fail instead of raising SIGPIPE.
+ *
+ * @param socket Connected socket
+ * @param data Bytes to send
+ * @param size Number of bytes
+ * @return true if every byte was handed to the kernel
+ */
+bool platform_socket_send(const PlatformSocket *socket, const void *data, size_t size);
+
+/**
+ * @brief Check whether a socket has bytes (or an end of stream) to read
+ *
+ * @param socket Connected socket
+ * @param timeout_ms Longest wait (0 = just check)
+ * @return true if a receive would not block
+ */
+bool platform_socket_readable(const PlatformSocket *socket, int timeout_ms);
+
+/**
+ * @brief Close a socket, removing a listener's socket file
+ *
+ * @param socket Socket to close (reset afterwards; NULL is ignored)
+ */
+void platform_socket_close(PlatformSocket *socket);
+
+#endif // SOCKET_IO_H
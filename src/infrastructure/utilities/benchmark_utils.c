@@ -0,0 +1,238 @@
+/**
+ * @file benchmark_utils.c
+ * @brief Micro-benchmark harness with warmup, batched sampling and robust statistics
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Each sample is timed as one region around body(context, batch_size)
+ * with the platform tick counter. The cost of the two counter reads,
+ * estimated as the fastest of a run of empty regions, is subtracted from
+ * every sample before it is divided by the batch size.
+ */
+
+#include "benchmark_utils.h"
+#include "math_utils.h"
+#include "../platform/cycle_counter.h"
+#include <stdlib.h>
+
+/**
+ * @brief Number of empty regions timed to estimate the counter overhead
+ */
+#define BENCHMARK_OVERHEAD_PROBES 64
+
+// ============================================================================
+// OPTIMIZATION BARRIERS
+// ============================================================================
+
+static volatile MathInteger g_benchmark_sink;
+
+/**
+ * @brief Store a value into a volatile sink (barrier fallback for other compilers)
+ *
+ * @param value Value to keep alive
+ */
+void benchmark_sink(MathInteger value)
+{
+    g_benchmark_sink = value;
+}
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Ticks spent in a timed region, net of the counter overhead
+ *
+ * @param start Counter value at the start
+ * @param stop Counter value at the end
+ * @param overhead Overhead of an empty region
+ * @return Net ticks (never negative)
+ */
+static uint64_t benchmark_net_ticks(uint64_t start, uint64_t stop, uint64_t overhead)
+{
+    uint64_t elapsed = stop - start;
+    return elapsed > overhead ? elapsed - overhead : 0;
+}
+
+/**
+ * @brief Order doubles ascending for qsort
+ */
+static int benchmark_compare_doubles(const void *left, const void *right)
+{
+    double a = *(const double *)left;
+    double b = *(const double *)right;
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Estimate the ticks taken by the counter reads themselves
+ *
+ * @return Fastest empty region in ticks
+ */
+static uint64_t benchmark_measure_overhead(void)
+{
+    uint64_t overhead = UINT64_MAX;
+    for (int i = 0; i < BENCHMARK_OVERHEAD_PROBES; i++)
+    {
+        uint64_t start = platform_counter_start();
+        uint64_t stop = platform_counter_stop();
+        overhead = MATH_MIN(overhead, stop - start);
+    }
+    return overhead;
+}
+
+/**
+ * @brief Double the batch size until one sample lasts at least min_sample_ns
+ *
+ * Each candidate size is timed twice and the faster run is kept, so a
+ * single interrupted or cold run cannot stop the doubling early.
+ *
+ * @param body Code under measurement
+ * @param context Opaque pointer passed to body
+ * @param min_sample_ns Target sample duration
+ * @param ns_per_tick Counter period
+ * @param overhead Counter overhead in ticks
+ * @return Calibrated batch size
+ */
+static MathNatural benchmark_calibrate_batch(BenchmarkBodyFunc body, void *context, double min_sample_ns,
+                                             double ns_per_tick, uint64_t overhead)
+{
+    MathNatural batch = 1;
+    while (batch < BENCHMARK_MAX_BATCH_SIZE)
+    {
+        uint64_t fastest = UINT64_MAX;
+        for (int run = 0; run < 2; run++)
+        {
+            uint64_t start = platform_counter_start();
+            body(context, batch);
+            uint64_t stop = platform_counter_stop();
+            fastest = MATH_MIN(fastest, benchmark_net_ticks(start, stop, overhead));
+        }
+
+        if ((double)fastest * ns_per_tick >= min_sample_ns)
+        {
+            break;
+        }
+        batch *= 2;
+    }
+    return batch;
+}
+
+// ============================================================================
+// HARNESS INTERFACE
+// ============================================================================
+
+/**
+ * @brief Measure a benchmark body
+ *
+ * @param body Code under measurement
+ * @param context Opaque pointer passed to body
+ * @param config Harness configuration (NULL = BENCHMARK_CONFIG_INIT)
+ * @param stats Output statistics
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus benchmark_run(BenchmarkBodyFunc body, void *context, const BenchmarkConfig *config, BenchmarkStats *stats)
+{
+    BenchmarkConfig effective = BENCHMARK_CONFIG_INIT;
+    if (config != NULL)
+    {
+        effective = *config;
+    }
+    if (body == NULL || stats == NULL || effective.sample_count == 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    double *samples = (double *)malloc(effective.sample_count * sizeof(double));
+    if (samples == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+
+    double ns_per_tick = 1e9 / platform_counter_frequency();
+    uint64_t overhead = benchmark_measure_overhead();
+
+    // Warm up before calibrating: a cold first call (page faults, cache and
+    // predictor misses) would otherwise end the doubling at a batch of 1
+    MathNatural batch = effective.batch_size;
+    MathNatural warmup_batch = batch != 0 ? batch : 1;
+    body(context, 1);
+    for (MathNatural w = 0; w < effective.warmup_samples; w++)
+    {
+        body(context, warmup_batch);
+    }
+    if (batch == 0)
+    {
+        batch = benchmark_calibrate_batch(body, context, effective.min_sample_ns, ns_per_tick, overhead);
+    }
+
+    for (MathNatural s = 0; s < effective.sample_count; s++)
+    {
+        uint64_t start = platform_counter_start();
+        body(context, batch);
+        uint64_t stop = platform_counter_stop();
+        samples[s] = (double)benchmark_net_ticks(start, stop, overhead) * ns_per_tick / (double)batch;
+    }
+
+    MathNatural n = effective.sample_count;
+    stats->mean_ns = math_calculate_average_time(samples, n);
+    stats->stddev_ns = math_calculate_stddev_time(samples, n, stats->mean_ns);
+
+    // Order statistics: nearest-rank p99, midpoint median for even counts
+    qsort(samples, n, sizeof(double), benchmark_compare_doubles);
+    stats->min_ns = samples[0];
+    stats->max_ns = samples[n - 1];
+    stats->median_ns = (n % 2 != 0) ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2.0;
+    stats->p99_ns = samples[(99 * n + 99) / 100 - 1];
+    stats->median_ticks = stats->median_ns / ns_per_tick;
+    stats->overhead_ticks = (double)overhead;
+    stats->sample_count = n;
+    stats->batch_size = batch;
+    stats->total_operations = n * batch;
+
+    free(samples);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Convert benchmark statistics to performance metrics
+ *
+ * @param stats Benchmark statistics
+ * @param metrics Output metrics
+ */
+void benchmark_stats_to_metrics(const BenchmarkStats *stats, MathPerformanceMetrics *metrics)
+{
+    if (stats == NULL || metrics == NULL)
+    {
+        return;
+    }
+
+    metrics->avg_time_ms = stats->mean_ns / 1e6;
+    metrics->min_time_ms = stats->min_ns / 1e6;
+    metrics->max_time_ms = stats->max_ns / 1e6;
+    metrics->stddev_time_ms = stats->stddev_ns / 1e6;
+    metrics->execution_time_ms = stats->mean_ns * (double)stats->total_operations / 1e6;
+    metrics->total_runs = stats->total_operations;
+    metrics->successful_runs = stats->total_operations;
+    metrics->success_rate = stats->total_operations > 0 ? 1.0 : 0.0;
+}
+
+/**
+ * @brief Get the name of the counter used for timing
+ *
+ * @return Counter name (e.g. "rdtsc")
+ */
+const char *benchmark_timer_name(void)
+{
+    return platform_counter_name(platform_counter_source());
+}
+
+/**
+ * @brief Get the rate of the counter used for timing
+ *
+ * @return Ticks per second
+ */
+double benchmark_timer_frequency(void)
+{
+    return platform_counter_frequency();
+}
@@ -0,0 +1,168 @@
+/**
+ * @file benchmark_utils.h
+ * @brief Micro-benchmark harness with warmup, batched sampling and robust statistics
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * A single GCD call takes tens of nanoseconds, below the resolution and
+ * the overhead of a millisecond clock. The harness therefore times
+ * batches of calls with the hardware tick counter, sizing each batch so
+ * one sample lasts well above the counter overhead, and repeats the
+ * measurement to report the distribution (min, median, p99, stddev)
+ * rather than a single mean.
+ */
+
+#ifndef BENCHMARK_UTILS_H
+#define BENCHMARK_UTILS_H
+
+#include "../../core/domain/mathematical_types.h"
+#include <stdbool.h>
+
+// ============================================================================
+// HARNESS DEFAULTS
+// ============================================================================
+
+/**
+ * @brief Default number of untimed samples run before measuring
+ */
+#define BENCHMARK_DEFAULT_WARMUP_SAMPLES 16
+
+/**
+ * @brief Default number of timed samples
+ */
+#define BENCHMARK_DEFAULT_SAMPLE_COUNT 1000
+
+/**
+ * @brief Default minimum duration of one sample when calibrating the batch size
+ */
+#define BENCHMARK_DEFAULT_MIN_SAMPLE_NS 10000.0
+
+/**
+ * @brief Upper bound on calls per sample chosen by calibration
+ */
+#define BENCHMARK_MAX_BATCH_SIZE (1u << 24)
+
+// ============================================================================
+// OPTIMIZATION BARRIERS
+// ============================================================================
+
+/**
+ * @brief Force a value to be materialized, so the work producing it cannot be removed
+ *
+ * BENCHMARK_CLOBBER_MEMORY additionally makes the compiler assume all
+ * memory was read and written, so stores into result buffers are kept.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define BENCHMARK_DO_NOT_OPTIMIZE(value) __asm__ __volatile__("" : : "r,m"(value) : "memory")
+#define BENCHMARK_CLOBBER_MEMORY() __asm__ __volatile__("" : : : "memory")
+#else
+#define BENCHMARK_DO_NOT_OPTIMIZE(value) benchmark_sink((MathInteger)(value))
+#define BENCHMARK_CLOBBER_MEMORY() benchmark_sink(0)
+#endif
+
+/**
+ * @brief Store a value into a volatile sink (barrier fallback for other compilers)
+ *
+ * @param value Value to keep alive
+ */
+void benchmark_sink(MathInteger value);
+
+// ============================================================================
+// HARNESS TYPES
+// ============================================================================
+
+/**
+ * @brief Code under measurement: run the benchmarked operation repetitions times
+ *
+ * The loop lives inside the body, so the indirect call is paid once per
+ * sample rather than once per operation.
+ */
+typedef void (*BenchmarkBodyFunc)(void *context, MathNatural repetitions);
+
+/**
+ * @brief Harness configuration
+ */
+typedef struct
+{
+    MathNatural warmup_samples; /**< Untimed samples run first (caches, branch predictors, clocks) */
+    MathNatural sample_count;   /**< Timed samples */
+    MathNatural batch_size;     /**< Operations per sample (0 = calibrate to min_sample_ns) */
+    double min_sample_ns;       /**< Target sample duration when calibrating */
+} BenchmarkConfig;
+
+/**
+ * @brief Benchmark configuration initialization macro
+ */
+#define BENCHMARK_CONFIG_INIT {                              \
+    .warmup_samples = BENCHMARK_DEFAULT_WARMUP_SAMPLES,      \
+    .sample_count = BENCHMARK_DEFAULT_SAMPLE_COUNT,          \
+    .batch_size = 0,                                         \
+    .min_sample_ns = BENCHMARK_DEFAULT_MIN_SAMPLE_NS}
+
+/**
+ * @brief Per-operation timing distribution of one benchmark run
+ *
+ * Each sample is the time of one batch divided by the batch size, with
+ * the counter's own read overhead subtracted.
+ */
+typedef struct
+{
+    double min_ns;                /**< Fastest sample */
+    double median_ns;             /**< Median sample */
+    double p99_ns;                /**< 99th percentile sample */
+    double max_ns;                /**< Slowest sample */
+    double mean_ns;               /**< Mean over all samples */
+    double stddev_ns;             /**< Sample standard deviation */
+    double median_ticks;          /**< Median in counter ticks per operation */
+    double overhead_ticks;        /**< Counter read overhead subtracted from each sample */
+    MathNatural sample_count;     /**< Timed samples */
+    MathNatural batch_size;       /**< Operations per sample */
+    MathNatural total_operations; /**< Timed operations (sample_count * batch_size) */
+} BenchmarkStats;
+
+// ============================================================================
+// HARNESS INTERFACE
+// ============================================================================
+
+/**
+ * @brief Measure a benchmark body
+ *
+ * Makes one discarded call and runs the warmup samples, then calibrates
+ * the batch size (doubling until a sample lasts at least min_sample_ns)
+ * unless one is given, then times sample_count batches.
+ *
+ * @param body Code under measurement
+ * @param context Opaque pointer passed to body
+ * @param config Harness configuration (NULL = BENCHMARK_CONFIG_INIT)
+ * @param stats Output statistics
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_MEMORY
+ */
+MathStatus benchmark_run(BenchmarkBodyFunc body, void *context, const BenchmarkConfig *config, BenchmarkStats *stats);
+
+/**
+ * @brief Convert benchmark statistics to performance metrics
+ *
+ * Metrics are per operation in milliseconds, with total_runs equal to the
+ * number of timed operations, so they merge with the metrics gathered
+ * by the execution paths.
+ *
+ * @param stats Benchmark statistics
+ * @param metrics Output metrics
+ */
+void benchmark_stats_to_metrics(const BenchmarkStats *stats, MathPerformanceMetrics *metrics);
+
+/**
+ * @brief Get the name of the counter used for timing
+ *
+ * @return Counter name (e.g. "rdtsc")
+ */
+const char *benchmark_timer_name(void);
+
+/**
+ * @brief Get the rate of the counter used for timing
+ *
+ * @return Ticks per second
+ */
+double benchmark_timer_frequency(void);
+
+#endif // BENCHMARK_UTILS_H
@@ -0,0 +1,1983 @@
+/**
+ * @file bignum_utils.c
+ * @brief Arbitrary-precision integer arithmetic for GCD algorithms
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This file implements the limb-array arithmetic behind MathBigInteger.
+ * Magnitudes are little-endian limb arrays; every routine keeps the
+ * representation normalized (no leading zero limbs, zero is non-negative).
+ */
+
+#include "bignum_utils.h"
+#include "math_utils.h"
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================================
+// LIMB HELPERS
+// ============================================================================
+
+#define BIGNUM_LIMB_MAX ((MathLimb)~(MathLimb)0)
+
+#if MATH_LIMB_BITS == 64
+#define BIGNUM_DECIMAL_CHUNK ((MathLimb)10000000000000000000ULL) /* 10^19 */
+#define BIGNUM_DECIMAL_CHUNK_DIGITS 19
+#else
+#define BIGNUM_DECIMAL_CHUNK ((MathLimb)1000000000UL) /* 10^9 */
+#define BIGNUM_DECIMAL_CHUNK_DIGITS 9
+#endif
+
+/**
+ * @brief Leading zero bits of a non-zero limb
+ */
+static unsigned bignum_limb_clz(MathLimb limb)
+{
+#if (defined(__GNUC__) || defined(__clang__)) && MATH_LIMB_BITS == 64
+    return (unsigned)__builtin_clzll((unsigned long long)limb);
+#elif defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_clz((unsigned int)limb);
+#else
+    unsigned count = 0;
+    while ((limb & ((MathLimb)1 << (MATH_LIMB_BITS - 1))) == 0)
+    {
+        limb <<= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Trailing zero bits of a non-zero limb
+ */
+static unsigned bignum_limb_ctz(MathLimb limb)
+{
+#if (defined(__GNUC__) || defined(__clang__)) && MATH_LIMB_BITS == 64
+    return (unsigned)__builtin_ctzll((unsigned long long)limb);
+#elif defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctz((unsigned int)limb);
+#else
+    unsigned count = 0;
+    while ((limb & 1) == 0)
+    {
+        limb >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Compare two normalized magnitudes given as raw limb arrays
+ */
+static int bignum_compare_limbs(const MathLimb *a, MathNatural a_size,
+                                const MathLimb *b, MathNatural b_size)
+{
+    if (a_size != b_size)
+    {
+        return a_size > b_size ? 1 : -1;
+    }
+
+    for (MathNatural i = a_size; i > 0; i--)
+    {
+        if (a[i - 1] != b[i - 1])
+        {
+            return a[i - 1] > b[i - 1] ? 1 : -1;
+        }
+    }
+
+    return 0;
+}
+
+// ============================================================================
+// SIZING
+// ============================================================================
+
+/**
+ * @brief Number of limbs needed to hold a value of the given bit length
+ *
+ * @param bits Bit length
+ * @return Limb count (at least 1)
+ */
+MathNatural bignum_limbs_for_bits(MathNatural bits)
+{
+    MathNatural limbs = (bits + MATH_LIMB_BITS - 1) / MATH_LIMB_BITS;
+    return limbs > 0 ? limbs : 1;
+}
+
+/**
+ * @brief Upper bound on the limbs needed to parse a number literal
+ *
+ * @param text Decimal or 0x-prefixed hexadecimal literal
+ * @return Limb count (at least 1)
+ */
+MathNatural bignum_limbs_for_string(const char *text)
+{
+    if (text == NULL)
+    {
+        return 1;
+    }
+
+    if (*text == '-' || *text == '+')
+    {
+        text++;
+    }
+
+    bool is_hex = text[0] == '0' && (text[1] == 'x' || text[1] == 'X');
+    if (is_hex)
+    {
+        text += 2;
+    }
+
+    MathNatural digits = (MathNatural)strlen(text);
+
+    // log2(10) < 3.322, so 3322 bits per thousand decimal digits is an upper bound
+    MathNatural bits = is_hex ? digits * 4 : (digits * 3322) / 1000 + 1;
+    return bignum_limbs_for_bits(bits) + 1;
+}
+
+// ============================================================================
+// INITIALIZATION AND ASSIGNMENT
+// ============================================================================
+
+/**
+ * @brief Initialize a big integer over caller-provided limb storage
+ *
+ * @param x Big integer to initialize (set to zero)
+ * @param limbs Limb storage
+ * @param capacity Number of limbs in the storage
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus bignum_init_buffer(MathBigInteger *x, MathLimb *limbs, MathNatural capacity)
+{
+    if (x == NULL || (limbs == NULL && capacity > 0))
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    x->limbs = limbs;
+    x->size = 0;
+    x->capacity = capacity;
+    x->negative = false;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Initialize a big integer with limb storage carved from an arena
+ *
+ * @param x Big integer to initialize (set to zero)
+ * @param arena Arena to allocate from
+ * @param capacity Number of limbs to reserve
+ * @return MATH_SUCCESS, or MATH_ERROR_MEMORY if the arena is exhausted
+ */
+MathStatus bignum_alloc(MathBigInteger *x, MemoryArena *arena, MathNatural capacity)
+{
+    if (x == NULL || arena == NULL || capacity == 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathLimb *limbs = (MathLimb *)memory_arena_alloc(arena, (size_t)capacity * sizeof(MathLimb),
+                                                     MEMORY_ARENA_DEFAULT_ALIGNMENT);
+    if (limbs == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+
+    return bignum_init_buffer(x, limbs, capacity);
+}
+
+/**
+ * @brief Set a big integer to zero
+ *
+ * @param x Big integer to clear
+ */
+void bignum_set_zero(MathBigInteger *x)
+{
+    if (x != NULL)
+    {
+        x->size = 0;
+        x->negative = false;
+    }
+}
+
+/**
+ * @brief Set a big integer from an unsigned 64-bit value
+ *
+ * @param x Destination
+ * @param value Value to store
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if capacity is insufficient
+ */
+MathStatus bignum_set_natural(MathBigInteger *x, MathNatural value)
+{
+    if (x == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    x->size = 0;
+    x->negative = false;
+
+    while (value != 0)
+    {
+        if (x->size >= x->capacity)
+        {
+            return MATH_ERROR_OVERFLOW;
+        }
+
+        x->limbs[x->size++] = (MathLimb)value;
+#if MATH_LIMB_BITS == 64
+        value = 0;
+#else
+        value >>= MATH_LIMB_BITS;
+#endif
+    }
+
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Set a big integer from a signed 64-bit value
+ *
+ * @param x Destination
+ * @param value Value to store
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if capacity is insufficient
+ */
+MathStatus bignum_set_int(MathBigInteger *x, MathInteger value)
+{
+    // Negate in unsigned arithmetic so INT64_MIN is representable
+    MathNatural magnitude = value < 0 ? (MathNatural)0 - (MathNatural)value : (MathNatural)value;
+
+    MathStatus status = bignum_set_natural(x, magnitude);
+    if (status == MATH_SUCCESS)
+    {
+        x->negative = value < 0;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Copy one big integer into another
+ *
+ * @param dest Destination
+ * @param src Source
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if capacity is insufficient
+ */
+MathStatus bignum_copy(MathBigInteger *dest, const MathBigInteger *src)
+{
+    if (dest == NULL || src == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (dest == src)
+    {
+        return MATH_SUCCESS;
+    }
+
+    if (src->size > dest->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    if (src->size > 0)
+    {
+        memmove(dest->limbs, src->limbs, (size_t)src->size * sizeof(MathLimb));
+    }
+
+    dest->size = src->size;
+    dest->negative = src->negative;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Strip leading zero limbs and canonicalize the sign of zero
+ *
+ * @param x Big integer to normalize
+ */
+void bignum_normalize(MathBigInteger *x)
+{
+    if (x == NULL)
+    {
+        return;
+    }
+
+    while (x->size > 0 && x->limbs[x->size - 1] == 0)
+    {
+        x->size--;
+    }
+
+    if (x->size == 0)
+    {
+        x->negative = false;
+    }
+}
+
+// ============================================================================
+// QUERIES AND COMPARISON
+// ============================================================================
+
+/**
+ * @brief Check whether a big integer is zero
+ */
+bool bignum_is_zero(const MathBigInteger *x)
+{
+    return x == NULL || x->size == 0;
+}
+
+/**
+ * @brief Check whether the magnitude of a big integer fits in 64 bits
+ */
+bool bignum_fits_natural(const MathBigInteger *x)
+{
+    return bignum_bit_length(x) <= 64;
+}
+
+/**
+ * @brief Low 64 bits of the magnitude
+ *
+ * @param x Big integer
+ * @return |x| mod 2^64
+ */
+MathNatural bignum_to_natural(const MathBigInteger *x)
+{
+    return bignum_extract_bits(x, 0, 64);
+}
+
+/**
+ * @brief Convert to a signed 64-bit value
+ *
+ * @param x Big integer
+ * @param value Output value
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if x does not fit
+ */
+MathStatus bignum_to_int(const MathBigInteger *x, MathInteger *value)
+{
+    if (x == NULL || value == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (!bignum_fits_natural(x))
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    MathNatural magnitude = bignum_to_natural(x);
+    MathNatural limit = (MathNatural)INT64_MAX + (x->negative ? 1 : 0);
+    if (magnitude > limit)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    *value = x->negative ? (MathInteger)((MathNatural)0 - magnitude) : (MathInteger)magnitude;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Compare magnitudes
+ *
+ * @return Negative, zero or positive as |a| <, ==, > |b|
+ */
+int bignum_compare_abs(const MathBigInteger *a, const MathBigInteger *b)
+{
+    return bignum_compare_limbs(a->limbs, a->size, b->limbs, b->size);
+}
+
+/**
+ * @brief Compare signed values
+ *
+ * @return Negative, zero or positive as a <, ==, > b
+ */
+int bignum_compare(const MathBigInteger *a, const MathBigInteger *b)
+{
+    if (a->negative != b->negative)
+    {
+        return a->negative ? -1 : 1;
+    }
+
+    int magnitude = bignum_compare_abs(a, b);
+    return a->negative ? -magnitude : magnitude;
+}
+
+/**
+ * @brief Number of significant bits in the magnitude (0 for zero)
+ */
+MathNatural bignum_bit_length(const MathBigInteger *x)
+{
+    if (x == NULL || x->size == 0)
+    {
+        return 0;
+    }
+
+    return x->size * MATH_LIMB_BITS - bignum_limb_clz(x->limbs[x->size - 1]);
+}
+
+/**
+ * @brief Number of trailing zero bits in the magnitude (0 for zero)
+ */
+MathNatural bignum_trailing_zeros(const MathBigInteger *x)
+{
+    if (x == NULL || x->size == 0)
+    {
+        return 0;
+    }
+
+    MathNatural index = 0;
+    while (x->limbs[index] == 0)
+    {
+        index++;
+    }
+
+    return index * MATH_LIMB_BITS + bignum_limb_ctz(x->limbs[index]);
+}
+
+/**
+ * @brief Extract a bit field from the magnitude
+ *
+ * @param x Big integer
+ * @param shift Position of the lowest bit to extract
+ * @param count Number of bits to extract (at most 64)
+ * @return (|x| >> shift) mod 2^count
+ */
+MathNatural bignum_extract_bits(const MathBigInteger *x, MathNatural shift, unsigned count)
+{
+    if (x == NULL || count == 0)
+    {
+        return 0;
+    }
+
+    if (count > 64)
+    {
+        count = 64;
+    }
+
+    MathNatural value = 0;
+    MathNatural index = shift / MATH_LIMB_BITS;
+    unsigned offset = (unsigned)(shift % MATH_LIMB_BITS);
+    unsigned filled = 0;
+
+    while (filled < count && index < x->size)
+    {
+        value |= (MathNatural)(x->limbs[index] >> offset) << filled;
+        filled += MATH_LIMB_BITS - offset;
+        offset = 0;
+        index++;
+    }
+
+    if (count < 64)
+    {
+        value &= ((MathNatural)1 << count) - 1;
+    }
+
+    return value;
+}
+
+// ============================================================================
+// SHIFTS
+// ============================================================================
+
+/**
+ * @brief Shift the magnitude left in place
+ *
+ * @param x Big integer to shift
+ * @param bits Shift amount
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if capacity is insufficient
+ */
+MathStatus bignum_shift_left(MathBigInteger *x, MathNatural bits)
+{
+    if (x == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (x->size == 0 || bits == 0)
+    {
+        return MATH_SUCCESS;
+    }
+
+    MathNatural limb_shift = bits / MATH_LIMB_BITS;
+    unsigned bit_shift = (unsigned)(bits % MATH_LIMB_BITS);
+    MathNatural new_size = x->size + limb_shift + (bit_shift != 0 ? 1 : 0);
+
+    if (new_size > x->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    if (bit_shift == 0)
+    {
+        memmove(x->limbs + limb_shift, x->limbs, (size_t)x->size * sizeof(MathLimb));
+    }
+    else
+    {
+        x->limbs[x->size + limb_shift] = x->limbs[x->size - 1] >> (MATH_LIMB_BITS - bit_shift);
+        for (MathNatural i = x->size - 1; i > 0; i--)
+        {
+            x->limbs[i + limb_shift] = (x->limbs[i] << bit_shift) |
+                                       (x->limbs[i - 1] >> (MATH_LIMB_BITS - bit_shift));
+        }
+        x->limbs[limb_shift] = x->limbs[0] << bit_shift;
+    }
+
+    for (MathNatural i = 0; i < limb_shift; i++)
+    {
+        x->limbs[i] = 0;
+    }
+
+    x->size = new_size;
+    bignum_normalize(x);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Shift the magnitude right in place (the sign is kept)
+ *
+ * @param x Big integer to shift
+ * @param bits Shift amount
+ */
+void bignum_shift_right(MathBigInteger *x, MathNatural bits)
+{
+    if (x == NULL || x->size == 0 || bits == 0)
+    {
+        return;
+    }
+
+    MathNatural limb_shift = bits / MATH_LIMB_BITS;
+    unsigned bit_shift = (unsigned)(bits % MATH_LIMB_BITS);
+
+    if (limb_shift >= x->size)
+    {
+        bignum_set_zero(x);
+        return;
+    }
+
+    MathNatural new_size = x->size - limb_shift;
+
+    if (bit_shift == 0)
+    {
+        memmove(x->limbs, x->limbs + limb_shift, (size_t)new_size * sizeof(MathLimb));
+    }
+    else
+    {
+        for (MathNatural i = 0; i + 1 < new_size; i++)
+        {
+            x->limbs[i] = (x->limbs[i + limb_shift] >> bit_shift) |
+                          (x->limbs[i + limb_shift + 1] << (MATH_LIMB_BITS - bit_shift));
+        }
+        x->limbs[new_size - 1] = x->limbs[x->size - 1] >> bit_shift;
+    }
+
+    x->size = new_size;
+    bignum_normalize(x);
+}
+
+// ============================================================================
+// ADDITION AND SUBTRACTION
+// ============================================================================
+
+/**
+ * @brief r = |a| + |b| (r may alias a or b)
+ */
+MathStatus bignum_add_abs(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b)
+{
+    if (r == NULL || a == NULL || b == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (a->size < b->size)
+    {
+        const MathBigInteger *swap = a;
+        a = b;
+        b = swap;
+    }
+
+    MathNatural a_size = a->size;
+    MathNatural b_size = b->size;
+
+    if (a_size > r->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    MathLimb carry = 0;
+    for (MathNatural i = 0; i < a_size; i++)
+    {
+        MathDoubleLimb sum = (MathDoubleLimb)a->limbs[i] + carry;
+        if (i < b_size)
+        {
+            sum += b->limbs[i];
+        }
+        r->limbs[i] = (MathLimb)sum;
+        carry = (MathLimb)(sum >> MATH_LIMB_BITS);
+    }
+
+    r->size = a_size;
+    if (carry != 0)
+    {
+        if (a_size >= r->capacity)
+        {
+            return MATH_ERROR_OVERFLOW;
+        }
+        r->limbs[r->size++] = carry;
+    }
+
+    r->negative = false;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief r = |a| - |b| (r may alias a or b)
+ *
+ * @return MATH_SUCCESS, or MATH_ERROR_UNDERFLOW if |a| < |b|
+ */
+MathStatus bignum_sub_abs(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b)
+{
+    if (r == NULL || a == NULL || b == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (bignum_compare_abs(a, b) < 0)
+    {
+        return MATH_ERROR_UNDERFLOW;
+    }
+
+    MathNatural a_size = a->size;
+    MathNatural b_size = b->size;
+
+    if (a_size > r->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    MathLimb borrow = 0;
+    for (MathNatural i = 0; i < a_size; i++)
+    {
+        MathLimb subtrahend = i < b_size ? b->limbs[i] : 0;
+        MathLimb minuend = a->limbs[i];
+        MathLimb difference = minuend - subtrahend - borrow;
+        borrow = (minuend < subtrahend) || (minuend - subtrahend < borrow) ? 1 : 0;
+        r->limbs[i] = difference;
+    }
+
+    r->size = a_size;
+    r->negative = false;
+    bignum_normalize(r);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Signed addition with explicit operand signs
+ */
+static MathStatus bignum_add_signed(MathBigInteger *r,
+                                    const MathBigInteger *a, bool a_negative,
+                                    const MathBigInteger *b, bool b_negative)
+{
+    MathStatus status;
+    bool result_negative;
+
+    if (a_negative == b_negative)
+    {
+        result_negative = a_negative;
+        status = bignum_add_abs(r, a, b);
+    }
+    else if (bignum_compare_abs(a, b) >= 0)
+    {
+        result_negative = a_negative;
+        status = bignum_sub_abs(r, a, b);
+    }
+    else
+    {
+        result_negative = b_negative;
+        status = bignum_sub_abs(r, b, a);
+    }
+
+    if (status == MATH_SUCCESS)
+    {
+        r->negative = result_negative && r->size > 0;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Signed r = a + b (r may alias a or b)
+ */
+MathStatus bignum_add(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b)
+{
+    if (r == NULL || a == NULL || b == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    return bignum_add_signed(r, a, a->negative, b, b->negative);
+}
+
+/**
+ * @brief Signed r = a - b (r may alias a or b)
+ */
+MathStatus bignum_sub(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b)
+{
+    if (r == NULL || a == NULL || b == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    return bignum_add_signed(r, a, a->negative, b, b->size > 0 && !b->negative);
+}
+
+// ============================================================================
+// MULTIPLICATION AND DIVISION
+// ============================================================================
+
+/**
+ * @brief Schoolbook product of raw magnitudes into na + nb limbs
+ */
+static void bignum_schoolbook_limbs(MathLimb *r, const MathLimb *a, MathNatural na,
+                                    const MathLimb *b, MathNatural nb)
+{
+    memset(r, 0, (size_t)(na + nb) * sizeof(MathLimb));
+
+    for (MathNatural i = 0; i < na; i++)
+    {
+        MathLimb carry = 0;
+        MathDoubleLimb multiplier = a[i];
+
+        for (MathNatural j = 0; j < nb; j++)
+        {
+            MathDoubleLimb product = multiplier * b[j] + r[i + j] + carry;
+            r[i + j] = (MathLimb)product;
+            carry = (MathLimb)(product >> MATH_LIMB_BITS);
+        }
+
+        r[i + nb] = carry;
+    }
+}
+
+/**
+ * @brief r = a + b on raw magnitudes (na >= nb, r holds na limbs), returns the carry
+ */
+static MathLimb bignum_add_limbs(MathLimb *r, const MathLimb *a, MathNatural na,
+                                 const MathLimb *b, MathNatural nb)
+{
+    MathLimb carry = 0;
+    for (MathNatural i = 0; i < na; i++)
+    {
+        MathDoubleLimb sum = (MathDoubleLimb)a[i] + carry + (i < nb ? b[i] : 0);
+        r[i] = (MathLimb)sum;
+        carry = (MathLimb)(sum >> MATH_LIMB_BITS);
+    }
+    return carry;
+}
+
+/**
+ * @brief r += x on raw magnitudes, propagating carries within rn limbs
+ */
+static void bignum_add_into(MathLimb *r, MathNatural rn, const MathLimb *x, MathNatural xn)
+{
+    MathLimb carry = 0;
+    MathNatural i = 0;
+    for (; i < xn; i++)
+    {
+        MathDoubleLimb sum = (MathDoubleLimb)r[i] + x[i] + carry;
+        r[i] = (MathLimb)sum;
+        carry = (MathLimb)(sum >> MATH_LIMB_BITS);
+    }
+    for (; carry != 0 && i < rn; i++)
+    {
+        r[i] += carry;
+        carry = r[i] == 0 ? 1 : 0;
+    }
+}
+
+/**
+ * @brief r -= x on raw magnitudes (requires r >= x), borrowing within rn limbs
+ */
+static void bignum_sub_into(MathLimb *r, MathNatural rn, const MathLimb *x, MathNatural xn)
+{
+    MathLimb borrow = 0;
+    MathNatural i = 0;
+    for (; i < xn; i++)
+    {
+        MathLimb minuend = r[i];
+        MathLimb subtrahend = x[i];
+        r[i] = minuend - subtrahend - borrow;
+        borrow = (minuend < subtrahend) || (minuend - subtrahend < borrow) ? 1 : 0;
+    }
+    for (; borrow != 0 && i < rn; i++)
+    {
+        borrow = r[i] == 0 ? 1 : 0;
+        r[i]--;
+    }
+}
+
+/**
+ * @brief Scratch limbs needed by bignum_karatsuba_limbs for n-limb operands
+ */
+static MathNatural bignum_karatsuba_scratch(MathNatural n)
+{
+    MathNatural total = 0;
+    while (n >= BIGNUM_KARATSUBA_THRESHOLD)
+    {
+        MathNatural high = n - n / 2;
+        total += 4 * (high + 1);
+        n = high + 1;
+    }
+    return total;
+}
+
+/**
+ * @brief Karatsuba product of two n-limb magnitudes into 2n limbs
+ *
+ * With a = a1*B^h + a0 and b = b1*B^h + b0:
+ * a*b = z2*B^2h + ((a0 + a1)(b0 + b1) - z0 - z2)*B^h + z0.
+ */
+static void bignum_karatsuba_limbs(MathLimb *r, const MathLimb *a, const MathLimb *b,
+                                   MathNatural n, MathLimb *scratch)
+{
+    if (n < BIGNUM_KARATSUBA_THRESHOLD)
+    {
+        bignum_schoolbook_limbs(r, a, n, b, n);
+        return;
+    }
+
+    MathNatural low = n / 2;
+    MathNatural high = n - low;
+    MathLimb *sum_a = scratch;
+    MathLimb *sum_b = sum_a + high + 1;
+    MathLimb *middle = sum_b + high + 1;
+    MathLimb *next = middle + 2 * (high + 1);
+
+    // z0 and z2 go straight into the low and high halves of r
+    bignum_karatsuba_limbs(r, a, b, low, next);
+    bignum_karatsuba_limbs(r + 2 * low, a + low, b + low, high, next);
+
+    sum_a[high] = bignum_add_limbs(sum_a, a + low, high, a, low);
+    sum_b[high] = bignum_add_limbs(sum_b, b + low, high, b, low);
+    bignum_karatsuba_limbs(middle, sum_a, sum_b, high + 1, next);
+
+    bignum_sub_into(middle, 2 * (high + 1), r, 2 * low);
+    bignum_sub_into(middle, 2 * (high + 1), r + 2 * low, 2 * high);
+    bignum_add_into(r + low, 2 * n - low, middle, 2 * (high + 1));
+}
+
+/**
+ * @brief Scratch limbs needed by bignum_mul_limbs for na x nb limbs (na >= nb)
+ */
+static MathNatural bignum_mul_limbs_scratch(MathNatural na, MathNatural nb)
+{
+    if (nb < BIGNUM_KARATSUBA_THRESHOLD)
+    {
+        return 0;
+    }
+
+    MathNatural tail = na % nb;
+    MathNatural inner = bignum_karatsuba_scratch(nb);
+    if (tail != 0)
+    {
+        inner = MATH_MAX(inner, bignum_mul_limbs_scratch(nb, tail));
+    }
+    return 2 * nb + inner;
+}
+
+/**
+ * @brief Product of raw magnitudes (na >= nb) into na + nb limbs
+ *
+ * Full nb-limb blocks of a go through Karatsuba; a shorter final block is
+ * multiplied recursively with the roles swapped, so no block is padded.
+ * Scratch layout: the block product followed by the recursion's scratch.
+ */
+static void bignum_mul_limbs(MathLimb *r, const MathLimb *a, MathNatural na,
+                             const MathLimb *b, MathNatural nb, MathLimb *scratch)
+{
+    if (nb < BIGNUM_KARATSUBA_THRESHOLD)
+    {
+        bignum_schoolbook_limbs(r, a, na, b, nb);
+        return;
+    }
+
+    MathNatural size = na + nb;
+    MathLimb *product = scratch;
+    MathLimb *next = product + 2 * nb;
+
+    memset(r, 0, (size_t)size * sizeof(MathLimb));
+
+    for (MathNatural offset = 0; offset < na; offset += nb)
+    {
+        MathNatural length = MATH_MIN(nb, na - offset);
+
+        if (length == nb)
+        {
+            bignum_karatsuba_limbs(product, a + offset, b, nb, next);
+        }
+        else
+        {
+            bignum_mul_limbs(product, b, nb, a + offset, length, next);
+        }
+
+        bignum_add_into(r + offset, size - offset, product, nb + length);
+    }
+}
+
+/**
+ * @brief Signed r = a * b (schoolbook; r must not alias a or b)
+ */
+MathStatus bignum_mul(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b)
+{
+    if (r == NULL || a == NULL || b == NULL || r == a || r == b)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (a->size == 0 || b->size == 0)
+    {
+        bignum_set_zero(r);
+        return MATH_SUCCESS;
+    }
+
+    MathNatural size = a->size + b->size;
+    if (size > r->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    bignum_schoolbook_limbs(r->limbs, a->limbs, a->size, b->limbs, b->size);
+
+    r->size = size;
+    r->negative = a->negative != b->negative;
+    bignum_normalize(r);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Signed r = a * b using Karatsuba above BIGNUM_KARATSUBA_THRESHOLD limbs
+ *
+ * Unbalanced operands are multiplied in blocks of the shorter length.
+ */
+MathStatus bignum_mul_karatsuba(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b,
+                                MemoryArena *scratch)
+{
+    if (r == NULL || a == NULL || b == NULL || r == a || r == b)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (scratch == NULL || MATH_MIN(a->size, b->size) < BIGNUM_KARATSUBA_THRESHOLD)
+    {
+        return bignum_mul(r, a, b);
+    }
+
+    bool negative = a->negative != b->negative;
+    if (a->size < b->size)
+    {
+        const MathBigInteger *swap = a;
+        a = b;
+        b = swap;
+    }
+
+    MathNatural size = a->size + b->size;
+    if (size > r->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    MemoryArenaMark mark = memory_arena_save(scratch);
+    MathNatural work_limbs = bignum_mul_limbs_scratch(a->size, b->size);
+    MathLimb *work = (MathLimb *)memory_arena_alloc(scratch, (size_t)work_limbs * sizeof(MathLimb),
+                                                    MEMORY_ARENA_DEFAULT_ALIGNMENT);
+    if (work == NULL)
+    {
+        return MATH_ERROR_MEMORY;
+    }
+
+    bignum_mul_limbs(r->limbs, a->limbs, a->size, b->limbs, b->size, work);
+    memory_arena_restore(scratch, mark);
+
+    r->size = size;
+    r->negative = negative;
+    bignum_normalize(r);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief In-place x = |x| * multiplier + addend
+ */
+MathStatus bignum_mul_limb_add(MathBigInteger *x, MathLimb multiplier, MathLimb addend)
+{
+    if (x == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathLimb carry = addend;
+    for (MathNatural i = 0; i < x->size; i++)
+    {
+        MathDoubleLimb product = (MathDoubleLimb)x->limbs[i] * multiplier + carry;
+        x->limbs[i] = (MathLimb)product;
+        carry = (MathLimb)(product >> MATH_LIMB_BITS);
+    }
+
+    if (carry != 0)
+    {
+        if (x->size >= x->capacity)
+        {
+            return MATH_ERROR_OVERFLOW;
+        }
+        x->limbs[x->size++] = carry;
+    }
+
+    x->negative = false;
+    bignum_normalize(x);
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief In-place x = x / divisor (truncated) returning |x| mod divisor
+ *
+ * @param x Dividend, replaced by the quotient
+ * @param divisor Non-zero single-limb divisor
+ * @return Remainder of the magnitude
+ */
+MathLimb bignum_div_limb(MathBigInteger *x, MathLimb divisor)
+{
+    if (x == NULL || divisor == 0)
+    {
+        return 0;
+    }
+
+    MathLimb remainder = 0;
+    for (MathNatural i = x->size; i > 0; i--)
+    {
+        MathDoubleLimb numerator = ((MathDoubleLimb)remainder << MATH_LIMB_BITS) | x->limbs[i - 1];
+        x->limbs[i - 1] = (MathLimb)(numerator / divisor);
+        remainder = (MathLimb)(numerator % divisor);
+    }
+
+    bignum_normalize(x);
+    return remainder;
+}
+
+/**
+ * @brief Knuth algorithm D on raw magnitudes
+ *
+ * Divides u (m limbs) by v (n >= 2 limbs, top limb non-zero, m >= n).
+ * un must hold m + 1 limbs and vn n limbs; q receives m - n + 1 limbs
+ * and r receives n limbs.
+ */
+static void bignum_knuth_divide(MathLimb *q, MathLimb *r,
+                                const MathLimb *u, MathNatural m,
+                                const MathLimb *v, MathNatural n,
+                                MathLimb *un, MathLimb *vn)
+{
+    // D1: normalize so the divisor's top bit is set
+    unsigned s = bignum_limb_clz(v[n - 1]);
+
+    for (MathNatural i = n - 1; i > 0; i--)
+    {
+        vn[i] = (v[i] << s) | (s != 0 ? v[i - 1] >> (MATH_LIMB_BITS - s) : 0);
+    }
+    vn[0] = v[0] << s;
+
+    un[m] = s != 0 ? u[m - 1] >> (MATH_LIMB_BITS - s) : 0;
+    for (MathNatural i = m - 1; i > 0; i--)
+    {
+        un[i] = (u[i] << s) | (s != 0 ? u[i - 1] >> (MATH_LIMB_BITS - s) : 0);
+    }
+    un[0] = u[0] << s;
+
+    for (MathNatural step = m - n + 1; step > 0; step--)
+    {
+        MathNatural j = step - 1;
+
+        // D3: estimate the quotient digit from the top two limbs
+        MathDoubleLimb numerator = ((MathDoubleLimb)un[j + n] << MATH_LIMB_BITS) | un[j + n - 1];
+        MathDoubleLimb qhat = numerator / vn[n - 1];
+        MathDoubleLimb rhat = numerator - qhat * vn[n - 1];
+
+        while ((qhat >> MATH_LIMB_BITS) != 0 ||
+               qhat * vn[n - 2] > ((rhat << MATH_LIMB_BITS) | un[j + n - 2]))
+        {
+            qhat--;
+            rhat += vn[n - 1];
+            if ((rhat >> MATH_LIMB_BITS) != 0)
+            {
+                break;
+            }
+        }
+
+        // D4: multiply and subtract
+        MathLimb carry = 0;
+        MathLimb borrow = 0;
+        for (MathNatural i = 0; i < n; i++)
+        {
+            MathDoubleLimb product = qhat * vn[i] + carry;
+            carry = (MathLimb)(product >> MATH_LIMB_BITS);
+
+            MathLimb low = (MathLimb)product;
+            MathLimb subtrahend = low + borrow;
+            MathLimb overflow = subtrahend < low ? 1 : 0;
+            MathLimb minuend = un[i + j];
+            un[i + j] = minuend - subtrahend;
+            borrow = overflow + (minuend < subtrahend ? 1 : 0);
+        }
+
+        MathLimb subtrahend = carry + borrow;
+        MathLimb overflow = subtrahend < carry ? 1 : 0;
+        MathLimb minuend = un[j + n];
+        un[j + n] = minuend - subtrahend;
+        bool negative = overflow != 0 || minuend < subtrahend;
+
+        q[j] = (MathLimb)qhat;
+
+        // D6: add back when the estimate was one too large
+        if (negative)
+        {
+            q[j]--;
+            MathLimb add_carry = 0;
+            for (MathNatural i = 0; i < n; i++)
+            {
+                MathDoubleLimb sum = (MathDoubleLimb)un[i + j] + vn[i] + add_carry;
+                un[i + j] = (MathLimb)sum;
+                add_carry = (MathLimb)(sum >> MATH_LIMB_BITS);
+            }
+            un[j + n] += add_carry;
+        }
+    }
+
+    // D8: unnormalize the remainder
+    for (MathNatural i = 0; i + 1 < n; i++)
+    {
+        r[i] = (un[i] >> s) | (s != 0 ? un[i + 1] << (MATH_LIMB_BITS - s) : 0);
+    }
+    r[n - 1] = un[n - 1] >> s;
+}
+
+/**
+ * @brief Truncated division a = q * b + r (Knuth algorithm D)
+ *
+ * @param q Quotient output (NULL if not needed)
+ * @param r Remainder output
+ * @param a Dividend
+ * @param b Divisor
+ * @param scratch Arena for the normalized working copies
+ * @return MATH_SUCCESS, MATH_ERROR_DIVISION_BY_ZERO or a capacity error
+ */
+MathStatus bignum_divmod(MathBigInteger *q, MathBigInteger *r,
+                         const MathBigInteger *a, const MathBigInteger *b,
+                         MemoryArena *scratch)
+{
+    if (r == NULL || a == NULL || b == NULL || q == r)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (b->size == 0)
+    {
+        return MATH_ERROR_DIVISION_BY_ZERO;
+    }
+
+    bool quotient_negative = a->negative != b->negative;
+    bool remainder_negative = a->negative;
+    MathNatural m = a->size;
+    MathNatural n = b->size;
+
+    // |a| < |b|: quotient zero, remainder a
+    if (bignum_compare_abs(a, b) < 0)
+    {
+        MathStatus status = bignum_copy(r, a);
+        if (status == MATH_SUCCESS && q != NULL)
+        {
+            bignum_set_zero(q);
+        }
+        return status;
+    }
+
+    if (q != NULL && m - n + 1 > q->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    if (n > r->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    if (scratch == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MemoryArenaMark mark = memory_arena_save(scratch);
+    size_t alignment = MEMORY_ARENA_DEFAULT_ALIGNMENT;
+    MathLimb *un = (MathLimb *)memory_arena_alloc(scratch, (size_t)(m + 1) * sizeof(MathLimb), alignment);
+    MathLimb *vn = (MathLimb *)memory_arena_alloc(scratch, (size_t)n * sizeof(MathLimb), alignment);
+    MathLimb *qn = (MathLimb *)memory_arena_alloc(scratch, (size_t)(m - n + 1) * sizeof(MathLimb), alignment);
+
+    if (un == NULL || vn == NULL || qn == NULL)
+    {
+        memory_arena_restore(scratch, mark);
+        return MATH_ERROR_MEMORY;
+    }
+
+    if (n == 1)
+    {
+        // Short division needs no normalization
+        MathLimb divisor = b->limbs[0];
+        MathLimb remainder = 0;
+        for (MathNatural i = m; i > 0; i--)
+        {
+            MathDoubleLimb numerator = ((MathDoubleLimb)remainder << MATH_LIMB_BITS) | a->limbs[i - 1];
+            qn[i - 1] = (MathLimb)(numerator / divisor);
+            remainder = (MathLimb)(numerator % divisor);
+        }
+        vn[0] = remainder;
+    }
+    else
+    {
+        bignum_knuth_divide(qn, vn, a->limbs, m, b->limbs, n, un, vn);
+    }
+
+    // Outputs are written only after both operands have been consumed
+    if (q != NULL)
+    {
+        memcpy(q->limbs, qn, (size_t)(m - n + 1) * sizeof(MathLimb));
+        q->size = m - n + 1;
+        bignum_normalize(q);
+        q->negative = quotient_negative && q->size > 0;
+    }
+
+    memcpy(r->limbs, vn, (size_t)n * sizeof(MathLimb));
+    r->size = n;
+    bignum_normalize(r);
+    r->negative = remainder_negative && r->size > 0;
+
+    memory_arena_restore(scratch, mark);
+    return MATH_SUCCESS;
+}
+
+// ============================================================================
+// NEWTON RECIPROCAL AND BARRETT REDUCTION
+// ============================================================================
+// Knuth division costs O(quotient * divisor) limb operations, which is
+// quadratic when both are large. Barrett reduction replaces the division
+// by two multiplications with mu = floor(B^2k / m), and mu itself comes
+// from Newton's iteration X' = X + X(B^2k - mX) / B^2k, which doubles the
+// number of correct limbs per step. With Karatsuba underneath, a remainder
+// costs a small multiple of one k-limb multiplication.
+
+/**
+ * @brief Allocate x = B^limbs from scratch
+ */
+static MathStatus bignum_alloc_power(MathBigInteger *x, MemoryArena *scratch, MathNatural limbs)
+{
+    MathStatus status = bignum_alloc(x, scratch, limbs + 1);
+    if (status == MATH_SUCCESS)
+    {
+        memset(x->limbs, 0, (size_t)limbs * sizeof(MathLimb));
+        x->limbs[limbs] = 1;
+        x->size = limbs + 1;
+    }
+    return status;
+}
+
+/**
+ * @brief x = floor(B^2k / d) for a k-limb divisor whose top bit is set
+ *
+ * The top half of the limbs gives a half-precision reciprocal recursively;
+ * one Newton step lifts it to full precision and a final correction makes
+ * it exact.
+ *
+ * @param x Output (capacity >= k + 3)
+ * @param d Normalized divisor
+ * @param scratch Arena for temporaries
+ */
+static MathStatus bignum_reciprocal(MathBigInteger *x, const MathBigInteger *d, MemoryArena *scratch)
+{
+    MathNatural k = d->size;
+    MemoryArenaMark mark = memory_arena_save(scratch);
+    MathStatus status;
+
+    if (k <= BIGNUM_BARRETT_THRESHOLD)
+    {
+        MathBigInteger power, remainder;
+        status = bignum_alloc_power(&power, scratch, 2 * k);
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_alloc(&remainder, scratch, k);
+        }
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_divmod(x, &remainder, &power, d, scratch);
+        }
+        memory_arena_restore(scratch, mark);
+        return status;
+    }
+
+    MathNatural high = (k + 1) / 2;
+    MathNatural low = k - high;
+    MathBigInteger head = {.limbs = d->limbs + low, .size = high, .capacity = high, .negative = false};
+
+    MathBigInteger head_inverse, product, error, correction, power;
+    status = bignum_alloc(&head_inverse, scratch, high + 3);
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_reciprocal(&head_inverse, &head, scratch);
+    }
+
+    // With X0 = head_inverse * B^low: B^2k - d*X0 = B^low * (B^(k+high) - d*head_inverse)
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&product, scratch, k + high + 3);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&product, d, &head_inverse, scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc_power(&power, scratch, k + high);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&error, scratch, k + high + 4);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_sub(&error, &power, &product);
+    }
+
+    // X0 * (B^2k - d*X0) / B^2k = head_inverse * error / B^(2 high)
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&correction, scratch, head_inverse.size + error.size + 1);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&correction, &head_inverse, &error, scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        bignum_shift_right(&correction, 2 * high * MATH_LIMB_BITS);
+        status = bignum_copy(x, &head_inverse);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_shift_left(x, low * MATH_LIMB_BITS);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_add(x, x, &correction);
+    }
+
+    // Exact fix-up: bring B^2k - d*x into [0, d)
+    MathLimb one_limb = 1;
+    MathBigInteger one = {.limbs = &one_limb, .size = 1, .capacity = 1, .negative = false};
+    MathBigInteger full_product, full_power, residual;
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&full_product, scratch, k + x->size + 1);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&full_product, d, x, scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc_power(&full_power, scratch, 2 * k);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&residual, scratch, MATH_MAX(full_product.size, full_power.size) + 1);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_sub(&residual, &full_power, &full_product);
+    }
+    while (status == MATH_SUCCESS && residual.negative)
+    {
+        status = bignum_sub(x, x, &one);
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_add(&residual, &residual, d);
+        }
+    }
+    while (status == MATH_SUCCESS && bignum_compare(&residual, d) >= 0)
+    {
+        status = bignum_add(x, x, &one);
+        if (status == MATH_SUCCESS)
+        {
+            status = bignum_sub(&residual, &residual, d);
+        }
+    }
+
+    memory_arena_restore(scratch, mark);
+    return status;
+}
+
+/**
+ * @brief r = x mod m for x < B^2k, given mu = floor(B^2k / m) and k-limb m
+ */
+static MathStatus bignum_barrett_step(MathBigInteger *r, const MathBigInteger *x, const MathBigInteger *m,
+                                      const MathBigInteger *mu, MemoryArena *scratch)
+{
+    MathNatural k = m->size;
+    MemoryArenaMark mark = memory_arena_save(scratch);
+    MathBigInteger estimate, scaled, product;
+
+    // q = floor(floor(x / B^(k-1)) * mu / B^(k+1)) undershoots x / m by at most 2
+    MathStatus status = bignum_alloc(&estimate, scratch, MATH_MAX(x->size, 1));
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_copy(&estimate, x);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        bignum_shift_right(&estimate, (k - 1) * MATH_LIMB_BITS);
+        status = bignum_alloc(&scaled, scratch, estimate.size + mu->size + 1);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&scaled, &estimate, mu, scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        bignum_shift_right(&scaled, (k + 1) * MATH_LIMB_BITS);
+        status = bignum_alloc(&product, scratch, scaled.size + k + 1);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_mul_karatsuba(&product, &scaled, m, scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_sub_abs(&product, x, &product);
+    }
+    while (status == MATH_SUCCESS && bignum_compare_abs(&product, m) >= 0)
+    {
+        status = bignum_sub_abs(&product, &product, m);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_copy(r, &product);
+    }
+
+    memory_arena_restore(scratch, mark);
+    return status;
+}
+
+/**
+ * @brief Signed remainder r = a mod b using Barrett reduction for large operands
+ *
+ * @param r Remainder output (capacity >= b->size), sign of a
+ * @param a Dividend
+ * @param b Divisor
+ * @param scratch Arena for temporaries (see BIGNUM_BARRETT_SCRATCH_BYTES)
+ * @return MATH_SUCCESS, MATH_ERROR_DIVISION_BY_ZERO or a capacity error
+ */
+MathStatus bignum_mod_barrett(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b,
+                              MemoryArena *scratch)
+{
+    if (r == NULL || a == NULL || b == NULL || scratch == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (b->size == 0)
+    {
+        return MATH_ERROR_DIVISION_BY_ZERO;
+    }
+
+    // Short quotients and small divisors are cheaper with long division
+    MathNatural k = b->size;
+    if (k <= BIGNUM_BARRETT_THRESHOLD || a->size < k + BIGNUM_BARRETT_THRESHOLD)
+    {
+        return bignum_divmod(NULL, r, a, b, scratch);
+    }
+
+    if (k > r->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    bool negative = a->negative;
+    unsigned shift = bignum_limb_clz(b->limbs[k - 1]);
+    MemoryArenaMark mark = memory_arena_save(scratch);
+    MathBigInteger divisor, dividend, mu, window, remainder;
+
+    // Normalize so the divisor's top bit is set: (a 2^s) mod (b 2^s) = (a mod b) 2^s
+    MathStatus status = bignum_alloc(&divisor, scratch, k + 1);
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_copy(&divisor, b);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        divisor.negative = false;
+        status = bignum_shift_left(&divisor, shift);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&dividend, scratch, a->size + 1);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_copy(&dividend, a);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        dividend.negative = false;
+        status = bignum_shift_left(&dividend, shift);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&mu, scratch, k + 3);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_reciprocal(&mu, &divisor, scratch);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&window, scratch, 2 * k);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        status = bignum_alloc(&remainder, scratch, k);
+    }
+
+    // Reduce k limbs at a time from the top so every window stays below B^2k
+    MathNatural length = dividend.size;
+    MathNatural chunks = (length + k - 1) / k;
+    for (MathNatural j = chunks; status == MATH_SUCCESS && j > 0; j--)
+    {
+        MathNatural offset = (j - 1) * k;
+        MathNatural chunk_size = MATH_MIN(k, length - offset);
+
+        memcpy(window.limbs, dividend.limbs + offset, (size_t)chunk_size * sizeof(MathLimb));
+        memset(window.limbs + chunk_size, 0, (size_t)(k - chunk_size) * sizeof(MathLimb));
+        memcpy(window.limbs + k, remainder.limbs, (size_t)remainder.size * sizeof(MathLimb));
+        window.size = k + remainder.size;
+        window.negative = false;
+        bignum_normalize(&window);
+
+        status = bignum_barrett_step(&remainder, &window, &divisor, &mu, scratch);
+    }
+
+    if (status == MATH_SUCCESS)
+    {
+        bignum_shift_right(&remainder, shift);
+        status = bignum_copy(r, &remainder);
+    }
+    if (status == MATH_SUCCESS)
+    {
+        r->negative = negative && r->size > 0;
+    }
+
+    memory_arena_restore(scratch, mark);
+    return status;
+}
+
+/**
+ * @brief r = cx * |x| + cy * |y| for single-limb cofactors
+ *
+ * @return MATH_SUCCESS, MATH_ERROR_UNDERFLOW if the combination would be
+ *         negative, or MATH_ERROR_INVALID_INPUT if a cofactor exceeds a limb
+ */
+MathStatus bignum_linear_combination(MathBigInteger *r,
+                                     const MathBigInteger *x, MathInteger cx,
+                                     const MathBigInteger *y, MathInteger cy)
+{
+    if (r == NULL || x == NULL || y == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    MathNatural mx = cx < 0 ? (MathNatural)0 - (MathNatural)cx : (MathNatural)cx;
+    MathNatural my = cy < 0 ? (MathNatural)0 - (MathNatural)cy : (MathNatural)cy;
+
+    if (mx > (MathNatural)BIGNUM_LIMB_MAX || my > (MathNatural)BIGNUM_LIMB_MAX)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    // Both cofactors negative can only produce a non-positive combination
+    if (cx < 0 && cy < 0)
+    {
+        if (x->size == 0 && y->size == 0)
+        {
+            bignum_set_zero(r);
+            return MATH_SUCCESS;
+        }
+        return MATH_ERROR_UNDERFLOW;
+    }
+
+    MathNatural size = MATH_MAX(x->size, y->size);
+    if (size + 1 > r->capacity)
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    // Arrange as positive_term +/- other_term
+    bool subtract = (cx < 0) != (cy < 0);
+    const MathBigInteger *positive = cx < 0 ? y : x;
+    const MathBigInteger *other = cx < 0 ? x : y;
+    MathLimb positive_factor = (MathLimb)(cx < 0 ? my : mx);
+    MathLimb other_factor = (MathLimb)(cx < 0 ? mx : my);
+
+    MathLimb positive_carry = 0;
+    MathLimb other_carry = 0;
+    MathLimb carry = 0;
+    MathNatural positive_size = positive->size;
+    MathNatural other_size = other->size;
+
+    for (MathNatural i = 0; i <= size; i++)
+    {
+        MathDoubleLimb p = positive_carry;
+        MathDoubleLimb o = other_carry;
+        if (i < positive_size)
+        {
+            p += (MathDoubleLimb)positive->limbs[i] * positive_factor;
+        }
+        if (i < other_size)
+        {
+            o += (MathDoubleLimb)other->limbs[i] * other_factor;
+        }
+        positive_carry = (MathLimb)(p >> MATH_LIMB_BITS);
+        other_carry = (MathLimb)(o >> MATH_LIMB_BITS);
+
+        MathLimb p_low = (MathLimb)p;
+        MathLimb o_low = (MathLimb)o;
+
+        if (subtract)
+        {
+            MathLimb subtrahend = o_low + carry;
+            MathLimb overflow = subtrahend < o_low ? 1 : 0;
+            r->limbs[i] = p_low - subtrahend;
+            carry = overflow + (p_low < subtrahend ? 1 : 0);
+        }
+        else
+        {
+            MathDoubleLimb sum = (MathDoubleLimb)p_low + o_low + carry;
+            r->limbs[i] = (MathLimb)sum;
+            carry = (MathLimb)(sum >> MATH_LIMB_BITS);
+        }
+    }
+
+    // Products of size limbs by one limb fit in size + 1 limbs
+    if (subtract && carry != 0)
+    {
+        return MATH_ERROR_UNDERFLOW;
+    }
+
+    r->size = size + 1;
+    r->negative = false;
+    bignum_normalize(r);
+    return MATH_SUCCESS;
+}
+
+// ============================================================================
+// TEXT CONVERSION
+// ============================================================================
+
+/**
+ * @brief Parse a decimal or 0x-prefixed hexadecimal literal
+ *
+ * @param x Destination (capacity from bignum_limbs_for_string)
+ * @param text Literal with optional leading sign
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_OVERFLOW
+ */
+MathStatus bignum_from_string(MathBigInteger *x, const char *text)
+{
+    if (x == NULL || text == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    bool negative = false;
+    if (*text == '-' || *text == '+')
+    {
+        negative = *text == '-';
+        text++;
+    }
+
+    bignum_set_zero(x);
+
+    if (text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+    {
+        text += 2;
+        size_t digits = strlen(text);
+        if (digits == 0)
+        {
+            return MATH_ERROR_INVALID_INPUT;
+        }
+
+        // Pack nibbles from the least significant end
+        for (size_t i = 0; i < digits; i++)
+        {
+            char c = text[digits - 1 - i];
+            MathLimb nibble;
+            if (c >= '0' && c <= '9')
+            {
+                nibble = (MathLimb)(c - '0');
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                nibble = (MathLimb)(c - 'a' + 10);
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                nibble = (MathLimb)(c - 'A' + 10);
+            }
+            else
+            {
+                return MATH_ERROR_INVALID_INPUT;
+            }
+
+            MathNatural index = (MathNatural)(i * 4) / MATH_LIMB_BITS;
+            unsigned offset = (unsigned)((i * 4) % MATH_LIMB_BITS);
+
+            while (x->size <= index)
+            {
+                if (x->size >= x->capacity)
+                {
+                    return nibble == 0 ? MATH_SUCCESS : MATH_ERROR_OVERFLOW;
+                }
+                x->limbs[x->size++] = 0;
+            }
+            x->limbs[index] |= nibble << offset;
+        }
+    }
+    else
+    {
+        if (*text == '\0')
+        {
+            return MATH_ERROR_INVALID_INPUT;
+        }
+
+        // Consume the digits in chunks of BIGNUM_DECIMAL_CHUNK_DIGITS
+        while (*text != '\0')
+        {
+            MathLimb chunk = 0;
+            MathLimb scale = 1;
+            for (int i = 0; i < BIGNUM_DECIMAL_CHUNK_DIGITS && *text != '\0'; i++, text++)
+            {
+                if (*text < '0' || *text > '9')
+                {
+                    return MATH_ERROR_INVALID_INPUT;
+                }
+                chunk = chunk * 10 + (MathLimb)(*text - '0');
+                scale *= 10;
+            }
+
+            MathStatus status = bignum_mul_limb_add(x, scale, chunk);
+            if (status != MATH_SUCCESS)
+            {
+                return status;
+            }
+        }
+    }
+
+    bignum_normalize(x);
+    x->negative = negative && x->size > 0;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Buffer size needed to print a big integer in decimal
+ *
+ * @return Size in bytes including sign and terminator
+ */
+size_t bignum_string_size(const MathBigInteger *x)
+{
+    // log10(2) < 0.30103
+    return (size_t)(bignum_bit_length(x) * 30103 / 100000) + 3;
+}
+
+/**
+ * @brief Print a big integer in decimal
+ *
+ * @param x Big integer to print
+ * @param buffer Output buffer
+ * @param buffer_size Size of the buffer (see bignum_string_size)
+ * @param scratch Arena for the working copy
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus bignum_to_string(const MathBigInteger *x, char *buffer, size_t buffer_size,
+                            MemoryArena *scratch)
+{
+    if (x == NULL || buffer == NULL || buffer_size == 0 || scratch == NULL)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (buffer_size < bignum_string_size(x))
+    {
+        return MATH_ERROR_OVERFLOW;
+    }
+
+    if (x->size == 0)
+    {
+        buffer[0] = '0';
+        buffer[1] = '\0';
+        return MATH_SUCCESS;
+    }
+
+    MemoryArenaMark mark = memory_arena_save(scratch);
+    MathBigInteger work;
+    MathNatural max_chunks = x->size * 2 + 2;
+    MathLimb *chunks = (MathLimb *)memory_arena_alloc(scratch, (size_t)max_chunks * sizeof(MathLimb),
+                                                      MEMORY_ARENA_DEFAULT_ALIGNMENT);
+
+    if (chunks == NULL || bignum_alloc(&work, scratch, x->size) != MATH_SUCCESS)
+    {
+        memory_arena_restore(scratch, mark);
+        return MATH_ERROR_MEMORY;
+    }
+
+    bignum_copy(&work, x);
+    work.negative = false;
+
+    MathNatural chunk_count = 0;
+    while (work.size > 0 && chunk_count < max_chunks)
+    {
+        chunks[chunk_count++] = bignum_div_limb(&work, BIGNUM_DECIMAL_CHUNK);
+    }
+
+    size_t position = 0;
+    if (x->negative)
+    {
+        buffer[position++] = '-';
+    }
+
+    // Most significant chunk unpadded, the rest zero-padded
+    int written = snprintf(buffer + position, buffer_size - position, "%llu",
+                           (unsigned long long)chunks[chunk_count - 1]);
+    position += (size_t)(written > 0 ? written : 0);
+
+    for (MathNatural i = chunk_count - 1; i > 0 && position < buffer_size; i--)
+    {
+        written = snprintf(buffer + position, buffer_size - position, "%0*llu",
+                           BIGNUM_DECIMAL_CHUNK_DIGITS, (unsigned long long)chunks[i - 1]);
+        position += (size_t)(written > 0 ? written : 0);
+    }
+
+    memory_arena_restore(scratch, mark);
+    return position < buffer_size ? MATH_SUCCESS : MATH_ERROR_OVERFLOW;
+}
+
+// ============================================================================
+// KERNEL EXECUTION
+// ============================================================================
+
+/**
+ * @brief Run a bignum kernel with scratch management and timing
+ *
+ * @param kernel Kernel to run
+ * @param input Arbitrary-precision input
+ * @return MathResult whose value is the bit length of the GCD
+ */
+MathResult bignum_run_gcd_kernel(BignumGcdKernel kernel, const MathBigBinaryInput *input)
+{
+    if (kernel == NULL || input == NULL || input->operand_a == NULL ||
+        input->operand_b == NULL || input->result == NULL)
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    double start_time = math_get_time_ms();
+
+    // Without caller scratch, temporaries come from the thread's pooled arena
+    MemoryScratch pooled;
+    MemoryArena *scratch = input->scratch;
+    MemoryArenaMark mark = 0;
+
+    if (scratch == NULL)
+    {
+        MathNatural limbs = MATH_MAX(input->operand_a->size, input->operand_b->size);
+        scratch = memory_scratch_begin(&pooled, BIGNUM_SCRATCH_BYTES(limbs));
+        if (scratch == NULL)
+        {
+            return math_create_error_result(MATH_ERROR_MEMORY, 0, 0.0);
+        }
+    }
+    else
+    {
+        mark = memory_arena_save(scratch);
+    }
+
+    MathNatural steps = 0;
+    MathStatus status = kernel(input, scratch, &steps);
+
+    if (input->scratch == NULL)
+    {
+        memory_scratch_end(&pooled);
+    }
+    else
+    {
+        memory_arena_restore(scratch, mark);
+    }
+
+    double elapsed = math_elapsed_time_ms(start_time, math_get_time_ms());
+
+    if (status != MATH_SUCCESS)
+    {
+        return math_create_error_result(status, steps, elapsed);
+    }
+
+    return math_create_success_result((MathInteger)bignum_bit_length(input->result), steps, elapsed);
+}
+
+/**
+ * @brief Run a bignum kernel on 64-bit operands
+ *
+ * @param kernel Kernel to run
+ * @param input Standard binary input
+ * @return MathResult whose value is the GCD
+ */
+MathResult bignum_run_gcd_kernel_word(BignumGcdKernel kernel, const MathBinaryInput *input)
+{
+    if (input == NULL)
+    {
+        return math_create_error_result(MATH_ERROR_INVALID_INPUT, 0, 0.0);
+    }
+
+    MathLimb limbs_a[BIGNUM_WORD_LIMBS];
+    MathLimb limbs_b[BIGNUM_WORD_LIMBS];
+    MathLimb limbs_result[BIGNUM_WORD_LIMBS];
+    MathLimb scratch_buffer[BIGNUM_SCRATCH_BYTES(BIGNUM_WORD_LIMBS) / sizeof(MathLimb)];
+
+    MathBigInteger a;
+    MathBigInteger b;
+    MathBigInteger gcd;
+    MemoryArena scratch;
+
+    bignum_init_buffer(&a, limbs_a, BIGNUM_WORD_LIMBS);
+    bignum_init_buffer(&b, limbs_b, BIGNUM_WORD_LIMBS);
+    bignum_init_buffer(&gcd, limbs_result, BIGNUM_WORD_LIMBS);
+    bignum_set_int(&a, input->operand_a);
+    bignum_set_int(&b, input->operand_b);
+    memory_arena_init_buffer(&scratch, scratch_buffer, sizeof(scratch_buffer));
+
+    MathBigBinaryInput big_input = MATH_BIG_BINARY_INPUT_INIT(&a, &b, &gcd);
+    big_input.scratch = &scratch;
+
+    MathResult result = bignum_run_gcd_kernel(kernel, &big_input);
+    if (!MATH_IS_VALID_RESULT(result))
+    {
+        return result;
+    }
+
+    // gcd(INT64_MIN, 0) = 2^63 has no MathInteger representation
+    MathInteger value;
+    if (bignum_to_int(&gcd, &value) != MATH_SUCCESS)
+    {
+        return math_create_error_result(MATH_ERROR_OVERFLOW, result.iterations, result.execution_time_ms);
+    }
+
+    result.value = value;
+    return result;
+}
@@ -0,0 +1,423 @@
+/**
+ * @file bignum_utils.h
+ * @brief Arbitrary-precision integer arithmetic for GCD algorithms
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * This header declares the limb-array arithmetic behind MathBigInteger:
+ * assignment, comparison, shifts, addition, multiplication, division and
+ * text conversion. Limb storage always comes from the caller, usually a
+ * MemoryArena, so none of these functions allocate from the heap.
+ */
+
+#ifndef BIGNUM_UTILS_H
+#define BIGNUM_UTILS_H
+
+#include "../../core/domain/mathematical_types.h"
+#include "memory_utils.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// ============================================================================
+// SIZING
+// ============================================================================
+
+/**
+ * @brief Number of limb-sized temporaries a GCD kernel may carve from scratch
+ *
+ * The half-GCD is the largest user: the pairs and matrices of every
+ * recursion level shrink geometrically but add up to about 34.
+ */
+#define BIGNUM_SCRATCH_TEMPORARIES 40
+
+/**
+ * @brief Scratch arena size that covers one GCD kernel call
+ *
+ * @param limbs Size in limbs of the larger operand
+ */
+#define BIGNUM_SCRATCH_BYTES(limbs)                              \
+    ((size_t)BIGNUM_SCRATCH_TEMPORARIES *                        \
+     (((size_t)(limbs) + 4) * sizeof(MathLimb) + MEMORY_ARENA_DEFAULT_ALIGNMENT))
+
+/**
+ * @brief Operand size in limbs from which bignum_mul_karatsuba recurses
+ */
+#define BIGNUM_KARATSUBA_THRESHOLD 32
+
+/**
+ * @brief Scratch arena size that covers one bignum_mul_karatsuba call
+ *
+ * @param limbs Size in limbs of the shorter operand
+ */
+#define BIGNUM_KARATSUBA_SCRATCH_BYTES(limbs) \
+    ((size_t)(12 * ((limbs) + 2) + 8 * 64) * sizeof(MathLimb) + MEMORY_ARENA_DEFAULT_ALIGNMENT)
+
+/**
+ * @brief Divisor size in limbs above which bignum_mod_barrett uses a Newton reciprocal
+ */
+#define BIGNUM_BARRETT_THRESHOLD 1024
+
+/**
+ * @brief Scratch arena size that covers one bignum_mod_barrett call
+ *
+ * @param dividend_limbs Size in limbs of the dividend
+ * @param divisor_limbs Size in limbs of the divisor
+ */
+#define BIGNUM_BARRETT_SCRATCH_BYTES(dividend_limbs, divisor_limbs)                   \
+    (((size_t)(dividend_limbs) + 64 * (size_t)(divisor_limbs) + 4096) * sizeof(MathLimb) + \
+     4096 * (size_t)MEMORY_ARENA_DEFAULT_ALIGNMENT)
+
+/**
+ * @brief Limbs needed to hold any 64-bit integer
+ */
+#define BIGNUM_WORD_LIMBS (64 / MATH_LIMB_BITS + 1)
+
+/**
+ * @brief Number of limbs needed to hold a value of the given bit length
+ *
+ * @param bits Bit length
+ * @return Limb count (at least 1)
+ */
+MathNatural bignum_limbs_for_bits(MathNatural bits);
+
+/**
+ * @brief Upper bound on the limbs needed to parse a number literal
+ *
+ * @param text Decimal or 0x-prefixed hexadecimal literal
+ * @return Limb count (at least 1)
+ */
+MathNatural bignum_limbs_for_string(const char *text);
+
+// ============================================================================
+// INITIALIZATION AND ASSIGNMENT
+// ============================================================================
+
+/**
+ * @brief Initialize a big integer over caller-provided limb storage
+ *
+ * @param x Big integer to initialize (set to zero)
+ * @param limbs Limb storage
+ * @param capacity Number of limbs in the storage
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus bignum_init_buffer(MathBigInteger *x, MathLimb *limbs, MathNatural capacity);
+
+/**
+ * @brief Initialize a big integer with limb storage carved from an arena
+ *
+ * @param x Big integer to initialize (set to zero)
+ * @param arena Arena to allocate from
+ * @param capacity Number of limbs to reserve
+ * @return MATH_SUCCESS, or MATH_ERROR_MEMORY if the arena is exhausted
+ */
+MathStatus bignum_alloc(MathBigInteger *x, MemoryArena *arena, MathNatural capacity);
+
+/**
+ * @brief Set a big integer to zero
+ *
+ * @param x Big integer to clear
+ */
+void bignum_set_zero(MathBigInteger *x);
+
+/**
+ * @brief Set a big integer from a signed 64-bit value
+ *
+ * @param x Destination
+ * @param value Value to store
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if capacity is insufficient
+ */
+MathStatus bignum_set_int(MathBigInteger *x, MathInteger value);
+
+/**
+ * @brief Set a big integer from an unsigned 64-bit value
+ *
+ * @param x Destination
+ * @param value Value to store
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if capacity is insufficient
+ */
+MathStatus bignum_set_natural(MathBigInteger *x, MathNatural value);
+
+/**
+ * @brief Copy one big integer into another
+ *
+ * @param dest Destination
+ * @param src Source
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if capacity is insufficient
+ */
+MathStatus bignum_copy(MathBigInteger *dest, const MathBigInteger *src);
+
+/**
+ * @brief Strip leading zero limbs and canonicalize the sign of zero
+ *
+ * @param x Big integer to normalize
+ */
+void bignum_normalize(MathBigInteger *x);
+
+// ============================================================================
+// QUERIES AND COMPARISON
+// ============================================================================
+
+/**
+ * @brief Check whether a big integer is zero
+ */
+bool bignum_is_zero(const MathBigInteger *x);
+
+/**
+ * @brief Check whether the magnitude of a big integer fits in 64 bits
+ */
+bool bignum_fits_natural(const MathBigInteger *x);
+
+/**
+ * @brief Low 64 bits of the magnitude
+ *
+ * @param x Big integer
+ * @return |x| mod 2^64
+ */
+MathNatural bignum_to_natural(const MathBigInteger *x);
+
+/**
+ * @brief Convert to a signed 64-bit value
+ *
+ * @param x Big integer
+ * @param value Output value
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if x does not fit
+ */
+MathStatus bignum_to_int(const MathBigInteger *x, MathInteger *value);
+
+/**
+ * @brief Compare magnitudes
+ *
+ * @return Negative, zero or positive as |a| <, ==, > |b|
+ */
+int bignum_compare_abs(const MathBigInteger *a, const MathBigInteger *b);
+
+/**
+ * @brief Compare signed values
+ *
+ * @return Negative, zero or positive as a <, ==, > b
+ */
+int bignum_compare(const MathBigInteger *a, const MathBigInteger *b);
+
+/**
+ * @brief Number of significant bits in the magnitude (0 for zero)
+ */
+MathNatural bignum_bit_length(const MathBigInteger *x);
+
+/**
+ * @brief Number of trailing zero bits in the magnitude (0 for zero)
+ */
+MathNatural bignum_trailing_zeros(const MathBigInteger *x);
+
+/**
+ * @brief Extract a bit field from the magnitude
+ *
+ * @param x Big integer
+ * @param shift Position of the lowest bit to extract
+ * @param count Number of bits to extract (at most 64)
+ * @return (|x| >> shift) mod 2^count
+ */
+MathNatural bignum_extract_bits(const MathBigInteger *x, MathNatural shift, unsigned count);
+
+// ============================================================================
+// ARITHMETIC
+// ============================================================================
+
+/**
+ * @brief Shift the magnitude left in place
+ *
+ * @param x Big integer to shift
+ * @param bits Shift amount
+ * @return MATH_SUCCESS, or MATH_ERROR_OVERFLOW if capacity is insufficient
+ */
+MathStatus bignum_shift_left(MathBigInteger *x, MathNatural bits);
+
+/**
+ * @brief Shift the magnitude right in place (the sign is kept)
+ *
+ * @param x Big integer to shift
+ * @param bits Shift amount
+ */
+void bignum_shift_right(MathBigInteger *x, MathNatural bits);
+
+/**
+ * @brief r = |a| + |b| (r may alias a or b)
+ */
+MathStatus bignum_add_abs(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b);
+
+/**
+ * @brief r = |a| - |b| (r may alias a or b)
+ *
+ * @return MATH_SUCCESS, or MATH_ERROR_UNDERFLOW if |a| < |b|
+ */
+MathStatus bignum_sub_abs(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b);
+
+/**
+ * @brief Signed r = a + b (r may alias a or b)
+ */
+MathStatus bignum_add(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b);
+
+/**
+ * @brief Signed r = a - b (r may alias a or b)
+ */
+MathStatus bignum_sub(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b);
+
+/**
+ * @brief Signed r = a * b (schoolbook; r must not alias a or b)
+ */
+MathStatus bignum_mul(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b);
+
+/**
+ * @brief Signed r = a * b using Karatsuba for large operands
+ *
+ * Falls back to schoolbook below BIGNUM_KARATSUBA_THRESHOLD limbs or when
+ * no scratch arena is given. r must not alias a or b (a and b may alias).
+ *
+ * @param r Product output (capacity >= a->size + b->size)
+ * @param a First factor
+ * @param b Second factor
+ * @param scratch Arena for the recursion (see BIGNUM_KARATSUBA_SCRATCH_BYTES)
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus bignum_mul_karatsuba(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b,
+                                MemoryArena *scratch);
+
+/**
+ * @brief In-place x = |x| * multiplier + addend
+ */
+MathStatus bignum_mul_limb_add(MathBigInteger *x, MathLimb multiplier, MathLimb addend);
+
+/**
+ * @brief In-place x = x / divisor (truncated) returning |x| mod divisor
+ *
+ * @param x Dividend, replaced by the quotient
+ * @param divisor Non-zero single-limb divisor
+ * @return Remainder of the magnitude
+ */
+MathLimb bignum_div_limb(MathBigInteger *x, MathLimb divisor);
+
+/**
+ * @brief Truncated division a = q * b + r (Knuth algorithm D)
+ *
+ * q and r must be distinct but may alias the operands. The remainder has
+ * the sign of a; its capacity must cover b->size limbs and the quotient's
+ * must cover a->size - b->size + 1.
+ *
+ * @param q Quotient output (NULL if not needed)
+ * @param r Remainder output
+ * @param a Dividend
+ * @param b Divisor
+ * @param scratch Arena for the normalized working copies
+ * @return MATH_SUCCESS, MATH_ERROR_DIVISION_BY_ZERO or a capacity error
+ */
+MathStatus bignum_divmod(MathBigInteger *q, MathBigInteger *r,
+                         const MathBigInteger *a, const MathBigInteger *b,
+                         MemoryArena *scratch);
+
+/**
+ * @brief Signed remainder r = a mod b using Barrett reduction for large operands
+ *
+ * Computes mu = floor(B^2k / b) by Newton iteration and reduces a k limbs
+ * at a time, so the cost is a few Karatsuba products instead of a
+ * quadratic long division. Small divisors and short quotients fall back
+ * to bignum_divmod. r may alias a.
+ *
+ * @param r Remainder output (capacity >= b->size), sign of a
+ * @param a Dividend
+ * @param b Divisor
+ * @param scratch Arena for temporaries (see BIGNUM_BARRETT_SCRATCH_BYTES)
+ * @return MATH_SUCCESS, MATH_ERROR_DIVISION_BY_ZERO or a capacity error
+ */
+MathStatus bignum_mod_barrett(MathBigInteger *r, const MathBigInteger *a, const MathBigInteger *b,
+                              MemoryArena *scratch);
+
+/**
+ * @brief r = cx * |x| + cy * |y| for single-limb cofactors
+ *
+ * Used to apply Lehmer cofactor matrices in one pass over the operands.
+ * r may alias x or y.
+ *
+ * @return MATH_SUCCESS, MATH_ERROR_UNDERFLOW if the combination would be
+ *         negative, or MATH_ERROR_INVALID_INPUT if a cofactor exceeds a limb
+ */
+MathStatus bignum_linear_combination(MathBigInteger *r,
+                                     const MathBigInteger *x, MathInteger cx,
+                                     const MathBigInteger *y, MathInteger cy);
+
+// ============================================================================
+// TEXT CONVERSION
+// ============================================================================
+
+/**
+ * @brief Parse a decimal or 0x-prefixed hexadecimal literal
+ *
+ * @param x Destination (capacity from bignum_limbs_for_string)
+ * @param text Literal with optional leading sign
+ * @return MATH_SUCCESS, MATH_ERROR_INVALID_INPUT or MATH_ERROR_OVERFLOW
+ */
+MathStatus bignum_from_string(MathBigInteger *x, const char *text);
+
+/**
+ * @brief Buffer size needed to print a big integer in decimal
+ *
+ * @return Size in bytes including sign and terminator
+ */
+size_t bignum_string_size(const MathBigInteger *x);
+
+/**
+ * @brief Print a big integer in decimal
+ *
+ * @param x Big integer to print
+ * @param buffer Output buffer
+ * @param buffer_size Size of the buffer (see bignum_string_size)
+ * @param scratch Arena for the working copy
+ * @return MATH_SUCCESS or an error code
+ */
+MathStatus bignum_to_string(const MathBigInteger *x, char *buffer, size_t buffer_size,
+                            MemoryArena *scratch);
+
+// ============================================================================
+// KERNEL EXECUTION
+// ============================================================================
+
+/**
+ * @brief Arbitrary-precision GCD kernel signature
+ *
+ * Writes the GCD to input->result (and the Bezout coefficients when the
+ * kernel supports them and the outputs are non-NULL), carving every
+ * temporary from scratch.
+ *
+ * @param input Arbitrary-precision input
+ * @param scratch Scratch arena sized with BIGNUM_SCRATCH_BYTES
+ * @param steps Output for the number of reduction steps
+ * @return MATH_SUCCESS or an error code
+ */
+typedef MathStatus (*BignumGcdKernel)(const MathBigBinaryInput *input,
+                                      MemoryArena *scratch,
+                                      MathNatural *steps);
+
+/**
+ * @brief Run a bignum kernel with scratch management and timing
+ *
+ * Temporaries come from input->scratch when given, otherwise from the
+ * calling thread's scratch pool (see memory_scratch_begin), so repeated
+ * calls do not touch the heap once the pool has grown to the operand size.
+ *
+ * @param kernel Kernel to run
+ * @param input Arbitrary-precision input
+ * @return MathResult whose value is the bit length of the GCD
+ */
+MathResult bignum_run_gcd_kernel(BignumGcdKernel kernel, const MathBigBinaryInput *input);
+
+/**
+ * @brief Run a bignum kernel on 64-bit operands
+ *
+ * Lets bignum implementations serve the regular compute entry point,
+ * using stack-backed limbs and scratch.
+ *
+ * @param kernel Kernel to run
+ * @param input Standard binary input
+ * @return MathResult whose value is the GCD
+ */
+MathResult bignum_run_gcd_kernel_word(BignumGcdKernel kernel, const MathBinaryInput *input);
+
+#endif // BIGNUM_UTILS_H
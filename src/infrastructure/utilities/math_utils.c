@@ -8,6 +8,11 @@
  * and result creation functions used throughout the GCD algorithms.
  */
 
+// clock_gettime() is hidden by glibc in strict C99 builds
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+#endif
+
 #include "../../core/domain/mathematical_types.h"
 #include <stdlib.h>
 #include <time.h>
@@ -93,16 +98,48 @@ MathNatural math_count_trailing_zeros(MathInteger value)
         return 0;
     }
 
+#if defined(__GNUC__) || defined(__clang__)
+    // Compiles to a single tzcnt/bsf (x86) or rbit+clz (ARM) instruction;
+    // ctz(-x) == ctz(x), so no absolute value is needed
+    return (MathNatural)__builtin_ctzll((unsigned long long)value);
+#else
     MathNatural count = 0;
-    MathInteger abs_value = MATH_ABS(value);
+    MathNatural bits = (MathNatural)value;
 
-    while ((abs_value & 1) == 0)
+    while ((bits & 1) == 0)
     {
-        abs_value >>= 1;
+        bits >>= 1;
         count++;
     }
 
     return count;
+#endif
+}
+
+/**
+ * @brief Number of significant bits of an unsigned value
+ *
+ * @param value Input value
+ * @return Position of the highest set bit plus one (0 for 0)
+ */
+MathNatural math_bit_length(MathNatural value)
+{
+    if (value == 0)
+    {
+        return 0;
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    return 64 - (MathNatural)__builtin_clzll((unsigned long long)value);
+#else
+    MathNatural bits = 0;
+    while (value != 0)
+    {
+        value >>= 1;
+        bits++;
+    }
+    return bits;
+#endif
 }
 
 /**
@@ -166,6 +203,43 @@ MathStatus math_safe_division(MathInteger dividend, MathInteger divisor, MathInt
     return MATH_SUCCESS;
 }
 
+/**
+ * @brief Modular multiplication without intermediate overflow
+ *
+ * Uses the 128-bit double limb when the compiler has one; otherwise the
+ * product is built by doubling and adding, each step reduced modulo
+ * modulus.
+ *
+ * @param a First factor (below modulus)
+ * @param b Second factor (below modulus)
+ * @param modulus Modulus (must be non-zero)
+ * @return a * b mod modulus
+ */
+MathNatural math_mul_mod(MathNatural a, MathNatural b, MathNatural modulus)
+{
+#if MATH_LIMB_BITS == 64
+    return (MathNatural)(((MathDoubleLimb)a * b) % modulus);
+#else
+    if ((a >> 32) == 0 && (b >> 32) == 0)
+    {
+        return (a * b) % modulus;
+    }
+
+    MathNatural result = 0;
+    while (b != 0)
+    {
+        if (b & 1)
+        {
+            // result + a mod modulus, without overflowing past 2^64
+            result = result >= modulus - a ? result - (modulus - a) : result + a;
+        }
+        a = a >= modulus - a ? a - (modulus - a) : a + a;
+        b >>= 1;
+    }
+    return result;
+#endif
+}
+
 // ============================================================================
 // TIMING UTILITIES (for performance measurement)
 // ============================================================================
@@ -257,6 +331,62 @@ MathResult math_create_error_result(MathStatus error_status, MathNatural iterati
     return result;
 }
 
+/**
+ * @brief Create a successful unsigned result
+ *
+ * @param value Result value
+ * @param iterations Number of iterations performed
+ * @param execution_time_ms Execution time in milliseconds
+ * @return Initialized MathUnsignedResult structure
+ */
+MathUnsignedResult math_create_unsigned_result(MathWideNatural value, MathNatural iterations, double execution_time_ms)
+{
+    MathUnsignedResult result = {
+        .value = value,
+        .status = MATH_SUCCESS,
+        .is_valid = true,
+        .iterations = iterations,
+        .execution_time_ms = execution_time_ms};
+    return result;
+}
+
+/**
+ * @brief Create an error unsigned result
+ *
+ * @param error_status Error status code
+ * @return MathUnsignedResult with value 0 and the error status
+ */
+MathUnsignedResult math_create_unsigned_error_result(MathStatus error_status)
+{
+    MathUnsignedResult result = {
+        .value = 0,
+        .status = error_status,
+        .is_valid = false,
+        .iterations = 0,
+        .execution_time_ms = 0.0};
+    return result;
+}
+
+/**
+ * @brief Create the summary result of a batch computation
+ *
+ * @param processed Number of operand pairs processed
+ * @param failed Number of pairs that could not be computed (e.g. overflow)
+ * @param execution_time_ms Execution time of the whole batch in milliseconds
+ * @return MathResult with value = successful pairs, iterations = processed pairs;
+ *         status is MATH_ERROR_OVERFLOW if any pair failed
+ */
+MathResult math_create_batch_result(MathNatural processed, MathNatural failed, double execution_time_ms)
+{
+    MathResult result = {
+        .value = (MathInteger)(processed - failed),
+        .status = (failed == 0) ? MATH_SUCCESS : MATH_ERROR_OVERFLOW,
+        .is_valid = (failed == 0),
+        .iterations = processed,
+        .execution_time_ms = execution_time_ms};
+    return result;
+}
+
 /**
  * @brief Create default binary input with sensible defaults
  *
@@ -509,4 +639,43 @@ double math_calculate_stddev_time(const double *times, MathNatural count, double
     }
 
     return sqrt(sum_sq_diff / (double)(count - 1));
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Merge performance metrics collected independently (e.g. per thread)
+ *
+ * @param dest Accumulated metrics (updated in place)
+ * @param src Metrics to merge into dest
+ */
+void math_merge_performance_metrics(MathPerformanceMetrics *dest, const MathPerformanceMetrics *src)
+{
+    if (dest == NULL || src == NULL || src->total_runs == 0)
+    {
+        return;
+    }
+
+    if (dest->total_runs == 0)
+    {
+        *dest = *src;
+        return;
+    }
+
+    double n_a = (double)dest->total_runs;
+    double n_b = (double)src->total_runs;
+    double n = n_a + n_b;
+
+    // Chan et al. parallel combination of mean and sum of squared deviations
+    double delta = src->avg_time_ms - dest->avg_time_ms;
+    double m2_a = dest->stddev_time_ms * dest->stddev_time_ms * (n_a - 1.0);
+    double m2_b = src->stddev_time_ms * src->stddev_time_ms * (n_b - 1.0);
+    double m2 = m2_a + m2_b + delta * delta * n_a * n_b / n;
+
+    dest->avg_time_ms += delta * n_b / n;
+    dest->stddev_time_ms = (n > 1.0) ? sqrt(m2 / (n - 1.0)) : 0.0;
+    dest->min_time_ms = MATH_MIN(dest->min_time_ms, src->min_time_ms);
+    dest->max_time_ms = MATH_MAX(dest->max_time_ms, src->max_time_ms);
+    dest->execution_time_ms += src->execution_time_ms;
+    dest->total_runs += src->total_runs;
+    dest->successful_runs += src->successful_runs;
+    dest->success_rate = (double)dest->successful_runs / (double)dest->total_runs;
+}
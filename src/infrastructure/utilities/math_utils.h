@@ -51,6 +51,14 @@ bool math_is_even(MathInteger value);
  */
 MathNatural math_count_trailing_zeros(MathInteger value);
 
+/**
+ * @brief Number of significant bits of an unsigned value
+ *
+ * @param value Input value
+ * @return Position of the highest set bit plus one (0 for 0)
+ */
+MathNatural math_bit_length(MathNatural value);
+
 /**
  * @brief Safe modulo operation with sign handling
  *
@@ -72,6 +80,16 @@ MathStatus math_safe_modulo(MathInteger dividend, MathInteger divisor, MathInteg
  */
 MathStatus math_safe_division(MathInteger dividend, MathInteger divisor, MathInteger *quotient, MathInteger *remainder);
 
+/**
+ * @brief Modular multiplication without intermediate overflow
+ *
+ * @param a First factor (below modulus)
+ * @param b Second factor (below modulus)
+ * @param modulus Modulus (must be non-zero)
+ * @return a * b mod modulus
+ */
+MathNatural math_mul_mod(MathNatural a, MathNatural b, MathNatural modulus);
+
 // ============================================================================
 // TIMING UTILITIES
 // ============================================================================
@@ -116,6 +134,35 @@ MathResult math_create_success_result(MathInteger value, MathNatural iterations,
  */
 MathResult math_create_error_result(MathStatus error_status, MathNatural iterations, double execution_time_ms);
 
+/**
+ * @brief Create a successful unsigned result
+ *
+ * @param value Result value
+ * @param iterations Number of iterations performed
+ * @param execution_time_ms Execution time in milliseconds
+ * @return Initialized MathUnsignedResult structure
+ */
+MathUnsignedResult math_create_unsigned_result(MathWideNatural value, MathNatural iterations, double execution_time_ms);
+
+/**
+ * @brief Create an error unsigned result
+ *
+ * @param error_status Error status code
+ * @return MathUnsignedResult with value 0 and the error status
+ */
+MathUnsignedResult math_create_unsigned_error_result(MathStatus error_status);
+
+/**
+ * @brief Create the summary result of a batch computation
+ *
+ * @param processed Number of operand pairs processed
+ * @param failed Number of pairs that could not be computed (e.g. overflow)
+ * @param execution_time_ms Execution time of the whole batch in milliseconds
+ * @return MathResult with value = successful pairs, iterations = processed pairs;
+ *         status is MATH_ERROR_OVERFLOW if any pair failed
+ */
+MathResult math_create_batch_result(MathNatural processed, MathNatural failed, double execution_time_ms);
+
 /**
  * @brief Create default binary input with sensible defaults
  *
@@ -206,4 +253,18 @@ double math_find_max_time(const double *times, MathNatural count);
  */
 double math_calculate_stddev_time(const double *times, MathNatural count, double average);
 
+/**
+ * @brief Merge performance metrics collected independently (e.g. per thread)
+ *
+ * Combines counts, extremes, means and standard deviations using the
+ * parallel variance formula, so metrics gathered without sharing can be
+ * folded together once at the end. Execution times are summed: merged
+ * per-thread metrics report the time spent by all threads, not the wall
+ * time of the slowest.
+ *
+ * @param dest Accumulated metrics (updated in place)
+ * @param src Metrics to merge into dest
+ */
+void math_merge_performance_metrics(MathPerformanceMetrics *dest, const MathPerformanceMetrics *src);
+
 #endif // MATH_UTILS_H
\ No newline at end of file
@@ -8,10 +8,21 @@
  * functions used throughout the system.
  */
 
-#include "../../core/domain/mathematical_types.h"
+#include "memory_utils.h"
 #include <stdlib.h>
 #include <string.h>
 
+// Platform detection for per-thread arenas
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || defined(__MINGW32__)
+#ifndef SINGLE_THREADED
+#define HAS_POSIX_THREADS 1
+#endif
+#endif
+
+#ifdef HAS_POSIX_THREADS
+#include <pthread.h>
+#endif
+
 // ============================================================================
 // BASIC SAFE OPERATIONS
 // ============================================================================
@@ -206,7 +217,7 @@ bool memory_validate_math_result(const MathResult *result)
     }
 
     // Check if status is in valid range
-    if (result->status < MATH_SUCCESS || result->status > MATH_ERROR_UNKNOWN)
+    if (result->status < MATH_SUCCESS || result->status > MATH_ERROR_LIMIT_REACHED)
     {
         return false;
     }
@@ -248,6 +259,33 @@ bool memory_validate_binary_input(const MathBinaryInput *input)
     return true;
 }
 
+/**
+ * @brief Basic validation of a MathBatchInput structure
+ *
+ * @param input Pointer to validate
+ * @return true if all arrays are present (or count is zero)
+ */
+bool memory_validate_batch_input(const MathBatchInput *input)
+{
+    if (input == NULL)
+    {
+        return false;
+    }
+
+    // An empty batch is valid and needs no buffers
+    if (input->count == 0)
+    {
+        return true;
+    }
+
+    if (input->operands_a == NULL || input->operands_b == NULL || input->results == NULL)
+    {
+        return false;
+    }
+
+    return true;
+}
+
 /**
  * @brief Basic validation of a MathPerformanceMetrics structure
  *
@@ -351,4 +389,326 @@ void *memory_align_up(void *ptr, size_t alignment)
     uintptr_t aligned = (addr + alignment - 1) & ~(alignment - 1);
 
     return (void *)aligned;
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// ARENA ALLOCATOR
+// ============================================================================
+
+/**
+ * @brief Initialize an arena with a heap-allocated block
+ *
+ * @param arena Arena to initialize
+ * @param capacity Size of the backing block in bytes
+ * @return MATH_SUCCESS, or MATH_ERROR_MEMORY if allocation fails
+ */
+MathStatus memory_arena_init(MemoryArena *arena, size_t capacity)
+{
+    if (arena == NULL || capacity == 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    arena->base = (unsigned char *)malloc(capacity);
+    if (arena->base == NULL)
+    {
+        arena->capacity = 0;
+        arena->offset = 0;
+        arena->high_water = 0;
+        arena->owns_memory = false;
+        return MATH_ERROR_MEMORY;
+    }
+
+    arena->capacity = capacity;
+    arena->offset = 0;
+    arena->high_water = 0;
+    arena->owns_memory = true;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Initialize an arena over a caller-provided buffer
+ *
+ * @param arena Arena to initialize
+ * @param buffer Backing buffer
+ * @param capacity Size of the buffer in bytes
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus memory_arena_init_buffer(MemoryArena *arena, void *buffer, size_t capacity)
+{
+    if (arena == NULL || buffer == NULL || capacity == 0)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    arena->base = (unsigned char *)buffer;
+    arena->capacity = capacity;
+    arena->offset = 0;
+    arena->high_water = 0;
+    arena->owns_memory = false;
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Allocate an aligned block from the arena
+ *
+ * @param arena Arena to allocate from
+ * @param size Number of bytes requested
+ * @param alignment Required alignment (power of 2)
+ * @return Pointer to the block, or NULL if the arena is exhausted
+ */
+void *memory_arena_alloc(MemoryArena *arena, size_t size, size_t alignment)
+{
+    if (arena == NULL || arena->base == NULL || alignment == 0 ||
+        (alignment & (alignment - 1)) != 0)
+    {
+        return NULL;
+    }
+
+    // Align the absolute address, not the offset, so caller buffers work too
+    uintptr_t current = (uintptr_t)(arena->base + arena->offset);
+    uintptr_t aligned = (current + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    size_t padding = (size_t)(aligned - current);
+
+    if (padding > arena->capacity - arena->offset ||
+        size > arena->capacity - arena->offset - padding)
+    {
+        return NULL;
+    }
+
+    arena->offset += padding + size;
+    if (arena->offset > arena->high_water)
+    {
+        arena->high_water = arena->offset;
+    }
+
+    return (void *)aligned;
+}
+
+/**
+ * @brief Record the current arena position
+ *
+ * @param arena Arena to query
+ * @return Mark to pass to memory_arena_restore
+ */
+MemoryArenaMark memory_arena_save(const MemoryArena *arena)
+{
+    return arena != NULL ? arena->offset : 0;
+}
+
+/**
+ * @brief Release every allocation made after a mark was taken
+ *
+ * @param arena Arena to roll back
+ * @param mark Mark previously returned by memory_arena_save
+ */
+void memory_arena_restore(MemoryArena *arena, MemoryArenaMark mark)
+{
+    if (arena != NULL && mark <= arena->offset)
+    {
+        arena->offset = mark;
+    }
+}
+
+/**
+ * @brief Release all allocations, keeping the backing block
+ *
+ * @param arena Arena to reset
+ */
+void memory_arena_reset(MemoryArena *arena)
+{
+    if (arena != NULL)
+    {
+        arena->offset = 0;
+        arena->high_water = 0;
+    }
+}
+
+/**
+ * @brief Release the backing block if the arena owns it
+ *
+ * @param arena Arena to destroy
+ */
+void memory_arena_destroy(MemoryArena *arena)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    if (arena->owns_memory)
+    {
+        free(arena->base);
+    }
+
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->offset = 0;
+    arena->high_water = 0;
+    arena->owns_memory = false;
+}
+
+// ============================================================================
+// THREAD SCRATCH POOL
+// ============================================================================
+// Each thread's arena lives behind a pthread key whose destructor frees it,
+// so short-lived worker threads do not leak their blocks. Single-threaded
+// builds use one static arena.
+
+#ifdef HAS_POSIX_THREADS
+static pthread_key_t g_thread_arena_key;
+static pthread_once_t g_thread_arena_once = PTHREAD_ONCE_INIT;
+static bool g_thread_arena_key_ready = false;
+
+/**
+ * @brief Free a thread's arena when the thread exits
+ *
+ * @param value The thread's MemoryArena
+ */
+static void thread_arena_free(void *value)
+{
+    MemoryArena *arena = (MemoryArena *)value;
+    memory_arena_destroy(arena);
+    free(arena);
+}
+
+/**
+ * @brief Create the key holding each thread's arena (once per process)
+ */
+static void thread_arena_create_key(void)
+{
+    g_thread_arena_key_ready = pthread_key_create(&g_thread_arena_key, thread_arena_free) == 0;
+}
+#else
+static MemoryArena g_thread_arena = {0};
+#endif
+
+/**
+ * @brief Get the calling thread's arena, creating its (empty) record on first use
+ *
+ * @param create Create the record if the thread has none
+ * @return The thread's arena, or NULL
+ */
+static MemoryArena *thread_arena_get(bool create)
+{
+#ifdef HAS_POSIX_THREADS
+    pthread_once(&g_thread_arena_once, thread_arena_create_key);
+    if (!g_thread_arena_key_ready)
+    {
+        return NULL;
+    }
+
+    MemoryArena *arena = (MemoryArena *)pthread_getspecific(g_thread_arena_key);
+    if (arena == NULL && create)
+    {
+        arena = (MemoryArena *)calloc(1, sizeof(MemoryArena));
+        if (arena != NULL && pthread_setspecific(g_thread_arena_key, arena) != 0)
+        {
+            free(arena);
+            arena = NULL;
+        }
+    }
+    return arena;
+#else
+    (void)create;
+    return &g_thread_arena;
+#endif
+}
+
+/**
+ * @brief Begin a scratch scope of at least bytes bytes
+ *
+ * @param scratch Scope to begin
+ * @param bytes Bytes the scope will allocate
+ * @return Arena to allocate from, or NULL if no memory is available
+ */
+MemoryArena *memory_scratch_begin(MemoryScratch *scratch, size_t bytes)
+{
+    if (scratch == NULL)
+    {
+        return NULL;
+    }
+    memset(scratch, 0, sizeof(*scratch));
+    if (bytes == 0)
+    {
+        bytes = 1;
+    }
+
+    MemoryArena *pool = thread_arena_get(true);
+    if (pool != NULL && pool->offset == 0 && pool->capacity < bytes)
+    {
+        // Outermost scope: grow geometrically so a slowly rising size settles quickly
+        size_t capacity = MATH_MAX(MEMORY_THREAD_ARENA_MIN_CAPACITY, 2 * pool->capacity);
+        capacity = MATH_MAX(capacity, bytes);
+        memory_arena_destroy(pool);
+        if (memory_arena_init(pool, capacity) != MATH_SUCCESS && memory_arena_init(pool, bytes) != MATH_SUCCESS)
+        {
+            pool = NULL;
+        }
+    }
+
+    if (pool != NULL && pool->capacity - pool->offset >= bytes)
+    {
+        scratch->arena = pool;
+        scratch->mark = memory_arena_save(pool);
+        return pool;
+    }
+
+    // Nested scope without room left (or no thread arena): a private block
+    if (memory_arena_init(&scratch->local, bytes) != MATH_SUCCESS)
+    {
+        return NULL;
+    }
+    scratch->arena = &scratch->local;
+    return scratch->arena;
+}
+
+/**
+ * @brief End a scratch scope, releasing everything allocated in it
+ *
+ * @param scratch Scope to end
+ */
+void memory_scratch_end(MemoryScratch *scratch)
+{
+    if (scratch == NULL || scratch->arena == NULL)
+    {
+        return;
+    }
+
+    if (scratch->arena == &scratch->local)
+    {
+        memory_arena_destroy(&scratch->local);
+    }
+    else
+    {
+        memory_arena_restore(scratch->arena, scratch->mark);
+        if (scratch->arena->offset == 0 && scratch->arena->capacity > MEMORY_THREAD_ARENA_RETAIN_CAPACITY)
+        {
+            memory_arena_destroy(scratch->arena);
+        }
+    }
+    scratch->arena = NULL;
+}
+
+/**
+ * @brief Release the calling thread's arena block
+ */
+void memory_thread_arena_release(void)
+{
+    MemoryArena *pool = thread_arena_get(false);
+    if (pool != NULL && pool->offset == 0)
+    {
+        memory_arena_destroy(pool);
+    }
+}
+
+/**
+ * @brief Get the capacity of the calling thread's arena block
+ *
+ * @return Capacity in bytes
+ */
+size_t memory_thread_arena_capacity(void)
+{
+    MemoryArena *pool = thread_arena_get(false);
+    return pool != NULL ? pool->capacity : 0;
+}
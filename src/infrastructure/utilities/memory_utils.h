@@ -112,6 +112,14 @@ bool memory_validate_math_result(const MathResult *result);
  */
 bool memory_validate_binary_input(const MathBinaryInput *input);
 
+/**
+ * @brief Basic validation of a MathBatchInput structure
+ *
+ * @param input Pointer to validate
+ * @return true if all arrays are present (or count is zero)
+ */
+bool memory_validate_batch_input(const MathBatchInput *input);
+
 /**
  * @brief Basic validation of a MathPerformanceMetrics structure
  *
@@ -150,4 +158,165 @@ bool memory_is_aligned(const void *ptr, size_t alignment);
  */
 void *memory_align_up(void *ptr, size_t alignment);
 
-#endif // MEMORY_UTILS_H
\ No newline at end of file
+// ============================================================================
+// ARENA ALLOCATOR
+// ============================================================================
+
+/**
+ * @brief Default alignment for arena allocations
+ */
+#define MEMORY_ARENA_DEFAULT_ALIGNMENT 16
+
+/**
+ * @brief Linear (bump) allocator over a single contiguous block
+ *
+ * Allocations are carved sequentially from the block and are never freed
+ * individually: callers either reset the arena or roll it back to a mark
+ * taken earlier. This makes scratch space for multi-step computations
+ * (bignum temporaries, per-call work buffers) a handful of pointer bumps.
+ */
+typedef struct MemoryArena
+{
+    unsigned char *base; /**< Start of the backing block */
+    size_t capacity;     /**< Size of the backing block in bytes */
+    size_t offset;       /**< Bytes currently in use */
+    size_t high_water;   /**< Largest offset reached since init/reset */
+    bool owns_memory;    /**< Whether the block was allocated by the arena */
+} MemoryArena;
+
+/**
+ * @brief Saved arena position for scoped rollback
+ */
+typedef size_t MemoryArenaMark;
+
+/**
+ * @brief Initialize an arena with a heap-allocated block
+ *
+ * @param arena Arena to initialize
+ * @param capacity Size of the backing block in bytes
+ * @return MATH_SUCCESS, or MATH_ERROR_MEMORY if allocation fails
+ */
+MathStatus memory_arena_init(MemoryArena *arena, size_t capacity);
+
+/**
+ * @brief Initialize an arena over a caller-provided buffer
+ *
+ * The arena does not take ownership; memory_arena_destroy leaves the
+ * buffer untouched. Useful for stack-backed scratch space.
+ *
+ * @param arena Arena to initialize
+ * @param buffer Backing buffer
+ * @param capacity Size of the buffer in bytes
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus memory_arena_init_buffer(MemoryArena *arena, void *buffer, size_t capacity);
+
+/**
+ * @brief Allocate an aligned block from the arena
+ *
+ * @param arena Arena to allocate from
+ * @param size Number of bytes requested
+ * @param alignment Required alignment (power of 2)
+ * @return Pointer to the block, or NULL if the arena is exhausted
+ */
+void *memory_arena_alloc(MemoryArena *arena, size_t size, size_t alignment);
+
+/**
+ * @brief Record the current arena position
+ *
+ * @param arena Arena to query
+ * @return Mark to pass to memory_arena_restore
+ */
+MemoryArenaMark memory_arena_save(const MemoryArena *arena);
+
+/**
+ * @brief Release every allocation made after a mark was taken
+ *
+ * @param arena Arena to roll back
+ * @param mark Mark previously returned by memory_arena_save
+ */
+void memory_arena_restore(MemoryArena *arena, MemoryArenaMark mark);
+
+/**
+ * @brief Release all allocations, keeping the backing block
+ *
+ * @param arena Arena to reset
+ */
+void memory_arena_reset(MemoryArena *arena);
+
+/**
+ * @brief Release the backing block if the arena owns it
+ *
+ * @param arena Arena to destroy
+ */
+void memory_arena_destroy(MemoryArena *arena);
+
+// ============================================================================
+// THREAD SCRATCH POOL
+// ============================================================================
+
+/**
+ * @brief Smallest block the per-thread arena grows to
+ */
+#define MEMORY_THREAD_ARENA_MIN_CAPACITY ((size_t)64 << 10)
+
+/**
+ * @brief Largest block the per-thread arena keeps between scopes
+ *
+ * A scope that needed more (one huge bignum, say) gets its block, which
+ * is released again when the scope ends so resident memory stays flat.
+ */
+#define MEMORY_THREAD_ARENA_RETAIN_CAPACITY ((size_t)16 << 20)
+
+/**
+ * @brief Scratch scope borrowed from the calling thread's arena
+ *
+ * Every thread owns one arena that grows to the largest scope it has
+ * served, so repeated scopes of the same size (one per batch, one per
+ * bignum GCD) allocate from the heap only the first time. A nested scope
+ * that does not fit in what the outer scopes left falls back to a
+ * private heap arena. Scopes must end in reverse order of beginning, on
+ * the thread that began them; a MemoryScratch must not be copied.
+ */
+typedef struct
+{
+    MemoryArena *arena;   /**< Arena serving the scope (NULL = not begun) */
+    MemoryArenaMark mark; /**< Position of the thread arena when the scope began */
+    MemoryArena local;    /**< Private arena when the thread arena had no room */
+} MemoryScratch;
+
+/**
+ * @brief Begin a scratch scope of at least bytes bytes
+ *
+ * Sizes must include the alignment padding of the allocations made in
+ * the scope (see BIGNUM_SCRATCH_BYTES).
+ *
+ * @param scratch Scope to begin
+ * @param bytes Bytes the scope will allocate
+ * @return Arena to allocate from, or NULL if no memory is available
+ */
+MemoryArena *memory_scratch_begin(MemoryScratch *scratch, size_t bytes);
+
+/**
+ * @brief End a scratch scope, releasing everything allocated in it
+ *
+ * @param scratch Scope to end (ignored if it was never begun)
+ */
+void memory_scratch_end(MemoryScratch *scratch);
+
+/**
+ * @brief Release the calling thread's arena block
+ *
+ * Threads release it automatically when they exit; long-lived threads can
+ * call this after a large job. Must not be called inside a scope.
+ */
+void memory_thread_arena_release(void);
+
+/**
+ * @brief Get the capacity of the calling thread's arena block
+ *
+ * @return Capacity in bytes (0 before the first scope)
+ */
+size_t memory_thread_arena_capacity(void);
+
+#endif // MEMORY_UTILS_H
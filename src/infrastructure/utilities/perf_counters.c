@@ -0,0 +1,338 @@
+/**
+ * @file perf_counters.c
+ * @brief Per-thread performance counters and latency histograms
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Blocks come from a fixed pool. A thread claims one under a lock the
+ * first time it records and keeps it in a thread-local pointer; a
+ * thread-specific key returns the block to the pool when the thread
+ * exits, counts included, so worker pools that are created per batch do
+ * not exhaust it. Threads beyond PERF_MAX_THREADS record into one shared
+ * block with atomic additions.
+ */
+
+#include "perf_counters.h"
+#include "memory_utils.h"
+#include <string.h>
+
+// Platform detection for the block pool lock
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || defined(__MINGW32__)
+#if !defined(SINGLE_THREADED) && (defined(__GNUC__) || defined(__clang__))
+#define HAS_POSIX_THREADS 1
+#endif
+#endif
+
+#ifdef HAS_POSIX_THREADS
+#include <pthread.h>
+#endif
+
+#ifndef DISABLE_PERF_COUNTERS
+
+/**
+ * @brief Assumed cache line size; blocks are aligned and sized to it
+ */
+#define PERF_CACHE_LINE_SIZE 64
+
+/**
+ * @brief Relaxed accesses: readers may run while the owner records
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define PERF_THREAD_LOCAL __thread
+#define PERF_LOAD(x) __atomic_load_n(&(x), __ATOMIC_RELAXED)
+#define PERF_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELAXED)
+#define PERF_ATOMIC_ADD(x, v) __atomic_fetch_add(&(x), (v), __ATOMIC_RELAXED)
+#define PERF_CACHE_ALIGNED __attribute__((aligned(PERF_CACHE_LINE_SIZE)))
+#else
+#define PERF_THREAD_LOCAL
+#define PERF_LOAD(x) (x)
+#define PERF_STORE(x, v) ((x) = (v))
+#define PERF_ATOMIC_ADD(x, v) ((x) += (v))
+#define PERF_CACHE_ALIGNED
+#endif
+
+// ============================================================================
+// BLOCK POOL
+// ============================================================================
+
+/**
+ * @brief Counters of one slot in one block
+ */
+typedef struct
+{
+    MathNatural calls;
+    MathNatural ticks;
+    MathNatural iterations;
+    MathNatural histogram[PERF_HISTOGRAM_BUCKETS];
+} PerfSlotCounters;
+
+/**
+ * @brief Counters of one thread (cache-line aligned, so threads never share a line)
+ */
+typedef struct
+{
+    PerfSlotCounters slots[PERF_COUNTER_SLOTS];
+} PERF_CACHE_ALIGNED PerfThreadBlock;
+
+static PerfThreadBlock g_perf_blocks[PERF_MAX_THREADS];
+static PerfThreadBlock g_perf_shared; /**< Overflow block, updated atomically */
+static bool g_perf_owned[PERF_MAX_THREADS];
+static MathNatural g_perf_claimed; /**< High-water mark of g_perf_blocks in use */
+
+static PERF_THREAD_LOCAL PerfThreadBlock *t_perf_block;
+
+#ifdef HAS_POSIX_THREADS
+static pthread_mutex_t g_perf_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t g_perf_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_perf_key;
+
+/**
+ * @brief Return an exiting thread's block to the pool
+ */
+static void perf_release_block(void *block)
+{
+    MathNatural index = (MathNatural)((PerfThreadBlock *)block - g_perf_blocks);
+    pthread_mutex_lock(&g_perf_lock);
+    g_perf_owned[index] = false;
+    pthread_mutex_unlock(&g_perf_lock);
+}
+
+static void perf_create_key(void)
+{
+    pthread_key_create(&g_perf_key, perf_release_block);
+}
+#endif
+
+/**
+ * @brief Claim a block for the calling thread
+ *
+ * @return Private block, or the shared block when the pool is exhausted
+ */
+static PerfThreadBlock *perf_claim_block(void)
+{
+    PerfThreadBlock *block = &g_perf_shared;
+
+#ifdef HAS_POSIX_THREADS
+    pthread_once(&g_perf_key_once, perf_create_key);
+    pthread_mutex_lock(&g_perf_lock);
+#endif
+    for (MathNatural i = 0; i < PERF_MAX_THREADS; i++)
+    {
+        if (!g_perf_owned[i])
+        {
+            g_perf_owned[i] = true;
+            block = &g_perf_blocks[i];
+            if (i + 1 > g_perf_claimed)
+            {
+                PERF_STORE(g_perf_claimed, i + 1);
+            }
+            break;
+        }
+    }
+#ifdef HAS_POSIX_THREADS
+    pthread_mutex_unlock(&g_perf_lock);
+    if (block != &g_perf_shared)
+    {
+        pthread_setspecific(g_perf_key, block);
+    }
+#endif
+
+    t_perf_block = block;
+    return block;
+}
+
+/**
+ * @brief Histogram bucket of a per-call tick count
+ */
+static unsigned int perf_bucket(uint64_t ticks)
+{
+    if (ticks < 2)
+    {
+        return 0;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    unsigned int bucket = 63u - (unsigned int)__builtin_clzll(ticks);
+#else
+    unsigned int bucket = 0;
+    while (ticks >>= 1)
+    {
+        bucket++;
+    }
+#endif
+    return bucket < PERF_HISTOGRAM_BUCKETS ? bucket : PERF_HISTOGRAM_BUCKETS - 1;
+}
+
+// ============================================================================
+// RECORDING
+// ============================================================================
+
+/**
+ * @brief Add calls to a slot of the calling thread's block
+ *
+ * @param slot Slot (values >= PERF_COUNTER_SLOTS are ignored)
+ * @param ticks Ticks spent in the calls
+ * @param calls Number of calls (0 is ignored)
+ * @param iterations Iterations reported by the calls
+ */
+void perf_record(unsigned int slot, uint64_t ticks, MathNatural calls, MathNatural iterations)
+{
+    if (slot >= PERF_COUNTER_SLOTS || calls == 0)
+    {
+        return;
+    }
+
+    PerfThreadBlock *block = t_perf_block != NULL ? t_perf_block : perf_claim_block();
+    PerfSlotCounters *counters = &block->slots[slot];
+    unsigned int bucket = perf_bucket(ticks / calls);
+
+    if (block == &g_perf_shared)
+    {
+        PERF_ATOMIC_ADD(counters->calls, calls);
+        PERF_ATOMIC_ADD(counters->ticks, ticks);
+        PERF_ATOMIC_ADD(counters->iterations, iterations);
+        PERF_ATOMIC_ADD(counters->histogram[bucket], calls);
+        return;
+    }
+
+    // Only the owner adds to its block: no read-modify-write needs to be
+    // atomic, but perf_reset may clear the slot meanwhile
+    PERF_STORE(counters->calls, PERF_LOAD(counters->calls) + calls);
+    PERF_STORE(counters->ticks, PERF_LOAD(counters->ticks) + ticks);
+    PERF_STORE(counters->iterations, PERF_LOAD(counters->iterations) + iterations);
+    PERF_STORE(counters->histogram[bucket], PERF_LOAD(counters->histogram[bucket]) + calls);
+}
+
+/**
+ * @brief Add one block's slot to running totals
+ */
+static void perf_accumulate(PerfCounterTotals *totals, PerfSlotCounters *counters)
+{
+    totals->calls += PERF_LOAD(counters->calls);
+    totals->ticks += PERF_LOAD(counters->ticks);
+    totals->iterations += PERF_LOAD(counters->iterations);
+    for (unsigned int b = 0; b < PERF_HISTOGRAM_BUCKETS; b++)
+    {
+        totals->histogram[b] += PERF_LOAD(counters->histogram[b]);
+    }
+}
+
+/**
+ * @brief Zero one block's slot
+ */
+static void perf_clear(PerfSlotCounters *counters)
+{
+    PERF_STORE(counters->calls, 0);
+    PERF_STORE(counters->ticks, 0);
+    PERF_STORE(counters->iterations, 0);
+    for (unsigned int b = 0; b < PERF_HISTOGRAM_BUCKETS; b++)
+    {
+        PERF_STORE(counters->histogram[b], 0);
+    }
+}
+
+#endif // DISABLE_PERF_COUNTERS
+
+// ============================================================================
+// AGGREGATION
+// ============================================================================
+
+/**
+ * @brief Sum a slot over every thread that recorded into it
+ *
+ * @param slot Slot to collect
+ * @param totals Output totals (zero when counters are compiled out)
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus perf_collect(unsigned int slot, PerfCounterTotals *totals)
+{
+    if (totals == NULL || slot >= PERF_COUNTER_SLOTS)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+    memory_clear(totals, sizeof(*totals));
+#ifndef DISABLE_PERF_COUNTERS
+    MathNatural claimed = PERF_LOAD(g_perf_claimed);
+    for (MathNatural i = 0; i < claimed; i++)
+    {
+        perf_accumulate(totals, &g_perf_blocks[i].slots[slot]);
+    }
+    perf_accumulate(totals, &g_perf_shared.slots[slot]);
+#endif
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Clear a slot in every thread's block
+ *
+ * @param slot Slot to clear
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus perf_reset(unsigned int slot)
+{
+    if (slot >= PERF_COUNTER_SLOTS)
+    {
+        return MATH_ERROR_INVALID_INPUT;
+    }
+
+#ifndef DISABLE_PERF_COUNTERS
+    MathNatural claimed = PERF_LOAD(g_perf_claimed);
+    for (MathNatural i = 0; i < claimed; i++)
+    {
+        perf_clear(&g_perf_blocks[i].slots[slot]);
+    }
+    perf_clear(&g_perf_shared.slots[slot]);
+#endif
+    return MATH_SUCCESS;
+}
+
+/**
+ * @brief Estimate a latency quantile from a histogram
+ *
+ * @param totals Collected totals
+ * @param quantile Quantile in [0, 1]
+ * @return Upper edge, in ticks, of the bucket holding the quantile (0 without calls)
+ */
+double perf_histogram_quantile(const PerfCounterTotals *totals, double quantile)
+{
+    if (totals == NULL || totals->calls == 0)
+    {
+        return 0.0;
+    }
+
+    quantile = quantile < 0.0 ? 0.0 : (quantile > 1.0 ? 1.0 : quantile);
+    MathNatural histogram_calls = 0;
+    for (unsigned int b = 0; b < PERF_HISTOGRAM_BUCKETS; b++)
+    {
+        histogram_calls += totals->histogram[b];
+    }
+
+    // Rank of the quantile among the calls, 1-based
+    MathNatural rank = (MathNatural)(quantile * (double)histogram_calls + 0.999999);
+    rank = rank == 0 ? 1 : rank;
+
+    MathNatural seen = 0;
+    for (unsigned int b = 0; b < PERF_HISTOGRAM_BUCKETS; b++)
+    {
+        seen += totals->histogram[b];
+        if (seen >= rank)
+        {
+            return (double)(1ull << (b + 1));
+        }
+    }
+    return (double)(1ull << PERF_HISTOGRAM_BUCKETS);
+}
+
+/**
+ * @brief Number of threads that own a private block
+ *
+ * @return Private blocks in use or retired
+ */
+MathNatural perf_thread_count(void)
+{
+#ifndef DISABLE_PERF_COUNTERS
+    return PERF_LOAD(g_perf_claimed);
+#else
+    return 0;
+#endif
+}
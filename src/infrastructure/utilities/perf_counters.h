@@ -0,0 +1,152 @@
+/**
+ * @file perf_counters.h
+ * @brief Per-thread performance counters and latency histograms
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * Every thread that records a sample gets its own block of counters,
+ * aligned to a cache line, so recording never contends with other
+ * threads: the owner updates its block with plain (relaxed) stores and
+ * no lock. Each block holds, per slot, the number of calls, the ticks
+ * spent in them, the iterations they reported and a log2-scaled
+ * histogram of ticks per call. perf_collect sums the blocks of all
+ * threads on demand.
+ *
+ * Building with -DDISABLE_PERF_COUNTERS turns PERF_TIMER_START,
+ * PERF_TIMER_STOP and PERF_RECORD into no-ops, so instrumented code
+ * carries no cost at all; the collection functions then report zeros.
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include "../../core/domain/mathematical_types.h"
+#include "../platform/cycle_counter.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// ============================================================================
+// COUNTER LAYOUT
+// ============================================================================
+
+/**
+ * @brief Number of independent slots (one per algorithm variant)
+ *
+ * Must cover every variant number, runtime registrations included; the
+ * registry checks this at compile time against GCD_VARIANT_CAPACITY.
+ */
+#define PERF_COUNTER_SLOTS 64
+
+/**
+ * @brief Histogram buckets: bucket i counts calls of [2^i, 2^(i+1)) ticks
+ *
+ * Bucket 0 also holds calls below one tick; the last bucket holds
+ * everything from 2^(PERF_HISTOGRAM_BUCKETS - 1) ticks up.
+ */
+#define PERF_HISTOGRAM_BUCKETS 32
+
+/**
+ * @brief Threads with a private block; further threads share an atomic block
+ */
+#define PERF_MAX_THREADS 64
+
+/**
+ * @brief Counters of one slot summed over all threads
+ */
+typedef struct
+{
+    MathNatural calls;                                /**< Recorded calls (batch pairs count individually) */
+    MathNatural ticks;                                /**< Tick counter ticks spent in them */
+    MathNatural iterations;                           /**< Iterations reported by the calls */
+    MathNatural histogram[PERF_HISTOGRAM_BUCKETS];    /**< Calls per log2(ticks per call) bucket */
+} PerfCounterTotals;
+
+// ============================================================================
+// RECORDING (compiled out with -DDISABLE_PERF_COUNTERS)
+// ============================================================================
+
+#ifndef DISABLE_PERF_COUNTERS
+
+#define PERF_COUNTERS_ENABLED 1
+
+/**
+ * @brief Read the tick counter around an instrumented region
+ */
+#define PERF_TIMER_START() platform_counter_start()
+#define PERF_TIMER_STOP() platform_counter_stop()
+
+/**
+ * @brief Record calls that together took ticks
+ *
+ * The histogram receives calls entries of ticks / calls each.
+ */
+#define PERF_RECORD(slot, ticks, calls, iterations) perf_record((slot), (ticks), (calls), (iterations))
+
+/**
+ * @brief Add calls to a slot of the calling thread's block
+ *
+ * @param slot Slot (values >= PERF_COUNTER_SLOTS are ignored)
+ * @param ticks Ticks spent in the calls
+ * @param calls Number of calls (0 is ignored)
+ * @param iterations Iterations reported by the calls
+ */
+void perf_record(unsigned int slot, uint64_t ticks, MathNatural calls, MathNatural iterations);
+
+#else
+
+#define PERF_COUNTERS_ENABLED 0
+#define PERF_TIMER_START() ((uint64_t)0)
+#define PERF_TIMER_STOP() ((uint64_t)0)
+// Arguments are still referenced, so callers need no #ifdef around their timing variables
+#define PERF_RECORD(slot, ticks, calls, iterations) ((void)(slot), (void)(ticks), (void)(calls), (void)(iterations))
+
+#endif // DISABLE_PERF_COUNTERS
+
+// ============================================================================
+// AGGREGATION
+// ============================================================================
+
+/**
+ * @brief Sum a slot over every thread that recorded into it
+ *
+ * Safe to call while other threads record; counts still being written
+ * may be missed by one sample.
+ *
+ * @param slot Slot to collect
+ * @param totals Output totals (zero when counters are compiled out)
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus perf_collect(unsigned int slot, PerfCounterTotals *totals);
+
+/**
+ * @brief Clear a slot in every thread's block
+ *
+ * Used when a slot is handed to a new owner (a runtime variant number
+ * that is unregistered and then reused). Calls still being recorded into
+ * the slot while it is cleared may survive the reset.
+ *
+ * @param slot Slot to clear
+ * @return MATH_SUCCESS or MATH_ERROR_INVALID_INPUT
+ */
+MathStatus perf_reset(unsigned int slot);
+
+/**
+ * @brief Estimate a latency quantile from a histogram
+ *
+ * @param totals Collected totals
+ * @param quantile Quantile in [0, 1]
+ * @return Upper edge, in ticks, of the bucket holding the quantile (0 without calls)
+ */
+double perf_histogram_quantile(const PerfCounterTotals *totals, double quantile);
+
+/**
+ * @brief Number of threads that own a private block
+ *
+ * Blocks of exited threads are handed to new threads with their counts
+ * kept, so this is the peak number of concurrently recording threads.
+ *
+ * @return Private blocks in use or retired
+ */
+MathNatural perf_thread_count(void);
+
+#endif // PERF_COUNTERS_H
@@ -0,0 +1,285 @@
+/**
+ * @file bench_main.c
+ * @brief Entry point of gcd_bench, the benchmark driver built next to the CLI
+ * @author Number Theory Algorithms Project
+ * @version 1.0
+ *
+ * gcd_bench runs the benchmark suite matrix without the analyzer's command
+ * set, so a build can be measured (and profiled for PGO) on its own. It
+ * links the same core library as gcd_analyzer; only the argument handling
+ * lives here.
+ */
+
+#include "../../core/orchestration/system_coordinator.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/gcd_isa.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/input_generators.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// PROGRAM INFORMATION
+// ============================================================================
+
+#define BENCH_PROGRAM_NAME "gcd_bench"
+
+/**
+ * @brief Samples per matrix cell of the PGO training run
+ *
+ * Enough for every cell's code path to be profiled, little enough for the
+ * training step to stay under a second or two.
+ */
+#define BENCH_TRAIN_SAMPLES 20
+
+/**
+ * @brief Options of one gcd_bench run
+ */
+typedef struct
+{
+    MathNatural samples;       /**< Timed samples per matrix cell */
+    MathNatural seed;          /**< Operand generator seed */
+    ReportFormat format;       /**< Report format of the suite results */
+    const char *output_path;   /**< Report destination (NULL = stdout) */
+    const char *isa_name;      /**< Forced batch kernel level (NULL = best) */
+    bool calibrate;            /**< Also calibrate the GCD_AUTO decision table */
+    bool train;                /**< Run the PGO training workload instead */
+} BenchOptions;
+
+/**
+ * @brief Print usage
+ */
+static void bench_print_usage(void)
+{
+    printf("Usage: %s [options]\n\n", BENCH_PROGRAM_NAME);
+    printf("Runs the benchmark suite matrix (every variant against every operand class).\n\n");
+    printf("Options:\n");
+    printf("  -i, --samples N     Timed samples per cell (default %d)\n", GCD_SUITE_DEFAULT_SAMPLES);
+    printf("  --seed S            Operand generator seed\n");
+    printf("  --format F          Report format: text, json or csv (default text)\n");
+    printf("  -o, --output FILE   Write the json or csv report to FILE\n");
+    printf("  --isa LEVEL         Force the batch kernels of LEVEL (baseline, x86-64-v2,\n");
+    printf("                      x86-64-v3, x86-64-v4, armv8.2-a)\n");
+    printf("  --calibrate         Also calibrate the GCD_AUTO decision table\n");
+    printf("  --train             Run the short, quiet PGO training workload\n");
+    printf("  -h, --help          Show this help\n\n");
+}
+
+// ============================================================================
+// ARGUMENT PARSING
+// ============================================================================
+
+/**
+ * @brief Parse a positive decimal or 0x-prefixed number
+ *
+ * @param text Argument text
+ * @param value Output value
+ * @return true if the whole argument is a number
+ */
+static bool bench_parse_number(const char *text, MathNatural *value)
+{
+    char *end = NULL;
+    unsigned long long parsed = strtoull(text, &end, 0);
+    if (end == text || *end != '\0' || text[0] == '-')
+    {
+        return false;
+    }
+    *value = (MathNatural)parsed;
+    return true;
+}
+
+/**
+ * @brief Parse the command line
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @param options Output options
+ * @return 0 to run, -1 after printing help, 1 on usage errors
+ */
+static int bench_parse_arguments(int argc, char *argv[], BenchOptions *options)
+{
+    options->samples = GCD_SUITE_DEFAULT_SAMPLES;
+    options->seed = GCD_RANDOM_DEFAULT_SEED;
+    options->format = REPORT_FORMAT_TEXT;
+    options->output_path = NULL;
+    options->isa_name = NULL;
+    options->calibrate = false;
+    options->train = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0)
+        {
+            bench_print_usage();
+            return -1;
+        }
+        else if (strcmp(arg, "--calibrate") == 0)
+        {
+            options->calibrate = true;
+        }
+        else if (strcmp(arg, "--train") == 0)
+        {
+            options->train = true;
+        }
+        else if ((strcmp(arg, "-i") == 0 || strcmp(arg, "--samples") == 0) && has_value)
+        {
+            if (!bench_parse_number(argv[++i], &options->samples) || options->samples == 0)
+            {
+                printf("Error: Number of samples must be positive\n\n");
+                return 1;
+            }
+        }
+        else if (strcmp(arg, "--seed") == 0 && has_value)
+        {
+            if (!bench_parse_number(argv[++i], &options->seed))
+            {
+                printf("Error: Invalid seed '%s'\n\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (strcmp(arg, "--format") == 0 && has_value)
+        {
+            if (!report_parse_format(argv[++i], &options->format))
+            {
+                printf("Error: Unknown report format '%s'\n\n", argv[i]);
+                return 1;
+            }
+        }
+        else if ((strcmp(arg, "-o") == 0 || strcmp(arg, "--output") == 0) && has_value)
+        {
+            options->output_path = argv[++i];
+        }
+        else if (strcmp(arg, "--isa") == 0 && has_value)
+        {
+            options->isa_name = argv[++i];
+        }
+        else
+        {
+            printf("Error: Unrecognized argument '%s'\n\n", arg);
+            bench_print_usage();
+            return 1;
+        }
+    }
+
+    if (options->output_path != NULL && options->format == REPORT_FORMAT_TEXT)
+    {
+        printf("Error: --output needs a json or csv report (use --format)\n\n");
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Force the batch kernels named on the command line
+ *
+ * @param name Level name as printed by platform_isa_level_name
+ * @return true if the level exists, is built and runs on this CPU
+ */
+static bool bench_select_isa(const char *name)
+{
+    for (int level = 0; level < PLATFORM_ISA_LEVEL_COUNT; level++)
+    {
+        if (strcmp(name, platform_isa_level_name((PlatformIsaLevel)level)) != 0)
+        {
+            continue;
+        }
+        if (gcd_isa_select_level((PlatformIsaLevel)level) != MATH_SUCCESS)
+        {
+            printf("Error: ISA level '%s' is not %s\n\n", name,
+                   gcd_isa_level_built((PlatformIsaLevel)level) ? "supported by this CPU" : "built in");
+            return false;
+        }
+        return true;
+    }
+
+    printf("Error: Unknown ISA level '%s'\n\n", name);
+    return false;
+}
+
+// ============================================================================
+// MAIN FUNCTION
+// ============================================================================
+
+/**
+ * @brief Main entry point
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @return 0 on success, 1 on usage errors, 2 if a run failed
+ */
+int main(int argc, char *argv[])
+{
+    BenchOptions options;
+    int parsed = bench_parse_arguments(argc, argv, &options);
+    if (parsed != 0)
+    {
+        return parsed < 0 ? 0 : 1;
+    }
+
+    MathStatus status = system_init();
+    if (status != MATH_SUCCESS)
+    {
+        printf("Error: Failed to initialize GCD analysis system (status: %d)\n", status);
+        return 2;
+    }
+
+    if (options.isa_name != NULL && !bench_select_isa(options.isa_name))
+    {
+        return 1;
+    }
+
+    // Training only has to execute the hot paths: nothing is printed or saved
+    if (options.train)
+    {
+        system_set_report_output(REPORT_FORMAT_TEXT, NULL);
+        if (system_benchmark_suite(BENCH_TRAIN_SAMPLES, options.seed, NULL, false) != MATH_SUCCESS ||
+            system_calibrate_dispatcher(BENCH_TRAIN_SAMPLES, options.seed, NULL, false) != MATH_SUCCESS)
+        {
+            printf("Error: Training run failed\n");
+            return 2;
+        }
+        return 0;
+    }
+
+    FILE *stream = NULL;
+    if (options.output_path != NULL)
+    {
+        stream = fopen(options.output_path, "w");
+        if (stream == NULL)
+        {
+            printf("Error: Could not open '%s' for writing\n\n", options.output_path);
+            return 2;
+        }
+    }
+    system_set_report_output(options.format, stream);
+
+    if (options.format == REPORT_FORMAT_TEXT)
+    {
+        printf("=== %s ===\n", BENCH_PROGRAM_NAME);
+        printf("Build: %s\n", GCD_BUILD_CONFIG);
+        printf("Batch Kernels: %s\n\n", platform_isa_level_name(gcd_isa_active_level()));
+    }
+
+    int exit_code = 0;
+    if (options.calibrate &&
+        system_calibrate_dispatcher(options.samples, options.seed, NULL, options.format == REPORT_FORMAT_TEXT) !=
+            MATH_SUCCESS)
+    {
+        printf("Error: Dispatcher calibration failed\n\n");
+        exit_code = 2;
+    }
+    if (exit_code == 0 && system_benchmark_suite(options.samples, options.seed, NULL, true) != MATH_SUCCESS)
+    {
+        printf("Error: Benchmark suite failed\n\n");
+        exit_code = 2;
+    }
+
+    system_set_report_output(REPORT_FORMAT_TEXT, NULL);
+    if (stream != NULL)
+    {
+        fclose(stream);
+    }
+    return exit_code;
+}
@@ -13,11 +13,20 @@
 #include "command_parser.h"
 #include "../../core/orchestration/system_coordinator.h"
 #include "../../challenges/greatest_common_divisor/challenge_services/mdc_analyzer.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/solution_registry.h"
+#include "../../infrastructure/utilities/bignum_utils.h"
+#include "../../infrastructure/utilities/memory_utils.h"
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
 // ============================================================================
 // COMMAND PARSING IMPLEMENTATION
 // ============================================================================
@@ -55,6 +64,26 @@ CliCommand parse_command(const char *command_str)
     {
         return CMD_BENCHMARK;
     }
+    if (strcmp(command_str, "bench-suite") == 0 || strcmp(command_str, "suite") == 0)
+    {
+        return CMD_BENCH_SUITE;
+    }
+    if (strcmp(command_str, "bench-compare") == 0)
+    {
+        return CMD_BENCH_COMPARE;
+    }
+    if (strcmp(command_str, "calibrate") == 0 || strcmp(command_str, "calib") == 0)
+    {
+        return CMD_CALIBRATE;
+    }
+    if (strcmp(command_str, "stream") == 0)
+    {
+        return CMD_STREAM;
+    }
+    if (strcmp(command_str, "serve") == 0)
+    {
+        return CMD_SERVE;
+    }
     if (strcmp(command_str, "extended") == 0 || strcmp(command_str, "ext") == 0)
     {
         return CMD_EXTENDED;
@@ -104,6 +133,14 @@ GcdAlgorithmVariant parse_algorithm_variant(const char *variant_str)
     {
         return GCD_EUCLIDEAN_DIVISION;
     }
+    if (strcmp(variant_str, "lehmer") == 0)
+    {
+        return GCD_EUCLIDEAN_LEHMER;
+    }
+    if (strcmp(variant_str, "table") == 0 || strcmp(variant_str, "lookup") == 0)
+    {
+        return GCD_EUCLIDEAN_TABLE;
+    }
     if (strcmp(variant_str, "recursive_modulo") == 0 || strcmp(variant_str, "rec_mod") == 0)
     {
         return GCD_RECURSIVE_MODULO;
@@ -116,10 +153,58 @@ GcdAlgorithmVariant parse_algorithm_variant(const char *variant_str)
     {
         return GCD_EXTENDED_EUCLIDEAN;
     }
+    if (strcmp(variant_str, "extended_iterative") == 0 || strcmp(variant_str, "ext_iter") == 0)
+    {
+        return GCD_EXTENDED_ITERATIVE;
+    }
     if (strcmp(variant_str, "stein") == 0 || strcmp(variant_str, "binary") == 0)
     {
         return GCD_BINARY_STEIN;
     }
+    if (strcmp(variant_str, "stein_ctz") == 0 || strcmp(variant_str, "ctz") == 0)
+    {
+        return GCD_BINARY_STEIN_CTZ;
+    }
+    if (strcmp(variant_str, "stein_simd") == 0 || strcmp(variant_str, "simd") == 0)
+    {
+        return GCD_BINARY_STEIN_SIMD;
+    }
+    if (strcmp(variant_str, "binary_extended") == 0 || strcmp(variant_str, "bin_ext") == 0)
+    {
+        return GCD_BINARY_EXTENDED;
+    }
+    if (strcmp(variant_str, "bignum_modulo") == 0 || strcmp(variant_str, "big_mod") == 0)
+    {
+        return GCD_BIGNUM_MODULO;
+    }
+    if (strcmp(variant_str, "bignum_lehmer") == 0 || strcmp(variant_str, "big_lehmer") == 0)
+    {
+        return GCD_BIGNUM_LEHMER;
+    }
+    if (strcmp(variant_str, "bignum_extended") == 0 || strcmp(variant_str, "big_ext") == 0)
+    {
+        return GCD_BIGNUM_EXTENDED;
+    }
+    if (strcmp(variant_str, "bignum_half_gcd") == 0 || strcmp(variant_str, "big_hgcd") == 0 ||
+        strcmp(variant_str, "half_gcd") == 0)
+    {
+        return GCD_BIGNUM_HALF_GCD;
+    }
+    if (strcmp(variant_str, "bignum_stein") == 0 || strcmp(variant_str, "big_stein") == 0)
+    {
+        return GCD_BIGNUM_STEIN;
+    }
+    if (strcmp(variant_str, "auto") == 0)
+    {
+        return GCD_AUTO;
+    }
+
+    // Implementation names, including those registered at runtime
+    GcdAlgorithmVariant registered;
+    if (gcd_registry_find_variant(variant_str, &registered))
+    {
+        return registered;
+    }
 
     return GCD_EUCLIDEAN_MODULO; // Default fallback
 }
@@ -129,7 +214,7 @@ GcdAlgorithmVariant parse_algorithm_variant(const char *variant_str)
  *
  * @param str String to parse
  * @param value Pointer to store parsed value
- * @return true if parsing successful
+ * @return true if parsing successful (false for values outside int64_t)
  */
 bool parse_integer(const char *str, GcdInteger *value)
 {
@@ -139,6 +224,7 @@ bool parse_integer(const char *str, GcdInteger *value)
     }
 
     char *endptr;
+    errno = 0;
     long long parsed = strtoll(str, &endptr, 10);
 
     if (*endptr != '\0' || endptr == str)
@@ -146,10 +232,59 @@ bool parse_integer(const char *str, GcdInteger *value)
         return false; // Invalid number
     }
 
+    // strtoll clamps to LLONG_MIN/LLONG_MAX: such operands go to the bignum path instead
+    if (errno == ERANGE)
+    {
+        return false;
+    }
+
     *value = (GcdInteger)parsed;
     return true;
 }
 
+/**
+ * @brief Check whether a string is an arbitrary-precision integer literal
+ *
+ * Accepts an optional sign followed by decimal digits or a 0x-prefixed
+ * hexadecimal number, matching bignum_from_string.
+ *
+ * @param str String to check
+ * @return true if the string is a well-formed literal
+ */
+bool parse_big_integer_literal(const char *str)
+{
+    if (str == NULL)
+    {
+        return false;
+    }
+
+    if (*str == '-' || *str == '+')
+    {
+        str++;
+    }
+
+    bool is_hex = str[0] == '0' && (str[1] == 'x' || str[1] == 'X');
+    if (is_hex)
+    {
+        str += 2;
+    }
+
+    if (*str == '\0')
+    {
+        return false;
+    }
+
+    for (; *str != '\0'; str++)
+    {
+        if (is_hex ? !isxdigit((unsigned char)*str) : !isdigit((unsigned char)*str))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /**
  * @brief Parse command line arguments
  *
@@ -163,6 +298,8 @@ CliCommand parse_arguments(int argc, char *argv[], CommandArgs *args)
     // Initialize args
     memset(args, 0, sizeof(CommandArgs));
     args->iterations = 1000; // Default iterations for benchmark
+    args->seed = GCD_RANDOM_DEFAULT_SEED;
+    args->threshold_percent = REPORT_DEFAULT_THRESHOLD_PERCENT;
 
     if (argc < 2)
     {
@@ -186,6 +323,102 @@ CliCommand parse_arguments(int argc, char *argv[], CommandArgs *args)
                 args->has_iterations = true;
             }
         }
+        else if (strcmp(argv[i], "--seed") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->seed = (MathNatural)strtoull(argv[++i], NULL, 0);
+                args->has_seed = true;
+            }
+        }
+        else if (strcmp(argv[i], "--format") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->format_name = argv[++i];
+            }
+        }
+        else if (strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "--output") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->output_path = argv[++i];
+            }
+        }
+        else if (strcmp(argv[i], "--threshold") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->threshold_percent = strtod(argv[++i], NULL);
+            }
+        }
+        else if (strcmp(argv[i], "--table") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->table_path = argv[++i];
+            }
+        }
+        else if (strcmp(argv[i], "--input") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->input_path = argv[++i];
+            }
+        }
+        else if (strcmp(argv[i], "--threads") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->thread_count = (MathNatural)strtoull(argv[++i], NULL, 10);
+            }
+        }
+        else if (strcmp(argv[i], "--listen") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->listen_address = argv[++i];
+            }
+        }
+        else if (strcmp(argv[i], "--connections") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->connection_limit = (MathNatural)strtoull(argv[++i], NULL, 10);
+            }
+        }
+        else if (strcmp(argv[i], "--small-bits") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->small_operand_bits = (unsigned int)strtoul(argv[++i], NULL, 10);
+                args->has_small_operand_bits = true;
+            }
+        }
+        else if (strcmp(argv[i], "--cache") == 0)
+        {
+            if (i + 1 < argc)
+            {
+                args->cache_entries = (MathNatural)strtoull(argv[++i], NULL, 10);
+                args->has_cache_entries = true;
+            }
+        }
+        else if (strcmp(argv[i], "--binary") == 0)
+        {
+            args->binary = true;
+        }
+        else if (strcmp(argv[i], "--production") == 0)
+        {
+            args->production = true;
+        }
+        else if (command == CMD_BENCH_COMPARE)
+        {
+            // bench-compare takes report paths instead of operands
+            if (args->report_path_count < 2)
+            {
+                args->report_paths[args->report_path_count++] = argv[i];
+            }
+        }
         else if (strcmp(argv[i], "-a") == 0 || strcmp(argv[i], "--algorithm") == 0)
         {
             if (i + 1 < argc)
@@ -207,6 +440,14 @@ CliCommand parse_arguments(int argc, char *argv[], CommandArgs *args)
                     args->has_operands = true;
                     i++; // Skip next argument since we used it
                 }
+                else if (parse_big_integer_literal(argv[i]) && parse_big_integer_literal(argv[i + 1]))
+                {
+                    // Too wide for GcdInteger: keep the text for the bignum path
+                    args->operand_a_text = argv[i];
+                    args->operand_b_text = argv[i + 1];
+                    args->has_big_operands = true;
+                    i++;
+                }
             }
         }
     }
@@ -218,6 +459,124 @@ CliCommand parse_arguments(int argc, char *argv[], CommandArgs *args)
 // COMMAND EXECUTION IMPLEMENTATIONS
 // ============================================================================
 
+/**
+ * @brief Parse the big operand literals into arena-backed integers
+ *
+ * The arena is sized to also hold the results, coefficients and scratch
+ * space of one bignum command; the caller destroys it.
+ *
+ * @param args Command arguments with has_big_operands set
+ * @param arena Arena to initialize
+ * @param a First operand output
+ * @param b Second operand output
+ * @return true on success (arena initialized), false otherwise
+ */
+static bool load_big_operands(const CommandArgs *args, MemoryArena *arena, MathBigInteger *a, MathBigInteger *b)
+{
+    MathNatural limbs_a = bignum_limbs_for_string(args->operand_a_text);
+    MathNatural limbs_b = bignum_limbs_for_string(args->operand_b_text);
+
+    if (memory_arena_init(arena, 2 * BIGNUM_SCRATCH_BYTES(limbs_a + limbs_b)) != MATH_SUCCESS)
+    {
+        return false;
+    }
+
+    if (bignum_alloc(a, arena, limbs_a) != MATH_SUCCESS ||
+        bignum_alloc(b, arena, limbs_b) != MATH_SUCCESS ||
+        bignum_from_string(a, args->operand_a_text) != MATH_SUCCESS ||
+        bignum_from_string(b, args->operand_b_text) != MATH_SUCCESS)
+    {
+        memory_arena_destroy(arena);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Print a labelled big integer in decimal
+ */
+static void print_big_value(const char *label, const MathBigInteger *x, MemoryArena *arena)
+{
+    MemoryArenaMark mark = memory_arena_save(arena);
+    size_t size = bignum_string_size(x);
+    char *text = (char *)memory_arena_alloc(arena, size, 1);
+
+    if (text != NULL && bignum_to_string(x, text, size, arena) == MATH_SUCCESS)
+    {
+        printf("%s%s\n", label, text);
+    }
+    else
+    {
+        printf("%s<unprintable>\n", label);
+    }
+
+    memory_arena_restore(arena, mark);
+}
+
+/**
+ * @brief Execute an arbitrary-precision algorithm on big operands
+ *
+ * @param args Command arguments with has_big_operands set
+ * @param variant Bignum algorithm variant to run
+ * @param coefficients Also compute and print Bezout coefficients
+ */
+static void execute_big_gcd(const CommandArgs *args, GcdAlgorithmVariant variant, bool coefficients)
+{
+    MemoryArena arena;
+    MathBigInteger a, b, gcd, x, y;
+    if (!load_big_operands(args, &arena, &a, &b))
+    {
+        printf("Error: Could not parse operands\n\n");
+        return;
+    }
+
+    MathNatural limbs = MATH_MAX(a.size, b.size) + 1;
+    bignum_alloc(&gcd, &arena, limbs);
+    bignum_alloc(&x, &arena, limbs);
+    bignum_alloc(&y, &arena, limbs);
+
+    MathBigBinaryInput input = MATH_BIG_BINARY_INPUT_INIT(&a, &b, &gcd);
+    if (coefficients)
+    {
+        input.coefficient_x = &x;
+        input.coefficient_y = &y;
+    }
+
+    MathResult result = system_execute_gcd_big(variant, &input);
+
+    printf("Algorithm: %s\n", mdc_analyzer_get_algorithm_name(variant));
+    printf("Input: gcd(<%lu bits>, <%lu bits>)\n",
+           (unsigned long)bignum_bit_length(&a), (unsigned long)bignum_bit_length(&b));
+
+    if (MATH_IS_VALID_RESULT(result))
+    {
+        print_big_value("Result: ", &gcd, &arena);
+        if (coefficients)
+        {
+            print_big_value("Coefficient x: ", &x, &arena);
+            print_big_value("Coefficient y: ", &y, &arena);
+        }
+        if (args->verbose)
+        {
+            printf("Result Bits: %lld\n", (long long)result.value);
+            printf("Steps: %lu\n", (unsigned long)result.iterations);
+            printf("Execution Time: %.6f ms\n", result.execution_time_ms);
+        }
+    }
+    else if (result.status == MATH_ERROR_NOT_IMPLEMENTED)
+    {
+        printf("Error: Algorithm has no arbitrary-precision path (use a bignum_* algorithm)\n");
+    }
+    else
+    {
+        printf("Error: Computation failed (status: %d)\n", result.status);
+    }
+    printf("\n");
+
+    memory_arena_destroy(&arena);
+}
+
 /**
  * @brief Execute help command
  */
@@ -232,6 +591,11 @@ void execute_help_command(void)
     printf("  execute, exec, run        Execute specific algorithm\n");
     printf("  compare, comp             Compare all algorithms\n");
     printf("  benchmark, bench          Run performance benchmark\n");
+    printf("  bench-suite, suite        Benchmark all algorithms over generated input classes\n");
+    printf("  bench-compare <base> <new> Flag regressions between two JSON reports\n");
+    printf("  calibrate, calib          Measure and save the 'auto' decision table\n");
+    printf("  stream                    Read operand pairs, write one GCD per pair\n");
+    printf("  serve --listen <addr>     Stay resident and answer binary batch requests\n");
     printf("  extended, ext             Execute Extended Euclidean algorithm\n");
     printf("  fastest, fast             Find fastest algorithm for input\n");
     printf("  status, stat              Show system status\n");
@@ -240,24 +604,94 @@ void execute_help_command(void)
 
     printf("Options:\n");
     printf("  -a, --algorithm <name>    Specify algorithm (modulo, sub, stein, etc.)\n");
-    printf("  -i, --iterations <num>    Number of iterations for benchmark\n");
+    printf("  -i, --iterations <num>    Number of timed samples for benchmark\n");
+    printf("      --seed <num>          Seed for generated inputs (bench-suite)\n");
+    printf("      --format <fmt>        Report format: text, json or csv (compare, fastest,\n");
+    printf("                            benchmark, bench-suite)\n");
+    printf("  -o, --output <file>       Write the report to a file (format from .json/.csv)\n");
+    printf("      --threshold <pct>     Allowed slowdown in bench-compare (default %.0f%%)\n",
+           REPORT_DEFAULT_THRESHOLD_PERCENT);
+    printf("      --table <file>        Decision table of 'auto': saved by calibrate, loaded by\n");
+    printf("                            the other commands (default: the startup profile)\n");
+    printf("      --input <file>        Operand pairs of stream (default: standard input), or\n");
+    printf("                            the dataset file of run (computed in place from a mapping)\n");
+    printf("      --binary              stream: int64 pairs in, int64 GCDs out (native endian)\n");
+    printf("      --threads <num>       stream, run --input, serve: batch worker threads (default: one\n");
+    printf("                            per CPU)\n");
+    printf("      --listen <addr>       serve: unix:<path>, or [tcp:]<host>:<port> (host may be * or\n");
+    printf("                            localhost)\n");
+    printf("      --connections <num>   serve: exit after this many connections (default: never)\n");
+    printf("      --small-bits <num>    'auto' answers pairs below 2^num from a lookup table\n");
+    printf("                            (default %u, 0 = off, at most %u)\n", SYSTEM_SMALL_OPERAND_BITS,
+           SYSTEM_SMALL_OPERAND_MAX_BITS);
+    printf("      --cache <entries>     Remember results of repeated pairs, per thread (execute,\n");
+    printf("                            extended, interactive; default off, at most %u)\n", GCD_CACHE_MAX_ENTRIES);
+    printf("      --production          Call bare kernels: batches validated once, no per-call timing\n");
+    printf("                            or counters (execute, stream, run --input, serve)\n");
     printf("  -v, --verbose             Verbose output\n\n");
 
     printf("Examples:\n");
     printf("  %s compare 48 18                    Compare all algorithms\n", "gcd_analyzer");
     printf("  %s execute -a modulo 48 18          Execute specific algorithm\n", "gcd_analyzer");
-    printf("  %s benchmark -i 5000 48 18          Benchmark with 5000 iterations\n", "gcd_analyzer");
+    printf("  %s benchmark -i 5000 48 18          Benchmark with 5000 samples\n", "gcd_analyzer");
+    printf("  %s bench-suite -i 200               Comparison matrix over all input classes\n", "gcd_analyzer");
+    printf("  %s bench-suite -o base.json         Save the matrix as a JSON report\n", "gcd_analyzer");
+    printf("  %s bench-compare base.json new.json Exit 1 if any median slowed down\n", "gcd_analyzer");
+    printf("  %s calibrate -i 200                 Tune 'auto' on this machine\n", "gcd_analyzer");
+    printf("  %s fastest --table %s 48 18\n", "gcd_analyzer", GCD_DISPATCH_DEFAULT_PATH);
+    printf("                                                 Ask a saved table for the fastest\n");
+    printf("  %s stream < pairs.txt > gcds.txt    GCD of each \"a b\" line, with 'auto'\n", "gcd_analyzer");
+    printf("  %s run --input pairs.bin --output gcds.bin\n", "gcd_analyzer");
+    printf("                                                 GCD of each pair of a binary dataset\n");
+    printf("  %s serve --listen unix:/tmp/gcd.sock  Answer batch requests until killed\n", "gcd_analyzer");
     printf("  %s extended 48 18                   Extended Euclidean algorithm\n", "gcd_analyzer");
-    printf("  %s fastest 1000000 999999           Find fastest for large numbers\n\n", "gcd_analyzer");
+    printf("  %s fastest 1000000 999999           Find fastest for large numbers\n", "gcd_analyzer");
+    printf("  %s compare 0x<hex digits> <decimal>  Compare bignum algorithms\n\n", "gcd_analyzer");
 
     printf("Available Algorithms:\n");
     printf("  modulo, mod               Euclidean algorithm with modulo\n");
     printf("  subtraction, sub          Euclidean algorithm with subtraction\n");
     printf("  division, div             Euclidean algorithm with division\n");
+    printf("  lehmer                    Lehmer's GCD (leading-digit quotient steps)\n");
+    printf("  table, lookup             Euclidean GCD finished from a precomputed 8-bit table\n");
     printf("  rec_mod                   Recursive Euclidean with modulo\n");
     printf("  rec_sub                   Recursive Euclidean with subtraction\n");
     printf("  extended, ext             Extended Euclidean algorithm\n");
-    printf("  stein, binary             Stein's binary GCD algorithm\n\n");
+    printf("  ext_iter                  Extended Euclidean without recursion\n");
+    printf("  stein, binary             Stein's binary GCD algorithm\n");
+    printf("  stein_ctz, ctz            Stein's binary GCD with count-trailing-zeros\n");
+    printf("  stein_simd, simd          Stein's binary GCD vectorized (AVX-512/AVX2/NEON)\n");
+    printf("  binary_extended, bin_ext  Binary extended GCD (division-free Bezout coefficients)\n");
+    printf("  bignum_modulo, big_mod    Arbitrary-precision Euclidean with long division\n");
+    printf("  bignum_lehmer, big_lehmer Arbitrary-precision Lehmer's GCD\n");
+    printf("  bignum_extended, big_ext  Arbitrary-precision Extended Euclidean\n");
+    printf("  bignum_half_gcd, big_hgcd Subquadratic half-GCD with Bezout coefficients (alias half_gcd)\n");
+    printf("  bignum_stein, big_stein   Arbitrary-precision binary GCD\n");
+    printf("  auto                      Per-input choice from the calibrated decision table\n\n");
+
+    printf("Operands beyond 64 bits (decimal or 0x hex) switch execute, compare,\n");
+    printf("benchmark and extended to the arbitrary-precision algorithms; extended and\n");
+    printf("auto run Extended Euclid or Lehmer below the calibrated half-GCD crossover\n");
+    printf("and the half-GCD above it.\n\n");
+
+    printf("Binary datasets: a %d-byte header (\"%s\", version %d, operand width in bits,\n",
+           GCD_DATASET_HEADER_SIZE, GCD_DATASET_MAGIC, GCD_DATASET_VERSION);
+    printf("layout 0 = AoS pairs / 1 = SoA columns, uint64 count; little-endian) and raw\n");
+    printf("little-endian int64 operands. run writes the GCDs with layout 2 (values).\n\n");
+
+    printf("serve requests: a %d-byte header (\"%s\", version %d, algorithm number or %d for\n",
+           GCD_PROTOCOL_HEADER_SIZE, GCD_PROTOCOL_REQUEST_MAGIC, GCD_PROTOCOL_VERSION,
+           GCD_PROTOCOL_DEFAULT_ALGORITHM);
+    printf("-a, layout 0/1, uint64 pair count, uint64 tag, 8 zero bytes) and the operands.\n");
+    printf("Each reply (\"%s\": status, count, tag, rejected pairs) carries the GCDs; see\n",
+           GCD_PROTOCOL_REPLY_MAGIC);
+    printf("gcd_protocol.h for the exact layout.\n\n");
+
+    printf("Every command starts from the host profile named by $%s, if set; calibrate\n",
+           GCD_DISPATCH_PROFILE_ENV);
+    printf("writes it there (or to --table, or %s in the working directory, which is\n", GCD_DISPATCH_DEFAULT_PATH);
+    printf("only read back through --table or the variable). A profile measured on another\n");
+    printf("CPU model is ignored.\n\n");
 }
 
 /**
@@ -277,6 +711,13 @@ void execute_list_command(bool verbose)
  */
 void execute_execute_command(const CommandArgs *args)
 {
+    if (args->has_big_operands)
+    {
+        GcdAlgorithmVariant variant = args->has_algorithm ? args->variant : GCD_BIGNUM_LEHMER;
+        execute_big_gcd(args, variant, variant == GCD_BIGNUM_EXTENDED || variant == GCD_BIGNUM_HALF_GCD);
+        return;
+    }
+
     if (!args->has_operands)
     {
         printf("Error: Two operands required for execution\n");
@@ -321,6 +762,20 @@ void execute_execute_command(const CommandArgs *args)
  */
 void execute_compare_command(const CommandArgs *args)
 {
+    if (args->has_big_operands)
+    {
+        MemoryArena arena;
+        MathBigInteger a, b;
+        if (!load_big_operands(args, &arena, &a, &b))
+        {
+            printf("Error: Could not parse operands\n\n");
+            return;
+        }
+        system_compare_big_algorithms(&a, &b, true);
+        memory_arena_destroy(&arena);
+        return;
+    }
+
     if (!args->has_operands)
     {
         printf("Error: Two operands required for comparison\n");
@@ -338,6 +793,20 @@ void execute_compare_command(const CommandArgs *args)
  */
 void execute_benchmark_command(const CommandArgs *args)
 {
+    if (args->has_big_operands)
+    {
+        MemoryArena arena;
+        MathBigInteger a, b;
+        if (!load_big_operands(args, &arena, &a, &b))
+        {
+            printf("Error: Could not parse operands\n\n");
+            return;
+        }
+        system_benchmark_big_algorithms(&a, &b, args->iterations, true);
+        memory_arena_destroy(&arena);
+        return;
+    }
+
     if (!args->has_operands)
     {
         printf("Error: Two operands required for benchmark\n");
@@ -348,6 +817,337 @@ void execute_benchmark_command(const CommandArgs *args)
     system_benchmark_algorithms(args->operand_a, args->operand_b, args->iterations, true);
 }
 
+/**
+ * @brief Execute benchmark suite command
+ *
+ * @param args Command arguments
+ */
+void execute_bench_suite_command(const CommandArgs *args)
+{
+    // The single-pair default of 1000 samples is more than a matrix cell needs
+    MathNatural samples = args->has_iterations ? args->iterations : GCD_SUITE_DEFAULT_SAMPLES;
+    if (samples == 0)
+    {
+        printf("Error: Number of samples must be positive\n\n");
+        return;
+    }
+
+    if (system_benchmark_suite(samples, args->seed, NULL, true) != MATH_SUCCESS)
+    {
+        printf("Error: Benchmark suite failed\n\n");
+    }
+}
+
+/**
+ * @brief Execute report comparison command
+ *
+ * @param args Command arguments
+ * @return 0 if no entry regressed, 1 on regressions, 2 on errors
+ */
+int execute_bench_compare_command(const CommandArgs *args)
+{
+    if (args->report_path_count != 2)
+    {
+        printf("Error: Two JSON reports required for comparison\n");
+        printf("Usage: bench-compare [--threshold percent] <baseline.json> <current.json>\n\n");
+        return 2;
+    }
+    if (args->threshold_percent < 0.0)
+    {
+        printf("Error: Threshold must not be negative\n\n");
+        return 2;
+    }
+
+    ReportEntry *baseline = (ReportEntry *)malloc(2 * REPORT_MAX_ENTRIES * sizeof(ReportEntry));
+    if (baseline == NULL)
+    {
+        printf("Error: Out of memory\n\n");
+        return 2;
+    }
+    ReportEntry *current = baseline + REPORT_MAX_ENTRIES;
+
+    MathNatural counts[2];
+    ReportEntry *entries[2] = {baseline, current};
+    for (int i = 0; i < 2; i++)
+    {
+        if (report_load_entries(args->report_paths[i], entries[i], REPORT_MAX_ENTRIES, &counts[i]) != MATH_SUCCESS)
+        {
+            printf("Error: Could not read report '%s'\n\n", args->report_paths[i]);
+            free(baseline);
+            return 2;
+        }
+    }
+
+    printf("=== Benchmark Comparison ===\n");
+    printf("Baseline: %s (%lu results)\n", args->report_paths[0], (unsigned long)counts[0]);
+    printf("Current:  %s (%lu results)\n\n", args->report_paths[1], (unsigned long)counts[1]);
+    MathNatural regressions = report_compare_entries(baseline, counts[0], current, counts[1],
+                                                     args->threshold_percent, true);
+
+    free(baseline);
+    return regressions > 0 ? 1 : 0;
+}
+
+/**
+ * @brief Execute dispatcher calibration command
+ *
+ * @param args Command arguments
+ * @return 0 on success, 2 on errors
+ */
+int execute_calibrate_command(const CommandArgs *args)
+{
+    MathNatural samples = args->has_iterations ? args->iterations : GCD_SUITE_DEFAULT_SAMPLES;
+    if (samples == 0)
+    {
+        printf("Error: Number of samples must be positive\n\n");
+        return 2;
+    }
+
+    // By default the table replaces the configured startup profile
+    const char *path = args->table_path != NULL ? args->table_path : system_profile_path();
+    if (path == NULL)
+    {
+        path = GCD_DISPATCH_DEFAULT_PATH;
+    }
+    MathStatus status = system_calibrate_dispatcher(samples, args->seed, path, true);
+    if (status != MATH_SUCCESS)
+    {
+        printf("Error: Calibration failed (could not write '%s'?)\n\n", path);
+        return 2;
+    }
+    if (args->table_path == NULL && system_profile_path() == NULL)
+    {
+        printf("Set %s=%s (or pass --table) to use it in later runs.\n\n", GCD_DISPATCH_PROFILE_ENV, path);
+    }
+    return 0;
+}
+
+/**
+ * @brief Execute stream command
+ *
+ * Standard output carries the GCDs only: errors and the -v summary go to
+ * standard error.
+ *
+ * @param args Command arguments
+ * @return 0 on success, 2 on errors
+ */
+int execute_stream_command(const CommandArgs *args)
+{
+    GcdStreamOptions options = GCD_STREAM_OPTIONS_INIT;
+    options.format = args->binary ? GCD_STREAM_BINARY : GCD_STREAM_TEXT;
+    options.thread_count = args->thread_count;
+    if (args->has_algorithm)
+    {
+        options.variant = args->variant;
+    }
+    if (args->has_algorithm && mdc_analyzer_get_implementation(options.variant) == NULL)
+    {
+        fprintf(stderr, "Error: Algorithm '%s' cannot run on a stream\n", args->algorithm_name);
+        return 2;
+    }
+
+    const char *mode = args->binary ? "rb" : "r";
+    FILE *input = args->input_path != NULL ? fopen(args->input_path, mode) : stdin;
+    if (input == NULL)
+    {
+        fprintf(stderr, "Error: Could not open '%s' for reading\n", args->input_path);
+        return 2;
+    }
+    FILE *output = args->output_path != NULL ? fopen(args->output_path, args->binary ? "wb" : "w") : stdout;
+    if (output == NULL)
+    {
+        fprintf(stderr, "Error: Could not open '%s' for writing\n", args->output_path);
+        if (input != stdin)
+        {
+            fclose(input);
+        }
+        return 2;
+    }
+
+#ifdef _WIN32
+    // Keep CRLF translation off binary records on the standard streams
+    if (args->binary)
+    {
+        _setmode(_fileno(input), _O_BINARY);
+        _setmode(_fileno(output), _O_BINARY);
+    }
+#endif
+
+    GcdStreamStats stats;
+    MathStatus status = system_stream_gcd(input, output, &options, &stats);
+
+    if (input != stdin)
+    {
+        fclose(input);
+    }
+    if (output != stdout && fclose(output) != 0 && status == MATH_SUCCESS)
+    {
+        status = MATH_ERROR_INVALID_INPUT;
+    }
+
+    if (status == MATH_ERROR_INVALID_INPUT && args->binary)
+    {
+        fprintf(stderr, "Error: Stream stopped after %lu pairs (truncated record or I/O error)\n",
+                (unsigned long)stats.pairs);
+    }
+    else if (status == MATH_ERROR_INVALID_INPUT)
+    {
+        fprintf(stderr, "Error: Stream stopped at line %lu (malformed pair, operand beyond 64 bits or I/O error)\n",
+                (unsigned long)stats.lines);
+    }
+    else if (status != MATH_SUCCESS)
+    {
+        fprintf(stderr, "Error: Stream failed (status: %d)\n", status);
+    }
+
+    if (args->verbose)
+    {
+        double seconds = stats.execution_time_ms / 1000.0;
+        fprintf(stderr, "=== Stream Summary ===\n");
+        fprintf(stderr, "Algorithm: %s\n", mdc_analyzer_get_algorithm_name(options.variant));
+        fprintf(stderr, "Pairs: %lu (%lu rejected)\n", (unsigned long)stats.pairs, (unsigned long)stats.failed);
+        fprintf(stderr, "Bytes: %lu in, %lu out\n", (unsigned long)stats.bytes_read, (unsigned long)stats.bytes_written);
+        fprintf(stderr, "Time: %.3f ms (%.3f ms in the batch API)\n", stats.execution_time_ms, stats.compute_time_ms);
+        if (seconds > 0.0)
+        {
+            fprintf(stderr, "Throughput: %.1f MB/s, %.2f M pairs/s\n",
+                    (double)stats.bytes_read / seconds / 1e6, (double)stats.pairs / seconds / 1e6);
+        }
+    }
+    return status == MATH_SUCCESS ? 0 : 2;
+}
+
+/**
+ * @brief Execute run --input: compute GCDs straight from a mapped dataset file
+ *
+ * @param args Command arguments
+ * @return 0 on success, 2 on errors
+ */
+int execute_dataset_command(const CommandArgs *args)
+{
+    GcdAlgorithmVariant variant = args->has_algorithm ? args->variant : GCD_AUTO;
+    if (mdc_analyzer_get_implementation(variant) == NULL)
+    {
+        fprintf(stderr, "Error: Algorithm '%s' cannot run on a dataset\n", args->algorithm_name);
+        return 2;
+    }
+    if (args->output_path == NULL)
+    {
+        fprintf(stderr, "Error: run --input needs --output <file> for the GCDs\n");
+        return 2;
+    }
+
+    GcdDatasetStats stats;
+    MathStatus status = system_run_dataset(args->input_path, args->output_path, variant, args->thread_count, &stats);
+    if (status == MATH_ERROR_NOT_IMPLEMENTED)
+    {
+        fprintf(stderr, "Error: '%s' uses an unsupported dataset version or operand width\n", args->input_path);
+        return 2;
+    }
+    if (status == MATH_ERROR_INVALID_INPUT)
+    {
+        fprintf(stderr, "Error: Could not map '%s' as an operand-pair dataset or write '%s'\n",
+                args->input_path, args->output_path);
+        return 2;
+    }
+    if (status != MATH_SUCCESS)
+    {
+        fprintf(stderr, "Error: Dataset run failed (status: %d)\n", status);
+        return 2;
+    }
+
+    double seconds = stats.execution_time_ms / 1000.0;
+    printf("Algorithm: %s\n", mdc_analyzer_get_algorithm_name(variant));
+    printf("Pairs: %lu, %s layout (%lu rejected)\n", (unsigned long)stats.pairs,
+           gcd_dataset_layout_name(stats.layout), (unsigned long)stats.failed);
+    if (args->verbose)
+    {
+        printf("Bytes: %lu mapped in, %lu mapped out\n", (unsigned long)stats.bytes_read,
+               (unsigned long)stats.bytes_written);
+        printf("Time: %.3f ms (%.3f ms in the batch API)\n", stats.execution_time_ms, stats.compute_time_ms);
+        if (seconds > 0.0)
+        {
+            printf("Throughput: %.1f MB/s, %.2f M pairs/s\n", (double)stats.bytes_read / seconds / 1e6,
+                   (double)stats.pairs / seconds / 1e6);
+        }
+    }
+    printf("\n");
+    return 0;
+}
+
+/**
+ * @brief Report the address serve is listening on
+ *
+ * @param address Address being served
+ * @param user_data Algorithm variant (GcdAlgorithmVariant *)
+ */
+static void serve_report_ready(const char *address, void *user_data)
+{
+    const GcdAlgorithmVariant *variant = (const GcdAlgorithmVariant *)user_data;
+    fprintf(stderr, "Serving %s on %s\n", mdc_analyzer_get_algorithm_name(*variant), address);
+    fflush(stderr);
+}
+
+/**
+ * @brief Execute serve command: stay resident and answer batch requests
+ *
+ * Messages go to standard error, like those of stream.
+ *
+ * @param args Command arguments
+ * @return 0 once --connections connections have been served, 2 on errors
+ */
+int execute_serve_command(const CommandArgs *args)
+{
+    GcdServeOptions options = GCD_SERVE_OPTIONS_INIT;
+    options.address = args->listen_address;
+    options.thread_count = args->thread_count;
+    options.connection_limit = args->connection_limit;
+    options.on_ready = serve_report_ready;
+    options.user_data = &options.variant;
+    if (args->has_algorithm)
+    {
+        options.variant = args->variant;
+    }
+    if (options.address == NULL)
+    {
+        fprintf(stderr, "Error: serve needs --listen <address>\n");
+        return 2;
+    }
+    if (args->has_algorithm && mdc_analyzer_get_implementation(options.variant) == NULL)
+    {
+        fprintf(stderr, "Error: Algorithm '%s' cannot serve batch requests\n", args->algorithm_name);
+        return 2;
+    }
+
+    GcdServeStats stats;
+    MathStatus status = system_serve(&options, &stats);
+    if (status == MATH_ERROR_NOT_IMPLEMENTED)
+    {
+        fprintf(stderr, "Error: serve needs BSD sockets and a little-endian host\n");
+        return 2;
+    }
+    if (status == MATH_ERROR_INVALID_INPUT && stats.connections == 0)
+    {
+        fprintf(stderr, "Error: Could not listen on '%s'\n", options.address);
+        return 2;
+    }
+    if (status != MATH_SUCCESS)
+    {
+        fprintf(stderr, "Error: Server stopped (status: %d)\n", status);
+        return 2;
+    }
+
+    if (args->verbose)
+    {
+        fprintf(stderr, "=== Server Summary ===\n");
+        fprintf(stderr, "Connections: %lu\n", (unsigned long)stats.connections);
+        fprintf(stderr, "Requests: %lu (%lu answered with an error)\n", (unsigned long)stats.requests,
+                (unsigned long)stats.errors);
+        fprintf(stderr, "Pairs: %lu (%lu rejected)\n", (unsigned long)stats.pairs, (unsigned long)stats.failed);
+    }
+    return 0;
+}
+
 /**
  * @brief Execute extended Euclidean command
  *
@@ -355,6 +1155,13 @@ void execute_benchmark_command(const CommandArgs *args)
  */
 void execute_extended_command(const CommandArgs *args)
 {
+    if (args->has_big_operands)
+    {
+        // The dispatcher switches to the half-GCD at the calibrated crossover
+        execute_big_gcd(args, GCD_AUTO, true);
+        return;
+    }
+
     if (!args->has_operands)
     {
         printf("Error: Two operands required for Extended Euclidean\n");
@@ -374,6 +1181,12 @@ void execute_extended_command(const CommandArgs *args)
  */
 void execute_fastest_command(const CommandArgs *args)
 {
+    if (args->has_big_operands)
+    {
+        printf("Error: fastest supports 64-bit operands only (use benchmark for big operands)\n\n");
+        return;
+    }
+
     if (!args->has_operands)
     {
         printf("Error: Two operands required for fastest algorithm analysis\n");
@@ -515,13 +1328,99 @@ void execute_interactive_mode(void)
 // ============================================================================
 
 /**
- * @brief Execute command based on parsed arguments
+ * @brief Apply --format and --output to the coordinator
+ *
+ * Without --format, an output file ending in .json or .csv selects the
+ * matching format. Console tables cannot be redirected to a file, and
+ * reports cover 64-bit operands only.
+ *
+ * @param command Command about to run
+ * @param args Command arguments
+ * @param stream Opened output file (NULL = stdout), closed by the caller
+ * @return true if the output is set up
+ */
+static bool setup_report_output(CliCommand command, const CommandArgs *args, FILE **stream)
+{
+    *stream = NULL;
+    ReportFormat format = REPORT_FORMAT_TEXT;
+
+    if (args->format_name != NULL)
+    {
+        if (!report_parse_format(args->format_name, &format))
+        {
+            printf("Error: Unknown format '%s' (expected text, json or csv)\n\n", args->format_name);
+            return false;
+        }
+    }
+    else if (args->output_path != NULL)
+    {
+        const char *extension = strrchr(args->output_path, '.');
+        if (extension != NULL && strcmp(extension, ".json") == 0)
+        {
+            format = REPORT_FORMAT_JSON;
+        }
+        else if (extension != NULL && strcmp(extension, ".csv") == 0)
+        {
+            format = REPORT_FORMAT_CSV;
+        }
+    }
+
+    // stream, serve and run --input write their own results: -o names their destination
+    if (command == CMD_STREAM || command == CMD_SERVE || (command == CMD_EXECUTE && args->input_path != NULL))
+    {
+        if (args->format_name != NULL)
+        {
+            printf("Error: %s writes GCDs, not reports\n\n", command == CMD_STREAM  ? "stream"
+                                                              : command == CMD_SERVE ? "serve"
+                                                                                     : "run --input");
+            return false;
+        }
+        system_set_report_output(REPORT_FORMAT_TEXT, NULL);
+        return true;
+    }
+
+    if (format == REPORT_FORMAT_TEXT)
+    {
+        if (args->output_path != NULL)
+        {
+            printf("Error: --output needs a json or csv report (use --format)\n\n");
+            return false;
+        }
+        system_set_report_output(REPORT_FORMAT_TEXT, NULL);
+        return true;
+    }
+
+    bool reports = command == CMD_COMPARE || command == CMD_BENCHMARK || command == CMD_BENCH_SUITE ||
+                   command == CMD_FASTEST;
+    if (!reports || args->has_big_operands)
+    {
+        printf("Error: JSON/CSV reports are available for compare, fastest, benchmark and bench-suite\n");
+        printf("       on 64-bit operands\n\n");
+        return false;
+    }
+
+    if (args->output_path != NULL)
+    {
+        *stream = fopen(args->output_path, "w");
+        if (*stream == NULL)
+        {
+            printf("Error: Could not open '%s' for writing\n\n", args->output_path);
+            return false;
+        }
+    }
+
+    system_set_report_output(format, *stream);
+    return true;
+}
+
+/**
+ * @brief Run the command itself, once the report output is set up
  *
  * @param command Command to execute
  * @param args Command arguments
  * @return Exit code (0 for success)
  */
-int execute_command(CliCommand command, const CommandArgs *args)
+static int execute_selected_command(CliCommand command, const CommandArgs *args)
 {
     switch (command)
     {
@@ -534,6 +1433,10 @@ int execute_command(CliCommand command, const CommandArgs *args)
         return 0;
 
     case CMD_EXECUTE:
+        if (args->input_path != NULL)
+        {
+            return execute_dataset_command(args);
+        }
         execute_execute_command(args);
         return 0;
 
@@ -545,6 +1448,22 @@ int execute_command(CliCommand command, const CommandArgs *args)
         execute_benchmark_command(args);
         return 0;
 
+    case CMD_BENCH_SUITE:
+        execute_bench_suite_command(args);
+        return 0;
+
+    case CMD_BENCH_COMPARE:
+        return execute_bench_compare_command(args);
+
+    case CMD_CALIBRATE:
+        return execute_calibrate_command(args);
+
+    case CMD_STREAM:
+        return execute_stream_command(args);
+
+    case CMD_SERVE:
+        return execute_serve_command(args);
+
     case CMD_EXTENDED:
         execute_extended_command(args);
         return 0;
@@ -570,4 +1489,56 @@ int execute_command(CliCommand command, const CommandArgs *args)
         printf("Unknown command. Use 'help' for available commands.\n\n");
         return 1;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Execute command based on parsed arguments
+ *
+ * @param command Command to execute
+ * @param args Command arguments
+ * @return Exit code (0 for success)
+ */
+int execute_command(CliCommand command, const CommandArgs *args)
+{
+    // calibrate writes --table; every other command reads it
+    if (args->table_path != NULL && command != CMD_CALIBRATE &&
+        system_load_dispatch_table(args->table_path) != MATH_SUCCESS)
+    {
+        printf("Error: Could not load decision table '%s'\n\n", args->table_path);
+        return 2;
+    }
+    if (args->has_small_operand_bits && system_set_small_operand_bits(args->small_operand_bits) != MATH_SUCCESS)
+    {
+        printf("Error: --small-bits must be at most %u\n\n", SYSTEM_SMALL_OPERAND_MAX_BITS);
+        return 2;
+    }
+    if (args->has_cache_entries && system_set_result_cache(args->cache_entries) != MATH_SUCCESS)
+    {
+        printf("Error: --cache must be at most %u entries\n\n", GCD_CACHE_MAX_ENTRIES);
+        return 2;
+    }
+
+    if (args->production)
+    {
+        system_set_execution_mode(SYSTEM_MODE_PRODUCTION);
+    }
+
+    FILE *stream;
+    if (!setup_report_output(command, args, &stream))
+    {
+        return 2;
+    }
+
+    int exit_code = execute_selected_command(command, args);
+
+    if (stream != NULL)
+    {
+        system_set_report_output(REPORT_FORMAT_TEXT, NULL);
+        if (fclose(stream) != 0)
+        {
+            printf("Error: Could not write '%s'\n\n", args->output_path);
+            exit_code = 2;
+        }
+    }
+    return exit_code;
+}
@@ -13,6 +13,7 @@
 
 #include "../../core/domain/mathematical_types.h"
 #include "../../challenges/greatest_common_divisor/domain_types.h"
+#include "../../challenges/greatest_common_divisor/challenge_services/benchmark_report.h"
 #include <stdbool.h>
 
 // ============================================================================
@@ -24,17 +25,22 @@
  */
 typedef enum
 {
-    CMD_HELP,        /**< Show help information */
-    CMD_LIST,        /**< List available algorithms */
-    CMD_EXECUTE,     /**< Execute specific algorithm */
-    CMD_COMPARE,     /**< Compare all algorithms */
-    CMD_BENCHMARK,   /**< Run benchmark */
-    CMD_EXTENDED,    /**< Execute Extended Euclidean */
-    CMD_FASTEST,     /**< Find fastest algorithm */
-    CMD_STATUS,      /**< Show system status */
-    CMD_TEST,        /**< Run self-test */
-    CMD_INTERACTIVE, /**< Interactive mode */
-    CMD_UNKNOWN      /**< Unknown command */
+    CMD_HELP,          /**< Show help information */
+    CMD_LIST,          /**< List available algorithms */
+    CMD_EXECUTE,       /**< Execute specific algorithm */
+    CMD_COMPARE,       /**< Compare all algorithms */
+    CMD_BENCHMARK,     /**< Run benchmark */
+    CMD_BENCH_SUITE,   /**< Benchmark every algorithm over every input class */
+    CMD_BENCH_COMPARE, /**< Compare two JSON benchmark reports for regressions */
+    CMD_CALIBRATE,     /**< Calibrate and save the GCD_AUTO decision table */
+    CMD_STREAM,        /**< Compute GCDs of an operand-pair stream */
+    CMD_SERVE,         /**< Answer framed batch requests on a socket */
+    CMD_EXTENDED,      /**< Execute Extended Euclidean */
+    CMD_FASTEST,       /**< Find fastest algorithm */
+    CMD_STATUS,        /**< Show system status */
+    CMD_TEST,          /**< Run self-test */
+    CMD_INTERACTIVE,   /**< Interactive mode */
+    CMD_UNKNOWN        /**< Unknown command */
 } CliCommand;
 
 /**
@@ -47,9 +53,30 @@ typedef struct
     char algorithm_name[64];
     GcdAlgorithmVariant variant;
     MathNatural iterations;
+    MathNatural seed;            /**< Operand generator seed for generated inputs */
+    const char *operand_a_text;  /**< First operand literal when it exceeds 64 bits */
+    const char *operand_b_text;  /**< Second operand literal when it exceeds 64 bits */
+    const char *format_name;     /**< Requested report format (--format) */
+    const char *output_path;     /**< Report destination (-o/--output) */
+    const char *report_paths[2]; /**< Baseline and current reports of bench-compare */
+    MathNatural report_path_count; /**< Report paths given */
+    double threshold_percent;    /**< Regression threshold of bench-compare */
+    const char *table_path;      /**< GCD_AUTO decision table (--table) */
+    const char *input_path;      /**< Input of stream (NULL = stdin) or dataset of run (--input) */
+    MathNatural thread_count;    /**< Batch workers of stream, run and serve (--threads, 0 = one per CPU) */
+    const char *listen_address;  /**< Address of serve (--listen) */
+    MathNatural connection_limit; /**< serve: exit after this many connections (--connections, 0 = never) */
+    bool binary;                 /**< Binary int64 records instead of text lines (--binary) */
+    unsigned int small_operand_bits; /**< Fast path width of 'auto' (--small-bits) */
+    bool has_small_operand_bits;
+    MathNatural cache_entries;   /**< Result cache entries per thread (--cache, 0 = off) */
+    bool has_cache_entries;
+    bool production;             /**< Bare kernels instead of the instrumented path (--production) */
     bool has_operands;
+    bool has_big_operands; /**< Operands only fit the arbitrary-precision path */
     bool has_algorithm;
     bool has_iterations;
+    bool has_seed;
     bool verbose;
 } CommandArgs;
 
@@ -93,6 +120,14 @@ GcdAlgorithmVariant parse_algorithm_variant(const char *variant_str);
  */
 bool parse_integer(const char *str, GcdInteger *value);
 
+/**
+ * @brief Check whether a string is an arbitrary-precision integer literal
+ *
+ * @param str String to check (decimal or 0x-prefixed hexadecimal)
+ * @return true if the string is a well-formed literal
+ */
+bool parse_big_integer_literal(const char *str);
+
 // ============================================================================
 // COMMAND EXECUTION FUNCTIONS
 // ============================================================================
@@ -153,7 +153,8 @@ int main(int argc, char *argv[])
     int exit_code = execute_command(command, &args);
 
     // Print system status on verbose mode or for status command
-    if (args.verbose && command != CMD_STATUS && command != CMD_HELP)
+    // (stream keeps standard output for its results and summarizes on stderr)
+    if (args.verbose && command != CMD_STATUS && command != CMD_HELP && command != CMD_STREAM)
     {
         printf("=== Session Summary ===\n");
         MathNatural total_executions;
@@ -167,6 +168,7 @@ int main(int argc, char *argv[])
                 printf("Average time per execution: %.6f ms\n", total_time / total_executions);
             }
         }
+        system_print_performance_counters();
         printf("\n");
     }
 
@@ -316,4 +318,6 @@ int main(int argc, char *argv[])
  * - mdc_mod        -> "rec_mod"
  * - mdc_sub        -> "rec_sub"
  * - mdc_ext        -> "extended" or "ext"
+ * - mdc_ext_iterative -> "extended_iterative" or "ext_iter"
+ * - mdc_ext_binary    -> "binary_extended" or "bin_ext"
  */
\ No newline at end of file